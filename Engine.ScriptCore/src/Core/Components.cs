@@ -279,6 +279,22 @@ namespace SW
 		}
 	}
 
+	/// <summary>
+	/// 	Represents a box collider of the entity's 2D rigid body.
+	/// 	Added at runtime it is attached to the body before the next physics step.
+	/// </summary>
+	public class BoxCollider2DComponent : Component
+	{
+	}
+
+	/// <summary>
+	/// 	Represents a circle collider of the entity's 2D rigid body.
+	/// 	Added at runtime it is attached to the body before the next physics step.
+	/// </summary>
+	public class CircleCollider2DComponent : Component
+	{
+	}
+
 	/// <summary>
 	///		Represents an audio source component that can play and stop audio.
 	/// </summary>
@@ -50,6 +50,15 @@ namespace SW
 		internal static delegate* unmanaged<ulong, Vector3*, Vector3*, ulong> Scene_InstantiatePrefabWithPositionRotation;
 		internal static delegate* unmanaged<ulong, Vector3*, Vector3*, Vector3*, ulong> Scene_InstantiatePrefabWithPositionRotationScale;
 
+		internal static delegate* unmanaged<RayCastQuery2D*, RayCastHit2D*, bool> Scene_RayCast2D;
+		internal static delegate* unmanaged<RayCastQuery2D*, uint, RayCastHit2D*, void> Scene_RayCast2DBatch;
+		internal static delegate* unmanaged<AABBQuery2D*, ulong*, uint, uint> Scene_OverlapAABB2D;
+		internal static delegate* unmanaged<AABBQuery2D*, uint, ulong*, uint, uint*, void> Scene_OverlapAABB2DBatch;
+		internal static delegate* unmanaged<CircleQuery2D*, ulong*, uint, uint> Scene_OverlapCircle2D;
+		internal static delegate* unmanaged<CircleQuery2D*, uint, ulong*, uint, uint*, void> Scene_OverlapCircle2DBatch;
+		internal static delegate* unmanaged<ShapeCastQuery2D*, RayCastHit2D*, bool> Scene_ShapeCast2D;
+		internal static delegate* unmanaged<ShapeCastQuery2D*, uint, RayCastHit2D*, void> Scene_ShapeCast2DBatch;
+
 
 		internal static delegate* unmanaged<ulong, NativeString> TagComponent_GetTag;
 		internal static delegate* unmanaged<ulong, NativeString, void> TagComponent_SetTag;
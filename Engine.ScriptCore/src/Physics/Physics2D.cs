@@ -0,0 +1,183 @@
+﻿using System;
+
+namespace SW
+{
+	/// <summary>
+	///		Queries against the physics world of the active scene.
+	/// </summary>
+	/// <remarks>
+	///		Sensors are never reported. The batch variants run all queries in a single call into the engine,
+	///		prefer them when issuing many queries per frame.
+	/// </remarks>
+	public static class Physics2D
+	{
+		/// <summary>
+		///		Layer mask matching every collision layer.
+		/// </summary>
+		public const uint AllLayers = 0xFFFF;
+
+		/// <summary>
+		///		Casts a ray and reports the closest hit.
+		/// </summary>
+		/// <param name="origin">The start point of the ray.</param>
+		/// <param name="direction">The direction of the ray.</param>
+		/// <param name="maxDistance">The length of the ray.</param>
+		/// <param name="hit">The closest hit.</param>
+		/// <param name="layerMask">Only colliders on these layers are reported.</param>
+		/// <returns>True if anything was hit, false otherwise.</returns>
+		public static bool RayCast(Vector2 origin, Vector2 direction, float maxDistance, out RayCastHit2D hit, uint layerMask = AllLayers)
+		{
+			return RayCast(new RayCastQuery2D(origin, direction, maxDistance, layerMask), out hit);
+		}
+
+		/// <summary>
+		///		Casts a ray and reports the closest hit.
+		/// </summary>
+		/// <param name="query">The ray to cast.</param>
+		/// <param name="hit">The closest hit.</param>
+		/// <returns>True if anything was hit, false otherwise.</returns>
+		public static bool RayCast(RayCastQuery2D query, out RayCastHit2D hit)
+		{
+			unsafe {
+				RayCastHit2D result;
+				bool isHit = InternalCalls.Scene_RayCast2D(&query, &result);
+				hit = result;
+				return isHit;
+			}
+		}
+
+		/// <summary>
+		///		Casts all the rays, writing one hit per query.
+		/// </summary>
+		/// <param name="queries">The rays to cast.</param>
+		/// <param name="hits">Receives the hits, must be at least as long as queries.</param>
+		public static void RayCastBatch(ReadOnlySpan<RayCastQuery2D> queries, Span<RayCastHit2D> hits)
+		{
+			if (hits.Length < queries.Length)
+				throw new ArgumentException("The hits buffer is smaller than the number of queries.", nameof(hits));
+
+			unsafe {
+				fixed (RayCastQuery2D* queriesPtr = queries)
+				fixed (RayCastHit2D* hitsPtr = hits) {
+					InternalCalls.Scene_RayCast2DBatch(queriesPtr, (uint)queries.Length, hitsPtr);
+				}
+			}
+		}
+
+		/// <summary>
+		///		Collects the IDs of entities overlapping the box.
+		/// </summary>
+		/// <param name="query">The box to test.</param>
+		/// <param name="entityIDs">Receives the IDs of the overlapping entities.</param>
+		/// <returns>The number of IDs written.</returns>
+		public static int OverlapAABB(AABBQuery2D query, Span<ulong> entityIDs)
+		{
+			unsafe {
+				fixed (ulong* idsPtr = entityIDs) {
+					return (int)InternalCalls.Scene_OverlapAABB2D(&query, idsPtr, (uint)entityIDs.Length);
+				}
+			}
+		}
+
+		/// <summary>
+		///		Runs all the box overlaps. Results of query i start at entityIDs[i * capacityPerQuery].
+		/// </summary>
+		/// <param name="queries">The boxes to test.</param>
+		/// <param name="entityIDs">Receives the IDs, must hold at least queries.Length * capacityPerQuery entries.</param>
+		/// <param name="capacityPerQuery">The number of IDs reserved per query.</param>
+		/// <param name="counts">Receives the number of IDs written per query, must be at least as long as queries.</param>
+		public static void OverlapAABBBatch(ReadOnlySpan<AABBQuery2D> queries, Span<ulong> entityIDs, int capacityPerQuery, Span<uint> counts)
+		{
+			ValidateOverlapBuffers(queries.Length, entityIDs.Length, capacityPerQuery, counts.Length);
+
+			unsafe {
+				fixed (AABBQuery2D* queriesPtr = queries)
+				fixed (ulong* idsPtr = entityIDs)
+				fixed (uint* countsPtr = counts) {
+					InternalCalls.Scene_OverlapAABB2DBatch(queriesPtr, (uint)queries.Length, idsPtr, (uint)capacityPerQuery, countsPtr);
+				}
+			}
+		}
+
+		/// <summary>
+		///		Collects the IDs of entities overlapping the circle.
+		/// </summary>
+		/// <param name="query">The circle to test.</param>
+		/// <param name="entityIDs">Receives the IDs of the overlapping entities.</param>
+		/// <returns>The number of IDs written.</returns>
+		public static int OverlapCircle(CircleQuery2D query, Span<ulong> entityIDs)
+		{
+			unsafe {
+				fixed (ulong* idsPtr = entityIDs) {
+					return (int)InternalCalls.Scene_OverlapCircle2D(&query, idsPtr, (uint)entityIDs.Length);
+				}
+			}
+		}
+
+		/// <summary>
+		///		Runs all the circle overlaps. Results of query i start at entityIDs[i * capacityPerQuery].
+		/// </summary>
+		/// <param name="queries">The circles to test.</param>
+		/// <param name="entityIDs">Receives the IDs, must hold at least queries.Length * capacityPerQuery entries.</param>
+		/// <param name="capacityPerQuery">The number of IDs reserved per query.</param>
+		/// <param name="counts">Receives the number of IDs written per query, must be at least as long as queries.</param>
+		public static void OverlapCircleBatch(ReadOnlySpan<CircleQuery2D> queries, Span<ulong> entityIDs, int capacityPerQuery, Span<uint> counts)
+		{
+			ValidateOverlapBuffers(queries.Length, entityIDs.Length, capacityPerQuery, counts.Length);
+
+			unsafe {
+				fixed (CircleQuery2D* queriesPtr = queries)
+				fixed (ulong* idsPtr = entityIDs)
+				fixed (uint* countsPtr = counts) {
+					InternalCalls.Scene_OverlapCircle2DBatch(queriesPtr, (uint)queries.Length, idsPtr, (uint)capacityPerQuery, countsPtr);
+				}
+			}
+		}
+
+		/// <summary>
+		///		Sweeps a circle or box and reports the first hit.
+		/// </summary>
+		/// <param name="query">The shape and sweep to cast.</param>
+		/// <param name="hit">The first hit.</param>
+		/// <returns>True if anything was hit, false otherwise.</returns>
+		public static bool ShapeCast(ShapeCastQuery2D query, out RayCastHit2D hit)
+		{
+			unsafe {
+				RayCastHit2D result;
+				bool isHit = InternalCalls.Scene_ShapeCast2D(&query, &result);
+				hit = result;
+				return isHit;
+			}
+		}
+
+		/// <summary>
+		///		Sweeps all the shapes, writing one hit per query.
+		/// </summary>
+		/// <param name="queries">The shapes to cast.</param>
+		/// <param name="hits">Receives the hits, must be at least as long as queries.</param>
+		public static void ShapeCastBatch(ReadOnlySpan<ShapeCastQuery2D> queries, Span<RayCastHit2D> hits)
+		{
+			if (hits.Length < queries.Length)
+				throw new ArgumentException("The hits buffer is smaller than the number of queries.", nameof(hits));
+
+			unsafe {
+				fixed (ShapeCastQuery2D* queriesPtr = queries)
+				fixed (RayCastHit2D* hitsPtr = hits) {
+					InternalCalls.Scene_ShapeCast2DBatch(queriesPtr, (uint)queries.Length, hitsPtr);
+				}
+			}
+		}
+
+		private static void ValidateOverlapBuffers(int queryCount, int idsLength, int capacityPerQuery, int countsLength)
+		{
+			if (capacityPerQuery <= 0)
+				throw new ArgumentOutOfRangeException(nameof(capacityPerQuery));
+
+			if ((long)queryCount * capacityPerQuery > idsLength)
+				throw new ArgumentException("The entity IDs buffer is smaller than queries * capacityPerQuery.");
+
+			if (countsLength < queryCount)
+				throw new ArgumentException("The counts buffer is smaller than the number of queries.");
+		}
+	}
+}
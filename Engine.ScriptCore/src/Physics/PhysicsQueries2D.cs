@@ -0,0 +1,212 @@
+﻿using System.Runtime.InteropServices;
+
+namespace SW
+{
+	// Layouts mirror Engine/src/Core/Physics/PhysicsQueries2D.hpp - keep them in sync!
+
+	/// <summary>
+	///		Ray cast from origin along direction, reporting the closest hit.
+	/// </summary>
+	[StructLayout(LayoutKind.Sequential)]
+	public struct RayCastQuery2D
+	{
+		/// <summary>
+		///		The start point of the ray.
+		/// </summary>
+		public Vector2 Origin;
+
+		/// <summary>
+		///		The direction of the ray (does not have to be normalized).
+		/// </summary>
+		public Vector2 Direction;
+
+		/// <summary>
+		///		The length of the ray.
+		/// </summary>
+		public float MaxDistance;
+
+		/// <summary>
+		///		Only colliders on these layers are reported.
+		/// </summary>
+		public uint LayerMask;
+
+		public RayCastQuery2D(Vector2 origin, Vector2 direction, float maxDistance, uint layerMask = Physics2D.AllLayers)
+		{
+			Origin = origin;
+			Direction = direction;
+			MaxDistance = maxDistance;
+			LayerMask = layerMask;
+		}
+	}
+
+	/// <summary>
+	///		Result of a ray or shape cast.
+	/// </summary>
+	[StructLayout(LayoutKind.Sequential)]
+	public struct RayCastHit2D
+	{
+		/// <summary>
+		///		The ID of the hit entity, 0 if nothing was hit.
+		/// </summary>
+		public ulong EntityID;
+
+		/// <summary>
+		///		The world point of the hit.
+		/// </summary>
+		public Vector2 Point;
+
+		/// <summary>
+		///		The surface normal at the hit point.
+		/// </summary>
+		public Vector2 Normal;
+
+		/// <summary>
+		///		The fraction [0 - 1] along the cast at which the hit occurred.
+		/// </summary>
+		public float Fraction;
+
+		/// <summary>
+		///		The distance along the cast at which the hit occurred.
+		/// </summary>
+		public float Distance;
+
+		/// <summary>
+		///		Whether anything was hit.
+		/// </summary>
+		public readonly bool Hit => EntityID != 0;
+
+		/// <summary>
+		///		The hit entity, null if nothing was hit.
+		/// </summary>
+		public readonly Entity? Entity => EntityID != 0 ? new Entity(EntityID) : null;
+	}
+
+	/// <summary>
+	///		Axis aligned box overlap query.
+	/// </summary>
+	[StructLayout(LayoutKind.Sequential)]
+	public struct AABBQuery2D
+	{
+		/// <summary>
+		///		The lower bound of the box.
+		/// </summary>
+		public Vector2 Min;
+
+		/// <summary>
+		///		The upper bound of the box.
+		/// </summary>
+		public Vector2 Max;
+
+		/// <summary>
+		///		Only colliders on these layers are reported.
+		/// </summary>
+		public uint LayerMask;
+
+		public AABBQuery2D(Vector2 min, Vector2 max, uint layerMask = Physics2D.AllLayers)
+		{
+			Min = min;
+			Max = max;
+			LayerMask = layerMask;
+		}
+	}
+
+	/// <summary>
+	///		Circle overlap query.
+	/// </summary>
+	[StructLayout(LayoutKind.Sequential)]
+	public struct CircleQuery2D
+	{
+		/// <summary>
+		///		The center of the circle.
+		/// </summary>
+		public Vector2 Center;
+
+		/// <summary>
+		///		The radius of the circle.
+		/// </summary>
+		public float Radius;
+
+		/// <summary>
+		///		Only colliders on these layers are reported.
+		/// </summary>
+		public uint LayerMask;
+
+		public CircleQuery2D(Vector2 center, float radius, uint layerMask = Physics2D.AllLayers)
+		{
+			Center = center;
+			Radius = radius;
+			LayerMask = layerMask;
+		}
+	}
+
+	/// <summary>
+	///		Shape swept by the shape cast.
+	/// </summary>
+	public enum ShapeCastShape2D : uint
+	{
+		Circle = 0,
+		Box = 1
+	}
+
+	/// <summary>
+	///		Sweeps the shape from origin by translation, reporting the first hit.
+	/// </summary>
+	[StructLayout(LayoutKind.Sequential)]
+	public struct ShapeCastQuery2D
+	{
+		/// <summary>
+		///		The start position of the shape.
+		/// </summary>
+		public Vector2 Origin;
+
+		/// <summary>
+		///		The sweep translation.
+		/// </summary>
+		public Vector2 Translation;
+
+		/// <summary>
+		///		The half extents of the box shape.
+		/// </summary>
+		public Vector2 HalfExtents;
+
+		/// <summary>
+		///		The radius of the circle shape.
+		/// </summary>
+		public float Radius;
+
+		/// <summary>
+		///		The rotation of the box shape (in radians).
+		/// </summary>
+		public float Angle;
+
+		/// <summary>
+		///		Only colliders on these layers are reported.
+		/// </summary>
+		public uint LayerMask;
+
+		/// <summary>
+		///		The shape to sweep.
+		/// </summary>
+		public ShapeCastShape2D Shape;
+
+		/// <summary>
+		///		Creates a circle cast.
+		/// </summary>
+		public static ShapeCastQuery2D Circle(Vector2 origin, Vector2 translation, float radius, uint layerMask = Physics2D.AllLayers)
+		{
+			return new ShapeCastQuery2D {
+				Origin = origin, Translation = translation, Radius = radius, LayerMask = layerMask, Shape = ShapeCastShape2D.Circle
+			};
+		}
+
+		/// <summary>
+		///		Creates a box cast.
+		/// </summary>
+		public static ShapeCastQuery2D Box(Vector2 origin, Vector2 translation, Vector2 halfExtents, float angle = 0.0f, uint layerMask = Physics2D.AllLayers)
+		{
+			return new ShapeCastQuery2D {
+				Origin = origin, Translation = translation, HalfExtents = halfExtents, Angle = angle, LayerMask = layerMask, Shape = ShapeCastShape2D.Box
+			};
+		}
+	}
+}
@@ -83,10 +83,19 @@ namespace SW
 		/// </remarks>
 		public event Action<Entity>? OnSensor2DEnd;
 
+		/// <summary>
+		///		Event triggered when one of this entity's 2D joints exceeds its breaking force or torque and breaks.
+		///	</summary>
+		///	<remarks>
+		///		The event handler receives the entity the broken joint was connected to.
+		/// </remarks>
+		public event Action<Entity>? OnJoint2DBreak;
+
 		private void OnCollision2DBeginInternal(ulong id) => OnCollision2DBegin?.Invoke(new Entity(id));
 		private void OnCollision2DEndInternal(ulong id) => OnCollision2DEnd?.Invoke(new Entity(id));
 		private void OnSensor2DBeginInternal(ulong id) => OnSensor2DBegin?.Invoke(new Entity(id));
 		private void OnSensor2DEndInternal(ulong id) => OnSensor2DEnd?.Invoke(new Entity(id));
+		private void OnJoint2DBreakInternal(ulong id) => OnJoint2DBreak?.Invoke(new Entity(id));
 
 		/// <summary>
 		///		Checks if this entity is a script entity of type T
@@ -0,0 +1,115 @@
+#include "Animation2D.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "AssetRegistry.hpp"
+#include "Core/Hash.hpp"
+#include "GUI/Editor/EditorResources.hpp"
+
+namespace SW
+{
+
+	bool Animation2D::Bake()
+	{
+		PROFILE_FUNCTION();
+
+		m_Clip = AnimationClip();
+
+		AnimationClip clip;
+		clip.TexCoords.reserve(Sprites.size());
+		clip.FrameEnds.reserve(Sprites.size());
+
+		for (u64 i = 0; i < Sprites.size(); i++)
+		{
+			const Sprite* sprite = Sprites[i] ? *Sprites[i] : nullptr;
+
+			if (sprite && sprite->GetHandle() == 0)
+				return false; // a placeholder, still loading
+
+			Texture2D** texture = sprite ? sprite->GetTextureRaw() : nullptr;
+
+			if (!texture || texture == &EditorResources::MissingAssetIcon || (clip.Texture && texture != clip.Texture))
+			{
+				SYSTEM_WARN("Animation {} can not be baked, its sprites must share one texture.", GetHandle());
+
+				m_CanBake = false;
+				return false;
+			}
+
+			if (!*texture || (*texture)->GetHandle() == 0)
+				return false; // the texture is still loading
+
+			clip.Texture       = texture;
+			clip.TextureHandle = (*texture)->GetHandle();
+
+			// The quad samples TexCordUpLeft at the first corner and TexCordRightDown at the third one.
+			glm::vec4 texCoords(sprite->TexCordUpLeft, sprite->TexCordRightDown);
+
+			if (ReverseAlongX)
+				std::swap(texCoords.x, texCoords.z);
+
+			if (ReverseAlongY)
+				std::swap(texCoords.y, texCoords.w);
+
+			const f32 duration = std::max(GetFrameDuration(i), 0.f);
+
+			clip.Length += duration;
+			clip.IsUniform &= duration == 1.f;
+
+			clip.TexCoords.emplace_back(texCoords);
+			clip.FrameEnds.emplace_back(clip.Length);
+		}
+
+		m_Clip    = std::move(clip);
+		m_CanBake = true;
+
+		return IsBaked();
+	}
+
+	u64 Animation2D::HashSources(const AssetRegistry& registry, const std::vector<AssetHandle>& sprites)
+	{
+		std::vector<u64> hashes;
+		hashes.reserve(sprites.size());
+
+		for (AssetHandle handle : sprites)
+		{
+			if (!registry.Contains(handle))
+			{
+				hashes.emplace_back(0);
+				continue;
+			}
+
+			const AssetMetaData& metadata = registry.GetAssetMetaData(handle);
+
+			// Sub-sprites are defined by the file of their spritesheet
+			if (metadata.ParentHandle && registry.Contains(metadata.ParentHandle))
+				hashes.emplace_back(registry.GetAssetMetaData(metadata.ParentHandle).ContentHash);
+			else
+				hashes.emplace_back(metadata.ContentHash);
+		}
+
+		return Hash::GenerateXXHash(hashes.data(), hashes.size() * sizeof(u64));
+	}
+
+	u32 Animation2D::GetFrameIndex(f32 time) const
+	{
+		const u32 count = (u32)m_Clip.FrameEnds.size();
+
+		if (count < 2 || m_Clip.Length <= 0.f)
+			return 0;
+
+		f32 position = std::fmod(time * Speed, m_Clip.Length);
+
+		if (position < 0.f)
+			position += m_Clip.Length; // played backwards
+
+		const f32* ends = m_Clip.FrameEnds.data();
+
+		const u32 index =
+		    m_Clip.IsUniform ? (u32)position : (u32)(std::upper_bound(ends, ends + count, position) - ends);
+
+		return std::min(index, count - 1);
+	}
+
+} // namespace SW
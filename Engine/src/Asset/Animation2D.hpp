@@ -1,7 +1,7 @@
 /**
  * @file Animation.hpp
  * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
- * @version 0.1.1
+ * @version 0.1.3
  * @date 2024-04-09
  *
  * @copyright Copyright (c) 2024 Tycjan Fortuna
@@ -14,6 +14,24 @@
 namespace SW
 {
 
+	/**
+	 * @brief Animation baked for playback. All frames sample one texture, so drawing a frame reads a single texture
+	 * 		  slot and one element of each contiguous array instead of following every sprite to its texture.
+	 */
+	struct AnimationClip final
+	{
+		Texture2D** Texture       = nullptr; /**< Texture shared by all frames, a slot of the asset manager */
+		AssetHandle TextureHandle = 0;       /**< Handle of the texture */
+
+		std::vector<glm::vec4> TexCoords; /**< Per frame: UV of the first (xy) and third (zw) corner, flipped */
+		std::vector<f32> FrameEnds;       /**< Per frame: end of the frame since the start of the clip, in frames */
+
+		f32 Length     = 0.f;  /**< Sum of the frame durations, in frames */
+		bool IsUniform = true; /**< Every frame lasts exactly one frame, no search is needed */
+	};
+
+	class AssetRegistry;
+
 	class Animation2D final : public Asset
 	{
 	public:
@@ -26,11 +44,79 @@ namespace SW
 		bool ReverseAlongX = false;
 		bool ReverseAlongY = false;
 
-		f32 Speed = 1.0f;
+		f32 Speed = 1.0f; /**< Frames per second, negative speed plays the animation backwards */
 
 		std::vector<Sprite**> Sprites;
 
+		std::vector<f32> FrameDurations; /**< Duration of every sprite in frames, missing entries last one frame */
+
+		/**
+		 * @brief Gets the duration of the frame, in frames.
+		 *
+		 * @param frame The index of the frame.
+		 * @return f32 The duration, 1 if it was never set
+		 */
+		f32 GetFrameDuration(u64 frame) const { return frame < FrameDurations.size() ? FrameDurations[frame] : 1.f; }
+
+		/**
+		 * @brief Bakes the sprites into the clip, called by the editor whenever the animation changes.
+		 * @note Fails while any sprite is still loading, or for good if the sprites use different textures.
+		 *
+		 * @return bool Whether the clip was baked
+		 */
+		bool Bake();
+
+		/**
+		 * @brief Checks whether the clip is baked.
+		 *
+		 * @return bool
+		 */
+		bool IsBaked() const { return !m_Clip.TexCoords.empty(); }
+
+		/**
+		 * @brief Checks whether baking may still succeed - false once the sprites turned out to use different
+		 * 		  textures, such animations are drawn sprite by sprite.
+		 *
+		 * @return bool
+		 */
+		bool CanBake() const { return m_CanBake; }
+
+		/**
+		 * @brief Gets the baked clip.
+		 *
+		 * @return const AnimationClip&
+		 */
+		const AnimationClip& GetClip() const { return m_Clip; }
+
+		/**
+		 * @brief Sets the clip baked ahead of time (e.g. stored in the animation file).
+		 *
+		 * @param clip The baked clip.
+		 */
+		void SetClip(AnimationClip&& clip) { m_Clip = std::move(clip); }
+
+		/**
+		 * @brief Hashes the sources of the sprites - the file of every sprite, or the spritesheet of a sub-sprite.
+		 * 		  A clip stored with the animation is outdated once the hash of its sprites changes.
+		 *
+		 * @param registry The registry with the content hashes of the sprites.
+		 * @param sprites The handles of the sprites.
+		 * @return u64 The hash
+		 */
+		static u64 HashSources(const AssetRegistry& registry, const std::vector<AssetHandle>& sprites);
+
+		/**
+		 * @brief Gets the frame of the baked clip played at the time.
+		 *
+		 * @param time The time since the start of the animation, in seconds.
+		 * @return u32 The index of the frame
+		 */
+		u32 GetFrameIndex(f32 time) const;
+
 	private:
+		AnimationClip m_Clip;
+
+		bool m_CanBake = true;
 	};
 
 } // namespace SW
@@ -30,6 +30,7 @@ namespace SW
 	    {".ttf", AssetType::FontSource},
 	    {".sw_font", AssetType::Font},
 	    {".sw_scene", AssetType::Scene},
+	    {".sw_scenebin", AssetType::Scene},
 	    {".sw_prefab", AssetType::Prefab},
 	    {".cs", AssetType::Script},
 	    {".sw_sprite", AssetType::Sprite},
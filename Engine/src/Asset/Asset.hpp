@@ -1,7 +1,7 @@
 /**
  * @file Asset.hpp
  * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
- * @version 0.1.1
+ * @version 0.1.2
  * @date 2024-04-07
  *
  * @copyright Copyright (c) 2024 Tycjan Fortuna
@@ -51,7 +51,7 @@ namespace SW
 
 	/**
 	 * @brief Enum class representing the state of an asset.
-	 * @warning NOT USED YET!
+	 * @note Reported per handle by AssetManager::GetAssetState().
 	 */
 	enum class AssetState : u8
 	{
@@ -183,6 +183,13 @@ namespace SW
 		 */
 		void SetHandle(AssetHandle handle) { m_Handle = handle; }
 
+		/**
+		 * @brief Get the memory held by the asset (CPU and GPU), used for the per type memory budgets.
+		 *
+		 * @return u64 The size in bytes, 0 if negligible.
+		 */
+		virtual u64 GetMemorySize() const { return 0; }
+
 		/**
 		 * @brief Get the asset state.
 		 *
@@ -209,7 +216,19 @@ namespace SW
 		AssetHandle m_Handle = 0u;               ///< The handle of the asset.
 		AssetState m_State   = AssetState::None; ///< The state of the asset.
 
-		friend class EditorAssetManager; // Handle is set by the AssetManager!
+		friend class EditorAssetManager;  // Handle is set by the AssetManager!
+		friend class RuntimeAssetManager; // Handle is set by the AssetManager!
+	};
+
+	/**
+	 * @brief Asset referenced under a user given name, e.g. an animation of an animated sprite.
+	 * @note Maps of named assets are keyed by the StringId of the name, the name is kept for the editor and files.
+	 */
+	template <typename T>
+	struct NamedAsset
+	{
+		std::string Name;    /**< The name of the asset. */
+		T** Value = nullptr; /**< The asset. */
 	};
 
 } // namespace SW
@@ -0,0 +1,100 @@
+#include "AssetDependencyGraph.hpp"
+
+#include <algorithm>
+
+namespace SW
+{
+
+	bool AssetDependencyGraph::AddDependency(AssetHandle dependent, AssetHandle dependency)
+	{
+		if (dependent == dependency)
+			return false;
+
+		std::vector<AssetHandle>& dependencies = m_Dependencies[dependent];
+
+		if (std::find(dependencies.begin(), dependencies.end(), dependency) != dependencies.end())
+			return false;
+
+		dependencies.emplace_back(dependency);
+		m_Dependents[dependency].emplace_back(dependent);
+
+		return true;
+	}
+
+	void AssetDependencyGraph::ClearDependencies(AssetHandle dependent)
+	{
+		auto it = m_Dependencies.find(dependent);
+
+		if (it == m_Dependencies.end())
+			return;
+
+		for (AssetHandle dependency : it->second)
+		{
+			auto dependents = m_Dependents.find(dependency);
+
+			if (dependents == m_Dependents.end())
+				continue;
+
+			std::erase(dependents->second, dependent);
+
+			if (dependents->second.empty())
+				m_Dependents.erase(dependents);
+		}
+
+		m_Dependencies.erase(it);
+	}
+
+	const std::vector<AssetHandle>& AssetDependencyGraph::GetDependencies(AssetHandle dependent) const
+	{
+		static const std::vector<AssetHandle> s_NoEdges;
+
+		auto it = m_Dependencies.find(dependent);
+
+		return it != m_Dependencies.end() ? it->second : s_NoEdges;
+	}
+
+	const std::vector<AssetHandle>& AssetDependencyGraph::GetDependents(AssetHandle dependency) const
+	{
+		static const std::vector<AssetHandle> s_NoEdges;
+
+		auto it = m_Dependents.find(dependency);
+
+		return it != m_Dependents.end() ? it->second : s_NoEdges;
+	}
+
+	std::vector<AssetHandle> AssetDependencyGraph::CollectDependents(AssetHandle dependency) const
+	{
+		// Depth first search over the reverse edges, an asset is finished once all its dependents are finished.
+		// Reversed, the finish order puts every asset before its dependents.
+		std::vector<AssetHandle> finished;
+		std::unordered_set<AssetHandle> visited = {dependency};
+		std::vector<std::pair<AssetHandle, u64>> stack = {{dependency, 0}}; // asset, index of its next dependent
+
+		while (!stack.empty())
+		{
+			auto& [handle, next] = stack.back();
+
+			const std::vector<AssetHandle>& dependents = GetDependents(handle);
+
+			if (next < dependents.size())
+			{
+				const AssetHandle dependent = dependents[next++];
+
+				if (visited.insert(dependent).second) // visited ones are done or on the stack (a cycle)
+					stack.emplace_back(dependent, 0);
+
+				continue;
+			}
+
+			finished.emplace_back(handle);
+			stack.pop_back();
+		}
+
+		finished.pop_back(); // the changed asset itself, always finished last
+
+		std::reverse(finished.begin(), finished.end());
+
+		return finished;
+	}
+
+} // namespace SW
@@ -0,0 +1,71 @@
+/**
+ * @file AssetDependencyGraph.hpp
+ * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
+ * @version 0.1.0
+ * @date 2024-06-03
+ *
+ * @copyright Copyright (c) 2024 Tycjan Fortuna
+ */
+#pragma once
+
+#include "Asset.hpp"
+
+namespace SW
+{
+
+	/**
+	 * @brief Dependencies between the loaded assets (e.g. sprite -> texture, animation -> sprites, font -> font
+	 * 		  source) together with the reverse edges, so the dependents of a changed asset are found without a scan.
+	 * @note Edges are recorded while the dependent asset loads and cleared when it is unloaded or reloaded.
+	 */
+	class AssetDependencyGraph final
+	{
+	public:
+		/**
+		 * @brief Adds the edge between the assets.
+		 *
+		 * @param dependent The asset using the dependency.
+		 * @param dependency The used asset.
+		 * @return Whether the edge was added, false if it already exists or both assets are the same.
+		 */
+		bool AddDependency(AssetHandle dependent, AssetHandle dependency);
+
+		/**
+		 * @brief Removes all edges from the asset to its dependencies, edges of its dependents stay.
+		 *
+		 * @param dependent The asset.
+		 */
+		void ClearDependencies(AssetHandle dependent);
+
+		/**
+		 * @brief Get the assets the asset depends on.
+		 *
+		 * @param dependent The asset.
+		 * @return const std::vector<AssetHandle>& The dependencies, in the order they were added.
+		 */
+		const std::vector<AssetHandle>& GetDependencies(AssetHandle dependent) const;
+
+		/**
+		 * @brief Get the assets directly depending on the asset.
+		 *
+		 * @param dependency The asset.
+		 * @return const std::vector<AssetHandle>& The dependents.
+		 */
+		const std::vector<AssetHandle>& GetDependents(AssetHandle dependency) const;
+
+		/**
+		 * @brief Collects all assets depending on the asset, directly or through other assets.
+		 * 		  Every asset comes after all the collected assets it depends on, so reloading them in this order
+		 * 		  never finishes a dependent before its dependencies. Edges closing a cycle are ignored.
+		 *
+		 * @param dependency The changed asset, not part of the result.
+		 * @return std::vector<AssetHandle> The dependents in topological order.
+		 */
+		std::vector<AssetHandle> CollectDependents(AssetHandle dependency) const;
+
+	private:
+		std::unordered_map<AssetHandle, std::vector<AssetHandle>> m_Dependencies; /**< Forward edges. */
+		std::unordered_map<AssetHandle, std::vector<AssetHandle>> m_Dependents;   /**< Reverse edges. */
+	};
+
+} // namespace SW
@@ -1,5 +1,7 @@
 #include "AssetDirectoryTree.hpp"
 
+#include <algorithm>
+
 #include "Asset/AssetManager.hpp"
 #include "Core/Project/ProjectContext.hpp"
 #include "Core/Utils/FileSystem.hpp"
@@ -28,6 +30,9 @@ namespace SW
 	AssetSourceItem* AssetDirectoryTree::FindChildItemByPath(AssetSourceItem* parent,
 	                                                         const std::filesystem::path& dir) const
 	{
+		if (parent == m_Root)
+			return FindItem(dir);
+
 		if (parent->Path == dir)
 			return parent;
 
@@ -51,18 +56,11 @@ namespace SW
 
 	void AssetDirectoryTree::TraverseDirectoryAndMapAssets()
 	{
-		const AssetRegistry& reg                                    = AssetManager::GetRegistry();
-		const std::map<AssetHandle, AssetMetaData>& availableAssets = reg.GetAvailableAssets();
-
-		std::unordered_map<std::filesystem::path, AssetHandle> pathToIdMap;
-		for (auto&& [handle, metadata] : availableAssets)
-		{
-			pathToIdMap[metadata.Path] = handle;
-		}
-
 		if (m_Root)
 			CleanUp(m_Root);
 
+		m_ItemsByPath.clear();
+
 		m_Root = new AssetSourceItem();
 		// m_Root->Handle = pathToIdMap.find(dir)->second; // no need for handle for not-draggable item
 		m_Root->Type      = AssetType::Directory;
@@ -71,43 +69,198 @@ namespace SW
 		m_Root->Color     = IM_COL32(204, 204, 178, 255);
 		m_Root->Path      = ".";
 
-		TraverseAndEmplace(pathToIdMap, m_Root->Path, m_Root);
+		TraverseAndEmplace(AssetManager::GetRegistry(), m_Root->Path, m_Root);
 	}
 
-	void AssetDirectoryTree::TraverseAndEmplace(
-	    const std::unordered_map<std::filesystem::path, AssetHandle>& pathToIdMap, const std::filesystem::path& dir,
-	    AssetSourceItem* item)
+	void AssetDirectoryTree::TraverseAndEmplace(const AssetRegistry& registry, const std::filesystem::path& dir,
+	                                            AssetSourceItem* item)
 	{
 		const std::filesystem::path fullPath = ProjectContext::Get()->GetAssetDirectory() / dir;
 
 		for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(fullPath))
 		{
-			AssetSourceItem* newItem = new AssetSourceItem();
-
 			const std::filesystem::path itemPath =
 			    std::filesystem::relative(entry.path(), ProjectContext::Get()->GetAssetDirectory());
 
-			AssetType type = std::filesystem::is_directory(entry)
-			                     ? AssetType::Directory
-			                     : Asset::GetAssetTypeFromExtension(itemPath.extension().string());
+			AssetSourceItem* newItem = Emplace(registry, itemPath, item);
+
+			if (newItem && newItem->Type == AssetType::Directory)
+				TraverseAndEmplace(registry, itemPath, newItem);
+		}
+	}
+
+	AssetSourceItem* AssetDirectoryTree::Emplace(const AssetRegistry& registry, const std::filesystem::path& path,
+	                                             AssetSourceItem* parent)
+	{
+		const std::filesystem::path fullPath = ProjectContext::Get()->GetAssetDirectory() / path;
+
+		const AssetType type = std::filesystem::is_directory(fullPath)
+		                           ? AssetType::Directory
+		                           : Asset::GetAssetTypeFromExtension(path.extension().string());
+
+		if (type == AssetType::AssetRegistry ||
+		    (type == AssetType::Directory && (path.filename() == "build" || path.filename() == "cache")))
+			return nullptr;
+
+		const AssetHandle handle = registry.FindHandle(path);
+
+		if (!handle) // not registered (e.g. the temporary file of a registry save)
+			return nullptr;
+
+		AssetSourceItem* newItem = new AssetSourceItem();
+
+		newItem->Handle           = handle;
+		newItem->Type             = type;
+		newItem->Thumbnail        = Asset::GetThumbnailFromAssetType(newItem->Type);
+		newItem->Icon             = Asset::GetIconFromAssetType(newItem->Type);
+		newItem->Color            = Asset::GetColorFromAssetType(newItem->Type);
+		newItem->Parent           = parent;
+		newItem->Path             = path;
+		newItem->ModificationTime = FileSystem::GetLastWriteTime(fullPath);
+
+		parent->Children.emplace_back(newItem);
+
+		m_ItemsByPath[path] = newItem;
+
+		return newItem;
+	}
+
+	void AssetDirectoryTree::ApplyChanges(const std::vector<FileChange>& changes)
+	{
+		if (!m_Root)
+			return;
+
+		PROFILE_FUNCTION();
+
+		for (const FileChange& change : changes)
+		{
+			switch (change.Type)
+			{
+			case FileChangeType::Added:
+			case FileChangeType::Modified:
+				AddItem(change.Path);
+				break;
+			case FileChangeType::Removed:
+				RemoveItem(change.Path);
+				break;
+			case FileChangeType::Renamed:
+				MoveItem(change.OldPath, change.Path);
+				break;
+			case FileChangeType::Overflow:
+				break; // the caller rebuilds the whole tree
+			}
+		}
+	}
+
+	AssetSourceItem* AssetDirectoryTree::FindItem(const std::filesystem::path& path) const
+	{
+		if (path.empty() || path == m_Root->Path)
+			return m_Root;
+
+		auto it = m_ItemsByPath.find(path);
+
+		return it != m_ItemsByPath.end() ? it->second : nullptr;
+	}
+
+	void AssetDirectoryTree::AddItem(const std::filesystem::path& path)
+	{
+		const std::filesystem::path fullPath = ProjectContext::Get()->GetAssetDirectory() / path;
+
+		std::error_code error;
+
+		if (!std::filesystem::exists(fullPath, error))
+			return; // removed again before the change was polled
+
+		if (AssetSourceItem* item = FindItem(path))
+		{
+			item->ModificationTime = FileSystem::GetLastWriteTime(fullPath);
+			item->Thumbnail        = Asset::GetThumbnailFromAssetType(item->Type); // asked for again by the panel
+
+			return;
+		}
+
+		AssetSourceItem* parent = FindItem(path.parent_path());
+
+		if (!parent) // inside a directory not shown in the tree
+			return;
+
+		AssetSourceItem* newItem = Emplace(AssetManager::GetRegistry(), path, parent);
+
+		// Entries created before the directory was watched are only found by scanning it.
+		if (newItem && newItem->Type == AssetType::Directory)
+			TraverseAndEmplace(AssetManager::GetRegistry(), path, newItem);
+	}
+
+	void AssetDirectoryTree::RemoveItem(const std::filesystem::path& path)
+	{
+		AssetSourceItem* item = FindItem(path);
+
+		if (!item || item == m_Root)
+			return;
+
+		std::erase(item->Parent->Children, item);
+
+		Unindex(item);
+		CleanUp(item);
+	}
+
+	void AssetDirectoryTree::MoveItem(const std::filesystem::path& oldPath, const std::filesystem::path& newPath)
+	{
+		AssetSourceItem* item = FindItem(oldPath);
+
+		if (!item || item == m_Root)
+		{
+			AddItem(newPath);
+			return;
+		}
+
+		RemoveItem(newPath); // replaced by the move
+
+		AssetSourceItem* newParent = FindItem(newPath.parent_path());
 
-			if (type == AssetType::AssetRegistry ||
-			    (type == AssetType::Directory && (itemPath.filename() == "build" || itemPath.filename() == "cache")))
-				continue;
+		if (!newParent)
+		{
+			RemoveItem(oldPath);
+			return;
+		}
 
-			newItem->Handle           = pathToIdMap.at(itemPath);
-			newItem->Type             = type;
-			newItem->Thumbnail        = Asset::GetThumbnailFromAssetType(newItem->Type);
-			newItem->Icon             = Asset::GetIconFromAssetType(newItem->Type);
-			newItem->Color            = Asset::GetColorFromAssetType(newItem->Type);
-			newItem->Parent           = item;
-			newItem->Path             = itemPath;
-			newItem->ModificationTime = FileSystem::GetLastWriteTime(entry);
+		std::erase(item->Parent->Children, item);
+
+		newParent->Children.emplace_back(item);
+		item->Parent = newParent;
+
+		Unindex(item);
+
+		std::vector<AssetSourceItem*> moved = {item};
+
+		while (!moved.empty())
+		{
+			AssetSourceItem* current = moved.back();
+			moved.pop_back();
 
-			item->Children.emplace_back(newItem);
+			current->Path = FileSystem::Rebase(current->Path, oldPath, newPath);
 
-			if (newItem->Type == AssetType::Directory)
-				TraverseAndEmplace(pathToIdMap, entry.path(), newItem);
+			m_ItemsByPath[current->Path] = current;
+
+			moved.insert(moved.end(), current->Children.begin(), current->Children.end());
+		}
+
+		if (item->IsFile()) // the extension might have changed
+		{
+			item->Type      = Asset::GetAssetTypeFromExtension(item->Path.extension().string());
+			item->Thumbnail = Asset::GetThumbnailFromAssetType(item->Type);
+			item->Icon      = Asset::GetIconFromAssetType(item->Type);
+			item->Color     = Asset::GetColorFromAssetType(item->Type);
+		}
+	}
+
+	void AssetDirectoryTree::Unindex(const AssetSourceItem* item)
+	{
+		m_ItemsByPath.erase(item->Path);
+
+		for (const AssetSourceItem* child : item->Children)
+		{
+			Unindex(child);
 		}
 	}
 
@@ -1,7 +1,7 @@
 /**
  * @file AssetDirectoryTree.hpp
  * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
- * @version 0.1.1
+ * @version 0.1.2
  * @date 2024-04-07
  *
  * @copyright Copyright (c) 2024 Tycjan Fortuna
@@ -9,10 +9,13 @@
 #pragma once
 
 #include "AssetSourceItem.hpp"
+#include "Core/Utils/FileWatcher.hpp"
 
 namespace SW
 {
 
+	class AssetRegistry;
+
 	class AssetDirectoryTree
 	{
 	public:
@@ -55,9 +58,21 @@ namespace SW
 		 */
 		void RefetchChanges();
 
+		/**
+		 * @brief Applies the changes of the asset directory to the tree without rebuilding it.
+		 * 		  Items of renamed and moved entries are kept, so pointers to them stay valid.
+		 * @warning Items of removed entries are deleted!
+		 * @note The asset registry must have applied the changes first, new items take their handles from it.
+		 *
+		 * @param changes The changes reported by a FileWatcher of the asset directory.
+		 */
+		void ApplyChanges(const std::vector<FileChange>& changes);
+
 	private:
 		AssetSourceItem* m_Root = nullptr;
 
+		std::unordered_map<std::filesystem::path, AssetSourceItem*> m_ItemsByPath; // every item except the root
+
 	private:
 		/**
 		 * @brief Recursively clean up the item and its children.
@@ -70,12 +85,62 @@ namespace SW
 		 * @brief Traverse the directory and emplace the assets.
 		 * 		  Scans the directory and emplaces the assets to the tree.
 		 *
-		 * @param pathToIdMap The map of path to asset handle.
+		 * @param registry The registry providing the handles of the assets.
 		 * @param dir The directory to traverse.
 		 * @param item The item to emplace the assets.
 		 */
-		void TraverseAndEmplace(const std::unordered_map<std::filesystem::path, AssetHandle>& pathToIdMap,
-		                        const std::filesystem::path& dir, AssetSourceItem* item);
+		void TraverseAndEmplace(const AssetRegistry& registry, const std::filesystem::path& dir,
+		                        AssetSourceItem* item);
+
+		/**
+		 * @brief Creates the item of the entry and adds it to the parent.
+		 * @warning Might return nullptr if the entry is not shown in the tree.
+		 *
+		 * @param registry The registry providing the handle of the asset.
+		 * @param path The path of the entry relative to the asset directory.
+		 * @param parent The parent item.
+		 * @return AssetSourceItem* The new item.
+		 */
+		AssetSourceItem* Emplace(const AssetRegistry& registry, const std::filesystem::path& path,
+		                         AssetSourceItem* parent);
+
+		/**
+		 * @brief Finds the item by path using the index.
+		 * @warning Might return nullptr.
+		 *
+		 * @param path The path relative to the asset directory, empty or "." for the root.
+		 * @return AssetSourceItem* The item if found, nullptr otherwise.
+		 */
+		AssetSourceItem* FindItem(const std::filesystem::path& path) const;
+
+		/**
+		 * @brief Adds the item of a new entry or updates the modification time of an existing one.
+		 *
+		 * @param path The path relative to the asset directory.
+		 */
+		void AddItem(const std::filesystem::path& path);
+
+		/**
+		 * @brief Removes the item with all its children.
+		 *
+		 * @param path The path relative to the asset directory.
+		 */
+		void RemoveItem(const std::filesystem::path& path);
+
+		/**
+		 * @brief Moves the item with all its children to the new path.
+		 *
+		 * @param oldPath The previous path relative to the asset directory.
+		 * @param newPath The new path relative to the asset directory.
+		 */
+		void MoveItem(const std::filesystem::path& oldPath, const std::filesystem::path& newPath);
+
+		/**
+		 * @brief Recursively removes the item and its children from the index.
+		 *
+		 * @param item The item to remove.
+		 */
+		void Unindex(const AssetSourceItem* item);
 	};
 
 } // namespace SW
@@ -41,4 +41,28 @@ namespace SW
 		return s_Serializers.at(metadata.Type)->TryLoadAsset(metadata);
 	}
 
+	Scope<AssetLoadData> AssetLoader::DecodeAsset(const AssetMetaData& metadata)
+	{
+		ASSERT(s_Serializers.find(metadata.Type) != s_Serializers.end(),
+		       "Asset serializer not available for this file: {} !", metadata.Path.string());
+
+		return s_Serializers.at(metadata.Type)->DecodeAsset(metadata);
+	}
+
+	Asset* AssetLoader::FinalizeAsset(const AssetMetaData& metadata, AssetLoadData* data)
+	{
+		ASSERT(s_Serializers.find(metadata.Type) != s_Serializers.end(),
+		       "Asset serializer not available for this file: {} !", metadata.Path.string());
+
+		return s_Serializers.at(metadata.Type)->FinalizeAsset(metadata, data);
+	}
+
+	Asset* AssetLoader::TryLoadAssetFromMemory(const AssetMetaData& metadata, const u8* data, u64 size)
+	{
+		ASSERT(s_Serializers.find(metadata.Type) != s_Serializers.end(),
+		       "Asset serializer not available for this file: {} !", metadata.Path.string());
+
+		return s_Serializers.at(metadata.Type)->TryLoadAssetFromMemory(metadata, data, size);
+	}
+
 } // namespace SW
@@ -15,6 +15,14 @@ namespace SW
 
 	class AssetSerializer;
 
+	/**
+	 * @brief Intermediate result of the worker part of an asynchronous load (decoded pixels, parsed YAML...).
+	 */
+	struct AssetLoadData
+	{
+		virtual ~AssetLoadData() = default;
+	};
+
 	class AssetLoader
 	{
 	public:
@@ -45,6 +53,35 @@ namespace SW
 		 */
 		[[nodiscard]] static Asset* TryLoadAsset(const AssetMetaData& metadata);
 
+		/**
+		 * @brief Try to load the asset from its cooked blob.
+		 *
+		 * @param metadata The metadata of the asset.
+		 * @param data The cooked blob of the asset.
+		 * @param size The size of the blob in bytes.
+		 * @return Asset* The loaded asset.
+		 */
+		[[nodiscard]] static Asset* TryLoadAssetFromMemory(const AssetMetaData& metadata, const u8* data, u64 size);
+
+		/**
+		 * @brief First part of the asynchronous load - file IO, decoding and parsing.
+		 * @note Safe to call from worker threads, does not touch the GPU nor the asset manager.
+		 *
+		 * @param metadata The metadata of the asset.
+		 * @return The decoded data, nullptr if the asset type has no worker part.
+		 */
+		[[nodiscard]] static Scope<AssetLoadData> DecodeAsset(const AssetMetaData& metadata);
+
+		/**
+		 * @brief Second part of the asynchronous load - GPU uploads and resolving of the dependencies.
+		 * @warning Must be called on the main thread.
+		 *
+		 * @param metadata The metadata of the asset.
+		 * @param data The result of DecodeAsset().
+		 * @return Asset* The loaded asset, nullptr if the load failed.
+		 */
+		[[nodiscard]] static Asset* FinalizeAsset(const AssetMetaData& metadata, AssetLoadData* data);
+
 	private:
 		static std::unordered_map<AssetType, Scope<AssetSerializer>> s_Serializers;
 	};
@@ -15,4 +15,14 @@ namespace SW
 		AssetLoader::Shutdown();
 	}
 
+	const std::vector<AssetHandle>& AssetManager::GetAssetDependencies(AssetHandle handle)
+	{
+		static const std::vector<AssetHandle> s_NoDependencies;
+
+		const EditorAssetManager* manager =
+		    ProjectContext::HasContext() ? ProjectContext::Get()->GetEditorAssetManager() : nullptr;
+
+		return manager ? manager->GetDependencies(handle) : s_NoDependencies;
+	}
+
 } // namespace SW
@@ -1,7 +1,7 @@
 /**
  * @file AssetManager.hpp
  * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
- * @version 0.1.2
+ * @version 0.1.5
  * @date 2024-04-14
  *
  * @copyright Copyright (c) 2024 Tycjan Fortuna
@@ -110,6 +110,148 @@ namespace SW
 			return (const T**)ProjectContext::Get()->GetAssetManager()->GetAsset(handle);
 		}
 
+		/**
+		 * @brief Get the asset, if it is not loaded yet the load is started in the background.
+		 * 		  Until the load finishes the slot holds a placeholder (textures and sprites) or nullptr.
+		 * @warning If the asset is not available, the nullptr will be returned.
+		 *
+		 * @param handle The handle of the asset.
+		 * @return Asset** The asset slot.
+		 */
+		static Asset** GetAssetRawAsync(AssetHandle handle)
+		{
+			return ProjectContext::Get()->GetAssetManager()->GetAssetRawAsync(handle);
+		}
+
+		/**
+		 * @brief Get the asset, if it is not loaded yet the load is started in the background.
+		 * 		  Until the load finishes the slot holds a placeholder (textures and sprites) or nullptr.
+		 * @warning If the asset is not available, the nullptr will be returned.
+		 *
+		 * @param handle The handle of the asset.
+		 * @return T** The asset slot.
+		 */
+		template <typename T>
+		static T** GetAssetRawAsync(AssetHandle handle)
+		{
+			return (T**)ProjectContext::Get()->GetAssetManager()->GetAssetRawAsync(handle);
+		}
+
+		/**
+		 * @brief Get the asset through the slot cached by the caller (see AssetSlot). While the slot is current it
+		 * 		  resolves with a single indexed load, otherwise the asset is looked up (and loaded) by handle and
+		 * 		  the slot is refreshed.
+		 * @warning Resolving a current slot does not mark the asset as used, the holder must keep a reference to
+		 * 			the asset (see AssetReferenceTracker) for it not to be evicted.
+		 *
+		 * @param handle The handle of the asset.
+		 * @param slot The slot cached by the caller, updated in place.
+		 * @return T* The asset, nullptr if it is not available.
+		 */
+		template <typename T>
+		static T* Resolve(AssetHandle handle, AssetSlot& slot)
+		{
+			AssetManagerBase* manager = ProjectContext::Get()->GetAssetManager();
+
+			if (Asset* asset = manager->ResolveSlot(handle, slot))
+				return (T*)asset;
+
+			Asset** element = manager->GetAssetRaw(handle);
+
+			return (T*)RefreshSlot(manager, handle, element, slot);
+		}
+
+		/**
+		 * @brief Same as Resolve(), but a missing asset is loaded in the background. Until the load finishes the
+		 * 		  placeholder (textures and sprites) or nullptr is returned.
+		 *
+		 * @param handle The handle of the asset.
+		 * @param slot The slot cached by the caller, updated in place.
+		 * @return T* The asset, nullptr if it is not available or still loading without a placeholder.
+		 */
+		template <typename T>
+		static T* ResolveAsync(AssetHandle handle, AssetSlot& slot)
+		{
+			AssetManagerBase* manager = ProjectContext::Get()->GetAssetManager();
+
+			if (Asset* asset = manager->ResolveSlot(handle, slot))
+				return (T*)asset;
+
+			Asset** element = manager->GetAssetRawAsync(handle);
+
+			return (T*)RefreshSlot(manager, handle, element, slot);
+		}
+
+		/**
+		 * @brief Get the load state of the asset.
+		 *
+		 * @param handle The handle of the asset.
+		 * @returns The state of the asset.
+		 */
+		static AssetState GetAssetState(AssetHandle handle)
+		{
+			return ProjectContext::Get()->GetAssetManager()->GetAssetState(handle);
+		}
+
+		/**
+		 * @brief Check if the asset is loaded (not a placeholder).
+		 *
+		 * @param handle The handle of the asset.
+		 * @returns If the asset is loaded.
+		 */
+		static bool IsLoaded(AssetHandle handle) { return GetAssetState(handle) == AssetState::Loaded; }
+
+		/**
+		 * @brief Finishes the asynchronously loaded assets, called once per frame by the application.
+		 *
+		 * @param budget The time budget in milliseconds.
+		 */
+		static void ProcessAsyncLoads(f32 budget)
+		{
+			if (ProjectContext::HasContext())
+				ProjectContext::Get()->GetAssetManager()->ProcessAsyncLoads(budget);
+		}
+
+		/**
+		 * @brief Adds a reference to the asset, referenced assets are never evicted.
+		 *
+		 * @param handle The handle of the asset.
+		 */
+		static void AddReference(AssetHandle handle)
+		{
+			if (ProjectContext::HasContext())
+				ProjectContext::Get()->GetAssetManager()->AddReference(handle);
+		}
+
+		/**
+		 * @brief Removes a reference added by AddReference().
+		 *
+		 * @param handle The handle of the asset.
+		 */
+		static void RemoveReference(AssetHandle handle)
+		{
+			if (ProjectContext::HasContext())
+				ProjectContext::Get()->GetAssetManager()->RemoveReference(handle);
+		}
+
+		/**
+		 * @brief Get the assets the asset referenced while it was loading (e.g. the sprites of an animation).
+		 * @note Only known for the loaded assets and only in the editor.
+		 *
+		 * @param handle The handle of the asset.
+		 * @return The dependencies, empty if they are not known.
+		 */
+		static const std::vector<AssetHandle>& GetAssetDependencies(AssetHandle handle);
+
+		/**
+		 * @brief Evicts unreferenced assets of the types exceeding their memory budget, called once per frame.
+		 */
+		static void EnforceMemoryBudgets()
+		{
+			if (ProjectContext::HasContext())
+				ProjectContext::Get()->GetAssetManager()->EnforceMemoryBudgets();
+		}
+
 		/**
 		 * @brief Check if the asset is valid.
 		 *
@@ -136,6 +278,29 @@ namespace SW
 			return ProjectContext::Get()->GetAssetManager()->ForceReload(handle);
 		}
 
+		/**
+		 * @brief Reloads the changed asset together with all loaded assets depending on it, dependencies first.
+		 * 		  In the editor the reload happens in the background (see ProcessAsyncLoads()).
+		 *
+		 * @param handle The handle of the changed asset.
+		 * @returns Whether any asset is (being) reloaded.
+		 */
+		static bool ReloadWithDependents(AssetHandle handle)
+		{
+			return ProjectContext::Get()->GetAssetManager()->ReloadWithDependents(handle);
+		}
+
+		/**
+		 * @brief Records that the asset being loaded depends on the asset without loading it (e.g. a font source).
+		 *
+		 * @param dependency The handle of the dependency.
+		 */
+		static void RecordDependency(AssetHandle dependency)
+		{
+			if (ProjectContext::HasContext())
+				ProjectContext::Get()->GetAssetManager()->RecordDependency(dependency);
+		}
+
 		/**
 		 * @brief Get the asset registry.
 		 * @returns The asset registry.
@@ -157,6 +322,35 @@ namespace SW
 		{
 			return ProjectContext::Get()->GetEditorAssetManager()->GetLoadedAssets();
 		}
+
+		/**
+		 * @brief Get the resident memory statistics per asset type.
+		 *
+		 * @return const std::map<AssetType, AssetMemoryStatistics>& The statistics.
+		 */
+		static const std::map<AssetType, AssetMemoryStatistics>& GetMemoryStatistics()
+		{
+			return ProjectContext::Get()->GetEditorAssetManager()->GetMemoryStatistics();
+		}
+
+	private:
+		/**
+		 * @brief Caches the slot of the looked up asset, slots holding no asset are not cached.
+		 *
+		 * @param manager The asset manager.
+		 * @param handle The handle of the asset.
+		 * @param element The looked up asset slot, nullptr if the asset is not available.
+		 * @param slot The slot cached by the caller.
+		 * @return Asset* The asset, nullptr if there is none.
+		 */
+		static Asset* RefreshSlot(AssetManagerBase* manager, AssetHandle handle, Asset** element, AssetSlot& slot)
+		{
+			Asset* asset = element ? *element : nullptr;
+
+			slot = asset ? manager->SyncSlot(handle, asset) : AssetSlot{};
+
+			return asset;
+		}
 	};
 
 } // namespace SW
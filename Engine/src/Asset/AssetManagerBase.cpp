@@ -7,6 +7,11 @@ namespace SW
 	{
 	}
 
+	AssetManagerBase::AssetManagerBase(std::map<AssetHandle, AssetMetaData>&& assets)
+	    : m_AvailRegistry(std::move(assets))
+	{
+	}
+
 	AssetManagerBase::~AssetManagerBase()
 	{
 	}
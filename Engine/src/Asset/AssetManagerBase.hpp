@@ -1,7 +1,7 @@
 /**
  * @file AssetManagerBase.hpp
  * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
- * @version 0.1.1
+ * @version 0.1.3
  * @date 2024-04-07
  *
  * @copyright Copyright (c) 2024 Tycjan Fortuna
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "AssetRegistry.hpp"
+#include "AssetSlotMap.hpp"
 #include "Core/OpenGL/Texture2D.hpp"
 
 namespace SW
@@ -18,6 +19,14 @@ namespace SW
 	{
 	public:
 		AssetManagerBase();
+
+		/**
+		 * @brief Creates the manager with a registry of already known assets (no asset directory scan).
+		 *
+		 * @param assets The available assets.
+		 */
+		explicit AssetManagerBase(std::map<AssetHandle, AssetMetaData>&& assets);
+
 		virtual ~AssetManagerBase();
 
 		/**
@@ -50,6 +59,72 @@ namespace SW
 		 */
 		virtual bool ForceReload(AssetHandle handle) = 0;
 
+		/**
+		 * @brief Reloads the changed asset together with all loaded assets depending on it, dependencies first.
+		 * @note By default only the asset itself is reloaded, synchronously.
+		 *
+		 * @param handle The handle of the changed asset.
+		 * @return Whether any asset is (being) reloaded.
+		 */
+		virtual bool ReloadWithDependents(AssetHandle handle) { return ForceReload(handle); }
+
+		/**
+		 * @brief Records that the asset being loaded depends on the asset, for dependencies which are not accessed
+		 * 		  through the manager (e.g. the font source a font is generated from).
+		 * @note Dependencies accessed through the manager are recorded automatically.
+		 *
+		 * @param dependency The handle of the dependency.
+		 */
+		virtual void RecordDependency(AssetHandle /*dependency*/) {}
+
+		/**
+		 * @brief Get the asset, if it is not loaded yet the load is started in the background.
+		 * 		  Until the load finishes the returned slot holds a placeholder (textures and sprites) or nullptr,
+		 * 		  the slot is updated in place once the asset is ready.
+		 * @note By default the asset is loaded synchronously.
+		 *
+		 * @param handle The handle of the asset.
+		 * @return Asset** The asset slot, nullptr if the asset is not available.
+		 */
+		virtual Asset** GetAssetRawAsync(AssetHandle handle) { return GetAssetRaw(handle); }
+
+		/**
+		 * @brief Get the load state of the asset.
+		 *
+		 * @param handle The handle of the asset.
+		 * @return AssetState The state of the asset.
+		 */
+		virtual AssetState GetAssetState(AssetHandle handle) const = 0;
+
+		/**
+		 * @brief Finishes the asynchronously loaded assets (GPU uploads, dependencies) on the main thread.
+		 * @note At least one asset is finished per call, even if it exceeds the budget.
+		 *
+		 * @param budget The time budget in milliseconds.
+		 */
+		virtual void ProcessAsyncLoads(f32 /*budget*/) {}
+
+		/**
+		 * @brief Adds a reference to the asset (e.g. a component holding its handle).
+		 * 		  Referenced assets are never evicted.
+		 *
+		 * @param handle The handle of the asset.
+		 */
+		virtual void AddReference(AssetHandle /*handle*/) {}
+
+		/**
+		 * @brief Removes a reference added by AddReference().
+		 *
+		 * @param handle The handle of the asset.
+		 */
+		virtual void RemoveReference(AssetHandle /*handle*/) {}
+
+		/**
+		 * @brief Evicts the least recently used unreferenced assets of the types exceeding their memory budget.
+		 * @note Evicted assets are reloaded on the next access.
+		 */
+		virtual void EnforceMemoryBudgets() {}
+
 		const AssetRegistry& GetRegistry() { return m_AvailRegistry; }
 
 		AssetRegistry& GetRegistryRaw() { return m_AvailRegistry; }
@@ -71,8 +146,32 @@ namespace SW
 		 */
 		const AssetMetaData& GetAssetMetaData(AssetHandle handle) { return m_AvailRegistry.GetAssetMetaData(handle); }
 
+		/**
+		 * @brief Resolves the slot cached by the holder of the handle, without loading anything.
+		 *
+		 * @param handle The handle of the asset.
+		 * @param slot The cached slot.
+		 * @return The asset, nullptr if the slot is stale and has to be synchronized again.
+		 */
+		Asset* ResolveSlot(AssetHandle handle, const AssetSlot& slot) const { return m_Slots.Resolve(handle, slot); }
+
+		/**
+		 * @brief Gets the slot holding the asset, to be cached by the holder of the handle.
+		 *
+		 * @param handle The handle of the asset.
+		 * @param asset The asset as returned by GetAssetRaw() or GetAssetRawAsync().
+		 * @return The slot.
+		 */
+		AssetSlot SyncSlot(AssetHandle handle, Asset* asset)
+		{
+			m_Slots.Set(handle, asset);
+
+			return m_Slots.Acquire(handle);
+		}
+
 	protected:
 		AssetRegistry m_AvailRegistry; // All asset pointers are owned by the AssetRegistry!
+		AssetSlotMap m_Slots;          // Mirrors the loaded assets, every change must go through m_Slots.Set()
 	};
 
 } // namespace SW
@@ -0,0 +1,354 @@
+#include "AssetPack.hpp"
+
+#include <algorithm>
+
+#include <yaml-cpp/yaml.h>
+
+#include "Animation2D.hpp"
+#include "Core/Scene/SceneBinarySerializer.hpp"
+#include "Core/Utils/SerializationUtils.hpp"
+
+#include <stb_image.h>
+
+namespace SW
+{
+
+	static_assert(sizeof(AssetPackHeader) == 40, "Asset pack header layout changed, bump AssetPack::Version!");
+	static_assert(sizeof(AssetPackEntry) == 56, "Asset pack entry layout changed, bump AssetPack::Version!");
+
+	static u64 AlignOffset(u64 offset, u64 alignment)
+	{
+		return (offset + alignment - 1) & ~(alignment - 1);
+	}
+
+	static bool IsCookable(AssetType type)
+	{
+		switch (type)
+		{
+		case AssetType::Texture2D:
+		case AssetType::Sprite:
+		case AssetType::Spritesheet:
+		case AssetType::Font:
+		case AssetType::FontSource:
+		case AssetType::Scene:
+		case AssetType::Prefab:
+		case AssetType::Animation2D:
+		case AssetType::Audio:
+			return true;
+		default:
+			return false; // directories, scripts, shaders and registries are not needed by the runtime
+		}
+	}
+
+	static bool ReadWholeFile(const std::filesystem::path& path, std::vector<char>& outBytes)
+	{
+		std::ifstream file(path, std::ios::binary | std::ios::ate);
+
+		if (!file)
+			return false;
+
+		outBytes.resize((size_t)file.tellg());
+
+		file.seekg(0);
+		file.read(outBytes.data(), (std::streamsize)outBytes.size());
+
+		return (bool)file;
+	}
+
+	static bool CookTexture(const AssetMetaData& metadata, const std::filesystem::path& source,
+	                        TextureCompressionMode mode, std::vector<char>& outBytes)
+	{
+		CookedTexture texture;
+
+		if (!TextureCache::TryLoad(metadata.Handle, metadata.ContentHash, mode, texture)) // usually cooked already
+		{
+			i32 width, height, channels;
+
+			stbi_set_flip_vertically_on_load_thread(true);
+			stbi_uc* pixels = stbi_load(source.string().c_str(), &width, &height, &channels, 0);
+
+			if (!pixels)
+				return false;
+
+			texture = TextureCache::Cook(pixels, width, height, channels, mode);
+
+			stbi_image_free(pixels);
+		}
+
+		const std::vector<u8> data = TextureCache::Serialize(texture, metadata.ContentHash);
+
+		outBytes.assign(data.begin(), data.end());
+
+		return true;
+	}
+
+	static bool CookAnimation(const AssetRegistry& registry, const std::filesystem::path& source,
+	                          std::vector<char>& outBytes)
+	{
+		if (!ReadWholeFile(source, outBytes))
+			return false;
+
+		YAML::Node file;
+
+		try
+		{
+			file = YAML::Load(std::string(outBytes.begin(), outBytes.end()));
+		}
+		catch (const YAML::ParserException& e)
+		{
+			APP_ERROR("Error while cooking the animation: {}, {}", source.string(), e.what());
+			return false;
+		}
+
+		YAML::Node animation = file["Animation"];
+
+		if (!animation || !animation["Baked"])
+			return true;
+
+		std::vector<AssetHandle> sprites;
+
+		for (YAML::Node sprite : animation["Sprites"])
+			sprites.emplace_back(TryDeserializeNode<u64>(sprite["Sprite"], "SpriteHandle", 0));
+
+		if (TryDeserializeNode<u64>(animation["Baked"], "SourceHash", 0) == Animation2D::HashSources(registry, sprites))
+			return true;
+
+		// The sprites changed since the animation was saved - the runtime bakes the clip from them instead.
+		animation.remove("Baked");
+
+		YAML::Emitter output;
+		output << file;
+
+		outBytes.assign(output.c_str(), output.c_str() + output.size());
+
+		return true;
+	}
+
+	bool AssetPack::Open(const std::filesystem::path& path)
+	{
+		PROFILE_FUNCTION();
+
+		Close();
+
+		if (!m_File.Open(path))
+			return false;
+
+		const u8* data = m_File.GetData();
+		const u64 size = m_File.GetSize();
+
+		AssetPackHeader header;
+
+		if (size < sizeof(AssetPackHeader))
+		{
+			SYSTEM_ERROR("{} is not an asset pack!", path);
+			m_File.Close();
+			return false;
+		}
+
+		std::memcpy(&header, data, sizeof(AssetPackHeader));
+
+		if (header.Magic != Magic || header.Version != Version)
+		{
+			SYSTEM_ERROR("{} is not an asset pack or has version {} (expected {}). Cook the project again.", path,
+			             header.Version, Version);
+			m_File.Close();
+			return false;
+		}
+
+		const u64 tableSize = (u64)header.EntryCount * sizeof(AssetPackEntry);
+
+		if (header.TableOffset % alignof(AssetPackEntry) != 0 || header.TableOffset > size ||
+		    tableSize > size - header.TableOffset || header.StringsOffset > size ||
+		    header.StringsSize > size - header.StringsOffset)
+		{
+			SYSTEM_ERROR("Asset pack {} is corrupted (table of contents out of bounds)!", path);
+			m_File.Close();
+			return false;
+		}
+
+		const AssetPackEntry* entries = reinterpret_cast<const AssetPackEntry*>(data + header.TableOffset);
+
+		for (u32 i = 0; i < header.EntryCount; i++)
+		{
+			const AssetPackEntry& entry = entries[i];
+
+			const bool blobInBounds = entry.Offset <= size && entry.Size <= size - entry.Offset;
+			const bool pathInBounds = (u64)entry.PathOffset + entry.PathLength <= header.StringsSize;
+			const bool sorted       = i == 0 || entries[i - 1].Handle < entry.Handle;
+
+			if (!blobInBounds || !pathInBounds || !sorted)
+			{
+				SYSTEM_ERROR("Asset pack {} is corrupted (entry {})!", path, i);
+				m_File.Close();
+				return false;
+			}
+		}
+
+		m_Entries    = entries;
+		m_EntryCount = header.EntryCount;
+		m_Strings    = reinterpret_cast<const char*>(data + header.StringsOffset);
+
+		SYSTEM_INFO("Asset pack {} opened ({} assets)", path, m_EntryCount);
+
+		return true;
+	}
+
+	void AssetPack::Close()
+	{
+		m_File.Close();
+
+		m_Entries    = nullptr;
+		m_EntryCount = 0;
+		m_Strings    = nullptr;
+	}
+
+	const AssetPackEntry* AssetPack::Find(AssetHandle handle) const
+	{
+		const AssetPackEntry* end = m_Entries + m_EntryCount;
+
+		const AssetPackEntry* it =
+		    std::lower_bound(m_Entries, end, handle,
+		                     [](const AssetPackEntry& entry, AssetHandle value) { return entry.Handle < value; });
+
+		return it != end && it->Handle == handle ? it : nullptr;
+	}
+
+	void AssetPack::FillMetaData(std::map<AssetHandle, AssetMetaData>& assets) const
+	{
+		for (u32 i = 0; i < m_EntryCount; i++)
+		{
+			const AssetPackEntry& entry = m_Entries[i];
+
+			AssetMetaData metadata;
+			metadata.Handle           = entry.Handle;
+			metadata.Type             = entry.Type;
+			metadata.Path             = GetPath(entry);
+			metadata.ModificationTime = entry.ModificationTime;
+			metadata.ParentHandle     = entry.ParentHandle;
+
+			assets.emplace_hint(assets.end(), entry.Handle, std::move(metadata)); // entries are already sorted
+		}
+	}
+
+	bool AssetPack::Cook(const AssetRegistry& registry, const std::filesystem::path& assetDirectory,
+	                     const std::filesystem::path& packPath, TextureCompressionMode textureCompression)
+	{
+		PROFILE_FUNCTION();
+
+		std::ofstream file(packPath, std::ios::binary | std::ios::trunc);
+
+		if (!file)
+		{
+			APP_ERROR("Failed to create the asset pack: {}", packPath);
+			return false;
+		}
+
+		AssetPackHeader header = {};
+		header.Magic           = Magic;
+		header.Version         = Version;
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(AssetPackHeader));
+
+		std::filesystem::path cookedScenePath = packPath;
+		cookedScenePath += SceneBinarySerializer::Extension;
+
+		std::vector<AssetPackEntry> entries;
+		std::string strings;
+		std::vector<char> blob;
+
+		const char zeros[BlobAlignment] = {};
+
+		u64 offset = sizeof(AssetPackHeader);
+
+		// The registry is ordered by handle, so the table of contents comes out sorted.
+		for (auto&& [handle, metadata] : registry.GetAvailableAssets())
+		{
+			if (!IsCookable(metadata.Type))
+				continue;
+
+			const std::filesystem::path source = assetDirectory / metadata.Path;
+
+			bool result = false;
+
+			if (metadata.ParentHandle) // stored inside the parent's blob
+			{
+				blob.clear();
+
+				result = true;
+			}
+			else if (metadata.Type == AssetType::Scene && !SceneBinarySerializer::IsBinaryScene(source))
+			{
+				result = SceneBinarySerializer::Convert(source, cookedScenePath) &&
+				         ReadWholeFile(cookedScenePath, blob);
+			}
+			else if (metadata.Type == AssetType::Texture2D)
+			{
+				result = CookTexture(metadata, source, textureCompression, blob);
+			}
+			else if (metadata.Type == AssetType::Animation2D)
+			{
+				result = CookAnimation(registry, source, blob);
+			}
+			else
+			{
+				result = ReadWholeFile(source, blob);
+			}
+
+			if (!result)
+			{
+				APP_WARN("Asset {} [{}] could not be cooked, skipped.", metadata.Path.string(), handle);
+				continue;
+			}
+
+			const u64 aligned = AlignOffset(offset, BlobAlignment);
+
+			file.write(zeros, (std::streamsize)(aligned - offset));
+			file.write(blob.data(), (std::streamsize)blob.size());
+
+			const std::string path = metadata.Path.string();
+
+			AssetPackEntry entry   = {};
+			entry.Handle           = handle;
+			entry.ParentHandle     = metadata.ParentHandle;
+			entry.Offset           = aligned;
+			entry.Size             = blob.size();
+			entry.ModificationTime = metadata.ModificationTime;
+			entry.PathOffset       = (u32)strings.size();
+			entry.PathLength       = (u32)path.size();
+			entry.Type             = metadata.Type;
+
+			entries.emplace_back(entry);
+			strings += path;
+
+			offset = aligned + blob.size();
+		}
+
+		std::filesystem::remove(cookedScenePath);
+
+		const u64 tableOffset = AlignOffset(offset, BlobAlignment);
+
+		file.write(zeros, (std::streamsize)(tableOffset - offset));
+		file.write(reinterpret_cast<const char*>(entries.data()),
+		           (std::streamsize)(entries.size() * sizeof(AssetPackEntry)));
+		file.write(strings.data(), (std::streamsize)strings.size());
+
+		header.EntryCount    = (u32)entries.size();
+		header.TableOffset   = tableOffset;
+		header.StringsOffset = tableOffset + entries.size() * sizeof(AssetPackEntry);
+		header.StringsSize   = strings.size();
+
+		file.seekp(0);
+		file.write(reinterpret_cast<const char*>(&header), sizeof(AssetPackHeader));
+
+		if (!file)
+		{
+			APP_ERROR("Failed to write the asset pack: {}", packPath);
+			return false;
+		}
+
+		APP_INFO("Cooked {} assets into {}", entries.size(), packPath);
+
+		return true;
+	}
+
+} // namespace SW
@@ -0,0 +1,160 @@
+/**
+ * @file AssetPack.hpp
+ * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
+ * @version 0.1.3
+ * @date 2024-05-26
+ *
+ * @copyright Copyright (c) 2024 Tycjan Fortuna
+ */
+#pragma once
+
+#include "AssetRegistry.hpp"
+#include "Cache/TextureCache.hpp"
+#include "Core/Utils/MappedFile.hpp"
+
+namespace SW
+{
+
+	/**
+	 * @brief Header at the beginning of every asset pack.
+	 */
+	struct AssetPackHeader
+	{
+		u32 Magic;         /**< Must be equal to AssetPack::Magic. */
+		u32 Version;       /**< Must be equal to AssetPack::Version. */
+		u32 EntryCount;    /**< Number of entries in the table of contents. */
+		u32 Reserved;      /**< Padding, always 0. */
+		u64 TableOffset;   /**< Offset of the table of contents. */
+		u64 StringsOffset; /**< Offset of the asset paths (not null terminated). */
+		u64 StringsSize;   /**< Size of the asset paths in bytes. */
+	};
+
+	/**
+	 * @brief Single entry of the table of contents, entries are sorted by handle.
+	 */
+	struct AssetPackEntry
+	{
+		AssetHandle Handle;         /**< Handle of the asset. */
+		AssetHandle ParentHandle;   /**< Owner of a sub-asset, 0 if the asset has its own blob. */
+		u64 Offset;                 /**< Offset of the asset blob (aligned to AssetPack::BlobAlignment). */
+		u64 Size;                   /**< Size of the asset blob in bytes. */
+		Timestamp ModificationTime; /**< Modification time of the source file at cook time. */
+		u32 PathOffset;             /**< Offset of the asset path inside the strings block. */
+		u32 PathLength;             /**< Length of the asset path. */
+		AssetType Type;             /**< Type of the asset. */
+		u8 Padding[7];              /**< Padding, always 0. */
+	};
+
+	/**
+	 * @brief Single file containing all cooked assets of a project, used by shipped games instead of the asset
+	 * 		  directory and the YAML asset registry.
+	 *
+	 * 		  Layout: header, blobs (aligned to BlobAlignment), table of contents, asset paths.
+	 * 		  The file is memory mapped - opening it only touches the header, the table and the paths,
+	 * 		  blob pages are loaded by the OS when the asset is actually read.
+	 * 		  Blobs are the source files as they are, except scenes which are cooked into the binary scene format
+	 * 		  and textures which are cooked by the TextureCache (mip chain, optionally block compressed).
+	 * 		  Sub-assets (e.g. sprites of a spritesheet) have empty blobs, they are loaded from their parents.
+	 * @note Bump the version whenever the layout changes, packs with a different version are rejected.
+	 */
+	class AssetPack final
+	{
+	public:
+		static constexpr u32 Magic         = 0x4B505753; /**< "SWPK" */
+		static constexpr u32 Version       = 2;          /**< Current version of the format. */
+		static constexpr u64 BlobAlignment = 16;         /**< Alignment of every blob in the file. */
+
+		static constexpr const char* Extension = ".sw_pack"; /**< File extension of the asset packs. */
+
+		/**
+		 * @brief Maps and validates the pack. Previously opened pack is closed.
+		 *
+		 * @param path Path to the pack file.
+		 * @return Whether the operation was successful.
+		 */
+		bool Open(const std::filesystem::path& path);
+
+		/**
+		 * @brief Unmaps the pack, all pointers returned by the pack are invalidated.
+		 */
+		void Close();
+
+		/**
+		 * @brief Whether a pack is currently opened.
+		 *
+		 * @return True if a pack is opened.
+		 */
+		bool IsOpen() const { return m_Entries != nullptr; }
+
+		/**
+		 * @brief Finds the entry of the asset (binary search in the table of contents).
+		 *
+		 * @param handle The handle of the asset.
+		 * @return The entry, nullptr if the asset is not in the pack.
+		 */
+		const AssetPackEntry* Find(AssetHandle handle) const;
+
+		/**
+		 * @brief Gets the blob of the asset, it points straight into the mapped file.
+		 *
+		 * @param entry The entry of the asset.
+		 * @return Pointer to the first byte of the blob.
+		 */
+		const u8* GetData(const AssetPackEntry& entry) const { return m_File.GetData() + entry.Offset; }
+
+		/**
+		 * @brief Gets the path of the asset relative to the project's asset directory.
+		 *
+		 * @param entry The entry of the asset.
+		 * @return The path of the asset.
+		 */
+		std::string_view GetPath(const AssetPackEntry& entry) const
+		{
+			return {m_Strings + entry.PathOffset, entry.PathLength};
+		}
+
+		/**
+		 * @brief Gets the number of entries in the pack.
+		 *
+		 * @return The number of entries.
+		 */
+		u32 GetEntryCount() const { return m_EntryCount; }
+
+		/**
+		 * @brief Gets the entries of the pack (sorted by handle).
+		 *
+		 * @return Pointer to the first entry.
+		 */
+		const AssetPackEntry* GetEntries() const { return m_Entries; }
+
+		/**
+		 * @brief Builds the metadata of all packed assets.
+		 *
+		 * @param assets The map to fill.
+		 */
+		void FillMetaData(std::map<AssetHandle, AssetMetaData>& assets) const;
+
+		/**
+		 * @brief Cooks all loadable assets of the registry into a single pack file.
+		 * @note Scenes are converted to the binary scene format, textures are cooked (taken from the texture cache
+		 * 		 if it is up to date), animations lose their baked clips if the sprites changed since they were saved,
+		 * 		 other assets are copied as they are.
+		 *
+		 * @param registry The registry containing the assets to cook.
+		 * @param assetDirectory The asset directory of the project (asset paths are relative to it).
+		 * @param packPath Path to the output pack file.
+		 * @param textureCompression How the textures are cooked.
+		 * @return Whether the operation was successful.
+		 */
+		static bool Cook(const AssetRegistry& registry, const std::filesystem::path& assetDirectory,
+		                 const std::filesystem::path& packPath, TextureCompressionMode textureCompression);
+
+	private:
+		MappedFile m_File; /**< The mapped pack file. */
+
+		const AssetPackEntry* m_Entries = nullptr; /**< The table of contents. */
+		u32 m_EntryCount                = 0;       /**< Number of entries in the table of contents. */
+		const char* m_Strings           = nullptr; /**< The asset paths. */
+	};
+
+} // namespace SW
@@ -0,0 +1,55 @@
+#include "AssetPreloader.hpp"
+
+#include "AssetManager.hpp"
+
+namespace SW
+{
+
+	void AssetPreloader::Start(const std::vector<AssetHandle>& handles)
+	{
+		PROFILE_FUNCTION();
+
+		Clear();
+
+		m_Handles.reserve(handles.size());
+
+		for (const AssetHandle handle : handles)
+		{
+			if (!AssetManager::IsValid(handle))
+				continue; // removed since the manifest was written, loaded on demand if it comes back
+
+			AssetManager::AddReference(handle);
+			AssetManager::GetAssetRawAsync(handle);
+
+			m_Handles.emplace_back(handle);
+		}
+
+		m_Pending = m_Handles;
+
+		Update(); // already loaded assets finish right away
+	}
+
+	void AssetPreloader::Update()
+	{
+		std::erase_if(m_Pending, [](AssetHandle handle) {
+			const AssetState state = AssetManager::GetAssetState(handle);
+
+			if (state == AssetState::None) // unloaded in the meantime
+				AssetManager::GetAssetRawAsync(handle);
+
+			return state == AssetState::Loaded || state == AssetState::Invalid;
+		});
+	}
+
+	void AssetPreloader::Clear()
+	{
+		for (const AssetHandle handle : m_Handles)
+		{
+			AssetManager::RemoveReference(handle);
+		}
+
+		m_Handles.clear();
+		m_Pending.clear();
+	}
+
+} // namespace SW
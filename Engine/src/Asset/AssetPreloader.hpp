@@ -0,0 +1,82 @@
+/**
+ * @file AssetPreloader.hpp
+ * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
+ * @version 0.1.0
+ * @date 2024-06-03
+ *
+ * @copyright Copyright (c) 2024 Tycjan Fortuna
+ */
+#pragma once
+
+#include "Asset.hpp"
+
+namespace SW
+{
+
+	/**
+	 * @brief Loads a set of assets (e.g. the dependency manifest of a scene) on the asynchronous loader workers
+	 * 		  and reports the progress. The assets are referenced until the preloader is cleared, so they are not
+	 * 		  evicted before they are used.
+	 */
+	class AssetPreloader final
+	{
+	public:
+		AssetPreloader() = default;
+		~AssetPreloader() { Clear(); }
+
+		AssetPreloader(const AssetPreloader& other)            = delete;
+		AssetPreloader& operator=(const AssetPreloader& other) = delete;
+
+		/**
+		 * @brief Requests the loads of the assets, the previous assets are released.
+		 * @note Dependencies should come before the assets using them, so they are decoded first.
+		 *
+		 * @param handles The handles of the assets, unavailable ones are skipped.
+		 */
+		void Start(const std::vector<AssetHandle>& handles);
+
+		/**
+		 * @brief Checks which of the assets finished loading.
+		 * @note Call once per frame, after AssetManager::ProcessAsyncLoads().
+		 */
+		void Update();
+
+		/**
+		 * @brief Releases the references of the assets, the assets stay loaded.
+		 */
+		void Clear();
+
+		/**
+		 * @brief Checks whether all assets finished loading (or failed to load).
+		 *
+		 * @return True if nothing is pending.
+		 */
+		bool IsFinished() const { return m_Pending.empty(); }
+
+		/**
+		 * @brief Gets the number of assets which finished loading (or failed to load).
+		 *
+		 * @return The number of finished assets.
+		 */
+		u32 GetFinishedCount() const { return (u32)(m_Handles.size() - m_Pending.size()); }
+
+		/**
+		 * @brief Gets the number of preloaded assets.
+		 *
+		 * @return The number of assets.
+		 */
+		u32 GetTotalCount() const { return (u32)m_Handles.size(); }
+
+		/**
+		 * @brief Gets the progress of the preload.
+		 *
+		 * @return The progress from 0 to 1, 1 if there is nothing to load.
+		 */
+		f32 GetProgress() const { return m_Handles.empty() ? 1.f : (f32)GetFinishedCount() / (f32)GetTotalCount(); }
+
+	private:
+		std::vector<AssetHandle> m_Handles; /**< All preloaded assets, each holds a reference. */
+		std::vector<AssetHandle> m_Pending; /**< Assets which are still loading. */
+	};
+
+} // namespace SW
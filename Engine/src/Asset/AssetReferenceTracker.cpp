@@ -0,0 +1,54 @@
+#include "AssetReferenceTracker.hpp"
+
+#include "AssetManager.hpp"
+
+namespace SW
+{
+
+	void AssetReferenceTracker::Set(u32 owner, AssetHandle handle)
+	{
+		auto it = m_References.find(owner);
+
+		if (it != m_References.end())
+		{
+			if (it->second == handle)
+				return;
+
+			AssetManager::RemoveReference(it->second);
+
+			if (handle)
+				it->second = handle;
+			else
+				m_References.erase(it);
+		}
+		else if (handle)
+		{
+			m_References.emplace(owner, handle);
+		}
+
+		AssetManager::AddReference(handle);
+	}
+
+	void AssetReferenceTracker::Remove(u32 owner)
+	{
+		auto it = m_References.find(owner);
+
+		if (it == m_References.end())
+			return;
+
+		AssetManager::RemoveReference(it->second);
+
+		m_References.erase(it);
+	}
+
+	void AssetReferenceTracker::Clear()
+	{
+		for (auto&& [owner, handle] : m_References)
+		{
+			AssetManager::RemoveReference(handle);
+		}
+
+		m_References.clear();
+	}
+
+} // namespace SW
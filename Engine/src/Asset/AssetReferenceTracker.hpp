@@ -0,0 +1,60 @@
+/**
+ * @file AssetReferenceTracker.hpp
+ * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
+ * @version 0.1.0
+ * @date 2024-05-28
+ *
+ * @copyright Copyright (c) 2024 Tycjan Fortuna
+ */
+#pragma once
+
+#include "Asset.hpp"
+
+namespace SW
+{
+
+	/**
+	 * @brief Keeps the asset manager reference counts in sync with asset handles stored by owners (e.g. entities of
+	 * 		  a scene holding a sprite component). Every owner holds at most one reference per tracker.
+	 */
+	class AssetReferenceTracker final
+	{
+	public:
+		AssetReferenceTracker() = default;
+		~AssetReferenceTracker() { Clear(); }
+
+		AssetReferenceTracker(const AssetReferenceTracker& other)            = delete;
+		AssetReferenceTracker& operator=(const AssetReferenceTracker& other) = delete;
+
+		/**
+		 * @brief Sets the asset referenced by the owner, the previous reference is released.
+		 *
+		 * @param owner The owner of the reference.
+		 * @param handle The handle of the asset, 0 releases the reference.
+		 */
+		void Set(u32 owner, AssetHandle handle);
+
+		/**
+		 * @brief Releases the reference of the owner.
+		 *
+		 * @param owner The owner of the reference.
+		 */
+		void Remove(u32 owner);
+
+		/**
+		 * @brief Releases all references.
+		 */
+		void Clear();
+
+		/**
+		 * @brief Gets the number of held references.
+		 *
+		 * @return The number of references.
+		 */
+		u64 GetCount() const { return m_References.size(); }
+
+	private:
+		std::unordered_map<u32, AssetHandle> m_References; /**< Referenced asset per owner. */
+	};
+
+} // namespace SW
@@ -1,8 +1,10 @@
 #include "AssetRegistry.hpp"
 
+#include <algorithm>
 #include <yaml-cpp/yaml.h>
 
 #include "AssetManager.hpp"
+#include "Core/Hash.hpp"
 #include "Core/Project/Project.hpp"
 #include "Core/Project/ProjectContext.hpp"
 #include "Core/Utils/FileSystem.hpp"
@@ -12,6 +14,86 @@
 namespace SW
 {
 
+	/**
+	 * @brief Brings the modification time and the content hash of the asset up to date.
+	 * 		  The modification time is a cheap pre-check, the file is hashed only if it differs. Touched, copied or
+	 * 		  checked out files with the same bytes are not reported as changed.
+	 *
+	 * @param metadata The metadata of the asset.
+	 * @param fullPath The absolute path of the asset.
+	 * @param time The current modification time of the file.
+	 * @return Whether the contents of the file changed.
+	 */
+	static bool RefreshContentHash(AssetMetaData& metadata, const std::filesystem::path& fullPath, Timestamp time)
+	{
+		if (metadata.ModificationTime == time && metadata.ContentHash != 0)
+			return false;
+
+		const bool hasTimeChanged = metadata.ModificationTime != time;
+
+		metadata.ModificationTime = time;
+
+		if (metadata.Type == AssetType::Directory)
+			return false;
+
+		u64 hash = 0;
+
+		if (!Hash::GenerateFileHash(fullPath, hash))
+			return hasTimeChanged;
+
+		// Registries written before the hashes were introduced have no hash to compare against.
+		const bool hasChanged = metadata.ContentHash != 0 ? metadata.ContentHash != hash : hasTimeChanged;
+
+		metadata.ContentHash = hash;
+
+		return hasChanged;
+	}
+
+	static bool WriteRegistryFile(const std::filesystem::path& path, const std::vector<AssetMetaData>& assets)
+	{
+		YAML::Emitter output;
+
+		output << YAML::BeginMap;
+		output << YAML::Key << "Assets" << YAML::Value << YAML::BeginSeq;
+
+		for (const AssetMetaData& metadata : assets)
+		{
+			output << YAML::BeginMap;
+
+			output << YAML::Key << "Handle" << YAML::Value << metadata.Handle;
+			output << YAML::Key << "Path" << YAML::Value << metadata.Path.string();
+			output << YAML::Key << "Type" << YAML::Value << Asset::GetStringifiedAssetType(metadata.Type);
+			output << YAML::Key << "ModificationTime" << YAML::Value << metadata.ModificationTime;
+			output << YAML::Key << "ContentHash" << YAML::Value << metadata.ContentHash;
+
+			if (metadata.ParentHandle)
+				output << YAML::Key << "ParentHandle" << YAML::Value << metadata.ParentHandle;
+
+			output << YAML::EndMap;
+		}
+
+		output << YAML::EndMap;
+
+		output << YAML::EndSeq;
+
+		// Written next to the registry and renamed, so a crash never leaves a truncated registry behind.
+		std::filesystem::path temporaryPath = path;
+		temporaryPath += ".tmp";
+
+		{
+			std::ofstream fout(temporaryPath, std::ios::trunc);
+			fout << output.c_str();
+
+			if (!fout)
+				return false;
+		}
+
+		std::error_code error;
+		std::filesystem::rename(temporaryPath, path, error);
+
+		return !error;
+	}
+
 	AssetRegistry::AssetRegistry()
 	{
 		const std::filesystem::path& regPath = ProjectContext::Get()->GetAssetRegistryPath();
@@ -22,9 +104,15 @@ namespace SW
 		FetchAvailableAssets();
 	}
 
+	AssetRegistry::AssetRegistry(std::map<AssetHandle, AssetMetaData>&& assets)
+	    : m_AvailableAssets(std::move(assets)), m_IsReadOnly(true)
+	{
+	}
+
 	AssetRegistry::~AssetRegistry()
 	{
-		SaveRegistryToFile();
+		if (!m_IsReadOnly)
+			SaveRegistryToFile();
 	}
 
 	void AssetRegistry::FetchDirectory(std::map<std::filesystem::path, AssetMetaData>& registered,
@@ -42,20 +130,17 @@ namespace SW
 
 			if (it != registered.end())
 			{
-				if (reload && it->second.ModificationTime != FileSystem::GetLastWriteTime(entry))
-				{
-					AssetManager::ForceReload(it->second.Handle);
-
-					it->second.ModificationTime = FileSystem::GetLastWriteTime(entry);
+				const Timestamp time  = FileSystem::GetLastWriteTime(entry);
+				const bool hasChanged = RefreshContentHash(it->second, entry.path(), time);
 
-					SYSTEM_INFO("Asset {} [{}] was reloaded!", it->second.Path.string(), it->second.Handle);
-				}
+				Register(it->second); // before the reload, which reads the refreshed metadata
 
-				m_AvailableAssets[it->second.Handle] = it->second;
+				if (reload && hasChanged && AssetManager::ReloadWithDependents(it->second.Handle))
+					SYSTEM_INFO("Asset {} [{}] is being reloaded!", it->second.Path.string(), it->second.Handle);
 
 				registered.erase(it);
 			}
-			else
+			else if (!m_HandlesByPath.contains(rel))
 			{
 				AssetMetaData metadata;
 				metadata.Handle           = Random::CreateID();
@@ -65,7 +150,10 @@ namespace SW
 				                                : Asset::GetAssetTypeFromExtension(rel.extension().string());
 				metadata.ModificationTime = FileSystem::GetLastWriteTime(entry);
 
-				m_AvailableAssets[metadata.Handle] = metadata;
+				if (metadata.Type != AssetType::Directory)
+					Hash::GenerateFileHash(entry.path(), metadata.ContentHash);
+
+				Register(metadata);
 			}
 
 			if (entry.is_directory())
@@ -75,10 +163,14 @@ namespace SW
 
 	void AssetRegistry::RefetchAvailableAssets()
 	{
+		if (m_IsReadOnly)
+			return;
+
 		std::map<std::filesystem::path, AssetMetaData> registeredEntries;
 		for (auto&& [handle, metadata] : m_AvailableAssets)
 		{
-			registeredEntries[metadata.Path] = metadata;
+			if (!metadata.ParentHandle) // sub-assets stay registered as long as their parents
+				registeredEntries[metadata.Path] = metadata;
 		}
 
 		// m_AvailableAssets.clear(); // not clearing - looking also for file changes for hot reload of assets
@@ -88,14 +180,352 @@ namespace SW
 
 		for (auto&& [path, metadata] : registeredEntries)
 		{ // Not found after reload -> candidates for unloading
-			bool result = AssetManager::ForceUnload(metadata.Handle);
+			Unregister(metadata.Handle);
+		}
+
+		RequestSave();
+	}
+
+	void AssetRegistry::ApplyChanges(const std::vector<FileChange>& changes)
+	{
+		if (m_IsReadOnly)
+			return;
+
+		PROFILE_FUNCTION();
+
+		const std::filesystem::path& assetDirectory = ProjectContext::Get()->GetAssetDirectory();
+
+		// The registry file lives in the asset directory, its own saves must not count as changes.
+		const std::filesystem::path registryPath =
+		    ProjectContext::Get()->GetAssetRegistryPath().lexically_relative(assetDirectory);
+
+		std::filesystem::path temporaryPath = registryPath;
+		temporaryPath += ".tmp";
 
-			ASSERT(result, "Could not unload asset {} [{}]", path.string(), metadata.Handle);
+		for (const FileChange& change : changes)
+		{
+			if (change.Path == registryPath || change.Path == temporaryPath)
+				continue;
+
+			switch (change.Type)
+			{
+			case FileChangeType::Added:
+			case FileChangeType::Modified:
+				AddOrUpdate(change.Path);
+				break;
+			case FileChangeType::Removed:
+				Remove(change.Path);
+				break;
+			case FileChangeType::Renamed:
+				Rename(change.OldPath, change.Path);
+				break;
+			case FileChangeType::Overflow:
+				break; // the caller scans the whole directory
+			}
+		}
+	}
+
+	void AssetRegistry::Update()
+	{
+		if (m_PendingSave.valid())
+		{
+			if (m_PendingSave.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+				return;
+
+			if (!m_PendingSave.get())
+			{
+				SYSTEM_ERROR("Failed to save the asset registry, trying again later.");
+
+				RequestSave();
+			}
+		}
+
+		if (m_IsSaveRequested && std::chrono::steady_clock::now() - m_SaveRequestTime >= SaveDelay)
+			StartSave();
+	}
+
+	void AssetRegistry::Register(const AssetMetaData& metadata)
+	{
+		auto it = m_AvailableAssets.find(metadata.Handle);
+
+		const bool isNew = it == m_AvailableAssets.end();
+
+		if (!isNew && !it->second.ParentHandle)
+			m_HandlesByPath.erase(it->second.Path);
+
+		m_AvailableAssets[metadata.Handle] = metadata;
+
+		if (!metadata.ParentHandle)
+			m_HandlesByPath[metadata.Path] = metadata.Handle;
+		else if (isNew)
+			m_SubAssets[metadata.ParentHandle].emplace_back(metadata.Handle);
+	}
+
+	void AssetRegistry::RegisterSubAssets(AssetHandle parent, const std::vector<AssetMetaData>& subAssets,
+	                                      bool removeMissing)
+	{
+		if (m_IsReadOnly)
+			return; // sub-assets of packed assets come from the pack
+
+		auto parentIt = m_AvailableAssets.find(parent);
+
+		if (parentIt == m_AvailableAssets.end())
+			return;
+
+		const std::filesystem::path parentPath = parentIt->second.Path;
 
-			SYSTEM_INFO("Asset {} [{}] was unloaded!", path.string(), metadata.Handle);
+		bool hasChanged = false;
+
+		if (auto registered = m_SubAssets.find(parent); removeMissing && registered != m_SubAssets.end())
+		{
+			std::vector<AssetHandle> removed;
+
+			for (AssetHandle subAsset : registered->second)
+			{
+				auto found = std::find_if(subAssets.begin(), subAssets.end(),
+				                          [subAsset](const AssetMetaData& other) { return other.Handle == subAsset; });
+
+				if (found == subAssets.end())
+					removed.emplace_back(subAsset);
+			}
+
+			for (AssetHandle subAsset : removed)
+			{
+				Unregister(subAsset);
+			}
+
+			hasChanged = !removed.empty();
+		}
+
+		for (const AssetMetaData& subAsset : subAssets)
+		{
+			AssetMetaData metadata    = subAsset;
+			metadata.Path             = parentPath / subAsset.Path;
+			metadata.ModificationTime = 0; // no file of its own
+			metadata.ContentHash      = 0;
+			metadata.ParentHandle     = parent;
+
+			auto it = m_AvailableAssets.find(metadata.Handle);
+
+			if (it != m_AvailableAssets.end())
+			{
+				if (it->second.ParentHandle != parent)
+				{
+					SYSTEM_WARN("Sub-asset {} [{}] collides with {}, skipped.", metadata.Path.string(),
+					            metadata.Handle, it->second.Path.string());
+					continue;
+				}
+
+				if (it->second.Path == metadata.Path && it->second.Type == metadata.Type)
+					continue; // already up to date
+			}
+
+			Register(metadata);
+
+			hasChanged = true;
 		}
 
-		SaveRegistryToFile();
+		if (hasChanged)
+			RequestSave();
+	}
+
+	AssetHandle AssetRegistry::FindHandle(const std::filesystem::path& path) const
+	{
+		auto it = m_HandlesByPath.find(path);
+
+		return it != m_HandlesByPath.end() ? it->second : 0;
+	}
+
+	void AssetRegistry::AddOrUpdate(const std::filesystem::path& path)
+	{
+		const std::filesystem::path fullPath = ProjectContext::Get()->GetAssetDirectory() / path;
+
+		std::error_code error;
+
+		if (!std::filesystem::exists(fullPath, error))
+			return; // removed again before the change was polled
+
+		const bool isDirectory = std::filesystem::is_directory(fullPath, error);
+		const Timestamp time   = FileSystem::GetLastWriteTime(fullPath);
+
+		const AssetHandle handle = FindHandle(path);
+
+		if (handle)
+		{
+			AssetMetaData& metadata = m_AvailableAssets.at(handle);
+
+			const Timestamp previousTime = metadata.ModificationTime;
+			const u64 previousHash       = metadata.ContentHash;
+
+			// Sub-assets (e.g. the sprites of a spritesheet) are reloaded as its dependents.
+			if (RefreshContentHash(metadata, fullPath, time) && AssetManager::ReloadWithDependents(handle))
+				SYSTEM_INFO("Asset {} [{}] is being reloaded!", path.string(), handle);
+
+			if (metadata.ModificationTime != previousTime || metadata.ContentHash != previousHash)
+				RequestSave();
+
+			return;
+		}
+
+		AssetMetaData metadata;
+		metadata.Handle           = Random::CreateID();
+		metadata.Path             = path;
+		metadata.Type             = isDirectory ? AssetType::Directory
+		                                        : Asset::GetAssetTypeFromExtension(path.extension().string());
+		metadata.ModificationTime = time;
+
+		if (!isDirectory)
+			Hash::GenerateFileHash(fullPath, metadata.ContentHash);
+
+		Register(metadata);
+
+		if (isDirectory)
+		{
+			std::map<std::filesystem::path, AssetMetaData> registered;
+
+			FetchDirectory(registered, fullPath, false);
+		}
+
+		RequestSave();
+	}
+
+	void AssetRegistry::Remove(const std::filesystem::path& path)
+	{
+		const AssetHandle handle = FindHandle(path);
+
+		if (!handle)
+			return;
+
+		if (m_AvailableAssets.at(handle).Type != AssetType::Directory)
+		{
+			Unregister(handle);
+			RequestSave();
+
+			return;
+		}
+
+		std::vector<AssetHandle> removed;
+
+		for (auto&& [assetPath, assetHandle] : m_HandlesByPath)
+		{
+			if (FileSystem::IsSameOrInside(assetPath, path))
+				removed.emplace_back(assetHandle);
+		}
+
+		for (AssetHandle assetHandle : removed)
+		{
+			Unregister(assetHandle);
+		}
+
+		RequestSave();
+	}
+
+	void AssetRegistry::Rename(const std::filesystem::path& oldPath, const std::filesystem::path& newPath)
+	{
+		const AssetHandle handle = FindHandle(oldPath);
+
+		if (!handle)
+		{
+			AddOrUpdate(newPath);
+			return;
+		}
+
+		Remove(newPath); // replaced by the move
+
+		std::vector<AssetHandle> moved;
+
+		if (m_AvailableAssets.at(handle).Type == AssetType::Directory)
+		{
+			for (auto&& [assetPath, assetHandle] : m_HandlesByPath)
+			{
+				if (FileSystem::IsSameOrInside(assetPath, oldPath))
+					moved.emplace_back(assetHandle);
+			}
+		}
+		else
+		{
+			moved.emplace_back(handle);
+		}
+
+		for (AssetHandle assetHandle : moved)
+		{
+			AssetMetaData metadata = m_AvailableAssets.at(assetHandle);
+			metadata.Path          = FileSystem::Rebase(metadata.Path, oldPath, newPath);
+
+			if (metadata.Type != AssetType::Directory)
+			{
+				const AssetType type = Asset::GetAssetTypeFromExtension(metadata.Path.extension().string());
+
+				if (type != metadata.Type) // the extension changed, the loaded asset is of the wrong type now
+				{
+					UnregisterSubAssets(assetHandle);
+					AssetManager::ForceUnload(assetHandle);
+
+					metadata.Type = type;
+				}
+			}
+
+			Register(metadata);
+
+			if (auto subAssets = m_SubAssets.find(assetHandle); subAssets != m_SubAssets.end())
+			{
+				for (AssetHandle subAsset : subAssets->second)
+				{
+					AssetMetaData& subAssetMetadata = m_AvailableAssets.at(subAsset);
+					subAssetMetadata.Path           = FileSystem::Rebase(subAssetMetadata.Path, oldPath, newPath);
+				}
+			}
+		}
+
+		SYSTEM_INFO("Asset {} [{}] was moved to {}", oldPath.string(), handle, newPath.string());
+
+		RequestSave();
+	}
+
+	void AssetRegistry::Unregister(AssetHandle handle)
+	{
+		UnregisterSubAssets(handle);
+
+		auto it = m_AvailableAssets.find(handle);
+
+		if (it == m_AvailableAssets.end())
+			return;
+
+		const bool result = AssetManager::ForceUnload(handle);
+
+		ASSERT(result, "Could not unload asset {} [{}]", it->second.Path.string(), handle);
+
+		SYSTEM_INFO("Asset {} [{}] was unloaded!", it->second.Path.string(), handle);
+
+		if (!it->second.ParentHandle)
+			m_HandlesByPath.erase(it->second.Path);
+		else if (auto siblings = m_SubAssets.find(it->second.ParentHandle); siblings != m_SubAssets.end())
+			std::erase(siblings->second, handle);
+
+		m_AvailableAssets.erase(it);
+	}
+
+	void AssetRegistry::UnregisterSubAssets(AssetHandle parent)
+	{
+		auto registered = m_SubAssets.find(parent);
+
+		if (registered == m_SubAssets.end())
+			return;
+
+		const std::vector<AssetHandle> subAssets = std::move(registered->second);
+
+		m_SubAssets.erase(registered);
+
+		for (AssetHandle subAsset : subAssets)
+		{
+			Unregister(subAsset);
+		}
+	}
+
+	void AssetRegistry::RequestSave()
+	{
+		m_IsSaveRequested = true;
+		m_SaveRequestTime = std::chrono::steady_clock::now();
 	}
 
 	const SW::AssetMetaData& AssetRegistry::GetAssetMetaData(AssetHandle handle) const
@@ -115,6 +545,7 @@ namespace SW
 		YAML::Node assets = registry["Assets"];
 
 		std::map<std::filesystem::path, AssetMetaData> registeredEntries;
+		std::vector<AssetMetaData> subAssets; // have no files, registered once their parents are found
 
 		for (const YAML::Node& asset : assets)
 		{
@@ -122,44 +553,63 @@ namespace SW
 			metadata.Handle           = TryDeserializeNode<AssetHandle>(asset, "Handle", 0);
 			metadata.Path             = TryDeserializeNode<std::string>(asset, "Path", "");
 			metadata.ModificationTime = TryDeserializeNode<u64>(asset, "ModificationTime", 0);
+			metadata.ContentHash      = TryDeserializeNode<u64>(asset, "ContentHash", 0);
+			metadata.ParentHandle     = TryDeserializeNode<AssetHandle>(asset, "ParentHandle", 0);
 			metadata.Type =
 			    Asset::GetAssetTypeFromStringified(TryDeserializeNode<std::string>(asset, "Type", "Unknown"));
 
-			registeredEntries[metadata.Path] = metadata;
+			if (metadata.ParentHandle)
+				subAssets.emplace_back(metadata);
+			else
+				registeredEntries[metadata.Path] = metadata;
 		}
 
 		m_AvailableAssets.clear();
+		m_HandlesByPath.clear();
+		m_SubAssets.clear();
 		FetchDirectory(registeredEntries, assetsDir, false);
+
+		for (const AssetMetaData& subAsset : subAssets)
+		{
+			if (Contains(subAsset.ParentHandle))
+				Register(subAsset);
+		}
 	}
 
 	void AssetRegistry::SaveRegistryToFile()
 	{
-		YAML::Emitter output;
+		if (m_IsReadOnly)
+			return;
 
-		output << YAML::BeginMap;
-		output << YAML::Key << "Assets" << YAML::Value << YAML::BeginSeq;
+		StartSave();
 
-		for (auto&& [handle, metadata] : m_AvailableAssets)
-		{
-			if (metadata.Type == AssetType::Directory) // Skip directories
-				continue;
+		if (!m_PendingSave.get())
+			SYSTEM_ERROR("Failed to save the asset registry {}", ProjectContext::Get()->GetAssetRegistryPath());
+	}
 
-			output << YAML::BeginMap;
+	void AssetRegistry::StartSave()
+	{
+		PROFILE_FUNCTION();
 
-			output << YAML::Key << "Handle" << YAML::Value << handle;
-			output << YAML::Key << "Path" << YAML::Value << metadata.Path.string();
-			output << YAML::Key << "Type" << YAML::Value << Asset::GetStringifiedAssetType(metadata.Type);
-			output << YAML::Key << "ModificationTime" << YAML::Value << metadata.ModificationTime;
+		// An older snapshot must not overwrite this one, its failure is still reported (this save writes it again)
+		if (m_PendingSave.valid() && !m_PendingSave.get())
+			SYSTEM_ERROR("Failed to save the asset registry {}", ProjectContext::Get()->GetAssetRegistryPath());
 
-			output << YAML::EndMap;
-		}
+		std::vector<AssetMetaData> assets;
+		assets.reserve(m_AvailableAssets.size());
 
-		output << YAML::EndMap;
+		for (auto&& [handle, metadata] : m_AvailableAssets)
+		{
+			if (metadata.Type != AssetType::Directory) // Skip directories
+				assets.emplace_back(metadata);
+		}
 
-		output << YAML::EndSeq;
+		m_IsSaveRequested = false;
 
-		std::ofstream fout(ProjectContext::Get()->GetAssetRegistryPath());
-		fout << output.c_str();
+		m_PendingSave = std::async(std::launch::async, [path = ProjectContext::Get()->GetAssetRegistryPath(),
+		                                                assets = std::move(assets)]() {
+			return WriteRegistryFile(path, assets);
+		});
 	}
 
 } // namespace SW
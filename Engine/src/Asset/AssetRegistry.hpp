@@ -1,8 +1,12 @@
 #pragma once
 
+#include <chrono>
+#include <future>
+
 #include "Asset.hpp"
 #include "AssetSourceItem.hpp"
 #include "Core/OpenGL/Texture2D.hpp"
+#include "Core/Utils/FileWatcher.hpp"
 
 namespace SW
 {
@@ -15,12 +19,25 @@ namespace SW
 		AssetType Type;
 		std::filesystem::path Path;
 		Timestamp ModificationTime;
+		u64 ContentHash          = 0; // XXH64 of the file, 0 if unknown
+		AssetHandle ParentHandle = 0; // owner of a sub-asset (e.g. spritesheet of a sprite), 0 if it has its own file
 	};
 
 	class AssetRegistry
 	{
 	public:
+		static constexpr std::chrono::milliseconds SaveDelay{1000}; /**< Quiet time before the registry is saved. */
+
 		AssetRegistry();
+
+		/**
+		 * @brief Creates the registry from already known assets (e.g. the table of contents of an asset pack).
+		 * @note The asset directory is not scanned and the registry file is never written.
+		 *
+		 * @param assets The available assets.
+		 */
+		explicit AssetRegistry(std::map<AssetHandle, AssetMetaData>&& assets);
+
 		~AssetRegistry();
 
 		bool Contains(AssetHandle handle) const { return m_AvailableAssets.find(handle) != m_AvailableAssets.end(); }
@@ -29,18 +46,119 @@ namespace SW
 		                    const std::filesystem::path& dir, bool reload);
 		void RefetchAvailableAssets();
 
+		/**
+		 * @brief Applies the changes of the asset directory without scanning it.
+		 * 		  Renamed and moved assets keep their handles, modified ones are reloaded together with their
+		 * 		  dependents if their contents changed, removed ones unloaded.
+		 * @note The registry file is saved once no change arrived for SaveDelay (see Update()).
+		 *
+		 * @param changes The changes reported by a FileWatcher of the asset directory.
+		 */
+		void ApplyChanges(const std::vector<FileChange>& changes);
+
+		/**
+		 * @brief Saves the registry file on a worker thread once the requested save is due.
+		 * @note Call once per frame.
+		 */
+		void Update();
+
+		/**
+		 * @brief Adds the asset to the registry, replacing the one with the same handle.
+		 *
+		 * @param metadata The metadata of the asset.
+		 */
+		void Register(const AssetMetaData& metadata);
+
+		/**
+		 * @brief Registers the sub-assets of the asset, they are stored inside the file of their parent.
+		 * 		  Their paths are the path of the parent followed by their names (e.g. "Hero.sw_spritesheet/Idle_0").
+		 * @note Sub-assets are not visible to FindHandle(), they go away together with their parent.
+		 *
+		 * @param parent The handle of the parent asset.
+		 * @param subAssets Handles, types and names (as paths) of the sub-assets.
+		 * @param removeMissing Whether the sub-assets not listed are unregistered, never while an asset is loading.
+		 */
+		void RegisterSubAssets(AssetHandle parent, const std::vector<AssetMetaData>& subAssets, bool removeMissing);
+
+		/**
+		 * @brief Finds the asset by path.
+		 *
+		 * @param path The path relative to the asset directory.
+		 * @return The handle of the asset, 0 if there is no such asset.
+		 */
+		AssetHandle FindHandle(const std::filesystem::path& path) const;
+
 		const AssetMetaData& GetAssetMetaData(AssetHandle handle) const;
 		const std::map<AssetHandle, AssetMetaData>& GetAvailableAssets() const { return m_AvailableAssets; }
 
+		// Changes made through here are not visible to FindHandle(), use Register() for new assets.
 		std::map<AssetHandle, AssetMetaData>& GetAvailableAssetsRaw() { return m_AvailableAssets; }
 
 	private:
 		std::map<AssetHandle, AssetMetaData> m_AvailableAssets;
+		std::unordered_map<std::filesystem::path, AssetHandle> m_HandlesByPath; // index of m_AvailableAssets
+		std::unordered_map<AssetHandle, std::vector<AssetHandle>> m_SubAssets;  // sub-assets of every parent
+
+		bool m_IsReadOnly = false; // true if the registry is not backed by the registry file
+
+		bool m_IsSaveRequested = false;                          // whether the registry file is outdated
+		std::chrono::steady_clock::time_point m_SaveRequestTime; // time of the last change
+		std::future<bool> m_PendingSave;                         // save running on a worker thread
 
 	private:
 		void FetchAvailableAssets();
 
+		/**
+		 * @brief Registers the asset at the path or reloads it if its contents changed.
+		 * 		  Directories are scanned for entries created before they were watched.
+		 *
+		 * @param path The path relative to the asset directory.
+		 */
+		void AddOrUpdate(const std::filesystem::path& path);
+
+		/**
+		 * @brief Unloads and unregisters the asset at the path, directories with all their assets.
+		 *
+		 * @param path The path relative to the asset directory.
+		 */
+		void Remove(const std::filesystem::path& path);
+
+		/**
+		 * @brief Moves the asset to the new path, directories with all their assets. Handles stay the same.
+		 *
+		 * @param oldPath The previous path relative to the asset directory.
+		 * @param newPath The new path relative to the asset directory.
+		 */
+		void Rename(const std::filesystem::path& oldPath, const std::filesystem::path& newPath);
+
+		/**
+		 * @brief Unloads and unregisters the asset together with its sub-assets.
+		 *
+		 * @param handle The handle of the asset.
+		 */
+		void Unregister(AssetHandle handle);
+
+		/**
+		 * @brief Unloads and unregisters all sub-assets of the asset.
+		 *
+		 * @param parent The handle of the parent asset.
+		 */
+		void UnregisterSubAssets(AssetHandle parent);
+
+		/**
+		 * @brief Marks the registry file as outdated, the save is postponed by every further change.
+		 */
+		void RequestSave();
+
+		/**
+		 * @brief Waits for the running save and writes the registry file on the calling thread.
+		 */
 		void SaveRegistryToFile();
+
+		/**
+		 * @brief Copies the registry and writes it to the file on a worker thread.
+		 */
+		void StartSave();
 	};
 
 } // namespace SW
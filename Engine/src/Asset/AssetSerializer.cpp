@@ -5,7 +5,10 @@
 #include "Asset/Font.hpp"
 #include "Audio/Sound.hpp"
 #include "Cache/FontCache.hpp"
+#include "Cache/TextureCache.hpp"
+#include "Core/Hash.hpp"
 #include "Core/Scene/Scene.hpp"
+#include "Core/Scene/SceneBinarySerializer.hpp"
 #include "Core/Scene/SceneSerializer.hpp"
 #include "Core/Utils/SerializationUtils.hpp"
 #include "GUI/Editor/EditorResources.hpp"
@@ -13,9 +16,70 @@
 #include "Spritesheet.hpp"
 #include "core/Project/ProjectContext.hpp"
 
+#include <stb_image.h>
+
 namespace SW
 {
 
+	static YAML::Node LoadYamlFromMemory(const u8* data, u64 size)
+	{
+		return YAML::Load(std::string(reinterpret_cast<const char*>(data), size));
+	}
+
+	/**
+	 * @brief Worker part of the YAML based assets - the file is read and parsed, the asset is built on the main thread.
+	 */
+	struct YamlLoadData final : AssetLoadData
+	{
+		YAML::Node File;
+	};
+
+	static Scope<AssetLoadData> DecodeYamlAsset(const AssetMetaData& metadata)
+	{
+		const std::filesystem::path path = ProjectContext::Get()->GetAssetDirectory() / metadata.Path;
+
+		Scope<YamlLoadData> data = CreateScope<YamlLoadData>();
+		data->File               = YAML::LoadFile(path.string());
+
+		return data;
+	}
+
+	/**
+	 * @brief Worker part of the textures - either the cooked texture (cache hit or freshly cooked) or the decoded
+	 * 		  image if the texture can not be cached. Cooked levels are moved to a staging buffer of the
+	 * 		  TextureUploader if one is free, the main thread then only issues the copy.
+	 */
+	struct Texture2DLoadData final : AssetLoadData
+	{
+		CookedTexture Cooked;
+		TextureStagingBuffer Staging;
+		stbi_uc* Pixels = nullptr;
+		i32 Width       = 0;
+		i32 Height      = 0;
+		i32 Channels    = 0;
+
+		~Texture2DLoadData() override
+		{
+			TextureUploader::Release(Staging); // the load was cancelled before the upload
+			stbi_image_free(Pixels);
+		}
+	};
+
+	static void StageCookedTexture(Texture2DLoadData& data)
+	{
+		if (!TextureUploader::IsFormatSupported(data.Cooked.Format))
+			return; // decoded on the main thread
+
+		data.Staging = TextureUploader::Stage(data.Cooked.Data.size());
+
+		if (!data.Staging)
+			return;
+
+		std::memcpy(data.Staging.Data, data.Cooked.Data.data(), data.Cooked.Data.size());
+
+		data.Cooked.Data = std::vector<u8>(); // the staged copy is the only one needed
+	}
+
 	void SceneAssetSerializer::Serialize(const AssetMetaData& metadata)
 	{
 		Scene* scene = *AssetManager::GetAssetRaw<Scene>(metadata.Handle);
@@ -28,6 +92,11 @@ namespace SW
 		return SceneSerializer::Deserialize(ProjectContext::Get()->GetAssetDirectory() / metadata.Path);
 	}
 
+	Asset* SceneAssetSerializer::TryLoadAssetFromMemory(const AssetMetaData& /*metadata*/, const u8* data, u64 size)
+	{
+		return SceneBinarySerializer::Deserialize(data, size); // scenes are cooked to the binary format
+	}
+
 	void Texture2DSerializer::Serialize(const AssetMetaData& /*metadata*/)
 	{
 		ASSERT(false, "Texture2D serialization is not supported!");
@@ -35,22 +104,82 @@ namespace SW
 
 	Asset* Texture2DSerializer::TryLoadAsset(const AssetMetaData& metadata)
 	{
-		Texture2D* texture = new Texture2D(ProjectContext::Get()->GetAssetDirectory() / metadata.Path, true);
+		Scope<AssetLoadData> data = DecodeAsset(metadata); // same cache as the asynchronous loads
+
+		return FinalizeAsset(metadata, data.get());
+	}
+
+	Asset* Texture2DSerializer::TryLoadAssetFromMemory(const AssetMetaData& /*metadata*/, const u8* data, u64 size)
+	{
+		CookedTexture cooked;
+
+		if (TextureCache::Deserialize(data, size, cooked))
+			return new Texture2D(cooked.Format, cooked.Levels, cooked.Data.data());
+
+		Texture2D* texture = new Texture2D(data, size, true); // packs cooked before textures were cooked
 
 		return texture;
 	}
 
-	void SpriteSerializer::Serialize(const AssetMetaData& /*metadata*/)
+	Scope<AssetLoadData> Texture2DSerializer::DecodeAsset(const AssetMetaData& metadata)
 	{
-		ASSERT(false, "Sprite serialization is not supported!");
+		const std::filesystem::path path  = ProjectContext::Get()->GetAssetDirectory() / metadata.Path;
+		const TextureCompressionMode mode = ProjectContext::Get()->GetConfig().TextureCompression;
+
+		Scope<Texture2DLoadData> data = CreateScope<Texture2DLoadData>();
+
+		if (TextureCache::TryLoad(metadata.Handle, metadata.ContentHash, mode, data->Cooked))
+		{
+			StageCookedTexture(*data);
+
+			return data;
+		}
+
+		stbi_set_flip_vertically_on_load_thread(true); // the global flag is not thread safe
+		data->Pixels = stbi_load(path.string().c_str(), &data->Width, &data->Height, &data->Channels, 0);
+
+		if (data->Pixels && metadata.ContentHash != 0) // cooked once, every further load skips the decoding
+		{
+			data->Cooked = TextureCache::Cook(data->Pixels, data->Width, data->Height, data->Channels, mode);
+
+			TextureCache::Store(metadata.Handle, metadata.ContentHash, data->Cooked);
+
+			stbi_image_free(data->Pixels);
+			data->Pixels = nullptr;
+
+			StageCookedTexture(*data);
+		}
+
+		return data;
 	}
 
-	Asset* SpriteSerializer::TryLoadAsset(const AssetMetaData& metadata)
+	Asset* Texture2DSerializer::FinalizeAsset(const AssetMetaData& metadata, AssetLoadData* data)
 	{
-		const std::filesystem::path path = ProjectContext::Get()->GetAssetDirectory() / metadata.Path;
+		Texture2DLoadData* texture = static_cast<Texture2DLoadData*>(data);
 
-		YAML::Node file = YAML::LoadFile(path.string());
+		if (texture && texture->Staging)
+			return new Texture2D(texture->Cooked.Format, texture->Cooked.Levels, texture->Staging);
+
+		if (texture && !texture->Cooked.Levels.empty())
+			return new Texture2D(texture->Cooked.Format, texture->Cooked.Levels, texture->Cooked.Data.data());
+
+		if (!texture || !texture->Pixels)
+		{
+			SYSTEM_ERROR("Failed to load the image: {}", metadata.Path.string());
+
+			return nullptr;
+		}
+
+		return new Texture2D(texture->Pixels, texture->Width, texture->Height, texture->Channels);
+	}
+
+	void SpriteSerializer::Serialize(const AssetMetaData& /*metadata*/)
+	{
+		ASSERT(false, "Sprite serialization is not supported!");
+	}
 
+	static Asset* DeserializeSprite(const YAML::Node& file, const AssetMetaData& metadata)
+	{
 		YAML::Node data = file["Sprite"];
 
 		if (!data)
@@ -65,7 +194,7 @@ namespace SW
 		const u64 handle   = TryDeserializeNode<u64>(data, "SpritesheetTextureHandle", 0);
 		const bool isValid = AssetManager::IsValid(handle);
 		Texture2D** texture =
-		    isValid ? AssetManager::GetAssetRaw<Texture2D>(handle) : &EditorResources::MissingAssetIcon;
+		    isValid ? AssetManager::GetAssetRawAsync<Texture2D>(handle) : &EditorResources::MissingAssetIcon;
 
 		sprite->SetTexture(texture);
 		sprite->TexCordLeftDown  = isValid
@@ -82,9 +211,106 @@ namespace SW
 		return sprite;
 	}
 
+	/**
+	 * @brief Cuts the sprite sub-asset from its spritesheet, the spritesheet is loaded once for all its sprites.
+	 */
+	static Asset* LoadSubSprite(const AssetMetaData& metadata)
+	{
+		Spritesheet** spritesheet = AssetManager::GetAssetRaw<Spritesheet>(metadata.ParentHandle);
+		const SpriteData* data    = spritesheet && *spritesheet ? (*spritesheet)->FindSprite(metadata.Handle) : nullptr;
+
+		Sprite* sprite = new Sprite();
+
+		if (!data || !(*spritesheet)->GetSpritesheetTextureRaw())
+		{
+			SYSTEM_ERROR("Sprite {} is missing in its spritesheet!", metadata.Path.string());
+
+			sprite->SetTexture(&EditorResources::MissingAssetIcon);
+			sprite->TexCordRightDown = glm::vec2(1.0f, 0.0f);
+			sprite->TexCordUpRight   = glm::vec2(1.0f, 1.0f);
+			sprite->TexCordUpLeft    = glm::vec2(0.0f, 1.0f);
+
+			return sprite;
+		}
+
+		const Spritesheet* sheet     = *spritesheet;
+		const SpriteTexCoords coords = sheet->GetTexCoords(*data, sheet->TextureSize);
+
+		sprite->SetTexture(sheet->GetSpritesheetTextureRaw());
+		sprite->TexCordLeftDown  = coords.LeftDown;
+		sprite->TexCordRightDown = coords.RightDown;
+		sprite->TexCordUpRight   = coords.UpRight;
+		sprite->TexCordUpLeft    = coords.UpLeft;
+
+		return sprite;
+	}
+
+	Asset* SpriteSerializer::TryLoadAsset(const AssetMetaData& metadata)
+	{
+		if (metadata.ParentHandle)
+			return LoadSubSprite(metadata);
+
+		const std::filesystem::path path = ProjectContext::Get()->GetAssetDirectory() / metadata.Path;
+
+		return DeserializeSprite(YAML::LoadFile(path.string()), metadata);
+	}
+
+	Asset* SpriteSerializer::TryLoadAssetFromMemory(const AssetMetaData& metadata, const u8* data, u64 size)
+	{
+		if (metadata.ParentHandle)
+			return LoadSubSprite(metadata); // packed without a blob
+
+		return DeserializeSprite(LoadYamlFromMemory(data, size), metadata);
+	}
+
+	Scope<AssetLoadData> SpriteSerializer::DecodeAsset(const AssetMetaData& metadata)
+	{
+		if (metadata.ParentHandle)
+			return nullptr; // nothing to read, cut from the spritesheet on the main thread
+
+		return DecodeYamlAsset(metadata);
+	}
+
+	Asset* SpriteSerializer::FinalizeAsset(const AssetMetaData& metadata, AssetLoadData* data)
+	{
+		if (metadata.ParentHandle)
+			return LoadSubSprite(metadata);
+
+		return data ? DeserializeSprite(static_cast<YamlLoadData*>(data)->File, metadata) : nullptr;
+	}
+
+	/**
+	 * @brief Registers the sprites of the spritesheet as its sub-assets.
+	 */
+	static void RegisterSubSprites(const Spritesheet* spritesheet, AssetHandle handle, bool removeMissing)
+	{
+		std::vector<AssetMetaData> subAssets;
+		subAssets.reserve(spritesheet->Sprites.size());
+
+		for (const SpriteData& sprite : spritesheet->Sprites)
+		{
+			AssetMetaData metadata;
+			metadata.Handle           = sprite.Handle;
+			metadata.Type             = AssetType::Sprite;
+			metadata.Path             = sprite.Name;
+			metadata.ModificationTime = 0;
+
+			subAssets.emplace_back(metadata);
+		}
+
+		AssetManager::GetRegistryRaw().RegisterSubAssets(handle, subAssets, removeMissing);
+	}
+
 	void SpritesheetSerializer::Serialize(const AssetMetaData& metadata)
 	{
-		const Spritesheet* spritesheet = *AssetManager::GetAsset<Spritesheet>(metadata.Handle);
+		Spritesheet* spritesheet = *AssetManager::GetAssetRaw<Spritesheet>(metadata.Handle);
+
+		const Texture2D* texture = spritesheet->GetSpritesheetTexture();
+
+		if (texture && texture != EditorResources::MissingAssetIcon) // not the placeholder of a loading texture
+			spritesheet->TextureSize = {(f32)texture->GetWidth(), (f32)texture->GetHeight()};
+
+		spritesheet->UpdateSpriteHandles(metadata.Handle); // sprites could be added or renamed
 
 		YAML::Emitter output;
 
@@ -92,12 +318,12 @@ namespace SW
 		output << YAML::Key << "Spritesheet" << YAML::Value;
 
 		output << YAML::BeginMap;
-		Texture2D* texture = spritesheet->GetSpritesheetTexture();
 		output << YAML::Key << "TextureHandle" << YAML::Value << (texture ? texture->GetHandle() : 0u);
 		output << YAML::Key << "ViewZoom" << YAML::Value << spritesheet->ViewZoom;
 		output << YAML::Key << "GridSize" << YAML::Value << spritesheet->GridSize;
 		output << YAML::Key << "CenterOffset" << YAML::Value << spritesheet->CenterOffset;
 		output << YAML::Key << "ViewPos" << YAML::Value << spritesheet->ViewPos;
+		output << YAML::Key << "TextureSize" << YAML::Value << spritesheet->TextureSize;
 		output << YAML::Key << "ShowImageBorders" << YAML::Value << spritesheet->ShowImageBorders;
 		output << YAML::Key << "ExportPath" << YAML::Value << spritesheet->ExportPath.string();
 
@@ -125,14 +351,12 @@ namespace SW
 
 		std::ofstream fout(ProjectContext::Get()->GetAssetDirectory() / metadata.Path);
 		fout << output.c_str();
+
+		RegisterSubSprites(spritesheet, metadata.Handle, true);
 	}
 
-	Asset* SpritesheetSerializer::TryLoadAsset(const AssetMetaData& metadata)
+	static Asset* DeserializeSpritesheet(const YAML::Node& file, const AssetMetaData& metadata)
 	{
-		const std::filesystem::path path = ProjectContext::Get()->GetAssetDirectory() / metadata.Path;
-
-		YAML::Node file = YAML::LoadFile(path.string());
-
 		YAML::Node data = file["Spritesheet"];
 
 		if (!data)
@@ -144,17 +368,32 @@ namespace SW
 
 		Spritesheet* spritesheet = new Spritesheet();
 
-		const u64 handle    = TryDeserializeNode<u64>(data, "TextureHandle", 0);
-		Texture2D** texture = handle ? AssetManager::GetAssetRaw<Texture2D>(handle) : nullptr;
-
-		spritesheet->SetSpritesheetTexture(texture);
 		spritesheet->ViewZoom         = TryDeserializeNode<f32>(data, "ViewZoom", 1.0f);
 		spritesheet->GridSize         = TryDeserializeNode<f32>(data, "GridSize", 32.0f);
 		spritesheet->CenterOffset     = TryDeserializeNode<glm::vec2>(data, "CenterOffset", glm::vec2(0.0f, 0.0f));
 		spritesheet->ViewPos          = TryDeserializeNode<glm::vec2>(data, "ViewPos", glm::vec2(0.0f, 0.0f));
+		spritesheet->TextureSize      = TryDeserializeNode<glm::vec2>(data, "TextureSize", glm::vec2(0.0f, 0.0f));
 		spritesheet->ShowImageBorders = TryDeserializeNode<bool>(data, "ShowImageBorders", false);
 		spritesheet->ExportPath       = TryDeserializeNode<std::string>(data, "ExportPath", "");
 
+		const u64 handle          = TryDeserializeNode<u64>(data, "TextureHandle", 0);
+		const bool hasTextureSize = spritesheet->TextureSize.x > 0.f && spritesheet->TextureSize.y > 0.f;
+		Texture2D** texture       = nullptr;
+
+		if (handle && hasTextureSize)
+		{
+			texture = AssetManager::GetAssetRawAsync<Texture2D>(handle);
+		}
+		else if (handle) // saved before the size was stored, the sprites can not be cut without it
+		{
+			texture = AssetManager::GetAssetRaw<Texture2D>(handle);
+
+			if (texture)
+				spritesheet->TextureSize = {(f32)(*texture)->GetWidth(), (f32)(*texture)->GetHeight()};
+		}
+
+		spritesheet->SetSpritesheetTexture(texture);
+
 		YAML::Node sprites = data["Sprites"];
 		for (YAML::Node sprite : sprites)
 		{
@@ -167,9 +406,44 @@ namespace SW
 			spritesheet->Sprites.emplace_back(spriteData);
 		}
 
+		spritesheet->UpdateSpriteHandles(metadata.Handle);
+
+		// Sprites added outside of the editor become available, the removed ones stay until the next save.
+		RegisterSubSprites(spritesheet, metadata.Handle, false);
+
 		return spritesheet;
 	}
 
+	Asset* SpritesheetSerializer::TryLoadAsset(const AssetMetaData& metadata)
+	{
+		const std::filesystem::path path = ProjectContext::Get()->GetAssetDirectory() / metadata.Path;
+
+		return DeserializeSpritesheet(YAML::LoadFile(path.string()), metadata);
+	}
+
+	Asset* SpritesheetSerializer::TryLoadAssetFromMemory(const AssetMetaData& metadata, const u8* data, u64 size)
+	{
+		return DeserializeSpritesheet(LoadYamlFromMemory(data, size), metadata);
+	}
+
+	Scope<AssetLoadData> SpritesheetSerializer::DecodeAsset(const AssetMetaData& metadata)
+	{
+		return DecodeYamlAsset(metadata);
+	}
+
+	Asset* SpritesheetSerializer::FinalizeAsset(const AssetMetaData& metadata, AssetLoadData* data)
+	{
+		return data ? DeserializeSpritesheet(static_cast<YamlLoadData*>(data)->File, metadata) : nullptr;
+	}
+
+	static FontCharsetType ReadCharsetType(const YAML::Node& data)
+	{
+		// The importer writes "CharsetType", older font files used "Charset".
+		const u32 fallback = TryDeserializeNode<u32>(data, "Charset", (u32)FontCharsetType::ASCII);
+
+		return (FontCharsetType)TryDeserializeNode<u32>(data, "CharsetType", fallback);
+	}
+
 	void FontSerializer::Serialize(const AssetMetaData& /*metadata*/)
 	{
 		ASSERT(false, "Font serialization is not supported!");
@@ -192,21 +466,56 @@ namespace SW
 
 		const u64 fontSourceHandle = TryDeserializeNode<u64>(data, "FontSourceHandle", 0);
 
+		AssetManager::RecordDependency(fontSourceHandle); // read straight from its file, never loaded on its own
+
 		const AssetMetaData& sourceMetadata = AssetManager::GetAssetMetaData(fontSourceHandle);
 
+		// The glyphs change with the font source as well, a changed source must not hit the cache of the old one.
+		const u64 cacheHash = metadata.ContentHash && sourceMetadata.ContentHash
+		                          ? Hash::GenerateXXHash(&sourceMetadata.ContentHash, sizeof(u64), metadata.ContentHash)
+		                          : 0;
+
+		if (Font* cached = FontCache::TryGetCachedFont(metadata.Handle, cacheHash))
+			return cached;
+
 		FontSpecification spec;
-		spec.Path           = ProjectContext::Get()->GetAssetDirectory() / sourceMetadata.Path;
-		spec.Charset        = (FontCharsetType)TryDeserializeNode<u32>(data, "Charset", (int)FontCharsetType::ASCII);
-		spec.PreloadedAtlas = FontCache::TryGetCachedAtlas(metadata.Handle, metadata.ModificationTime);
+		spec.Path    = ProjectContext::Get()->GetAssetDirectory() / sourceMetadata.Path;
+		spec.Charset = ReadCharsetType(data);
 
 		Font* font = new Font(spec);
 
-		if (!spec.PreloadedAtlas)
-			FontCache::CacheAtlas(font->GetAtlasTexture(), metadata.Handle, metadata.ModificationTime);
+		if (!font->IsDynamic()) // dynamic fonts have no glyphs to cache
+			FontCache::CacheFont(font, metadata.Handle, cacheHash);
 
 		return font;
 	}
 
+	Asset* FontSerializer::TryLoadAssetFromMemory(const AssetMetaData& metadata, const u8* data, u64 size)
+	{
+		YAML::Node file = LoadYamlFromMemory(data, size);
+
+		YAML::Node fontNode = file["Font"];
+
+		if (!fontNode)
+		{
+			SYSTEM_ERROR("Error while deserializing the font: {}", metadata.Path.string());
+
+			return nullptr;
+		}
+
+		const u64 fontSourceHandle = TryDeserializeNode<u64>(fontNode, "FontSourceHandle", 0);
+
+		// The atlas is generated straight from the packed font source, the editor font cache is not shipped.
+		FontSpecification spec;
+		spec.Path    = AssetManager::GetAssetMetaData(fontSourceHandle).Path;
+		spec.Data    = ProjectContext::Get()->GetRuntimeAssetManager()->GetAssetData(fontSourceHandle, spec.DataSize);
+		spec.Charset = ReadCharsetType(fontNode);
+
+		ASSERT(spec.Data, "Font source of the font {} is missing in the asset pack!", metadata.Path.string());
+
+		return new Font(spec);
+	}
+
 	void FontSourceSerializer::Serialize(const AssetMetaData& /*metadata*/)
 	{
 	}
@@ -216,9 +525,17 @@ namespace SW
 		return nullptr;
 	}
 
+	Asset* FontSourceSerializer::TryLoadAssetFromMemory(const AssetMetaData& /*metadata*/, const u8* /*data*/,
+	                                                    u64 /*size*/)
+	{
+		return nullptr;
+	}
+
 	void AnimationSerializer::Serialize(const AssetMetaData& metadata)
 	{
-		const Animation2D* animation = *AssetManager::GetAsset<Animation2D>(metadata.Handle);
+		Animation2D* animation = *AssetManager::GetAsset<Animation2D>(metadata.Handle);
+
+		animation->Bake(); // stored with the animation, the runtime never resolves the sprites frame by frame
 
 		YAML::Emitter output;
 
@@ -232,34 +549,59 @@ namespace SW
 
 		output << YAML::Key << "Sprites" << YAML::Value << YAML::BeginSeq;
 
-		for (Sprite** const sprite : animation->Sprites)
+		for (u64 i = 0; i < animation->Sprites.size(); i++)
 		{
 			output << YAML::BeginMap;
 
 			output << YAML::Key << "Sprite";
 
 			output << YAML::BeginMap;
-			output << YAML::Key << "SpriteHandle" << YAML::Value << (*sprite)->GetHandle();
+			output << YAML::Key << "SpriteHandle" << YAML::Value << (*animation->Sprites[i])->GetHandle();
 			output << YAML::EndMap;
 
+			output << YAML::Key << "Duration" << YAML::Value << animation->GetFrameDuration(i);
+
 			output << YAML::EndMap;
 		}
 
-		output << YAML::EndMap;
 		output << YAML::EndSeq;
 
+		if (animation->IsBaked())
+		{
+			const AnimationClip& clip = animation->GetClip();
+
+			std::vector<AssetHandle> sprites;
+			sprites.reserve(animation->Sprites.size());
+
+			for (Sprite** sprite : animation->Sprites)
+				sprites.emplace_back((*sprite)->GetHandle());
+
+			output << YAML::Key << "Baked" << YAML::Value;
+
+			output << YAML::BeginMap;
+			output << YAML::Key << "SourceHash" << YAML::Value
+			       << Animation2D::HashSources(AssetManager::GetRegistry(), sprites);
+			output << YAML::Key << "TextureHandle" << YAML::Value << clip.TextureHandle;
+			output << YAML::Key << "TexCoords" << YAML::Value << YAML::BeginSeq;
+
+			for (const glm::vec4& texCoords : clip.TexCoords)
+				output << texCoords;
+
+			output << YAML::EndSeq;
+			output << YAML::Key << "FrameEnds" << YAML::Value << YAML::Flow << clip.FrameEnds;
+			output << YAML::EndMap;
+		}
+
+		output << YAML::EndMap;
+
 		output << YAML::EndMap;
 
 		std::ofstream fout(ProjectContext::Get()->GetAssetDirectory() / metadata.Path);
 		fout << output.c_str();
 	}
 
-	Asset* AnimationSerializer::TryLoadAsset(const AssetMetaData& metadata)
+	static Asset* DeserializeAnimation(const YAML::Node& file, const AssetMetaData& metadata, bool isPacked)
 	{
-		const std::filesystem::path path = ProjectContext::Get()->GetAssetDirectory() / metadata.Path;
-
-		YAML::Node file = YAML::LoadFile(path.string());
-
 		YAML::Node data = file["Animation"];
 
 		if (!data)
@@ -279,14 +621,67 @@ namespace SW
 		for (YAML::Node sprite : sprites)
 		{
 			Sprite** spr =
-			    AssetManager::GetAssetRaw<Sprite>(TryDeserializeNode<u64>(sprite["Sprite"], "SpriteHandle", 0));
+			    AssetManager::GetAssetRawAsync<Sprite>(TryDeserializeNode<u64>(sprite["Sprite"], "SpriteHandle", 0));
 
 			animation->Sprites.emplace_back(spr);
+			animation->FrameDurations.emplace_back(sprite["Duration"] ? sprite["Duration"].as<f32>() : 1.f);
+		}
+
+		// Only the packed clips are trusted (the cook drops the outdated ones) - in the editor the sprites may have
+		// changed since the animation was saved, so the clip is always baked again once they load.
+		YAML::Node baked = isPacked ? data["Baked"] : YAML::Node();
+
+		if (baked)
+		{
+			AnimationClip clip;
+			clip.TextureHandle = TryDeserializeNode<u64>(baked, "TextureHandle", 0);
+
+			for (YAML::Node texCoords : baked["TexCoords"])
+				clip.TexCoords.emplace_back(texCoords.as<glm::vec4>());
+
+			for (YAML::Node end : baked["FrameEnds"])
+			{
+				const f32 duration = end.as<f32>() - clip.Length;
+
+				clip.IsUniform &= duration == 1.f;
+				clip.Length = end.as<f32>();
+				clip.FrameEnds.emplace_back(clip.Length);
+			}
+
+			if (AssetManager::IsValid(clip.TextureHandle) && !clip.TexCoords.empty() &&
+			    clip.TexCoords.size() == clip.FrameEnds.size())
+			{
+				clip.Texture = AssetManager::GetAssetRawAsync<Texture2D>(clip.TextureHandle);
+
+				animation->SetClip(std::move(clip));
+			}
 		}
 
 		return animation;
 	}
 
+	Asset* AnimationSerializer::TryLoadAsset(const AssetMetaData& metadata)
+	{
+		const std::filesystem::path path = ProjectContext::Get()->GetAssetDirectory() / metadata.Path;
+
+		return DeserializeAnimation(YAML::LoadFile(path.string()), metadata, false);
+	}
+
+	Asset* AnimationSerializer::TryLoadAssetFromMemory(const AssetMetaData& metadata, const u8* data, u64 size)
+	{
+		return DeserializeAnimation(LoadYamlFromMemory(data, size), metadata, true);
+	}
+
+	Scope<AssetLoadData> AnimationSerializer::DecodeAsset(const AssetMetaData& metadata)
+	{
+		return DecodeYamlAsset(metadata);
+	}
+
+	Asset* AnimationSerializer::FinalizeAsset(const AssetMetaData& metadata, AssetLoadData* data)
+	{
+		return data ? DeserializeAnimation(static_cast<YamlLoadData*>(data)->File, metadata, false) : nullptr;
+	}
+
 	void SoundSerializer::Serialize(const AssetMetaData& /*metadata*/)
 	{
 	}
@@ -298,6 +693,13 @@ namespace SW
 		return sound;
 	}
 
+	Asset* SoundSerializer::TryLoadAssetFromMemory(const AssetMetaData& metadata, const u8* data, u64 size)
+	{
+		Sound* sound = new Sound(metadata.Path.string(), data, size);
+
+		return sound;
+	}
+
 	void PrefabSerializer::Serialize(const AssetMetaData& metadata)
 	{
 		Prefab* prefab     = *AssetManager::GetAssetRaw<Prefab>(metadata.Handle);
@@ -330,32 +732,83 @@ namespace SW
 		fout << output.c_str();
 	}
 
-	Asset* PrefabSerializer::TryLoadAsset(const AssetMetaData& metadata)
+	/**
+	 * @brief Worker part of the prefabs - the entities are parsed into records, the prefab is built on the main thread.
+	 */
+	struct PrefabLoadData final : AssetLoadData
 	{
-		const std::filesystem::path path = ProjectContext::Get()->GetAssetDirectory() / metadata.Path;
+		bool HasPrefab   = false;
+		u64 RootEntityID = 0;
 
-		YAML::Node file = YAML::LoadFile(path.string());
+		ParsedEntities Entities;
+	};
 
-		YAML::Node data = file["Prefab"];
+	static void ParsePrefab(const YAML::Node& file, PrefabLoadData& outData)
+	{
+		const YAML::Node data = file["Prefab"];
 
 		if (!data)
+			return;
+
+		outData.HasPrefab    = true;
+		outData.RootEntityID = TryDeserializeNode<u64>(data, "RootEntityHandle", 0);
+
+		SceneSerializer::ParseEntitiesNode(data["Entities"], outData.Entities);
+	}
+
+	static Asset* CreatePrefab(PrefabLoadData& data, const AssetMetaData& metadata)
+	{
+		if (!data.HasPrefab)
 		{
-			ASSERT(false, "Error while deserializing the prefab: {}, no entities section found!", path.string());
+			ASSERT(false, "Error while deserializing the prefab: {}, no entities section found!",
+			       metadata.Path.string());
 
 			return new Prefab();
 		}
 
-		YAML::Node entities = data["Entities"];
-
 		Prefab* prefab     = new Prefab();
 		Scene* prefabScene = prefab->GetSceneRaw();
 
-		SceneSerializer::DeserializeEntitiesNode(entities, prefabScene);
+		SceneSerializer::CommitEntities(data.Entities, prefabScene);
 
-		const u64 rootHandle = TryDeserializeNode<u64>(data, "RootEntityHandle", 0);
-		prefab->SetRootEntity(prefabScene->GetEntityByID(rootHandle));
+		prefab->SetRootEntity(prefabScene->GetEntityByID(data.RootEntityID));
 
 		return prefab;
 	}
 
+	static Asset* DeserializePrefab(const YAML::Node& file, const AssetMetaData& metadata)
+	{
+		PrefabLoadData data;
+		ParsePrefab(file, data);
+
+		return CreatePrefab(data, metadata);
+	}
+
+	Asset* PrefabSerializer::TryLoadAsset(const AssetMetaData& metadata)
+	{
+		const std::filesystem::path path = ProjectContext::Get()->GetAssetDirectory() / metadata.Path;
+
+		return DeserializePrefab(YAML::LoadFile(path.string()), metadata);
+	}
+
+	Asset* PrefabSerializer::TryLoadAssetFromMemory(const AssetMetaData& metadata, const u8* data, u64 size)
+	{
+		return DeserializePrefab(LoadYamlFromMemory(data, size), metadata);
+	}
+
+	Scope<AssetLoadData> PrefabSerializer::DecodeAsset(const AssetMetaData& metadata)
+	{
+		const std::filesystem::path path = ProjectContext::Get()->GetAssetDirectory() / metadata.Path;
+
+		Scope<PrefabLoadData> data = CreateScope<PrefabLoadData>();
+		ParsePrefab(YAML::LoadFile(path.string()), *data);
+
+		return data;
+	}
+
+	Asset* PrefabSerializer::FinalizeAsset(const AssetMetaData& metadata, AssetLoadData* data)
+	{
+		return data ? CreatePrefab(*static_cast<PrefabLoadData*>(data), metadata) : nullptr;
+	}
+
 } // namespace SW
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "AssetLoader.hpp"
 #include "AssetRegistry.hpp"
 
 namespace SW
@@ -17,6 +18,30 @@ namespace SW
 		virtual void Serialize(const AssetMetaData& metadata) = 0;
 
 		virtual Asset* TryLoadAsset(const AssetMetaData& metadata) = 0;
+
+		/**
+		 * @brief Loads the asset from its cooked blob (see AssetPack) instead of the asset directory.
+		 *
+		 * @param metadata The metadata of the asset.
+		 * @param data The cooked blob, stays mapped for the whole lifetime of the runtime asset manager.
+		 * @param size The size of the blob in bytes.
+		 * @return Asset* The loaded asset.
+		 */
+		virtual Asset* TryLoadAssetFromMemory(const AssetMetaData& metadata, const u8* data, u64 size) = 0;
+
+		/**
+		 * @brief Worker part of the asynchronous load, see AssetLoader::DecodeAsset().
+		 * @note By default there is no worker part and the whole load happens in FinalizeAsset().
+		 */
+		virtual Scope<AssetLoadData> DecodeAsset(const AssetMetaData& /*metadata*/) { return nullptr; }
+
+		/**
+		 * @brief Main thread part of the asynchronous load, see AssetLoader::FinalizeAsset().
+		 */
+		virtual Asset* FinalizeAsset(const AssetMetaData& metadata, AssetLoadData* /*data*/)
+		{
+			return TryLoadAsset(metadata);
+		}
 	};
 
 	class SceneAssetSerializer final : public AssetSerializer
@@ -25,6 +50,8 @@ namespace SW
 		void Serialize(const AssetMetaData& metadata) override;
 
 		Asset* TryLoadAsset(const AssetMetaData& metadata) override;
+
+		Asset* TryLoadAssetFromMemory(const AssetMetaData& metadata, const u8* data, u64 size) override;
 	};
 
 	class Texture2DSerializer final : public AssetSerializer
@@ -33,6 +60,12 @@ namespace SW
 		void Serialize(const AssetMetaData& metadata) override;
 
 		Asset* TryLoadAsset(const AssetMetaData& metadata) override;
+
+		Asset* TryLoadAssetFromMemory(const AssetMetaData& metadata, const u8* data, u64 size) override;
+
+		Scope<AssetLoadData> DecodeAsset(const AssetMetaData& metadata) override;
+
+		Asset* FinalizeAsset(const AssetMetaData& metadata, AssetLoadData* data) override;
 	};
 
 	class SpriteSerializer final : public AssetSerializer
@@ -41,6 +74,12 @@ namespace SW
 		void Serialize(const AssetMetaData& metadata) override;
 
 		Asset* TryLoadAsset(const AssetMetaData& metadata) override;
+
+		Asset* TryLoadAssetFromMemory(const AssetMetaData& metadata, const u8* data, u64 size) override;
+
+		Scope<AssetLoadData> DecodeAsset(const AssetMetaData& metadata) override;
+
+		Asset* FinalizeAsset(const AssetMetaData& metadata, AssetLoadData* data) override;
 	};
 
 	class SpritesheetSerializer final : public AssetSerializer
@@ -49,6 +88,12 @@ namespace SW
 		void Serialize(const AssetMetaData& metadata) override;
 
 		Asset* TryLoadAsset(const AssetMetaData& metadata) override;
+
+		Asset* TryLoadAssetFromMemory(const AssetMetaData& metadata, const u8* data, u64 size) override;
+
+		Scope<AssetLoadData> DecodeAsset(const AssetMetaData& metadata) override;
+
+		Asset* FinalizeAsset(const AssetMetaData& metadata, AssetLoadData* data) override;
 	};
 
 	class FontSerializer final : public AssetSerializer
@@ -57,6 +102,8 @@ namespace SW
 		void Serialize(const AssetMetaData& metadata) override;
 
 		Asset* TryLoadAsset(const AssetMetaData& metadata) override;
+
+		Asset* TryLoadAssetFromMemory(const AssetMetaData& metadata, const u8* data, u64 size) override;
 	};
 
 	class FontSourceSerializer final : public AssetSerializer
@@ -65,6 +112,8 @@ namespace SW
 		void Serialize(const AssetMetaData& metadata) override;
 
 		Asset* TryLoadAsset(const AssetMetaData& metadata) override;
+
+		Asset* TryLoadAssetFromMemory(const AssetMetaData& metadata, const u8* data, u64 size) override;
 	};
 
 	class AnimationSerializer final : public AssetSerializer
@@ -73,6 +122,12 @@ namespace SW
 		void Serialize(const AssetMetaData& metadata) override;
 
 		Asset* TryLoadAsset(const AssetMetaData& metadata) override;
+
+		Asset* TryLoadAssetFromMemory(const AssetMetaData& metadata, const u8* data, u64 size) override;
+
+		Scope<AssetLoadData> DecodeAsset(const AssetMetaData& metadata) override;
+
+		Asset* FinalizeAsset(const AssetMetaData& metadata, AssetLoadData* data) override;
 	};
 
 	class SoundSerializer final : public AssetSerializer
@@ -81,6 +136,8 @@ namespace SW
 		void Serialize(const AssetMetaData& metadata) override;
 
 		Asset* TryLoadAsset(const AssetMetaData& metadata) override;
+
+		Asset* TryLoadAssetFromMemory(const AssetMetaData& metadata, const u8* data, u64 size) override;
 	};
 
 	class PrefabSerializer final : public AssetSerializer
@@ -89,6 +146,12 @@ namespace SW
 		void Serialize(const AssetMetaData& metadata) override;
 
 		Asset* TryLoadAsset(const AssetMetaData& metadata) override;
+
+		Asset* TryLoadAssetFromMemory(const AssetMetaData& metadata, const u8* data, u64 size) override;
+
+		Scope<AssetLoadData> DecodeAsset(const AssetMetaData& metadata) override;
+
+		Asset* FinalizeAsset(const AssetMetaData& metadata, AssetLoadData* data) override;
 	};
 
 } // namespace SW
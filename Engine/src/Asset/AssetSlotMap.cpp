@@ -0,0 +1,53 @@
+#include "AssetSlotMap.hpp"
+
+#include <atomic>
+
+namespace SW
+{
+
+	static std::atomic<u32> s_NextGeneration = 1u; // shared by all slot maps, see AssetSlotMap
+
+	static u32 NextGeneration()
+	{
+		u32 generation = s_NextGeneration.fetch_add(1, std::memory_order_relaxed);
+
+		if (generation == 0) // wrapped around, 0 marks the default constructed slots
+			generation = s_NextGeneration.fetch_add(1, std::memory_order_relaxed);
+
+		return generation;
+	}
+
+	AssetSlot AssetSlotMap::Acquire(AssetHandle handle)
+	{
+		auto [it, isInserted] = m_Indices.try_emplace(handle, (u32)m_Entries.size());
+
+		if (isInserted)
+			m_Entries.emplace_back(Entry{nullptr, NextGeneration()});
+
+		return AssetSlot{handle, it->second, m_Entries[it->second].Generation};
+	}
+
+	void AssetSlotMap::Set(AssetHandle handle, Asset* asset)
+	{
+		auto it = m_Indices.find(handle);
+
+		if (it == m_Indices.end())
+		{
+			if (!asset)
+				return; // never acquired, nothing to invalidate
+
+			it = m_Indices.try_emplace(handle, (u32)m_Entries.size()).first;
+
+			m_Entries.emplace_back();
+		}
+
+		Entry& entry = m_Entries[it->second];
+
+		if (entry.Instance == asset && entry.Generation != 0)
+			return;
+
+		entry.Instance   = asset;
+		entry.Generation = NextGeneration();
+	}
+
+} // namespace SW
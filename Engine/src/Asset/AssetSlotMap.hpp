@@ -0,0 +1,96 @@
+/**
+ * @file AssetSlotMap.hpp
+ * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
+ * @version 0.1.0
+ * @date 2024-06-03
+ *
+ * @copyright Copyright (c) 2024 Tycjan Fortuna
+ */
+#pragma once
+
+#include "Asset.hpp"
+
+namespace SW
+{
+
+	/**
+	 * @brief Resolved asset handle, cached by its holder (e.g. a component) to skip the manager lookup.
+	 *
+	 * 		  Stays valid only while the slot holds the very asset it was resolved to, loading, reloading or
+	 * 		  unloading the asset bumps the generation of the slot and the cached copies stop resolving.
+	 * @note Default constructed slot never resolves.
+	 */
+	struct AssetSlot
+	{
+		AssetHandle Handle = 0u; /**< Handle the slot was resolved for, changing the handle invalidates the cache. */
+		u32 Index          = 0u; /**< Index of the slot in the slot map. */
+		u32 Generation     = 0u; /**< Generation of the slot when it was resolved, 0 is never used. */
+	};
+
+	/**
+	 * @brief Assets of a manager in a flat array, every handle gets its slot on the first use and keeps it.
+	 *
+	 * 		  Resolving a cached AssetSlot is a single indexed load and a generation compare, compared to the
+	 * 		  virtual call and hash probe of AssetManagerBase::GetAssetRaw() followed by the Asset** dereference.
+	 * 		  Generations are unique across all slot maps, so slots cached before the project changed never resolve
+	 * 		  in the new manager.
+	 */
+	class AssetSlotMap final
+	{
+	public:
+		/**
+		 * @brief Gets the slot of the handle with its current generation, the slot is created if needed.
+		 *
+		 * @param handle The handle of the asset.
+		 * @return The slot.
+		 */
+		AssetSlot Acquire(AssetHandle handle);
+
+		/**
+		 * @brief Stores the asset in the slot of the handle. The generation is bumped if the asset changed.
+		 * @note Called by the managers whenever the asset of the handle is loaded, replaced or unloaded.
+		 *
+		 * @param handle The handle of the asset.
+		 * @param asset The asset, nullptr if unloaded.
+		 */
+		void Set(AssetHandle handle, Asset* asset);
+
+		/**
+		 * @brief Resolves the cached slot.
+		 *
+		 * @param handle The handle the slot is expected to be resolved for.
+		 * @param slot The cached slot.
+		 * @return The asset, nullptr if the slot is stale (or holds no asset) and has to be acquired again.
+		 */
+		Asset* Resolve(AssetHandle handle, const AssetSlot& slot) const
+		{
+			if (slot.Handle != handle || slot.Index >= m_Entries.size())
+				return nullptr;
+
+			const Entry& entry = m_Entries[slot.Index];
+
+			return entry.Generation == slot.Generation ? entry.Instance : nullptr;
+		}
+
+		/**
+		 * @brief Gets the number of slots.
+		 *
+		 * @return The number of slots.
+		 */
+		u64 GetSize() const { return m_Entries.size(); }
+
+	private:
+		/**
+		 * @brief Single slot, the asset and the generation it was stored with.
+		 */
+		struct Entry
+		{
+			Asset* Instance = nullptr; /**< The asset, nullptr if not loaded. */
+			u32 Generation  = 0u;      /**< Bumped on every change of the asset. */
+		};
+
+		std::vector<Entry> m_Entries;                   /**< The slots. */
+		std::unordered_map<AssetHandle, u32> m_Indices; /**< Slot index per handle, not used by Resolve(). */
+	};
+
+} // namespace SW
@@ -0,0 +1,94 @@
+#include "AsyncAssetLoader.hpp"
+
+namespace SW
+{
+
+	AsyncAssetLoader::AsyncAssetLoader(u32 workerCount)
+	{
+		for (u32 i = 0; i < workerCount; i++)
+		{
+			m_Workers.emplace_back(&AsyncAssetLoader::WorkerLoop, this);
+		}
+	}
+
+	AsyncAssetLoader::~AsyncAssetLoader()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_RequestsMutex);
+
+			m_IsStopping = true;
+		}
+
+		m_RequestsCondition.notify_all();
+
+		for (std::thread& worker : m_Workers)
+		{
+			worker.join();
+		}
+	}
+
+	void AsyncAssetLoader::Enqueue(const AssetMetaData& metadata)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_RequestsMutex);
+
+			m_Requests.emplace_back(metadata);
+		}
+
+		m_RequestsCondition.notify_one();
+	}
+
+	bool AsyncAssetLoader::TryPopDecoded(DecodedAsset& outDecoded)
+	{
+		std::lock_guard<std::mutex> lock(m_DecodedMutex);
+
+		if (m_Decoded.empty())
+			return false;
+
+		outDecoded = std::move(m_Decoded.front());
+		m_Decoded.pop_front();
+
+		return true;
+	}
+
+	u32 AsyncAssetLoader::GetQueuedCount()
+	{
+		std::lock_guard<std::mutex> lock(m_RequestsMutex);
+
+		return (u32)m_Requests.size();
+	}
+
+	void AsyncAssetLoader::WorkerLoop()
+	{
+		while (true)
+		{
+			DecodedAsset decoded;
+
+			{
+				std::unique_lock<std::mutex> lock(m_RequestsMutex);
+
+				m_RequestsCondition.wait(lock, [this]() { return m_IsStopping || !m_Requests.empty(); });
+
+				if (m_IsStopping)
+					return;
+
+				decoded.MetaData = std::move(m_Requests.front());
+				m_Requests.pop_front();
+			}
+
+			try
+			{
+				decoded.Data = AssetLoader::DecodeAsset(decoded.MetaData);
+			}
+			catch (const std::exception& e)
+			{
+				SYSTEM_ERROR("Failed to decode the asset {}: {}", decoded.MetaData.Path.string(), e.what());
+			}
+
+			std::lock_guard<std::mutex> lock(m_DecodedMutex);
+
+			m_Decoded.emplace_back(std::move(decoded));
+		}
+	}
+
+} // namespace SW
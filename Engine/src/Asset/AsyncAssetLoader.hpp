@@ -0,0 +1,92 @@
+/**
+ * @file AsyncAssetLoader.hpp
+ * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
+ * @version 0.1.0
+ * @date 2024-05-27
+ *
+ * @copyright Copyright (c) 2024 Tycjan Fortuna
+ */
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "AssetLoader.hpp"
+
+namespace SW
+{
+
+	/**
+	 * @brief Result of the worker part of an asynchronous load.
+	 */
+	struct DecodedAsset
+	{
+		AssetMetaData MetaData;    /**< The metadata of the asset. */
+		Scope<AssetLoadData> Data; /**< The decoded data, nullptr if decoding failed or is not needed. */
+	};
+
+	/**
+	 * @brief Pool of worker threads running the worker part (AssetLoader::DecodeAsset) of asynchronous loads.
+	 * 		  Decoded assets are queued and picked up by the main thread, which finishes the load.
+	 */
+	class AsyncAssetLoader final
+	{
+	public:
+		/**
+		 * @brief Starts the worker threads.
+		 *
+		 * @param workerCount Number of the worker threads.
+		 */
+		explicit AsyncAssetLoader(u32 workerCount);
+
+		/**
+		 * @brief Stops the worker threads, not yet decoded requests are dropped.
+		 */
+		~AsyncAssetLoader();
+
+		AsyncAssetLoader(const AsyncAssetLoader&)            = delete;
+		AsyncAssetLoader& operator=(const AsyncAssetLoader&) = delete;
+
+		/**
+		 * @brief Queues the asset for decoding.
+		 *
+		 * @param metadata The metadata of the asset (copied).
+		 */
+		void Enqueue(const AssetMetaData& metadata);
+
+		/**
+		 * @brief Takes the oldest decoded asset.
+		 * @warning Must be called on the main thread.
+		 *
+		 * @param outDecoded The decoded asset.
+		 * @return Whether any decoded asset was available.
+		 */
+		bool TryPopDecoded(DecodedAsset& outDecoded);
+
+		/**
+		 * @brief Number of requests waiting for a worker.
+		 *
+		 * @return u32 The number of requests.
+		 */
+		u32 GetQueuedCount();
+
+	private:
+		std::vector<std::thread> m_Workers; /**< The worker threads. */
+
+		std::deque<AssetMetaData> m_Requests;        /**< Assets waiting for a worker. */
+		std::mutex m_RequestsMutex;                  /**< Guards m_Requests and m_IsStopping. */
+		std::condition_variable m_RequestsCondition; /**< Wakes the workers up. */
+		bool m_IsStopping = false;                   /**< Whether the workers should exit. */
+
+		std::deque<DecodedAsset> m_Decoded; /**< Assets waiting for the main thread. */
+		std::mutex m_DecodedMutex;          /**< Guards m_Decoded. */
+
+		/**
+		 * @brief Body of every worker thread.
+		 */
+		void WorkerLoop();
+	};
+
+} // namespace SW
@@ -2,86 +2,130 @@
 
 #include "Core/OpenGL/Texture2D.hpp"
 #include "Core/Project/ProjectContext.hpp"
+#include "Core/Utils/MappedFile.hpp"
 
 namespace SW
 {
 
-	Texture2D* FontCache::TryGetCachedAtlas(AssetHandle handle, Timestamp lastModified)
+	static_assert(sizeof(FontCacheHeader) == 64, "Font cache header layout changed, bump FontCache::Version!");
+	static_assert(sizeof(FontGlyph) == 40, "Font glyph layout changed, bump FontCache::Version!");
+	static_assert(sizeof(FontKerning) == 12, "Font kerning layout changed, bump FontCache::Version!");
+
+	Font* FontCache::TryGetCachedFont(AssetHandle handle, u64 contentHash)
 	{
-		const std::filesystem::path cachePath = ProjectContext::Get()->GetAssetDirectory() / "cache" / "fonts";
+		PROFILE_FUNCTION();
 
-		for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(cachePath))
-		{
-			const std::filesystem::path& filepath = entry.path();
-			const std::string& filename           = filepath.filename().string();
+		if (contentHash == 0)
+			return nullptr;
 
-			const std::string handleStr = filename.substr(0, filename.find("_"));
-			const std::string modTimeStr =
-			    filename.substr(filename.find("_") + 1, filename.find(".cache") - filename.find("_") - 1);
+		const std::filesystem::path cachePath = GetCachePath(handle);
 
-			const u64 itemHandle = std::stoull(handleStr);
-			const u64 modTime    = std::stoull(modTimeStr);
+		if (!std::filesystem::exists(cachePath))
+			return nullptr;
 
-			if (itemHandle == handle)
-			{
+		MappedFile file;
 
-				if (modTime == lastModified)
-				{
-					std::ifstream file(filepath, std::ios::binary);
+		if (!file.Open(cachePath))
+			return nullptr;
 
-					ASSERT(file.is_open());
+		const u8* data = file.GetData();
+		const u64 size = file.GetSize();
 
-					i32 width, height, channels;
-					file.read(reinterpret_cast<char*>(&width), sizeof(i32));
-					file.read(reinterpret_cast<char*>(&height), sizeof(i32));
-					file.read(reinterpret_cast<char*>(&channels), sizeof(i32));
+		FontCacheHeader header = {};
 
-					char* data = new char[width * height * channels];
-					file.read(data, width * height * channels);
-					file.close();
+		if (size >= sizeof(FontCacheHeader))
+			std::memcpy(&header, data, sizeof(FontCacheHeader));
 
-					TextureSpecification spec;
-					spec.Height = height;
-					spec.Width  = width;
-					spec.Format = channels == 3 ? ImageFormat::RGB8 : ImageFormat::RGBA8;
+		if (header.Magic != Magic || header.Version != Version || header.ContentHash != contentHash)
+			return nullptr; // outdated, overwritten once the font is generated again
 
-					Texture2D* texture = new Texture2D(spec);
-					texture->SetData(data, width * height * channels);
-					delete[] data;
+		const u64 glyphsSize  = (u64)header.GlyphCount * sizeof(FontGlyph);
+		const u64 kerningSize = (u64)header.KerningCount * sizeof(FontKerning);
+		const u64 pixelsSize  = (u64)header.AtlasWidth * (u64)header.AtlasHeight * (u64)header.AtlasChannels;
 
-					return texture;
-				}
-				else
-				{
-					std::filesystem::remove(filepath);
-				}
+		const bool hasValidAtlas = header.AtlasWidth > 0 && header.AtlasHeight > 0 &&
+		                           (header.AtlasChannels == 3 || header.AtlasChannels == 4);
 
-				break;
-			}
+		if (!hasValidAtlas || sizeof(FontCacheHeader) + glyphsSize + kerningSize + pixelsSize != size)
+		{
+			SYSTEM_WARN("Font cache {} is corrupted, the font will be generated again.", cachePath);
+			return nullptr;
 		}
 
-		return nullptr;
+		const u8* glyphs  = data + sizeof(FontCacheHeader);
+		const u8* kerning = glyphs + glyphsSize;
+		const u8* pixels  = kerning + kerningSize;
+
+		std::vector<FontGlyph> fontGlyphs(header.GlyphCount);
+		std::memcpy(fontGlyphs.data(), glyphs, glyphsSize);
+
+		std::vector<FontKerning> fontKerning(header.KerningCount);
+		std::memcpy(fontKerning.data(), kerning, kerningSize);
+
+		TextureSpecification spec;
+		spec.Width  = (u32)header.AtlasWidth;
+		spec.Height = (u32)header.AtlasHeight;
+		spec.Format = header.AtlasChannels == 3 ? ImageFormat::RGB8 : ImageFormat::RGBA8;
+
+		Texture2D* atlas = new Texture2D(spec);
+		atlas->SetData((void*)pixels, (u32)pixelsSize);
+
+		return new Font(header.Metrics, std::move(fontGlyphs), std::move(fontKerning), atlas);
 	}
 
-	void FontCache::CacheAtlas(const Texture2D* atlas, AssetHandle handle, Timestamp lastModified)
+	void FontCache::CacheFont(const Font* font, AssetHandle handle, u64 contentHash)
 	{
-		const std::filesystem::path cachePath = ProjectContext::Get()->GetAssetDirectory() / "cache" / "fonts";
-		const std::string newFilename         = std::to_string(handle) + "_" + std::to_string(lastModified) + ".cache";
+		PROFILE_FUNCTION();
+
+		if (contentHash == 0)
+			return;
 
-		std::ofstream file(cachePath / newFilename, std::ios::binary | std::ios::trunc);
+		const std::filesystem::path cachePath = GetCachePath(handle);
 
-		ASSERT(file.is_open());
+		std::ofstream file(cachePath, std::ios::binary | std::ios::trunc);
 
-		i32 width         = atlas->GetWidth();
-		i32 height        = atlas->GetHeight();
-		i32 channels      = atlas->GetChannels();
-		const char* bytes = atlas->GetBytes();
+		if (!file)
+		{
+			SYSTEM_ERROR("Failed to create the font cache {}", cachePath);
+			return;
+		}
+
+		const Texture2D* atlas                  = font->GetAtlasTexture();
+		const std::vector<u8> pixels            = atlas->GetBytes();
+		const std::vector<FontGlyph>& glyphs    = font->GetGlyphs();
+		const std::vector<FontKerning>& kerning = font->GetKerning();
+
+		FontCacheHeader header = {};
+		header.Magic           = Magic;
+		header.Version         = Version;
+		header.ContentHash     = contentHash;
+		header.GlyphCount      = (u32)glyphs.size();
+		header.KerningCount    = (u32)kerning.size();
+		header.AtlasWidth      = atlas->GetWidth();
+		header.AtlasHeight     = atlas->GetHeight();
+		header.AtlasChannels   = (i32)(pixels.size() / ((u64)atlas->GetWidth() * (u64)atlas->GetHeight()));
+		header.Metrics         = font->GetMetrics();
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(FontCacheHeader));
+		file.write(reinterpret_cast<const char*>(glyphs.data()), (std::streamsize)(glyphs.size() * sizeof(FontGlyph)));
+		file.write(reinterpret_cast<const char*>(kerning.data()),
+		           (std::streamsize)(kerning.size() * sizeof(FontKerning)));
+		file.write(reinterpret_cast<const char*>(pixels.data()), (std::streamsize)pixels.size());
+
+		if (!file)
+		{
+			SYSTEM_ERROR("Failed to write the font cache {}", cachePath);
+
+			file.close();
+			std::filesystem::remove(cachePath);
+		}
+	}
+
+	std::filesystem::path FontCache::GetCachePath(AssetHandle handle)
+	{
+		const std::filesystem::path cacheDirectory = ProjectContext::Get()->GetAssetDirectory() / "cache" / "fonts";
 
-		file.write(reinterpret_cast<const char*>(&width), sizeof(i32));
-		file.write(reinterpret_cast<const char*>(&height), sizeof(i32));
-		file.write(reinterpret_cast<const char*>(&channels), sizeof(i32));
-		file.write(bytes, width * height * channels);
-		file.close();
+		return cacheDirectory / (std::to_string(handle) + ".sw_cache");
 	}
 
 } // namespace SW
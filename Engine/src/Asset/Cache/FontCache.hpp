@@ -1,49 +1,79 @@
 /**
  * @file FontCache.hpp
  * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
- * @version 0.1.1
+ * @version 0.1.4
  * @date 2024-04-07
  *
  * @copyright Copyright (c) 2024 Tycjan Fortuna
  */
 #pragma once
 
+#include "Asset/Font.hpp"
+
 namespace SW
 {
 
-	class Texture2D;
+	/**
+	 * @brief Header at the beginning of every font cache file.
+	 */
+	struct FontCacheHeader
+	{
+		u32 Magic;           /**< Must be equal to FontCache::Magic. */
+		u32 Version;         /**< Must be equal to FontCache::Version. */
+		u64 ContentHash;     /**< Content hash of the font asset and its source the cache was made from. */
+		u32 GlyphCount;      /**< Number of glyphs following the header. */
+		u32 KerningCount;    /**< Number of kerning pairs following the glyphs. */
+		i32 AtlasWidth;      /**< Width of the atlas. */
+		i32 AtlasHeight;     /**< Height of the atlas. */
+		i32 AtlasChannels;   /**< Number of channels of the atlas, its pixels follow the kerning pairs. */
+		u32 Reserved;        /**< Padding, always 0. */
+		FontMetrics Metrics; /**< Vertical metrics of the font. */
+	};
 
 	/**
-	 * @brief The FontCache class provides functionality for caching font atlases.
+	 * @brief The FontCache class provides functionality for caching generated fonts, so a warm load touches neither
+	 * 		  FreeType nor the atlas packer.
 	 */
 	class FontCache
 	{
 	public:
-		using Timestamp   = u64;
 		using AssetHandle = u64;
 
+		static constexpr u32 Magic   = 0x43465753; /**< "SWFC" */
+		static constexpr u32 Version = 2;          /**< Current version of the format. */
+
 		/**
-		 * @brief Tries to retrieve a cached atlas texture based on the provided handle and last modified timestamp.
+		 * @brief Tries to load the cached font based on the provided handle and content hash.
+		 * 		  Keyed by the contents, so a touched or copied font asset still hits the cache.
 		 * @warning The caller is responsible for managing its lifetime. Must be deleted when no longer needed.
 		 *
-		 * @param handle The handle of the font atlas.
-		 * @param lastModified The last modified timestamp of the font atlas.
-		 * @return A pointer to the cached atlas texture if it exists, nullptr otherwise.
+		 * @param handle The handle of the font asset.
+		 * @param contentHash The content hash of the font asset and its source, 0 if unknown (never cached).
+		 * @return A pointer to the cached font if it exists and is up to date, nullptr otherwise.
 		 */
-		static Texture2D* TryGetCachedAtlas(AssetHandle handle, Timestamp lastModified);
+		static Font* TryGetCachedFont(AssetHandle handle, u64 contentHash);
 
 		/**
-		 * @brief Caches the provided atlas texture with the given handle and last modified timestamp.
+		 * @brief Caches the glyphs, the kerning and the atlas of the font.
 		 * @note Cache is stored in the project's asset directory / cache / fonts.
-		 * 		 The cache file is named as follows: [handle]_[lastModified].cache
-		 * 		 The cache file contains the width, height, channels, and pixel data of the atlas texture.
-		 * 		 The cache file is in binary format.
+		 * 		 The cache file is named as follows: [handle].sw_cache, so a lookup opens it directly.
+		 * 		 Layout: header, glyphs, kerning pairs, atlas pixels.
+		 * @warning Reads the atlas back from the GPU.
+		 *
+		 * @param font The font to be cached.
+		 * @param handle The handle of the font asset.
+		 * @param contentHash The content hash of the font asset and its source, 0 if unknown (never cached).
+		 */
+		static void CacheFont(const Font* font, AssetHandle handle, u64 contentHash);
+
+	private:
+		/**
+		 * @brief Gets the path of the cache file of the font.
 		 *
-		 * @param atlas The atlas texture to be cached.
-		 * @param handle The handle of the font atlas.
-		 * @param lastModified The last modified timestamp of the font atlas.
+		 * @param handle The handle of the font asset.
+		 * @return The path of the cache file.
 		 */
-		static void CacheAtlas(const Texture2D* atlas, AssetHandle handle, Timestamp lastModified);
+		static std::filesystem::path GetCachePath(AssetHandle handle);
 	};
 
 } // namespace SW
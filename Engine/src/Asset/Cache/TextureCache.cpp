@@ -0,0 +1,399 @@
+#include "TextureCache.hpp"
+
+#include <algorithm>
+#include <thread>
+
+#include "Core/Project/ProjectContext.hpp"
+#include "Core/Utils/BlockCompression.hpp"
+#include "Core/Utils/LZ4.hpp"
+#include "Core/Utils/MappedFile.hpp"
+
+namespace SW
+{
+
+	static_assert(sizeof(CookedTextureHeader) == 24, "Cooked texture header changed, bump TextureCache::Version!");
+	static_assert(sizeof(CookedTextureLevel) == 32, "Cooked texture level changed, bump TextureCache::Version!");
+
+	static constexpr u32 MaxLevelCount = 32; // enough for any texture size representable by i32
+
+	static std::vector<u8> ExpandToRGBA(const u8* pixels, i32 width, i32 height, i32 channels)
+	{
+		const u64 pixelCount = (u64)width * (u64)height;
+
+		std::vector<u8> rgba(pixelCount * 4);
+
+		for (u64 i = 0; i < pixelCount; i++)
+		{
+			const u8* source = pixels + i * channels;
+			u8* target       = rgba.data() + i * 4;
+
+			switch (channels)
+			{
+			case 1:
+			case 2: {
+				target[0] = target[1] = target[2] = source[0];
+				target[3]                         = channels == 2 ? source[1] : 255;
+				break;
+			}
+			case 3: {
+				std::memcpy(target, source, 3);
+				target[3] = 255;
+				break;
+			}
+			default: {
+				std::memcpy(target, source, 4);
+				break;
+			}
+			}
+		}
+
+		return rgba;
+	}
+
+	// Colors are weighted by alpha, so fully transparent pixels do not bleed into the edges of sprites.
+	static void Downsample(const u8* source, i32 width, i32 height, u8* target, i32 targetWidth, i32 targetHeight)
+	{
+		for (i32 y = 0; y < targetHeight; y++)
+		{
+			const i32 rows[2] = {std::min(y * 2, height - 1), std::min(y * 2 + 1, height - 1)};
+
+			for (i32 x = 0; x < targetWidth; x++)
+			{
+				const i32 columns[2] = {std::min(x * 2, width - 1), std::min(x * 2 + 1, width - 1)};
+
+				u32 alphaSum      = 0;
+				u32 weighted[3]   = {};
+				u32 unweighted[3] = {};
+
+				for (i32 row : rows)
+				{
+					for (i32 column : columns)
+					{
+						const u8* pixel = source + ((u64)row * width + column) * 4;
+
+						for (i32 i = 0; i < 3; i++)
+						{
+							weighted[i] += (u32)pixel[i] * pixel[3];
+							unweighted[i] += pixel[i];
+						}
+
+						alphaSum += pixel[3];
+					}
+				}
+
+				u8* result = target + ((u64)y * targetWidth + x) * 4;
+
+				for (i32 i = 0; i < 3; i++)
+					result[i] = (u8)(alphaSum ? (weighted[i] + alphaSum / 2) / alphaSum : (unweighted[i] + 2) / 4);
+
+				result[3] = (u8)((alphaSum + 2) / 4);
+			}
+		}
+	}
+
+	static bool IsCookedFormat(ImageFormat format)
+	{
+		return format == ImageFormat::RGBA8 || format == ImageFormat::BC1 || format == ImageFormat::BC3;
+	}
+
+	static bool IsCookedWith(ImageFormat format, TextureCompressionMode mode)
+	{
+		if (mode == TextureCompressionMode::BC)
+			return format == ImageFormat::BC1 || format == ImageFormat::BC3;
+
+		return format == ImageFormat::RGBA8;
+	}
+
+	static u64 GetLevelSize(ImageFormat format, i32 width, i32 height)
+	{
+		switch (format)
+		{
+		case ImageFormat::BC1:
+			return BlockCompression::GetCompressedSize(width, height, BlockCompression::BC1BlockSize);
+		case ImageFormat::BC3:
+			return BlockCompression::GetCompressedSize(width, height, BlockCompression::BC3BlockSize);
+		default:
+			return (u64)width * (u64)height * 4;
+		}
+	}
+
+	CookedTexture TextureCache::Cook(const u8* pixels, i32 width, i32 height, i32 channels,
+	                                 TextureCompressionMode mode)
+	{
+		PROFILE_FUNCTION();
+
+		std::vector<u8> level = ExpandToRGBA(pixels, width, height, channels);
+
+		bool hasAlpha = false;
+
+		for (u64 i = 3; i < level.size() && !hasAlpha; i += 4)
+			hasAlpha = level[i] != 255;
+
+		CookedTexture texture;
+		texture.Format = mode == TextureCompressionMode::None ? ImageFormat::RGBA8
+		                 : hasAlpha                           ? ImageFormat::BC3
+		                                                      : ImageFormat::BC1;
+
+		std::vector<u8> nextLevel;
+
+		while (true)
+		{
+			TextureMipLevel mip;
+			mip.Width  = width;
+			mip.Height = height;
+			mip.Offset = texture.Data.size();
+			mip.Size   = GetLevelSize(texture.Format, width, height);
+
+			texture.Data.resize(mip.Offset + mip.Size);
+
+			u8* data = texture.Data.data() + mip.Offset;
+
+			if (texture.Format == ImageFormat::BC1)
+				BlockCompression::EncodeBC1(level.data(), width, height, data);
+			else if (texture.Format == ImageFormat::BC3)
+				BlockCompression::EncodeBC3(level.data(), width, height, data);
+			else
+				std::memcpy(data, level.data(), mip.Size);
+
+			texture.Levels.emplace_back(mip);
+
+			if (width == 1 && height == 1)
+				break;
+
+			const i32 nextWidth  = std::max(width / 2, 1);
+			const i32 nextHeight = std::max(height / 2, 1);
+
+			nextLevel.resize((u64)nextWidth * nextHeight * 4);
+			Downsample(level.data(), width, height, nextLevel.data(), nextWidth, nextHeight);
+
+			level.swap(nextLevel);
+			width  = nextWidth;
+			height = nextHeight;
+		}
+
+		return texture;
+	}
+
+	std::vector<u8> TextureCache::Serialize(const CookedTexture& texture, u64 contentHash)
+	{
+		PROFILE_FUNCTION();
+
+		const u64 tableSize = texture.Levels.size() * sizeof(CookedTextureLevel);
+
+		std::vector<u8> data(sizeof(CookedTextureHeader) + tableSize);
+		std::vector<CookedTextureLevel> levels;
+
+		for (const TextureMipLevel& mip : texture.Levels)
+		{
+			const u8* pixels = texture.Data.data() + mip.Offset;
+			const u64 offset = data.size();
+			const u64 bound  = LZ4::GetMaxCompressedSize(mip.Size);
+
+			data.resize(offset + bound);
+
+			u64 packedSize = LZ4::Compress(pixels, mip.Size, data.data() + offset, bound);
+
+			if (packedSize == 0 || packedSize >= mip.Size) // e.g. noise, stored as it is
+			{
+				std::memcpy(data.data() + offset, pixels, mip.Size);
+				packedSize = mip.Size;
+			}
+
+			data.resize(offset + packedSize);
+
+			CookedTextureLevel level = {};
+			level.Width              = mip.Width;
+			level.Height             = mip.Height;
+			level.Offset             = offset;
+			level.PackedSize         = packedSize;
+			level.Size               = mip.Size;
+
+			levels.emplace_back(level);
+		}
+
+		CookedTextureHeader header = {};
+		header.Magic               = Magic;
+		header.Version             = Version;
+		header.ContentHash         = contentHash;
+		header.Format              = texture.Format;
+		header.LevelCount          = (u32)levels.size();
+
+		std::memcpy(data.data(), &header, sizeof(CookedTextureHeader));
+		std::memcpy(data.data() + sizeof(CookedTextureHeader), levels.data(), tableSize);
+
+		return data;
+	}
+
+	bool TextureCache::IsCookedTexture(const u8* data, u64 size)
+	{
+		if (size < sizeof(CookedTextureHeader))
+			return false;
+
+		CookedTextureHeader header;
+		std::memcpy(&header, data, sizeof(CookedTextureHeader));
+
+		return header.Magic == Magic && header.Version == Version;
+	}
+
+	bool TextureCache::Deserialize(const u8* data, u64 size, CookedTexture& outTexture)
+	{
+		PROFILE_FUNCTION();
+
+		if (!IsCookedTexture(data, size))
+			return false;
+
+		CookedTextureHeader header;
+		std::memcpy(&header, data, sizeof(CookedTextureHeader));
+
+		const u64 tableSize = (u64)header.LevelCount * sizeof(CookedTextureLevel);
+
+		if (!IsCookedFormat(header.Format) || header.LevelCount == 0 || header.LevelCount > MaxLevelCount ||
+		    tableSize > size - sizeof(CookedTextureHeader))
+			return false;
+
+		outTexture.Format = header.Format;
+		outTexture.Levels.clear();
+		outTexture.Data.clear();
+
+		for (u32 i = 0; i < header.LevelCount; i++)
+		{
+			CookedTextureLevel level;
+			std::memcpy(&level, data + sizeof(CookedTextureHeader) + i * sizeof(CookedTextureLevel),
+			            sizeof(CookedTextureLevel));
+
+			const bool hasValidSize = level.Width > 0 && level.Height > 0 &&
+			                          level.Size == GetLevelSize(header.Format, level.Width, level.Height);
+			const bool inBounds = level.Offset <= size && level.PackedSize <= size - level.Offset;
+
+			if (!hasValidSize || !inBounds || level.PackedSize > level.Size)
+				return false;
+
+			TextureMipLevel mip;
+			mip.Width  = level.Width;
+			mip.Height = level.Height;
+			mip.Offset = outTexture.Data.size();
+			mip.Size   = level.Size;
+
+			outTexture.Data.resize(mip.Offset + mip.Size);
+
+			u8* pixels = outTexture.Data.data() + mip.Offset;
+
+			if (level.PackedSize == level.Size)
+				std::memcpy(pixels, data + level.Offset, level.Size);
+			else if (!LZ4::Decompress(data + level.Offset, level.PackedSize, pixels, level.Size))
+				return false;
+
+			outTexture.Levels.emplace_back(mip);
+		}
+
+		return true;
+	}
+
+	bool TextureCache::TryLoad(AssetHandle handle, u64 contentHash, TextureCompressionMode mode,
+	                           CookedTexture& outTexture)
+	{
+		PROFILE_FUNCTION();
+
+		if (contentHash == 0)
+			return false;
+
+		const std::filesystem::path cachePath = GetCachePath(handle);
+
+		if (!std::filesystem::exists(cachePath))
+			return false;
+
+		MappedFile file;
+
+		if (!file.Open(cachePath) || !IsCookedTexture(file.GetData(), file.GetSize()))
+			return false;
+
+		CookedTextureHeader header;
+		std::memcpy(&header, file.GetData(), sizeof(CookedTextureHeader));
+
+		if (header.ContentHash != contentHash || !IsCookedWith(header.Format, mode))
+			return false; // outdated, overwritten once the texture is cooked again
+
+		if (!Deserialize(file.GetData(), file.GetSize(), outTexture))
+		{
+			SYSTEM_WARN("Texture cache {} is corrupted, the texture will be cooked again.", cachePath);
+			return false;
+		}
+
+		return true;
+	}
+
+	void TextureCache::Store(AssetHandle handle, u64 contentHash, const CookedTexture& texture)
+	{
+		PROFILE_FUNCTION();
+
+		if (contentHash == 0)
+			return;
+
+		const std::filesystem::path cachePath = GetCachePath(handle);
+		const std::vector<u8> data            = Serialize(texture, contentHash);
+
+		// Decodes of the same texture may overlap and another worker may have the cache mapped - every writer gets
+		// its own temporary file which replaces the cache in one step.
+		std::filesystem::path temporaryPath = cachePath;
+		temporaryPath += std::format(".{}.tmp", std::hash<std::thread::id>()(std::this_thread::get_id()));
+
+		{
+			std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+
+			if (!file)
+			{
+				SYSTEM_ERROR("Failed to create the texture cache {}", temporaryPath);
+				return;
+			}
+
+			file.write(reinterpret_cast<const char*>(data.data()), (std::streamsize)data.size());
+
+			if (!file)
+			{
+				SYSTEM_ERROR("Failed to write the texture cache {}", temporaryPath);
+
+				file.close();
+				std::filesystem::remove(temporaryPath);
+
+				return;
+			}
+		}
+
+		std::error_code error;
+		std::filesystem::rename(temporaryPath, cachePath, error);
+
+		if (error)
+		{
+			SYSTEM_WARN("Failed to replace the texture cache {}: {}", cachePath, error.message());
+
+			std::filesystem::remove(temporaryPath, error);
+		}
+	}
+
+	const char* TextureCache::GetStringifiedCompressionMode(TextureCompressionMode mode)
+	{
+		switch (mode)
+		{
+		case TextureCompressionMode::BC:
+			return "BC";
+		default:
+			return "None";
+		}
+	}
+
+	TextureCompressionMode TextureCache::GetCompressionModeFromStringified(const std::string& mode)
+	{
+		if (mode == "BC")
+			return TextureCompressionMode::BC;
+
+		return TextureCompressionMode::None;
+	}
+
+	std::filesystem::path TextureCache::GetCachePath(AssetHandle handle)
+	{
+		const std::filesystem::path cacheDirectory = ProjectContext::Get()->GetAssetDirectory() / "cache" / "textures";
+
+		return cacheDirectory / (std::to_string(handle) + ".sw_texture");
+	}
+
+} // namespace SW
@@ -0,0 +1,151 @@
+/**
+ * @file TextureCache.hpp
+ * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
+ * @version 0.1.1
+ * @date 2024-06-03
+ *
+ * @copyright Copyright (c) 2024 Tycjan Fortuna
+ */
+#pragma once
+
+#include "Core/OpenGL/Texture2D.hpp"
+
+namespace SW
+{
+
+	/**
+	 * @brief How the textures of a project are cooked.
+	 */
+	enum class TextureCompressionMode : u32
+	{
+		None = 0, /**< RGBA8 mip levels, lossless. */
+		BC        /**< BC1 mip levels for opaque textures, BC3 for textures with alpha. */
+	};
+
+	/**
+	 * @brief Texture ready to be uploaded - pre-flipped, with the whole mip chain.
+	 */
+	struct CookedTexture
+	{
+		ImageFormat Format = ImageFormat::None; /**< RGBA8, BC1 or BC3. */
+		std::vector<TextureMipLevel> Levels;    /**< The mip levels, the first one is the full size texture. */
+		std::vector<u8> Data;                   /**< Pixels (or blocks) of all levels. */
+	};
+
+	/**
+	 * @brief Header at the beginning of every cooked texture.
+	 */
+	struct CookedTextureHeader
+	{
+		u32 Magic;          /**< Must be equal to TextureCache::Magic. */
+		u32 Version;        /**< Must be equal to TextureCache::Version. */
+		u64 ContentHash;    /**< Content hash of the source image, 0 if unknown. */
+		ImageFormat Format; /**< Format of the levels. */
+		u32 LevelCount;     /**< Number of levels following the header. */
+	};
+
+	/**
+	 * @brief Single level of a cooked texture.
+	 */
+	struct CookedTextureLevel
+	{
+		i32 Width;      /**< The width of the level. */
+		i32 Height;     /**< The height of the level. */
+		u64 Offset;     /**< Offset of the payload from the beginning of the cooked texture. */
+		u64 PackedSize; /**< Size of the payload, equal to Size if it is stored uncompressed. */
+		u64 Size;       /**< Size of the pixels (or blocks) of the level. */
+	};
+
+	/**
+	 * @brief The TextureCache class cooks textures into a format uploaded as it is - no image decoding, no mipmap
+	 * 		  generation on the GPU, optionally block compressed. Cooked textures are stored in the project's cache
+	 * 		  (editor) and in the asset pack (shipped games).
+	 *
+	 * 		  Layout: header, levels, LZ4 compressed payloads of the levels.
+	 */
+	class TextureCache
+	{
+	public:
+		using AssetHandle = u64;
+
+		static constexpr u32 Magic   = 0x58545753; /**< "SWTX" */
+		static constexpr u32 Version = 1;          /**< Current version of the format. */
+
+		/**
+		 * @brief Cooks the decoded image. Alpha weighted box filter builds the mip chain.
+		 *
+		 * @param pixels The decoded pixels, already flipped for OpenGL.
+		 * @param width The width of the image.
+		 * @param height The height of the image.
+		 * @param channels Number of channels of the pixels (1 to 4), grey images are expanded to RGBA.
+		 * @param mode How the levels are stored.
+		 * @return The cooked texture.
+		 */
+		static CookedTexture Cook(const u8* pixels, i32 width, i32 height, i32 channels, TextureCompressionMode mode);
+
+		/**
+		 * @brief Serializes the cooked texture, every level is LZ4 compressed unless it does not get smaller.
+		 *
+		 * @param texture The cooked texture.
+		 * @param contentHash The content hash of the source image, 0 if unknown.
+		 * @return The serialized texture.
+		 */
+		static std::vector<u8> Serialize(const CookedTexture& texture, u64 contentHash);
+
+		/**
+		 * @brief Checks whether the data starts with the header of a cooked texture.
+		 *
+		 * @param data The data.
+		 * @param size The size of the data in bytes.
+		 * @return True if the data is a cooked texture of the current version.
+		 */
+		static bool IsCookedTexture(const u8* data, u64 size);
+
+		/**
+		 * @brief Deserializes the cooked texture, the levels are validated against the size of the data.
+		 *
+		 * @param data The serialized texture.
+		 * @param size The size of the serialized texture in bytes.
+		 * @param outTexture The cooked texture.
+		 * @return Whether the operation was successful.
+		 */
+		static bool Deserialize(const u8* data, u64 size, CookedTexture& outTexture);
+
+		/**
+		 * @brief Tries to load the cooked texture of the asset from the cache.
+		 * @note Safe to call from worker threads.
+		 *
+		 * @param handle The handle of the texture asset.
+		 * @param contentHash The content hash of the source image, 0 if unknown (never cached).
+		 * @param mode The compression mode of the project, textures cooked with another one are outdated.
+		 * @param outTexture The cooked texture.
+		 * @return Whether the cache exists and is up to date.
+		 */
+		static bool TryLoad(AssetHandle handle, u64 contentHash, TextureCompressionMode mode,
+		                    CookedTexture& outTexture);
+
+		/**
+		 * @brief Stores the cooked texture of the asset in the cache.
+		 * @note Cache is stored in the project's asset directory / cache / textures as [handle].sw_texture.
+		 * 		 Safe to call from worker threads, the file is written aside and renamed over the previous one.
+		 *
+		 * @param handle The handle of the texture asset.
+		 * @param contentHash The content hash of the source image, 0 if unknown (never cached).
+		 * @param texture The cooked texture.
+		 */
+		static void Store(AssetHandle handle, u64 contentHash, const CookedTexture& texture);
+
+		static const char* GetStringifiedCompressionMode(TextureCompressionMode mode);
+		static TextureCompressionMode GetCompressionModeFromStringified(const std::string& mode);
+
+	private:
+		/**
+		 * @brief Gets the path of the cache file of the texture.
+		 *
+		 * @param handle The handle of the texture asset.
+		 * @return The path of the cache file.
+		 */
+		static std::filesystem::path GetCachePath(AssetHandle handle);
+	};
+
+} // namespace SW
@@ -1,10 +1,11 @@
 #include "ThumbnailCache.hpp"
 
+#include <algorithm>
+
 #include "Asset/AssetManager.hpp"
 #include "Asset/Font.hpp"
 #include "Core/OpenGL/Texture2D.hpp"
 #include "Core/Project/ProjectContext.hpp"
-#include "Core/Utils/FileSystem.hpp"
 #include "Core/Utils/SerializationUtils.hpp"
 
 namespace SW
@@ -19,173 +20,67 @@ namespace SW
 	}
 
 	Texture2D** ThumbnailCache::GetTextureThumbnail(const std::filesystem::path& itemPath, AssetHandle handle,
-	                                                Timestamp lastModified)
+	                                                u64 contentHash)
 	{
 		auto it = m_Thumbnails.find(handle);
 
-		/*
-		  Process:
-		    - Check if the thumbnail was already loaded into the cache.
-		        - If yes:
-		            - Check if the last modified timestamp has changed since the thumbnail was loaded.
-		                - If the timestamp has changed, it means the original asset has been modified, so we need to
-		  reload the thumbnail.
-		                - If the timestamp has not changed, we can return the cached thumbnail as it is still
-		  up-to-date.
-		        - If no:
-		            - The thumbnail has not been loaded into the cache yet. We need to load the thumbnail from the asset
-		  source, resize it to the appropriate dimensions for a thumbnail, and then save it into the cache.
-		            - We also need to save the last modified timestamp of the original asset with the thumbnail in the
-		  cache, so we can check if the thumbnail is up-to-date the next time it is requested.
-		*/
-
-		const std::filesystem::path cachePath = ProjectContext::Get()->GetAssetDirectory() / "cache" / "thumbnails";
-
-		if (it != m_Thumbnails.end())
-		{
-			ThumbnailCacheData& data = it->second;
-
-			if (data.LastModified == lastModified)
-				return &data.Texture;
-
-			const std::string oldFilename = std::to_string(handle) + "_" + std::to_string(data.LastModified) + ".cache";
-
-			std::filesystem::remove(cachePath / oldFilename);
-
-			return LoadAndCacheTexture(itemPath, cachePath, handle, lastModified);
-		}
-
-		for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(cachePath))
-		{
-			const std::filesystem::path& filepath = entry.path();
-			const std::string& filename           = filepath.filename().string();
-
-			const std::string handleStr = filename.substr(0, filename.find("_"));
-			const std::string modTimeStr =
-			    filename.substr(filename.find("_") + 1, filename.find(".cache") - filename.find("_") - 1);
-
-			const u64 itemHandle = std::stoull(handleStr);
-			const u64 modTime    = std::stoull(modTimeStr);
-
-			if (itemHandle == handle)
-			{
-
-				if (modTime == lastModified)
-				{
-					std::ifstream file(filepath, std::ios::binary);
-
-					ASSERT(file.is_open());
+		if (it != m_Thumbnails.end() && it->second.ContentHash == contentHash)
+			return &it->second.Texture;
 
-					i32 width, height, channels;
-					file.read(reinterpret_cast<char*>(&width), sizeof(i32));
-					file.read(reinterpret_cast<char*>(&height), sizeof(i32));
-					file.read(reinterpret_cast<char*>(&channels), sizeof(i32));
+		ThumbnailView view;
 
-					char* data = new char[(size_t)(width * height * channels)];
-					file.read(data, width * height * channels);
-					file.close();
+		if (GetCacheFile().Find(handle, contentHash, view))
+			return CreateThumbnail(handle, contentHash, view);
 
-					TextureSpecification spec;
-					spec.Height = (u32)height;
-					spec.Width  = (u32)width;
-					spec.Format = (u32)channels == 3 ? ImageFormat::RGB8 : ImageFormat::RGBA8;
-
-					Texture2D* texture = new Texture2D(spec);
-					texture->SetData(data, (u32)(width * height * channels));
-					delete[] data;
-
-					ThumbnailCacheData cacheData = ThumbnailCacheData{texture, lastModified};
-					m_Thumbnails[handle]         = cacheData;
-
-					return &m_Thumbnails[handle].Texture;
-				}
-				else
-				{
-					std::filesystem::remove(filepath);
-
-					return LoadAndCacheTexture(itemPath, cachePath, handle, lastModified);
-				}
-			}
-		}
-
-		return LoadAndCacheTexture(itemPath, cachePath, handle, lastModified);
+		return GenerateTextureThumbnail(itemPath, handle, contentHash);
 	}
 
 	Texture2D** ThumbnailCache::GetFontAtlasThumbnail(const std::filesystem::path& itemPath, AssetHandle handle,
-	                                                  Timestamp lastModified)
+	                                                  u64 contentHash)
 	{
 		auto it = m_Thumbnails.find(handle);
 
-		const std::filesystem::path cachePath = ProjectContext::Get()->GetAssetDirectory() / "cache" / "thumbnails";
+		if (it != m_Thumbnails.end() && it->second.ContentHash == contentHash)
+			return &it->second.Texture;
 
-		if (it != m_Thumbnails.end())
-		{
-			ThumbnailCacheData& data = it->second;
-
-			if (data.LastModified == lastModified)
-				return &data.Texture;
+		ThumbnailView view;
 
-			const std::string oldFilename = std::to_string(handle) + "_" + std::to_string(data.LastModified) + ".cache";
+		if (GetCacheFile().Find(handle, contentHash, view))
+			return CreateThumbnail(handle, contentHash, view);
 
-			std::filesystem::remove(cachePath / oldFilename);
+		return LoadAndCacheFontAtlas(itemPath, handle, contentHash);
+	}
 
-			return LoadAndCacheFontAtlas(itemPath, cachePath, handle, lastModified);
-		}
+	void ThumbnailCache::Update()
+	{
+		GeneratedThumbnail generated;
 
-		for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(cachePath))
+		for (u32 i = 0; m_Generator && i < MaxUploadsPerFrame && m_Generator->TryPopGenerated(generated); i++)
 		{
-			const std::filesystem::path& filepath = entry.path();
-			const std::string& filename           = filepath.filename().string();
-
-			const std::string handleStr = filename.substr(0, filename.find("_"));
-			const std::string modTimeStr =
-			    filename.substr(filename.find("_") + 1, filename.find(".cache") - filename.find("_") - 1);
+			auto it = m_Thumbnails.find(generated.Handle);
 
-			const u64 itemHandle = std::stoull(handleStr);
-			const u64 modTime    = std::stoull(modTimeStr);
+			// The cache was cleared or the asset was modified again while the thumbnail was being generated.
+			if (it == m_Thumbnails.end() || it->second.ContentHash != generated.ContentHash)
+				continue;
 
-			if (itemHandle == handle)
+			if (generated.Pixels.empty())
 			{
+				SYSTEM_WARN("Failed to generate the thumbnail of the asset {}", generated.Handle);
+				continue;
+			}
 
-				if (modTime == lastModified)
-				{
-					std::ifstream file(filepath, std::ios::binary);
-
-					ASSERT(file.is_open());
-
-					i32 width, height, channels;
-					file.read(reinterpret_cast<char*>(&width), sizeof(i32));
-					file.read(reinterpret_cast<char*>(&height), sizeof(i32));
-					file.read(reinterpret_cast<char*>(&channels), sizeof(i32));
-
-					char* data = new char[(size_t)(width * height * channels)];
-					file.read(data, width * height * channels);
-					file.close();
-
-					TextureSpecification spec;
-					spec.Height = (u32)height;
-					spec.Width  = (u32)width;
-					spec.Format = channels == 3 ? ImageFormat::RGB8 : ImageFormat::RGBA8;
-
-					Texture2D* texture = new Texture2D(spec);
-					texture->SetData(data, (u32)(width * height * channels));
-					delete[] data;
-
-					ThumbnailCacheData cacheData = ThumbnailCacheData{texture, lastModified};
-					m_Thumbnails[handle]         = cacheData;
+			ThumbnailView view;
+			view.Width    = generated.Width;
+			view.Height   = generated.Height;
+			view.Channels = generated.Channels;
+			view.Pixels   = generated.Pixels.data();
 
-					return &m_Thumbnails[handle].Texture;
-				}
-				else
-				{
-					std::filesystem::remove(filepath);
+			GetCacheFile().Store(generated.Handle, generated.ContentHash, view);
 
-					return LoadAndCacheFontAtlas(itemPath, cachePath, handle, lastModified);
-				}
-			}
+			CreateThumbnail(generated.Handle, generated.ContentHash, view);
 		}
 
-		return LoadAndCacheFontAtlas(itemPath, cachePath, handle, lastModified);
+		m_File.Update();
 	}
 
 	void ThumbnailCache::Clear()
@@ -195,69 +90,81 @@ namespace SW
 			delete pair.second.Texture;
 		}
 
-		std::filesystem::remove_all(ProjectContext::Get()->GetAssetDirectory() / "cache" / "thumbnails");
+		m_Thumbnails.clear();
 
-		FileSystem::CreateEmptyDirectoryIfNotExists(ProjectContext::Get()->GetAssetDirectory() / "cache" /
-		                                            "thumbnails");
+		if (m_Generator)
+			m_Generator->ClearRequests();
+
+		GetCacheFile().Clear();
 	}
 
-	void ThumbnailCache::DownscaleTexture(Texture2D* texture)
+	ThumbnailCacheFile& ThumbnailCache::GetCacheFile()
 	{
-		i32 originalWidth  = texture->GetWidth();
-		i32 originalHeight = texture->GetHeight();
-		i32 newWidth       = originalWidth;
-		i32 newHeight      = originalHeight;
-		i32 clampedSize    = std::min(256, std::max(originalWidth, originalHeight));
+		const std::filesystem::path cacheDirectory = ProjectContext::Get()->GetAssetDirectory() / "cache";
+		const std::filesystem::path cachePath      = cacheDirectory / "thumbnails.sw_cache";
 
-		if (originalWidth > originalHeight)
-		{
-			newWidth  = clampedSize;
-			newHeight = (i32)(clampedSize * originalHeight / originalWidth);
-		}
-		else
+		if (m_File.GetPath() != cachePath)
 		{
-			newHeight = clampedSize;
-			newWidth  = (i32)(clampedSize * originalWidth / originalHeight);
+			// Thumbnails used to be stored one file per asset, they would never be read again.
+			std::filesystem::remove_all(cacheDirectory / "thumbnails");
+
+			m_File.Open(cachePath);
 		}
 
-		texture->ChangeSize(newWidth, newHeight);
+		return m_File;
 	}
 
-	Texture2D** ThumbnailCache::LoadAndCacheTexture(const std::filesystem::path& itemPath,
-	                                                const std::filesystem::path& cachePath, AssetHandle handle,
-	                                                Timestamp lastModified)
+	Texture2D** ThumbnailCache::CreateThumbnail(AssetHandle handle, u64 contentHash, const ThumbnailView& view)
 	{
-		const std::string newFilename = std::to_string(handle) + "_" + std::to_string(lastModified) + ".cache";
+		TextureSpecification spec;
+		spec.Height = (u32)view.Height;
+		spec.Width  = (u32)view.Width;
+		spec.Format = view.Channels == 3 ? ImageFormat::RGB8 : ImageFormat::RGBA8;
 
-		Texture2D* loaded = new Texture2D(ProjectContext::Get()->GetAssetDirectory() / itemPath);
-		DownscaleTexture(loaded);
+		Texture2D* texture = new Texture2D(spec);
+		texture->SetData((void*)view.Pixels, (u32)(view.Width * view.Height * view.Channels));
 
-		std::ofstream file(cachePath / newFilename, std::ios::binary | std::ios::trunc);
-
-		ASSERT(file.is_open());
+		return StoreThumbnail(handle, contentHash, texture);
+	}
 
-		i32 width         = loaded->GetWidth();
-		i32 height        = loaded->GetHeight();
-		i32 channels      = loaded->GetChannels();
-		const char* bytes = loaded->GetBytes();
+	Texture2D** ThumbnailCache::StoreThumbnail(AssetHandle handle, u64 contentHash, Texture2D* texture)
+	{
+		ThumbnailCacheData& data = m_Thumbnails[handle];
 
-		file.write(reinterpret_cast<const char*>(&width), sizeof(i32));
-		file.write(reinterpret_cast<const char*>(&height), sizeof(i32));
-		file.write(reinterpret_cast<const char*>(&channels), sizeof(i32));
-		file.write(bytes, width * height * channels);
-		file.close();
+		delete data.Texture; // outdated thumbnail, the slot handed out before stays valid
 
-		m_Thumbnails[handle] = ThumbnailCacheData{loaded, lastModified};
+		data = ThumbnailCacheData{texture, contentHash};
 
-		return &m_Thumbnails[handle].Texture;
+		return &data.Texture;
 	}
 
-	Texture2D** ThumbnailCache::LoadAndCacheFontAtlas(const std::filesystem::path& itemPath,
-	                                                  const std::filesystem::path& cachePath, AssetHandle handle,
-	                                                  Timestamp lastModified)
+	Texture2D** ThumbnailCache::GenerateTextureThumbnail(const std::filesystem::path& itemPath, AssetHandle handle,
+	                                                     u64 contentHash)
 	{
-		const std::string newFilename = std::to_string(handle) + "_" + std::to_string(lastModified) + ".cache";
+		if (!m_Generator)
+		{
+			const u32 cores   = std::thread::hardware_concurrency();
+			const u32 workers = std::clamp(cores / 4, 1u, 2u); // the asset manager uses its own workers
+
+			m_Generator = CreateScope<ThumbnailGenerator>(workers);
+		}
+
+		ThumbnailCacheData& data = m_Thumbnails[handle];
+		data.ContentHash         = contentHash; // an outdated thumbnail stays visible until the new one is uploaded
+
+		ThumbnailRequest request;
+		request.Handle      = handle;
+		request.ContentHash = contentHash;
+		request.Path        = ProjectContext::Get()->GetAssetDirectory() / itemPath;
+
+		m_Generator->Enqueue(request);
+
+		return &data.Texture;
+	}
 
+	Texture2D** ThumbnailCache::LoadAndCacheFontAtlas(const std::filesystem::path& itemPath, AssetHandle handle,
+	                                                  u64 contentHash)
+	{
 		YAML::Node fontData = YAML::LoadFile((ProjectContext::Get()->GetAssetDirectory() / itemPath).string());
 
 		YAML::Node data = fontData["Font"];
@@ -271,42 +178,31 @@ namespace SW
 		FontSpecification spec;
 		spec.Path    = ProjectContext::Get()->GetAssetDirectory() / sourceMetadata.Path;
 		spec.Charset = (FontCharsetType)TryDeserializeNode<int>(data, "CharsetType", (int)FontCharsetType::ASCII);
+
+		if (spec.Charset == FontCharsetType::Dynamic) // the preview shows the ASCII glyphs
+			spec.Charset = FontCharsetType::ASCII;
 		spec.ApplyMSDFColoring = false;
 		spec.ForceHeight       = 512;
 		spec.ForceWidth        = 512;
 
-		Font* font       = new Font(spec);
-		Texture2D* atlas = font->GetAtlasTexture();
-
-		std::ofstream file(cachePath / newFilename, std::ios::binary | std::ios::trunc);
+		Font* font                   = new Font(spec);
+		Texture2D* atlas             = font->GetAtlasTexture();
+		const std::vector<u8> pixels = atlas->GetBytes();
 
-		ASSERT(file.is_open());
+		ThumbnailView view;
+		view.Width    = atlas->GetWidth();
+		view.Height   = atlas->GetHeight();
+		view.Channels = atlas->GetChannels();
+		view.Pixels   = pixels.data();
 
-		i32 width         = atlas->GetWidth();
-		i32 height        = atlas->GetHeight();
-		i32 channels      = atlas->GetChannels();
-		const char* bytes = atlas->GetBytes();
+		GetCacheFile().Store(handle, contentHash, view);
 
-		file.write(reinterpret_cast<const char*>(&width), sizeof(i32));
-		file.write(reinterpret_cast<const char*>(&height), sizeof(i32));
-		file.write(reinterpret_cast<const char*>(&channels), sizeof(i32));
-		file.write(bytes, width * height * channels);
-		file.close();
-
-		// Copy the font atlas texture since we delete font afterwards (maybe clean this later on)
-		TextureSpecification texSpec;
-		texSpec.Height = (u32)height;
-		texSpec.Width  = (u32)width;
-		texSpec.Format = channels == 3 ? ImageFormat::RGB8 : ImageFormat::RGBA8;
-
-		Texture2D* texture = new Texture2D(texSpec);
-		texture->SetData((void*)bytes, (u32)(width * height * channels));
+		// Copy the font atlas texture since we delete font afterwards
+		Texture2D** thumbnail = CreateThumbnail(handle, contentHash, view);
 
 		delete font;
 
-		m_Thumbnails[handle] = ThumbnailCacheData{texture, lastModified};
-
-		return &m_Thumbnails[handle].Texture;
+		return thumbnail;
 	}
 
 } // namespace SW
@@ -1,7 +1,7 @@
 /**
  * @file ThumbnailCache.hpp
  * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
- * @version 0.1.1
+ * @version 0.1.4
  * @date 2024-04-07
  *
  * @copyright Copyright (c) 2024 Tycjan Fortuna
@@ -9,6 +9,8 @@
 #pragma once
 
 #include "Asset/Asset.hpp"
+#include "ThumbnailCacheFile.hpp"
+#include "ThumbnailGenerator.hpp"
 
 namespace SW
 {
@@ -19,7 +21,7 @@ namespace SW
 	struct ThumbnailCacheData
 	{
 		Texture2D* Texture; // The actual thumbnail texture.
-		u64 LastModified;   // The last modified timestamp of the asset.
+		u64 ContentHash;    // The content hash of the asset.
 	};
 
 	class ThumbnailCache
@@ -28,7 +30,7 @@ namespace SW
 		ThumbnailCache() = default;
 		~ThumbnailCache();
 
-		using Timestamp = u64;
+		static constexpr u32 MaxUploadsPerFrame = 8; // Generated thumbnails uploaded to the GPU per frame at most.
 
 		/**
 		 * @brief Retrieves the thumbnail texture of the asset with the provided handle.
@@ -36,11 +38,10 @@ namespace SW
 		 *
 		 * @param itemPath The path of the asset.
 		 * @param handle The handle of the asset.
-		 * @param lastModified The last modified timestamp of the asset.
-		 * @return A pointer to the thumbnail texture if it exists, nullptr otherwise.
+		 * @param contentHash The content hash of the asset.
+		 * @return A pointer to the thumbnail texture slot, the slot holds nullptr while the thumbnail is generated.
 		 */
-		Texture2D** GetTextureThumbnail(const std::filesystem::path& itemPath, AssetHandle handle,
-		                                Timestamp lastModified);
+		Texture2D** GetTextureThumbnail(const std::filesystem::path& itemPath, AssetHandle handle, u64 contentHash);
 
 		/**
 		 * @brief Retrieves the thumbnail texture of the font atlas with the provided handle.
@@ -48,11 +49,16 @@ namespace SW
 		 *
 		 * @param itemPath The path of the font atlas.
 		 * @param handle The handle of the font atlas.
-		 * @param lastModified The last modified timestamp of the font atlas.
+		 * @param contentHash The content hash of the font atlas.
 		 * @return A pointer to the thumbnail texture if it exists, nullptr otherwise.
 		 */
-		Texture2D** GetFontAtlasThumbnail(const std::filesystem::path& itemPath, AssetHandle handle,
-		                                  Timestamp lastModified);
+		Texture2D** GetFontAtlasThumbnail(const std::filesystem::path& itemPath, AssetHandle handle, u64 contentHash);
+
+		/**
+		 * @brief Uploads generated thumbnails and writes pending ones to the cache file in the background.
+		 * @note Call once per frame.
+		 */
+		void Update();
 
 		/**
 		 * @brief Clear the cache of all thumbnails.
@@ -63,37 +69,58 @@ namespace SW
 	private:
 		std::unordered_map<AssetHandle, ThumbnailCacheData> m_Thumbnails; // The cache of thumbnails.
 
+		ThumbnailCacheFile m_File; // The thumbnails stored on disk.
+
+		Scope<ThumbnailGenerator> m_Generator; // Generates texture thumbnails, created on the first request.
+
 	private:
 		/**
-		 * @brief Downscale the provided texture to a smaller size.
+		 * @brief Gets the cache file of the current project, opening it if the project changed.
 		 *
-		 * @param texture The texture to downscale.
+		 * @return The cache file.
 		 */
-		void DownscaleTexture(Texture2D* texture);
+		ThumbnailCacheFile& GetCacheFile();
 
 		/**
-		 * @brief Load and cache the thumbnail texture of the asset with the provided handle.
+		 * @brief Creates the thumbnail texture from the provided pixels and stores it in the cache.
+		 *
+		 * @param handle The handle of the asset.
+		 * @param contentHash The content hash of the asset.
+		 * @param view The pixels of the thumbnail.
+		 * @return A pointer to the cached thumbnail texture.
+		 */
+		Texture2D** CreateThumbnail(AssetHandle handle, u64 contentHash, const ThumbnailView& view);
+
+		/**
+		 * @brief Stores the thumbnail texture in the cache, replacing the outdated one.
 		 *
-		 * @param itemPath The path of the asset.
-		 * @param cachePath The path of the cache directory.
 		 * @param handle The handle of the asset.
-		 * @param lastModified The last modified timestamp of the asset.
+		 * @param contentHash The content hash of the asset.
+		 * @param texture The thumbnail texture, owned by the cache from now on.
 		 * @return A pointer to the cached thumbnail texture.
 		 */
-		Texture2D** LoadAndCacheTexture(const std::filesystem::path& itemPath, const std::filesystem::path& cachePath,
-		                                AssetHandle handle, Timestamp lastModified);
+		Texture2D** StoreThumbnail(AssetHandle handle, u64 contentHash, Texture2D* texture);
+
+		/**
+		 * @brief Queues the generation of the thumbnail texture of the asset with the provided handle.
+		 *
+		 * @param itemPath The path of the asset.
+		 * @param handle The handle of the asset.
+		 * @param contentHash The content hash of the asset.
+		 * @return A pointer to the thumbnail texture slot, filled in by Update() once the thumbnail is generated.
+		 */
+		Texture2D** GenerateTextureThumbnail(const std::filesystem::path& itemPath, AssetHandle handle,
+		                                     u64 contentHash);
 
 		/**
 		 * @brief Load and cache the thumbnail texture of the font atlas with the provided handle.
 		 *
 		 * @param itemPath The path of the font source file.
-		 * @param cachePath The path of the cache directory.
 		 * @param handle The handle of the font atlas.
-		 * @param lastModified The last modified timestamp of the font atlas.
-		 * @return Texture2D**
+		 * @param contentHash The content hash of the font atlas.
+		 * @return A pointer to the cached thumbnail texture.
 		 */
-		Texture2D** LoadAndCacheFontAtlas(const std::filesystem::path& itemPath, const std::filesystem::path& cachePath,
-		                                  AssetHandle handle, Timestamp lastModified);
+		Texture2D** LoadAndCacheFontAtlas(const std::filesystem::path& itemPath, AssetHandle handle, u64 contentHash);
 	};
 
 } // namespace SW
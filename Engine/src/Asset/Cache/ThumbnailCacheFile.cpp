@@ -0,0 +1,328 @@
+#include "ThumbnailCacheFile.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace SW
+{
+
+	static_assert(sizeof(ThumbnailCacheHeader) == 16, "Thumbnail cache header layout changed, bump the version!");
+	static_assert(sizeof(ThumbnailCacheEntry) == 40, "Thumbnail cache entry layout changed, bump the version!");
+
+	static u64 AlignOffset(u64 offset, u64 alignment)
+	{
+		return (offset + alignment - 1) & ~(alignment - 1);
+	}
+
+	static u64 GetPixelsSize(i32 width, i32 height, i32 channels)
+	{
+		return (u64)width * (u64)height * (u64)channels;
+	}
+
+	template <typename T>
+	static bool WriteCacheFile(const std::filesystem::path& path, const std::vector<T>& blobs)
+	{
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+		if (!file)
+			return false;
+
+		ThumbnailCacheHeader header = {};
+		header.Magic                = ThumbnailCacheFile::Magic;
+		header.Version              = ThumbnailCacheFile::Version;
+		header.EntryCount           = (u32)blobs.size();
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(ThumbnailCacheHeader));
+
+		u64 offset = AlignOffset(sizeof(ThumbnailCacheHeader) + blobs.size() * sizeof(ThumbnailCacheEntry),
+		                         ThumbnailCacheFile::BlobAlignment);
+
+		for (const T& blob : blobs)
+		{
+			ThumbnailCacheEntry entry = {};
+			entry.Handle              = blob.Handle;
+			entry.ContentHash         = blob.ContentHash;
+			entry.Offset              = offset;
+			entry.Width               = blob.Width;
+			entry.Height              = blob.Height;
+			entry.Channels            = blob.Channels;
+
+			file.write(reinterpret_cast<const char*>(&entry), sizeof(ThumbnailCacheEntry));
+
+			offset = AlignOffset(offset + GetPixelsSize(blob.Width, blob.Height, blob.Channels),
+			                     ThumbnailCacheFile::BlobAlignment);
+		}
+
+		const char zeros[ThumbnailCacheFile::BlobAlignment] = {};
+
+		for (const T& blob : blobs)
+		{
+			const u64 position = (u64)file.tellp();
+
+			file.write(zeros, (std::streamsize)(AlignOffset(position, ThumbnailCacheFile::BlobAlignment) - position));
+			file.write(reinterpret_cast<const char*>(blob.Pixels),
+			           (std::streamsize)GetPixelsSize(blob.Width, blob.Height, blob.Channels));
+		}
+
+		return (bool)file;
+	}
+
+	ThumbnailCacheFile::~ThumbnailCacheFile()
+	{
+		Close();
+	}
+
+	void ThumbnailCacheFile::Open(const std::filesystem::path& path)
+	{
+		PROFILE_FUNCTION();
+
+		Close();
+
+		m_Path = path;
+
+		u32 entryCount                     = 0;
+		const ThumbnailCacheEntry* entries = MapFile(entryCount);
+
+		m_Records.reserve(entryCount);
+
+		for (u32 i = 0; i < entryCount; i++)
+		{
+			const ThumbnailCacheEntry& entry = entries[i];
+
+			ThumbnailRecord& record = m_Records[entry.Handle];
+			record.ContentHash      = entry.ContentHash;
+			record.Version          = m_NextVersion++;
+			record.Width            = entry.Width;
+			record.Height           = entry.Height;
+			record.Channels         = entry.Channels;
+			record.Pixels           = m_File.GetData() + entry.Offset;
+		}
+	}
+
+	void ThumbnailCacheFile::Close()
+	{
+		if (m_Path.empty())
+			return;
+
+		FinishCompaction(true);
+
+		if (m_DirtyBytes != 0)
+		{
+			StartCompaction();
+			FinishCompaction(true);
+		}
+
+		m_File.Close();
+		m_Records.clear();
+		m_Path.clear();
+
+		m_DirtyBytes = 0;
+	}
+
+	bool ThumbnailCacheFile::Find(AssetHandle handle, u64 contentHash, ThumbnailView& outView) const
+	{
+		auto it = m_Records.find(handle);
+
+		if (it == m_Records.end() || it->second.ContentHash != contentHash)
+			return false;
+
+		const ThumbnailRecord& record = it->second;
+
+		outView.Width    = record.Width;
+		outView.Height   = record.Height;
+		outView.Channels = record.Channels;
+		outView.Pixels   = record.Pixels;
+
+		return true;
+	}
+
+	void ThumbnailCacheFile::Store(AssetHandle handle, u64 contentHash, const ThumbnailView& thumbnail)
+	{
+		const u64 size = GetPixelsSize(thumbnail.Width, thumbnail.Height, thumbnail.Channels);
+
+		ThumbnailRecord& record = m_Records[handle];
+
+		if (record.Pixels)
+			m_DirtyBytes += GetPixelsSize(record.Width, record.Height, record.Channels); // outdated blob
+
+		record.ContentHash = contentHash;
+		record.Version     = m_NextVersion++;
+		record.Width       = thumbnail.Width;
+		record.Height      = thumbnail.Height;
+		record.Channels    = thumbnail.Channels;
+
+		record.Pending.assign(thumbnail.Pixels, thumbnail.Pixels + size);
+		record.Pixels = record.Pending.data();
+
+		m_DirtyBytes += size;
+	}
+
+	void ThumbnailCacheFile::Clear()
+	{
+		FinishCompaction(true);
+
+		m_File.Close();
+		m_Records.clear();
+
+		m_DirtyBytes = 0;
+
+		if (!m_Path.empty())
+			std::filesystem::remove(m_Path);
+	}
+
+	void ThumbnailCacheFile::Update()
+	{
+		if (m_Compaction)
+		{
+			FinishCompaction(false);
+			return;
+		}
+
+		// Rewriting the whole file is amortized by waiting for the dirty bytes to reach half of its size.
+		if (m_DirtyBytes >= std::max(CompactionThreshold, m_File.GetSize() / 2))
+			StartCompaction();
+	}
+
+	const ThumbnailCacheEntry* ThumbnailCacheFile::MapFile(u32& outEntryCount)
+	{
+		outEntryCount = 0;
+
+		if (!std::filesystem::exists(m_Path) || !m_File.Open(m_Path))
+			return nullptr;
+
+		const u8* data = m_File.GetData();
+		const u64 size = m_File.GetSize();
+
+		ThumbnailCacheHeader header = {};
+
+		if (size >= sizeof(ThumbnailCacheHeader))
+			std::memcpy(&header, data, sizeof(ThumbnailCacheHeader));
+
+		const u64 tableEnd = sizeof(ThumbnailCacheHeader) + (u64)header.EntryCount * sizeof(ThumbnailCacheEntry);
+
+		bool isValid = header.Magic == Magic && header.Version == Version && tableEnd <= size;
+
+		const ThumbnailCacheEntry* entries =
+		    reinterpret_cast<const ThumbnailCacheEntry*>(data + sizeof(ThumbnailCacheHeader));
+
+		for (u32 i = 0; isValid && i < header.EntryCount; i++)
+		{
+			const ThumbnailCacheEntry& entry = entries[i];
+
+			const bool hasValidSize = entry.Width > 0 && entry.Height > 0 && entry.Channels > 0;
+			const u64 pixelsSize    = hasValidSize ? GetPixelsSize(entry.Width, entry.Height, entry.Channels) : 0;
+
+			isValid = hasValidSize && entry.Offset <= size && pixelsSize <= size - entry.Offset;
+		}
+
+		if (!isValid)
+		{
+			SYSTEM_WARN("Thumbnail cache {} is outdated or corrupted, thumbnails will be regenerated.", m_Path);
+
+			m_File.Close();
+			std::filesystem::remove(m_Path);
+
+			return nullptr;
+		}
+
+		outEntryCount = header.EntryCount;
+
+		return entries;
+	}
+
+	void ThumbnailCacheFile::StartCompaction()
+	{
+		PROFILE_FUNCTION();
+
+		m_Compaction = CreateScope<Compaction>();
+		m_Compaction->Blobs.reserve(m_Records.size());
+
+		for (auto&& [handle, record] : m_Records)
+		{
+			const u8* pixels = record.Pixels;
+
+			// Pending pixels may be replaced while the worker runs, mapped ones stay until FinishCompaction().
+			if (!record.Pending.empty())
+				pixels = m_Compaction->Copies.emplace_back(record.Pending).data();
+
+			m_Compaction->Blobs.emplace_back(CompactionBlob{handle, record.Version, record.ContentHash, record.Width,
+			                                                record.Height, record.Channels, pixels});
+		}
+
+		m_DirtyBytes = 0;
+
+		std::filesystem::path temporaryPath = m_Path;
+		temporaryPath += ".tmp";
+
+		const std::vector<CompactionBlob>* blobs = &m_Compaction->Blobs;
+
+		m_Compaction->Result = std::async(std::launch::async, [temporaryPath, blobs]() {
+			return WriteCacheFile(temporaryPath, *blobs);
+		});
+	}
+
+	void ThumbnailCacheFile::FinishCompaction(bool wait)
+	{
+		if (!m_Compaction)
+			return;
+
+		if (!wait && m_Compaction->Result.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+			return;
+
+		PROFILE_FUNCTION();
+
+		std::filesystem::path temporaryPath = m_Path;
+		temporaryPath += ".tmp";
+
+		if (!m_Compaction->Result.get())
+		{
+			SYSTEM_ERROR("Failed to write the thumbnail cache {}", temporaryPath);
+
+			m_DirtyBytes = std::max<u64>(m_DirtyBytes, 1); // pending pixels are kept, Close() tries again
+
+			m_Compaction.reset();
+			return;
+		}
+
+		m_File.Close(); // the file can not be replaced while mapped (Windows)
+
+		std::error_code error;
+		std::filesystem::rename(temporaryPath, m_Path, error);
+
+		u32 entryCount                     = 0;
+		const ThumbnailCacheEntry* entries = error ? nullptr : MapFile(entryCount);
+
+		std::unordered_map<AssetHandle, const ThumbnailCacheEntry*> written;
+		written.reserve(entryCount);
+
+		for (u32 i = 0; i < entryCount; i++)
+		{
+			written[entries[i].Handle] = &entries[i];
+		}
+
+		// Records stored after the snapshot keep their pending pixels, the rest moves into the new mapping.
+		for (const CompactionBlob& blob : m_Compaction->Blobs)
+		{
+			auto record = m_Records.find(blob.Handle);
+
+			if (record == m_Records.end() || record->second.Version != blob.Version)
+				continue;
+
+			auto entry = written.find(blob.Handle);
+
+			if (entry != written.end())
+			{
+				record->second.Pixels = m_File.GetData() + entry->second->Offset;
+				record->second.Pending.clear();
+				record->second.Pending.shrink_to_fit();
+			}
+			else if (record->second.Pending.empty())
+			{
+				m_Records.erase(record); // pointed into the old mapping, regenerated on the next request
+			}
+		}
+
+		m_Compaction.reset();
+	}
+
+} // namespace SW
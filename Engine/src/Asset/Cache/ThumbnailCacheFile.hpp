@@ -0,0 +1,201 @@
+/**
+ * @file ThumbnailCacheFile.hpp
+ * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
+ * @version 0.1.1
+ * @date 2024-05-29
+ *
+ * @copyright Copyright (c) 2024 Tycjan Fortuna
+ */
+#pragma once
+
+#include <future>
+
+#include "Asset/Asset.hpp"
+#include "Core/Utils/MappedFile.hpp"
+
+namespace SW
+{
+
+	/**
+	 * @brief Header at the beginning of the thumbnail cache file.
+	 */
+	struct ThumbnailCacheHeader
+	{
+		u32 Magic;      /**< Must be equal to ThumbnailCacheFile::Magic. */
+		u32 Version;    /**< Must be equal to ThumbnailCacheFile::Version. */
+		u32 EntryCount; /**< Number of entries in the table following the header. */
+		u32 Reserved;   /**< Padding, always 0. */
+	};
+
+	/**
+	 * @brief Single entry of the thumbnail cache table.
+	 */
+	struct ThumbnailCacheEntry
+	{
+		AssetHandle Handle; /**< Handle of the asset. */
+		u64 ContentHash;    /**< Content hash of the asset the thumbnail was made from. */
+		u64 Offset;         /**< Offset of the pixels (aligned to ThumbnailCacheFile::BlobAlignment). */
+		i32 Width;          /**< Width of the thumbnail. */
+		i32 Height;         /**< Height of the thumbnail. */
+		i32 Channels;       /**< Number of channels of the thumbnail. */
+		u32 Reserved;       /**< Padding, always 0. */
+	};
+
+	/**
+	 * @brief Pixels of a cached thumbnail.
+	 */
+	struct ThumbnailView
+	{
+		i32 Width        = 0;       /**< Width of the thumbnail. */
+		i32 Height       = 0;       /**< Height of the thumbnail. */
+		i32 Channels     = 0;       /**< Number of channels of the thumbnail. */
+		const u8* Pixels = nullptr; /**< Tightly packed pixels, valid until the next call to the cache file. */
+	};
+
+	/**
+	 * @brief Single file holding the thumbnails of all assets of a project.
+	 *
+	 * 		  Layout: header, table of entries, pixel blobs (aligned to BlobAlignment).
+	 * 		  The file is memory mapped and indexed by handle on open, so a lookup is a single hash probe.
+	 * 		  New and regenerated thumbnails are kept in memory and written out by a compaction, which rewrites the
+	 * 		  file without the outdated blobs on a worker thread once enough of them piled up.
+	 * @note Bump the version whenever the layout changes, files with a different version are discarded.
+	 */
+	class ThumbnailCacheFile final
+	{
+	public:
+		static constexpr u32 Magic         = 0x43545753; /**< "SWTC" */
+		static constexpr u32 Version       = 2;          /**< Current version of the format. */
+		static constexpr u64 BlobAlignment = 16;         /**< Alignment of every blob in the file. */
+
+		static constexpr u64 CompactionThreshold = 8 * 1024 * 1024; /**< Minimum dirty bytes to compact. */
+
+		ThumbnailCacheFile() = default;
+		~ThumbnailCacheFile();
+
+		ThumbnailCacheFile(const ThumbnailCacheFile&)            = delete;
+		ThumbnailCacheFile& operator=(const ThumbnailCacheFile&) = delete;
+
+		/**
+		 * @brief Maps and indexes the cache file. Previously opened file is closed.
+		 * @note A missing or invalid file results in an empty cache.
+		 *
+		 * @param path Path to the cache file.
+		 */
+		void Open(const std::filesystem::path& path);
+
+		/**
+		 * @brief Writes the pending thumbnails and unmaps the file.
+		 */
+		void Close();
+
+		/**
+		 * @brief Gets the path of the opened cache file.
+		 *
+		 * @return The path, empty if no file is opened.
+		 */
+		const std::filesystem::path& GetPath() const { return m_Path; }
+
+		/**
+		 * @brief Finds the thumbnail of the asset.
+		 *
+		 * @param handle The handle of the asset.
+		 * @param contentHash The content hash of the asset.
+		 * @param outView The pixels of the thumbnail.
+		 * @return Whether an up to date thumbnail was found.
+		 */
+		bool Find(AssetHandle handle, u64 contentHash, ThumbnailView& outView) const;
+
+		/**
+		 * @brief Stores the thumbnail of the asset, replacing the previous one.
+		 * @note The pixels are copied.
+		 *
+		 * @param handle The handle of the asset.
+		 * @param contentHash The content hash of the asset.
+		 * @param thumbnail The pixels of the thumbnail.
+		 */
+		void Store(AssetHandle handle, u64 contentHash, const ThumbnailView& thumbnail);
+
+		/**
+		 * @brief Drops all thumbnails and deletes the file.
+		 */
+		void Clear();
+
+		/**
+		 * @brief Finishes a completed compaction or starts a new one if enough dirty bytes piled up.
+		 * @note Call once per frame.
+		 */
+		void Update();
+
+	private:
+		/**
+		 * @brief Thumbnail known to the cache, either mapped or pending to be written.
+		 */
+		struct ThumbnailRecord
+		{
+			u64 ContentHash  = 0;       /**< Content hash of the asset the thumbnail was made from. */
+			u64 Version      = 0;       /**< Bumped on every store, tells compacted records apart from newer ones. */
+			i32 Width        = 0;       /**< Width of the thumbnail. */
+			i32 Height       = 0;       /**< Height of the thumbnail. */
+			i32 Channels     = 0;       /**< Number of channels of the thumbnail. */
+			const u8* Pixels = nullptr; /**< Pixels inside the mapped file or inside Pending. */
+
+			std::vector<u8> Pending; /**< Pixels not written to the file yet. */
+		};
+
+		/**
+		 * @brief Thumbnail captured by a running compaction.
+		 */
+		struct CompactionBlob
+		{
+			AssetHandle Handle; /**< Handle of the asset. */
+			u64 Version;        /**< Version of the record when the compaction started. */
+			u64 ContentHash;    /**< Content hash of the asset the thumbnail was made from. */
+			i32 Width;          /**< Width of the thumbnail. */
+			i32 Height;         /**< Height of the thumbnail. */
+			i32 Channels;       /**< Number of channels of the thumbnail. */
+			const u8* Pixels;   /**< Pixels inside the mapped file or inside Copies. */
+		};
+
+		/**
+		 * @brief State of a compaction running on a worker thread.
+		 */
+		struct Compaction
+		{
+			std::vector<CompactionBlob> Blobs;   /**< Thumbnails to write. */
+			std::vector<std::vector<u8>> Copies; /**< Copies of the pending pixels. */
+			std::future<bool> Result;            /**< Whether the file was written. */
+		};
+
+		std::filesystem::path m_Path; /**< Path to the cache file. */
+		MappedFile m_File;            /**< The mapped cache file. */
+
+		std::unordered_map<AssetHandle, ThumbnailRecord> m_Records; /**< All known thumbnails. */
+
+		u64 m_DirtyBytes  = 0; /**< Bytes pending to be written plus outdated bytes in the file. */
+		u64 m_NextVersion = 1; /**< Version given to the next stored record. */
+
+		Scope<Compaction> m_Compaction; /**< The running compaction, nullptr if none. */
+
+		/**
+		 * @brief Maps the file at m_Path and validates it.
+		 *
+		 * @param outEntryCount The number of entries of the file.
+		 * @return The entries of the file, nullptr if the file is missing or invalid.
+		 */
+		const ThumbnailCacheEntry* MapFile(u32& outEntryCount);
+
+		/**
+		 * @brief Snapshots all records and starts writing them to a temporary file on a worker thread.
+		 */
+		void StartCompaction();
+
+		/**
+		 * @brief Replaces the file with the compacted one and points the records into the new mapping.
+		 *
+		 * @param wait Whether to wait for the worker thread.
+		 */
+		void FinishCompaction(bool wait);
+	};
+
+} // namespace SW
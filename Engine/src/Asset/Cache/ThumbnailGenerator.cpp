@@ -0,0 +1,197 @@
+#include "ThumbnailGenerator.hpp"
+
+#include <algorithm>
+
+#include <stb_image.h>
+
+namespace SW
+{
+
+	ThumbnailGenerator::ThumbnailGenerator(u32 workerCount)
+	{
+		for (u32 i = 0; i < workerCount; i++)
+		{
+			m_Workers.emplace_back(&ThumbnailGenerator::WorkerLoop, this);
+		}
+	}
+
+	ThumbnailGenerator::~ThumbnailGenerator()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_RequestsMutex);
+
+			m_IsStopping = true;
+		}
+
+		m_RequestsCondition.notify_all();
+
+		for (std::thread& worker : m_Workers)
+		{
+			worker.join();
+		}
+	}
+
+	void ThumbnailGenerator::Enqueue(const ThumbnailRequest& request)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_RequestsMutex);
+
+			m_Requests.emplace_back(request);
+		}
+
+		m_RequestsCondition.notify_one();
+	}
+
+	bool ThumbnailGenerator::TryPopGenerated(GeneratedThumbnail& outThumbnail)
+	{
+		std::lock_guard<std::mutex> lock(m_GeneratedMutex);
+
+		if (m_Generated.empty())
+			return false;
+
+		outThumbnail = std::move(m_Generated.front());
+		m_Generated.pop_front();
+
+		return true;
+	}
+
+	void ThumbnailGenerator::ClearRequests()
+	{
+		std::lock_guard<std::mutex> lock(m_RequestsMutex);
+
+		m_Requests.clear();
+	}
+
+	void ThumbnailGenerator::Downscale(const u8* pixels, i32 width, i32 height, i32 channels, i32 maxSize,
+	                                   GeneratedThumbnail& outThumbnail)
+	{
+		const i32 clampedSize = std::min(maxSize, std::max(width, height));
+
+		i32 newWidth  = width;
+		i32 newHeight = height;
+
+		if (width > height)
+		{
+			newWidth  = clampedSize;
+			newHeight = std::max(1, (i32)((i64)clampedSize * height / width));
+		}
+		else
+		{
+			newHeight = clampedSize;
+			newWidth  = std::max(1, (i32)((i64)clampedSize * width / height));
+		}
+
+		outThumbnail.Width    = newWidth;
+		outThumbnail.Height   = newHeight;
+		outThumbnail.Channels = channels;
+
+		const size_t rowSize = (size_t)width * (size_t)channels;
+
+		if (newWidth == width && newHeight == height)
+		{
+			outThumbnail.Pixels.assign(pixels, pixels + rowSize * (size_t)height);
+			return;
+		}
+
+		outThumbnail.Pixels.resize((size_t)newWidth * (size_t)newHeight * (size_t)channels);
+
+		// Column sums of the source rows covered by a destination row, accumulated in one flat loop over the whole
+		// row so the compiler can vectorize it - this is where almost all of the time goes.
+		std::vector<u32> columnSums(rowSize);
+
+		u8* destination = outThumbnail.Pixels.data();
+
+		for (i32 y = 0; y < newHeight; y++)
+		{
+			const i32 firstRow = (i32)((i64)y * height / newHeight);
+			const i32 lastRow  = std::max(firstRow + 1, (i32)((i64)(y + 1) * height / newHeight));
+
+			std::fill(columnSums.begin(), columnSums.end(), 0u);
+
+			for (i32 row = firstRow; row < lastRow; row++)
+			{
+				const u8* source = pixels + (size_t)row * rowSize;
+
+				for (size_t i = 0; i < rowSize; i++)
+				{
+					columnSums[i] += source[i];
+				}
+			}
+
+			for (i32 x = 0; x < newWidth; x++)
+			{
+				const i32 firstColumn = (i32)((i64)x * width / newWidth);
+				const i32 lastColumn  = std::max(firstColumn + 1, (i32)((i64)(x + 1) * width / newWidth));
+				const u64 area        = (u64)(lastRow - firstRow) * (u64)(lastColumn - firstColumn);
+
+				for (i32 channel = 0; channel < channels; channel++)
+				{
+					u64 sum = 0;
+
+					for (i32 column = firstColumn; column < lastColumn; column++)
+					{
+						sum += columnSums[(size_t)column * (size_t)channels + (size_t)channel];
+					}
+
+					*destination++ = (u8)((sum + area / 2) / area);
+				}
+			}
+		}
+	}
+
+	void ThumbnailGenerator::WorkerLoop()
+	{
+		while (true)
+		{
+			ThumbnailRequest request;
+
+			{
+				std::unique_lock<std::mutex> lock(m_RequestsMutex);
+
+				m_RequestsCondition.wait(lock, [this]() { return m_IsStopping || !m_Requests.empty(); });
+
+				if (m_IsStopping)
+					return;
+
+				request = std::move(m_Requests.front());
+				m_Requests.pop_front();
+			}
+
+			GeneratedThumbnail thumbnail;
+
+			Generate(request, thumbnail);
+
+			std::lock_guard<std::mutex> lock(m_GeneratedMutex);
+
+			m_Generated.emplace_back(std::move(thumbnail));
+		}
+	}
+
+	void ThumbnailGenerator::Generate(const ThumbnailRequest& request, GeneratedThumbnail& outThumbnail)
+	{
+		PROFILE_FUNCTION();
+
+		outThumbnail.Handle      = request.Handle;
+		outThumbnail.ContentHash = request.ContentHash;
+
+		const std::string path = request.Path.string();
+
+		i32 width = 0, height = 0, channels = 0;
+
+		if (!stbi_info(path.c_str(), &width, &height, &channels))
+			return;
+
+		const i32 requestedChannels = channels == 3 ? 3 : 4; // thumbnails are either RGB8 or RGBA8
+
+		stbi_set_flip_vertically_on_load_thread(true); // the global flag is not thread safe
+		stbi_uc* pixels = stbi_load(path.c_str(), &width, &height, &channels, requestedChannels);
+
+		if (!pixels)
+			return;
+
+		Downscale(pixels, width, height, requestedChannels, MaxSize, outThumbnail);
+
+		stbi_image_free(pixels);
+	}
+
+} // namespace SW
@@ -0,0 +1,130 @@
+/**
+ * @file ThumbnailGenerator.hpp
+ * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
+ * @version 0.1.1
+ * @date 2024-05-30
+ *
+ * @copyright Copyright (c) 2024 Tycjan Fortuna
+ */
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "Asset/Asset.hpp"
+
+namespace SW
+{
+
+	/**
+	 * @brief Image to generate the thumbnail of.
+	 */
+	struct ThumbnailRequest
+	{
+		AssetHandle Handle = 0;     /**< Handle of the asset. */
+		u64 ContentHash    = 0;     /**< Content hash of the asset. */
+		std::filesystem::path Path; /**< Absolute path to the image. */
+	};
+
+	/**
+	 * @brief Thumbnail generated on a worker thread.
+	 */
+	struct GeneratedThumbnail
+	{
+		AssetHandle Handle = 0; /**< Handle of the asset. */
+		u64 ContentHash    = 0; /**< Content hash of the asset. */
+		i32 Width          = 0; /**< Width of the thumbnail. */
+		i32 Height         = 0; /**< Height of the thumbnail. */
+		i32 Channels       = 0; /**< Number of channels of the thumbnail (3 or 4). */
+
+		std::vector<u8> Pixels; /**< Tightly packed pixels, empty if the image could not be decoded. */
+	};
+
+	/**
+	 * @brief Pool of worker threads decoding images and downscaling them into thumbnails, entirely on the CPU.
+	 * 		  Generated thumbnails are queued and picked up by the main thread, which only uploads the small texture.
+	 */
+	class ThumbnailGenerator final
+	{
+	public:
+		static constexpr i32 MaxSize = 256; /**< Maximum width and height of a thumbnail. */
+
+		/**
+		 * @brief Starts the worker threads.
+		 *
+		 * @param workerCount Number of the worker threads.
+		 */
+		explicit ThumbnailGenerator(u32 workerCount);
+
+		/**
+		 * @brief Stops the worker threads, not yet generated requests are dropped.
+		 */
+		~ThumbnailGenerator();
+
+		ThumbnailGenerator(const ThumbnailGenerator&)            = delete;
+		ThumbnailGenerator& operator=(const ThumbnailGenerator&) = delete;
+
+		/**
+		 * @brief Queues the image for thumbnail generation.
+		 *
+		 * @param request The image to generate the thumbnail of.
+		 */
+		void Enqueue(const ThumbnailRequest& request);
+
+		/**
+		 * @brief Takes the oldest generated thumbnail.
+		 *
+		 * @param outThumbnail The generated thumbnail.
+		 * @return Whether any generated thumbnail was available.
+		 */
+		bool TryPopGenerated(GeneratedThumbnail& outThumbnail);
+
+		/**
+		 * @brief Drops all requests waiting for a worker.
+		 * @note Thumbnails being generated at the moment are still queued.
+		 */
+		void ClearRequests();
+
+		/**
+		 * @brief Downscales the image with a box filter so that it fits into maxSize x maxSize.
+		 * @note Every destination pixel is the average of the source pixels it covers. Images that already fit
+		 * 		 are copied as they are.
+		 *
+		 * @param pixels Tightly packed pixels of the image.
+		 * @param width Width of the image.
+		 * @param height Height of the image.
+		 * @param channels Number of channels of the image.
+		 * @param maxSize Maximum width and height of the result.
+		 * @param outThumbnail Receives the size, the channels and the pixels of the result.
+		 */
+		static void Downscale(const u8* pixels, i32 width, i32 height, i32 channels, i32 maxSize,
+		                      GeneratedThumbnail& outThumbnail);
+
+	private:
+		std::vector<std::thread> m_Workers; /**< The worker threads. */
+
+		std::deque<ThumbnailRequest> m_Requests;     /**< Images waiting for a worker. */
+		std::mutex m_RequestsMutex;                  /**< Guards m_Requests and m_IsStopping. */
+		std::condition_variable m_RequestsCondition; /**< Wakes the workers up. */
+		bool m_IsStopping = false;                   /**< Whether the workers should exit. */
+
+		std::deque<GeneratedThumbnail> m_Generated; /**< Thumbnails waiting for the main thread. */
+		std::mutex m_GeneratedMutex;                /**< Guards m_Generated. */
+
+		/**
+		 * @brief Body of every worker thread.
+		 */
+		void WorkerLoop();
+
+		/**
+		 * @brief Decodes the image and downscales it.
+		 *
+		 * @param request The image to generate the thumbnail of.
+		 * @param outThumbnail The generated thumbnail, without pixels if the image could not be decoded.
+		 */
+		static void Generate(const ThumbnailRequest& request, GeneratedThumbnail& outThumbnail);
+	};
+
+} // namespace SW
@@ -0,0 +1,397 @@
+#include "DynamicGlyphAtlas.hpp"
+
+#undef INFINITE
+#include <msdf-atlas-gen/msdf-atlas-gen.h>
+
+#include "Core/OpenGL/Texture2D.hpp"
+
+namespace SW
+{
+
+	static msdfgen::FontHandle* LoadFont(msdfgen::FreetypeHandle* ft, const std::filesystem::path& path,
+	                                     const u8* data, u64 dataSize)
+	{
+		return data ? msdfgen::loadFontData(ft, data, (int)dataSize) : msdfgen::loadFont(ft, path.string().c_str());
+	}
+
+	static Texture2D* CreatePageTexture()
+	{
+		TextureSpecification spec;
+		spec.Width  = DynamicGlyphAtlas::PageSize;
+		spec.Height = DynamicGlyphAtlas::PageSize;
+		spec.Format = ImageFormat::RGB8;
+
+		Texture2D* texture = new Texture2D(spec);
+		texture->Clear(); // storage starts undefined, the padding between glyphs must be empty
+
+		return texture;
+	}
+
+	static void GenerateGlyph(msdfgen::FontHandle* font, f64 geometryScale, u32 codepoint, GeneratedGlyph& outGlyph)
+	{
+		outGlyph.Codepoint = codepoint;
+
+		msdfgen::GlyphIndex index;
+
+		if (!font || !msdfgen::getGlyphIndex(index, font, codepoint))
+		{
+			outGlyph.IsMissing = true;
+			return;
+		}
+
+		msdf_atlas::GlyphGeometry geometry;
+
+		if (!geometry.load(font, geometryScale, codepoint))
+		{
+			outGlyph.IsMissing = true;
+			return;
+		}
+
+		// Same settings as the static atlases, so both kinds of fonts look alike.
+		geometry.edgeColoring(&msdfgen::edgeColoringInkTrap, 3.0, 0);
+		geometry.wrapBox(DynamicGlyphAtlas::GlyphScale, DynamicGlyphAtlas::PixelRange / DynamicGlyphAtlas::GlyphScale,
+		                 1.0);
+
+		outGlyph.Glyph.Codepoint = codepoint;
+		outGlyph.Glyph.Advance   = (f32)geometry.getAdvance();
+
+		if (geometry.isWhitespace())
+			return;
+
+		i32 width = 0, height = 0;
+		geometry.getBoxSize(width, height);
+		geometry.placeBox(0, 0);
+
+		f64 al, ab, ar, at;
+		geometry.getQuadAtlasBounds(al, ab, ar, at);
+
+		f64 pl, pb, pr, pt;
+		geometry.getQuadPlaneBounds(pl, pb, pr, pt);
+
+		outGlyph.Glyph.PlaneMin = {(f32)pl, (f32)pb};
+		outGlyph.Glyph.PlaneMax = {(f32)pr, (f32)pt};
+		outGlyph.Glyph.AtlasMin = {(f32)al, (f32)ab};
+		outGlyph.Glyph.AtlasMax = {(f32)ar, (f32)at};
+
+		msdf_atlas::GeneratorAttributes attributes;
+		attributes.config.overlapSupport = true;
+		attributes.scanlinePass          = true;
+
+		msdfgen::Bitmap<f32, 3> bitmap(width, height);
+		msdf_atlas::msdfGenerator(bitmap, geometry, attributes);
+
+		outGlyph.Width  = width;
+		outGlyph.Height = height;
+		outGlyph.Pixels.resize((size_t)width * (size_t)height * 3);
+
+		u8* pixel = outGlyph.Pixels.data();
+
+		for (i32 y = 0; y < height; y++)
+		{
+			for (i32 x = 0; x < width; x++)
+			{
+				const f32* channels = bitmap(x, y);
+
+				*pixel++ = msdfgen::pixelFloatToByte(channels[0]);
+				*pixel++ = msdfgen::pixelFloatToByte(channels[1]);
+				*pixel++ = msdfgen::pixelFloatToByte(channels[2]);
+			}
+		}
+	}
+
+	DynamicGlyphAtlas::DynamicGlyphAtlas(const FontSpecification& spec, FontMetrics& outMetrics)
+	    : m_Path(spec.Path), m_Data(spec.Data), m_DataSize(spec.DataSize)
+	{
+		msdfgen::FreetypeHandle* ft = msdfgen::initializeFreetype();
+
+		ASSERT(ft, "MSDFGEN failed to initialize");
+
+		msdfgen::FontHandle* font = LoadFont(ft, m_Path, m_Data, m_DataSize);
+
+		ASSERT(font, "Failed to load the font: {}", m_Path.string());
+
+		msdfgen::FontMetrics metrics = {};
+		msdfgen::getFontMetrics(metrics, font);
+
+		m_GeometryScale = metrics.emSize > 0.0 ? 1.0 / metrics.emSize : 1.0;
+
+		outMetrics.LineHeight = metrics.lineHeight * m_GeometryScale;
+		outMetrics.AscenderY  = metrics.ascenderY * m_GeometryScale;
+		outMetrics.DescenderY = metrics.descenderY * m_GeometryScale;
+
+		msdfgen::destroyFont(font);
+		msdfgen::deinitializeFreetype(ft);
+
+		m_Pages.emplace_back().Texture = CreatePageTexture();
+
+		const u32 cores   = std::thread::hardware_concurrency();
+		const u32 workers = std::clamp(cores / 4, 1u, 2u); // the asset manager uses its own workers
+
+		for (u32 i = 0; i < workers; i++)
+		{
+			m_Workers.emplace_back(&DynamicGlyphAtlas::WorkerLoop, this);
+		}
+
+		Request(' '); // used for spaces and tabs
+		Request('?'); // fallback for missing glyphs
+
+		SYSTEM_INFO("Dynamic font `{}` created successfully!", m_Path.string());
+	}
+
+	DynamicGlyphAtlas::~DynamicGlyphAtlas()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_RequestsMutex);
+
+			m_IsStopping = true;
+		}
+
+		m_RequestsCondition.notify_all();
+
+		for (std::thread& worker : m_Workers)
+		{
+			worker.join();
+		}
+
+		for (AtlasPage& page : m_Pages)
+		{
+			delete page.Texture;
+		}
+	}
+
+	void DynamicGlyphAtlas::Update(u64 useIndex)
+	{
+		m_UseIndex = useIndex;
+
+		for (u32 i = 0; i < MaxUploadsPerUpdate; i++)
+		{
+			GeneratedGlyph generated;
+
+			{
+				std::lock_guard<std::mutex> lock(m_GeneratedMutex);
+
+				if (m_Generated.empty())
+					return;
+
+				generated = std::move(m_Generated.front());
+				m_Generated.pop_front();
+			}
+
+			m_Requested.erase(generated.Codepoint);
+
+			if (generated.IsMissing)
+			{
+				m_Missing.insert(generated.Codepoint);
+				continue;
+			}
+
+			ResidentGlyph resident = {generated.Glyph, NoPage};
+
+			if (!generated.Pixels.empty())
+			{
+				i32 x = 0, y = 0;
+
+				if (!Pack(generated.Width, generated.Height, resident.Page, x, y))
+					continue; // every page is in use right now, requested again on the next use
+
+				AtlasPage& page = m_Pages[resident.Page];
+				page.Texture->SetSubData(generated.Pixels.data(), x, y, generated.Width, generated.Height);
+				page.LastUsed = m_UseIndex;
+
+				resident.Glyph.AtlasMin += glm::vec2((f32)x, (f32)y);
+				resident.Glyph.AtlasMax += glm::vec2((f32)x, (f32)y);
+			}
+
+			m_Glyphs[generated.Codepoint] = resident;
+		}
+	}
+
+	const FontGlyph* DynamicGlyphAtlas::FindGlyph(u32 codepoint, Texture2D*& outPage)
+	{
+		auto it = m_Glyphs.find(codepoint);
+
+		if (it == m_Glyphs.end())
+		{
+			if (!m_Missing.contains(codepoint))
+				Request(codepoint);
+
+			return nullptr;
+		}
+
+		if (it->second.Page == NoPage)
+		{
+			outPage = m_Pages[0].Texture;
+		}
+		else
+		{
+			AtlasPage& page = m_Pages[it->second.Page];
+			page.LastUsed   = m_UseIndex;
+			outPage         = page.Texture;
+		}
+
+		return &it->second.Glyph;
+	}
+
+	void DynamicGlyphAtlas::MarkUsed(const Texture2D* page, u64 useIndex)
+	{
+		for (AtlasPage& atlasPage : m_Pages)
+		{
+			if (atlasPage.Texture == page)
+				atlasPage.LastUsed = std::max(atlasPage.LastUsed, useIndex);
+		}
+	}
+
+	u64 DynamicGlyphAtlas::GetMemorySize() const
+	{
+		u64 size = 0;
+
+		for (const AtlasPage& page : m_Pages)
+		{
+			size += page.Texture->GetMemorySize();
+		}
+
+		return size;
+	}
+
+	void DynamicGlyphAtlas::Request(u32 codepoint)
+	{
+		if (!m_Requested.insert(codepoint).second)
+			return;
+
+		{
+			std::lock_guard<std::mutex> lock(m_RequestsMutex);
+
+			m_Requests.emplace_back(codepoint);
+		}
+
+		m_RequestsCondition.notify_one();
+	}
+
+	bool DynamicGlyphAtlas::Pack(i32 width, i32 height, u32& outPage, i32& outX, i32& outY)
+	{
+		const i32 paddedWidth  = width + GlyphPadding;
+		const i32 paddedHeight = height + GlyphPadding;
+
+		const auto packIntoPage = [paddedWidth, paddedHeight, &outX, &outY](AtlasPage& page) {
+			// Prefer a shelf that wastes little height, open a new one otherwise, any shelf that fits as last resort.
+			AtlasShelf* best = nullptr;
+
+			for (AtlasShelf& shelf : page.Shelves)
+			{
+				if (shelf.Height >= paddedHeight && shelf.NextX + paddedWidth <= PageSize &&
+				    (!best || shelf.Height < best->Height))
+					best = &shelf;
+			}
+
+			if ((!best || best->Height > paddedHeight + paddedHeight / 2) && page.NextShelfY + paddedHeight <= PageSize)
+			{
+				best = &page.Shelves.emplace_back(AtlasShelf{page.NextShelfY, paddedHeight, 0});
+
+				page.NextShelfY += paddedHeight;
+			}
+
+			if (!best)
+				return false;
+
+			outX = best->NextX;
+			outY = best->Y;
+
+			best->NextX += paddedWidth;
+
+			return true;
+		};
+
+		for (u32 i = 0; i < (u32)m_Pages.size(); i++)
+		{
+			if (packIntoPage(m_Pages[i]))
+			{
+				outPage = i;
+				return true;
+			}
+		}
+
+		if (m_Pages.size() < MaxPages)
+		{
+			m_Pages.emplace_back().Texture = CreatePageTexture();
+
+			outPage = (u32)m_Pages.size() - 1;
+
+			return packIntoPage(m_Pages.back());
+		}
+
+		// All pages are full - evict the least recently used one, unless it is used by the current draws.
+		u32 victim = 0;
+
+		for (u32 i = 1; i < (u32)m_Pages.size(); i++)
+		{
+			if (m_Pages[i].LastUsed < m_Pages[victim].LastUsed)
+				victim = i;
+		}
+
+		if (m_Pages[victim].LastUsed >= m_UseIndex)
+			return false;
+
+		EvictPage(victim);
+
+		outPage = victim;
+
+		return packIntoPage(m_Pages[victim]);
+	}
+
+	void DynamicGlyphAtlas::EvictPage(u32 index)
+	{
+		std::erase_if(m_Glyphs, [index](const auto& pair) { return pair.second.Page == index; });
+
+		m_Generation++;
+
+		AtlasPage& page = m_Pages[index];
+		page.Shelves.clear();
+		page.NextShelfY = 0;
+		page.LastUsed   = 0;
+
+		// Glyphs packed next to the texels of the evicted ones would sample them through the bilinear filtering
+		page.Texture->Clear();
+	}
+
+	void DynamicGlyphAtlas::WorkerLoop()
+	{
+		// FreeType faces must not be shared between threads, every worker loads its own.
+		msdfgen::FreetypeHandle* ft = msdfgen::initializeFreetype();
+		msdfgen::FontHandle* font   = ft ? LoadFont(ft, m_Path, m_Data, m_DataSize) : nullptr;
+
+		if (!font)
+			SYSTEM_ERROR("Dynamic font worker failed to load the font: {}", m_Path.string());
+
+		while (true)
+		{
+			u32 codepoint = 0;
+
+			{
+				std::unique_lock<std::mutex> lock(m_RequestsMutex);
+
+				m_RequestsCondition.wait(lock, [this]() { return m_IsStopping || !m_Requests.empty(); });
+
+				if (m_IsStopping)
+					break;
+
+				codepoint = m_Requests.front();
+				m_Requests.pop_front();
+			}
+
+			GeneratedGlyph generated;
+
+			GenerateGlyph(font, m_GeometryScale, codepoint, generated);
+
+			std::lock_guard<std::mutex> lock(m_GeneratedMutex);
+
+			m_Generated.emplace_back(std::move(generated));
+		}
+
+		if (font)
+			msdfgen::destroyFont(font);
+
+		if (ft)
+			msdfgen::deinitializeFreetype(ft);
+	}
+
+} // namespace SW
@@ -0,0 +1,215 @@
+/**
+ * @file DynamicGlyphAtlas.hpp
+ * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
+ * @version 0.1.2
+ * @date 2024-05-31
+ *
+ * @copyright Copyright (c) 2024 Tycjan Fortuna
+ */
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "Font.hpp"
+
+namespace SW
+{
+
+	/**
+	 * @brief Glyph generated on a worker thread, not yet packed into an atlas page.
+	 */
+	struct GeneratedGlyph
+	{
+		u32 Codepoint   = 0;     /**< Unicode codepoint of the glyph. */
+		bool IsMissing  = false; /**< Whether the font has no glyph for the codepoint. */
+		FontGlyph Glyph = {};    /**< Placement of the glyph, atlas bounds are relative to the bitmap. */
+		i32 Width       = 0;     /**< Width of the bitmap, 0 for whitespace. */
+		i32 Height      = 0;     /**< Height of the bitmap, 0 for whitespace. */
+
+		std::vector<u8> Pixels; /**< RGB MSDF bitmap, bottom row first. */
+	};
+
+	/**
+	 * @brief Glyph atlas filled on demand, used by fonts with FontCharsetType::Dynamic.
+	 *
+	 * 		  Glyphs are generated the first time they are asked for, on worker threads owning their own FreeType
+	 * 		  instance. The main thread packs the finished bitmaps into atlas pages with a shelf packer - glyphs of
+	 * 		  a similar height share a row. New pages are added up to MaxPages, after that the least recently used
+	 * 		  page is evicted as a whole and its glyphs are generated again when needed.
+	 * @note Kerning is not available for dynamic fonts.
+	 */
+	class DynamicGlyphAtlas final
+	{
+	public:
+		static constexpr i32 PageSize            = 1024; /**< Width and height of every atlas page. */
+		static constexpr u32 MaxPages            = 4;    /**< Pages allocated before evicting. */
+		static constexpr i32 GlyphPadding        = 1;    /**< Empty pixels between glyphs. */
+		static constexpr f64 GlyphScale          = 40.0; /**< Pixels per em, the same as the static atlases. */
+		static constexpr f64 PixelRange          = 2.0;  /**< Range of the distance field in pixels. */
+		static constexpr u32 MaxUploadsPerUpdate = 64;   /**< Generated glyphs packed per Update() at most. */
+
+		/**
+		 * @brief Loads the metrics of the font and starts the worker threads.
+		 * @note spec.Data (if used) must stay valid for the whole lifetime of the atlas.
+		 *
+		 * @param spec The specification of the font.
+		 * @param outMetrics Receives the vertical metrics of the font.
+		 */
+		DynamicGlyphAtlas(const FontSpecification& spec, FontMetrics& outMetrics);
+
+		/**
+		 * @brief Stops the worker threads and deletes the pages.
+		 */
+		~DynamicGlyphAtlas();
+
+		DynamicGlyphAtlas(const DynamicGlyphAtlas&)            = delete;
+		DynamicGlyphAtlas& operator=(const DynamicGlyphAtlas&) = delete;
+
+		/**
+		 * @brief Packs the glyphs generated since the last call into the pages.
+		 * @note Call before looking up the glyphs of a text. Pages used with the current use index are never evicted,
+		 * 		 so pass a value that changes whenever the draws referencing the pages were submitted.
+		 *
+		 * @param useIndex Index of the current batch of draws.
+		 */
+		void Update(u64 useIndex);
+
+		/**
+		 * @brief Finds the glyph of the codepoint, queuing its generation if it is not in the atlas yet.
+		 *
+		 * @param codepoint The unicode codepoint.
+		 * @param outPage Receives the page texture containing the glyph.
+		 * @return The glyph, nullptr if it is being generated or missing in the font.
+		 */
+		const FontGlyph* FindGlyph(u32 codepoint, Texture2D*& outPage);
+
+		/**
+		 * @brief Marks the page as used by a batch of draws, so it is not evicted while the batch is pending.
+		 *
+		 * @param page The page texture, other textures are ignored.
+		 * @param useIndex Index of the batch of draws.
+		 */
+		void MarkUsed(const Texture2D* page, u64 useIndex);
+
+		/**
+		 * @brief Gets the generation of the atlas, bumped whenever a page is evicted.
+		 * @note Atlas bounds of glyphs looked up in an older generation may point to other glyphs.
+		 *
+		 * @return The generation.
+		 */
+		u64 GetGeneration() const { return m_Generation; }
+
+		/**
+		 * @brief Whether the font has no glyph for the codepoint.
+		 *
+		 * @param codepoint The unicode codepoint.
+		 * @return True if the glyph is known to be missing.
+		 */
+		bool IsMissing(u32 codepoint) const { return m_Missing.contains(codepoint); }
+
+		/**
+		 * @brief Gets the texture of the page.
+		 *
+		 * @param index Index of the page, the first page always exists.
+		 * @return The texture of the page.
+		 */
+		Texture2D* GetPage(u32 index) const { return m_Pages[index].Texture; }
+
+		/**
+		 * @brief Gets the memory held by the pages.
+		 *
+		 * @return The size in bytes.
+		 */
+		u64 GetMemorySize() const;
+
+	private:
+		static constexpr u32 NoPage = ~0u; /**< Page index of glyphs without a bitmap (whitespace). */
+
+		/**
+		 * @brief Row of glyphs inside an atlas page.
+		 */
+		struct AtlasShelf
+		{
+			i32 Y;      /**< Bottom edge of the shelf. */
+			i32 Height; /**< Height of the shelf. */
+			i32 NextX;  /**< Left edge of the next glyph placed on the shelf. */
+		};
+
+		/**
+		 * @brief Single texture of the atlas.
+		 */
+		struct AtlasPage
+		{
+			Texture2D* Texture = nullptr;    /**< The page texture. */
+			std::vector<AtlasShelf> Shelves; /**< Shelves opened so far, from the bottom up. */
+			i32 NextShelfY = 0;              /**< Bottom edge of the next shelf. */
+			u64 LastUsed   = 0;              /**< Value of m_UseIndex when a glyph of the page was used last. */
+		};
+
+		/**
+		 * @brief Glyph packed into the atlas.
+		 */
+		struct ResidentGlyph
+		{
+			FontGlyph Glyph; /**< Placement of the glyph, atlas bounds are inside the page. */
+			u32 Page;        /**< Index of the page, NoPage for whitespace. */
+		};
+
+		std::filesystem::path m_Path;  /**< Path to the font file. */
+		const u8* m_Data    = nullptr; /**< Font file in memory, used instead of m_Path. */
+		u64 m_DataSize      = 0;       /**< Size of the font file in memory. */
+		f64 m_GeometryScale = 1.0;     /**< Scale from font units to em units. */
+
+		std::vector<AtlasPage> m_Pages;                  /**< The atlas pages. */
+		std::unordered_map<u32, ResidentGlyph> m_Glyphs; /**< Glyphs packed into the pages. */
+		std::unordered_set<u32> m_Requested;             /**< Glyphs queued or being generated. */
+		std::unordered_set<u32> m_Missing;               /**< Codepoints the font has no glyph for. */
+		u64 m_UseIndex   = 0;                            /**< Use index passed to the last Update(). */
+		u64 m_Generation = 0;                            /**< Bumped by every EvictPage(). */
+
+		std::vector<std::thread> m_Workers; /**< The worker threads. */
+
+		std::deque<u32> m_Requests;                  /**< Codepoints waiting for a worker. */
+		std::mutex m_RequestsMutex;                  /**< Guards m_Requests and m_IsStopping. */
+		std::condition_variable m_RequestsCondition; /**< Wakes the workers up. */
+		bool m_IsStopping = false;                   /**< Whether the workers should exit. */
+
+		std::deque<GeneratedGlyph> m_Generated; /**< Glyphs waiting for the main thread. */
+		std::mutex m_GeneratedMutex;            /**< Guards m_Generated. */
+
+		/**
+		 * @brief Queues the generation of the glyph unless it is already queued.
+		 *
+		 * @param codepoint The unicode codepoint.
+		 */
+		void Request(u32 codepoint);
+
+		/**
+		 * @brief Finds room for a bitmap, adding or evicting a page if needed.
+		 *
+		 * @param width Width of the bitmap.
+		 * @param height Height of the bitmap.
+		 * @param outPage Receives the index of the page.
+		 * @param outX Receives the left edge of the room.
+		 * @param outY Receives the bottom edge of the room.
+		 * @return Whether any room was found.
+		 */
+		bool Pack(i32 width, i32 height, u32& outPage, i32& outX, i32& outY);
+
+		/**
+		 * @brief Drops all glyphs of the page and clears its texels.
+		 *
+		 * @param index Index of the page.
+		 */
+		void EvictPage(u32 index);
+
+		/**
+		 * @brief Body of every worker thread.
+		 */
+		void WorkerLoop();
+	};
+
+} // namespace SW
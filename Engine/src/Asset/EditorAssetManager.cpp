@@ -2,54 +2,214 @@
 
 #include "AssetLoader.hpp"
 
+#include <algorithm>
+
+#include "Core/Utils/Timer.hpp"
+#include "GUI/Editor/EditorResources.hpp"
+#include "Sprite.hpp"
+
 namespace SW
 {
 
 	EditorAssetManager::~EditorAssetManager()
 	{
+		m_AsyncLoader.reset(); // workers must not touch the registry while it is being destroyed
+
 		for (std::pair<AssetHandle, Asset*> pair : m_Registry)
 		{
-			delete pair.second;
+			if (!IsPlaceholder(pair.second))
+				delete pair.second;
 		}
+
+		delete m_PlaceholderSprite;
 	}
 
 	Asset** EditorAssetManager::GetAssetRaw(AssetHandle handle)
 	{
 		Asset** element = &m_Registry[handle];
 
-		if (*element != nullptr)
-			return element;
+		if (*element == nullptr) // otherwise loaded, or a placeholder of an asset which is still loading
+		{
+			if (!IsValid(handle))
+				return nullptr;
+
+			if (GetAssetState(handle) == AssetState::Invalid)
+				return element; // failed to load and there is no placeholder, not retried until reloaded
+
+			m_AsyncStates.erase(handle); // loaded synchronously, the asynchronous result (if any) will be discarded
+
+			const AssetMetaData& metadata = GetAssetMetaData(handle);
+
+			BeginLoad(handle);
+
+			Asset* newAsset = AssetLoader::TryLoadAsset(metadata);
+
+			EndLoad(metadata, newAsset);
+
+			if (newAsset)
+			{
+				newAsset->m_Handle = handle;
+			}
+			else
+			{
+				m_AsyncStates[handle] = AssetState::Invalid; // not retried until reloaded
+
+				newAsset = GetPlaceholder(metadata.Type);
+
+				APP_ERROR("Asset {} [{}] failed to load", metadata.Path.string(), handle);
+			}
+
+			*element = newAsset; // the registry nodes are stable, nested loads do not move the slot
+
+			m_Slots.Set(handle, newAsset);
+		}
+
+		TrackAccess(handle);
+
+		return element;
+	}
+
+	const Asset** EditorAssetManager::GetAsset(AssetHandle handle)
+	{
+		return const_cast<const Asset**>(GetAssetRaw(handle));
+	}
+
+	Asset** EditorAssetManager::GetAssetRawAsync(AssetHandle handle)
+	{
+		Asset** element = &m_Registry[handle];
+
+		if (*element != nullptr || m_AsyncStates.contains(handle))
+		{
+			TrackAccess(handle);
+
+			return element; // loaded, loading or failed to load
+		}
 
 		if (!IsValid(handle))
 			return nullptr;
 
 		const AssetMetaData& metadata = GetAssetMetaData(handle);
 
-		Asset* newAsset    = AssetLoader::TryLoadAsset(metadata);
-		newAsset->m_Handle = handle;
+		m_AsyncStates[handle] = AssetState::Loading;
+		*element              = GetPlaceholder(metadata.Type);
+
+		m_Slots.Set(handle, *element);
+
+		GetAsyncLoader().Enqueue(metadata);
 
-		m_Registry[handle] = newAsset;
+		TrackAccess(handle);
 
-		return &m_Registry[handle];
+		return element;
 	}
 
-	const Asset** EditorAssetManager::GetAsset(AssetHandle handle)
+	AssetState EditorAssetManager::GetAssetState(AssetHandle handle) const
 	{
-		return const_cast<const Asset**>(GetAssetRaw(handle));
+		if (!IsValid(handle))
+			return AssetState::Invalid;
+
+		auto state = m_AsyncStates.find(handle);
+
+		if (state != m_AsyncStates.end())
+			return state->second;
+
+		auto it = m_Registry.find(handle);
+
+		return it != m_Registry.end() && it->second ? AssetState::Loaded : AssetState::None;
+	}
+
+	void EditorAssetManager::ProcessAsyncLoads(f32 budget)
+	{
+		if (!m_AsyncLoader)
+			return;
+
+		PROFILE_FUNCTION();
+
+		Timer timer;
+
+		DecodedAsset decoded;
+
+		while (timer.ElapsedMillis() < budget && m_AsyncLoader->TryPopDecoded(decoded))
+		{
+			const AssetHandle handle = decoded.MetaData.Handle;
+
+			auto reload = m_PendingReloads.find(handle);
+
+			if (reload != m_PendingReloads.end() && reload->second.PendingDecodes > 0)
+			{
+				if (--reload->second.PendingDecodes == 0) // the older decodes could have read the file before a change
+					reload->second.Data = std::move(decoded.Data);
+
+				continue;
+			}
+
+			auto state = m_AsyncStates.find(handle);
+
+			if (state == m_AsyncStates.end() || state->second != AssetState::Loading || !IsValid(handle))
+				continue; // unloaded or loaded synchronously in the meantime
+
+			// Finalizing may request dependencies, which can rehash the maps - do not keep iterators around.
+			BeginLoad(handle);
+
+			Asset* newAsset = AssetLoader::FinalizeAsset(decoded.MetaData, decoded.Data.get());
+
+			EndLoad(decoded.MetaData, newAsset);
+
+			if (!newAsset)
+			{
+				m_AsyncStates[handle] = AssetState::Invalid;
+
+				APP_ERROR("Asset {} [{}] failed to load asynchronously", decoded.MetaData.Path.string(), handle);
+
+				continue;
+			}
+
+			newAsset->m_Handle = handle;
+			m_Registry[handle] = newAsset; // every holder of the slot switches from the placeholder
+			m_Slots.Set(handle, newAsset); // cached slots of the placeholder go stale
+
+			m_AsyncStates.erase(handle);
+		}
+
+		// Swapped strictly in order, a dependent waits until all its dependencies are reloaded.
+		while (!m_ReloadOrder.empty() && timer.ElapsedMillis() < budget)
+		{
+			const AssetHandle handle = m_ReloadOrder.front();
+
+			auto reload = m_PendingReloads.find(handle);
+
+			if (reload->second.PendingDecodes > 0)
+				break;
+
+			const Scope<AssetLoadData> data = std::move(reload->second.Data);
+
+			m_PendingReloads.erase(reload);
+			m_ReloadOrder.pop_front();
+
+			FinishReload(handle, data.get());
+		}
 	}
 
 	bool EditorAssetManager::ForceUnload(AssetHandle handle)
 	{
+		m_AsyncStates.erase(handle);
+
+		CancelReload(handle);
+
 		if (!ContainsAsset(handle))
 		{
 			return true; // Asset was not loaded
 		}
 
 		Asset* asset = m_Registry.at(handle);
-		if (asset)
+		if (asset && !IsPlaceholder(asset))
+		{
+			ReleaseResidency(handle);
+
 			delete asset;
+		}
 
 		m_Registry.erase(handle);
+		m_Slots.Set(handle, nullptr);
 
 		APP_INFO("Asset with handle {0} was unloaded", handle);
 
@@ -61,20 +221,346 @@ namespace SW
 		if (!ContainsAsset(handle))
 			return false;
 
+		m_AsyncStates.erase(handle);
+
+		CancelReload(handle); // reloaded right away
+
 		const AssetMetaData& metadata = GetAssetMetaData(handle);
 
 		Asset* oldAsset = m_Registry[handle];
 
-		Asset* reloadedAsset    = AssetLoader::TryLoadAsset(metadata);
-		reloadedAsset->m_Handle = handle;
+		const std::vector<AssetHandle> previousDependencies = m_Dependencies.GetDependencies(handle);
+
+		ReleaseResidency(handle);
 
-		m_Registry[handle] = reloadedAsset;
+		BeginLoad(handle);
 
-		delete oldAsset;
+		Asset* reloadedAsset = AssetLoader::TryLoadAsset(metadata);
+
+		if (!reloadedAsset)
+		{
+			for (AssetHandle dependency : previousDependencies)
+			{
+				RecordDependency(dependency); // still used by the previous version
+			}
+		}
+
+		// Placeholders are not resident, the previous version stays resident if the reload fails
+		const Asset* residentAsset = reloadedAsset || IsPlaceholder(oldAsset) ? reloadedAsset : oldAsset;
+
+		EndLoad(metadata, residentAsset);
+
+		if (!reloadedAsset)
+		{
+			if (!oldAsset || IsPlaceholder(oldAsset))
+				m_AsyncStates[handle] = AssetState::Invalid;
+
+			APP_ERROR("Asset {} [{}] failed to reload, the previous version is kept", metadata.Path.string(), handle);
+
+			return false;
+		}
+
+		reloadedAsset->m_Handle = handle;
+		m_Registry[handle]      = reloadedAsset;
+		m_Slots.Set(handle, reloadedAsset);
+
+		if (!IsPlaceholder(oldAsset))
+			delete oldAsset;
 
 		APP_INFO("Asset with handle {0} was reloaded", handle);
 
 		return true;
 	}
 
+	bool EditorAssetManager::ReloadWithDependents(AssetHandle handle)
+	{
+		if (!IsValid(handle))
+			return false;
+
+		bool isReloading = false;
+
+		auto it = m_Registry.find(handle);
+
+		if (it != m_Registry.end() && it->second)
+		{
+			if (m_AsyncStates.contains(handle))
+				isReloading = ForceReload(handle); // the running load could have read the file before it changed
+			else
+				isReloading = QueueReload(handle);
+		}
+
+		// Also when the asset itself is not loaded, e.g. a font source is only read by its fonts.
+		for (AssetHandle dependent : m_Dependencies.CollectDependents(handle))
+		{
+			isReloading |= QueueReload(dependent);
+		}
+
+		return isReloading;
+	}
+
+	void EditorAssetManager::RecordDependency(AssetHandle dependency)
+	{
+		if (m_LoadingStack.empty())
+			return;
+
+		// Counted once per edge, released together with the edges of the dependent.
+		if (m_Dependencies.AddDependency(m_LoadingStack.back(), dependency))
+			m_Residency[dependency].References++;
+	}
+
+	void EditorAssetManager::AddReference(AssetHandle handle)
+	{
+		if (handle)
+			m_Residency[handle].References++;
+	}
+
+	void EditorAssetManager::RemoveReference(AssetHandle handle)
+	{
+		auto it = m_Residency.find(handle);
+
+		if (it != m_Residency.end() && it->second.References > 0)
+			it->second.References--;
+	}
+
+	// Only the types whose holders either resolve the handle through the manager every time (components) or hold a
+	// counted reference (dependent assets) can be evicted. Other types are kept by raw slots (e.g. editor panels).
+	static bool IsEvictable(AssetType type)
+	{
+		return type == AssetType::Texture2D || type == AssetType::Sprite || type == AssetType::Font;
+	}
+
+	void EditorAssetManager::EnforceMemoryBudgets()
+	{
+		m_FrameIndex++;
+
+		for (auto&& [type, statistics] : m_MemoryStatistics)
+		{
+			if (statistics.Budget != 0 && statistics.ResidentBytes > statistics.Budget)
+				EvictAssets(type, statistics);
+		}
+	}
+
+	void EditorAssetManager::SetMemoryBudget(AssetType type, u64 bytes)
+	{
+		if (!IsEvictable(type))
+		{
+			APP_WARN("Assets of type {} can not be evicted, the memory budget is ignored.",
+			         Asset::GetStringifiedAssetType(type));
+
+			return;
+		}
+
+		m_MemoryStatistics[type].Budget = bytes;
+	}
+
+	void EditorAssetManager::TrackAccess(AssetHandle handle)
+	{
+		m_Residency[handle].LastAccessFrame = m_FrameIndex;
+
+		RecordDependency(handle);
+	}
+
+	void EditorAssetManager::BeginLoad(AssetHandle handle)
+	{
+		m_LoadingStack.emplace_back(handle);
+	}
+
+	void EditorAssetManager::EndLoad(const AssetMetaData& metadata, const Asset* asset)
+	{
+		m_LoadingStack.pop_back();
+
+		if (!asset)
+			return;
+
+		AssetResidency& residency = m_Residency[metadata.Handle];
+		residency.Type            = metadata.Type;
+		residency.Size            = asset->GetMemorySize();
+
+		AssetMemoryStatistics& statistics = m_MemoryStatistics[metadata.Type];
+		statistics.ResidentBytes += residency.Size;
+		statistics.ResidentCount++;
+	}
+
+	void EditorAssetManager::ReleaseResidency(AssetHandle handle)
+	{
+		for (AssetHandle dependency : m_Dependencies.GetDependencies(handle))
+		{
+			RemoveReference(dependency);
+		}
+
+		m_Dependencies.ClearDependencies(handle);
+
+		auto it = m_Residency.find(handle);
+
+		if (it == m_Residency.end())
+			return;
+
+		AssetResidency& residency = it->second;
+
+		if (residency.Type != AssetType::Unknown)
+		{
+			AssetMemoryStatistics& statistics = m_MemoryStatistics[residency.Type];
+			statistics.ResidentBytes -= std::min(statistics.ResidentBytes, residency.Size);
+			statistics.ResidentCount -= std::min(statistics.ResidentCount, 1u);
+		}
+
+		residency.Type = AssetType::Unknown;
+		residency.Size = 0;
+	}
+
+	void EditorAssetManager::EvictAssets(AssetType type, AssetMemoryStatistics& statistics)
+	{
+		PROFILE_FUNCTION();
+
+		std::vector<std::pair<u64, AssetHandle>> candidates; // last access frame, handle
+
+		for (auto&& [handle, residency] : m_Residency)
+		{
+			if (residency.Type != type || residency.References != 0 || residency.Size == 0)
+				continue;
+
+			if (residency.LastAccessFrame + 1 >= m_FrameIndex || m_AsyncStates.contains(handle) ||
+			    m_PendingReloads.contains(handle))
+				continue; // used during the last frame or being (re)loaded
+
+			candidates.emplace_back(residency.LastAccessFrame, handle);
+		}
+
+		std::sort(candidates.begin(), candidates.end());
+
+		for (auto&& [lastAccessFrame, handle] : candidates)
+		{
+			if (statistics.ResidentBytes <= statistics.Budget)
+				break;
+
+			auto it = m_Registry.find(handle);
+
+			if (it == m_Registry.end() || !it->second || IsPlaceholder(it->second))
+				continue;
+
+			ReleaseResidency(handle);
+
+			delete it->second;
+			it->second = nullptr; // the slot stays, the next access loads the asset again
+
+			m_Slots.Set(handle, nullptr);
+
+			statistics.Evictions++;
+		}
+	}
+
+	AsyncAssetLoader& EditorAssetManager::GetAsyncLoader()
+	{
+		if (!m_AsyncLoader)
+		{
+			const u32 cores   = std::thread::hardware_concurrency();
+			const u32 workers = std::clamp(cores / 2, 1u, 4u); // leave the rest for the main and render threads
+
+			m_AsyncLoader = CreateScope<AsyncAssetLoader>(workers);
+		}
+
+		return *m_AsyncLoader;
+	}
+
+	bool EditorAssetManager::QueueReload(AssetHandle handle)
+	{
+		auto it = m_Registry.find(handle);
+
+		if (it == m_Registry.end() || !it->second || !IsValid(handle) || m_AsyncStates.contains(handle))
+			return false; // not loaded (or still loading), the next access loads the current version
+
+		std::erase(m_ReloadOrder, handle); // requested again, moved after the assets requested together with it
+		m_ReloadOrder.emplace_back(handle);
+
+		m_PendingReloads[handle].PendingDecodes++;
+
+		GetAsyncLoader().Enqueue(GetAssetMetaData(handle));
+
+		return true;
+	}
+
+	void EditorAssetManager::CancelReload(AssetHandle handle)
+	{
+		if (m_PendingReloads.erase(handle)) // decodes still running are dropped by ProcessAsyncLoads()
+			std::erase(m_ReloadOrder, handle);
+	}
+
+	void EditorAssetManager::FinishReload(AssetHandle handle, AssetLoadData* data)
+	{
+		auto it = m_Registry.find(handle);
+
+		if (it == m_Registry.end() || !it->second || !IsValid(handle))
+			return; // unloaded in the meantime
+
+		Asset* oldAsset = it->second;
+
+		const AssetMetaData& metadata = GetAssetMetaData(handle);
+
+		const std::vector<AssetHandle> previousDependencies = m_Dependencies.GetDependencies(handle);
+
+		ReleaseResidency(handle);
+
+		// Finalizing may request dependencies, which can rehash the registry - do not keep the iterator around.
+		BeginLoad(handle);
+
+		Asset* reloadedAsset = AssetLoader::FinalizeAsset(metadata, data);
+
+		if (!reloadedAsset)
+		{
+			for (AssetHandle dependency : previousDependencies)
+			{
+				RecordDependency(dependency); // still used by the previous version
+			}
+		}
+
+		EndLoad(metadata, reloadedAsset ? reloadedAsset : oldAsset);
+
+		if (!reloadedAsset)
+		{
+			APP_ERROR("Asset {} [{}] failed to reload, the previous version is kept", metadata.Path.string(), handle);
+
+			return;
+		}
+
+		reloadedAsset->m_Handle = handle;
+		m_Registry[handle]      = reloadedAsset;
+		m_Slots.Set(handle, reloadedAsset);
+
+		if (!IsPlaceholder(oldAsset))
+			delete oldAsset;
+
+		APP_INFO("Asset with handle {0} was reloaded", handle);
+	}
+
+	Asset* EditorAssetManager::GetPlaceholder(AssetType type)
+	{
+		switch (type)
+		{
+		case AssetType::Texture2D:
+			return EditorResources::MissingAssetIcon;
+		case AssetType::Sprite:
+		{
+			if (!m_PlaceholderSprite)
+			{
+				m_PlaceholderSprite = new Sprite();
+				m_PlaceholderSprite->SetTexture(&EditorResources::MissingAssetIcon);
+
+				m_PlaceholderSprite->TexCordLeftDown  = {0.f, 0.f};
+				m_PlaceholderSprite->TexCordRightDown = {1.f, 0.f};
+				m_PlaceholderSprite->TexCordUpRight   = {1.f, 1.f};
+				m_PlaceholderSprite->TexCordUpLeft    = {0.f, 1.f};
+			}
+
+			return m_PlaceholderSprite;
+		}
+		default:
+			return nullptr;
+		}
+	}
+
+	bool EditorAssetManager::IsPlaceholder(const Asset* asset) const
+	{
+		return asset && (asset == EditorResources::MissingAssetIcon || asset == m_PlaceholderSprite);
+	}
+
 } // namespace SW
@@ -1,20 +1,60 @@
 /**
  * @file EditorAssetManager.hpp
  * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
- * @version 0.1.1
+ * @version 0.1.7
  * @date 2024-04-07
  *
  * @copyright Copyright (c) 2024 Tycjan Fortuna
  */
 #pragma once
 
+#include <deque>
+
+#include "AssetDependencyGraph.hpp"
 #include "AssetLoader.hpp"
 #include "AssetManagerBase.hpp"
+#include "AsyncAssetLoader.hpp"
+#include "Core/Hash.hpp"
+#include "Core/Project/ProjectContext.hpp"
+#include "Core/Utils/FileSystem.hpp"
 #include "Core/Utils/Random.hpp"
 
 namespace SW
 {
 
+	class Sprite;
+
+	/**
+	 * @brief Memory statistics of a single asset type.
+	 */
+	struct AssetMemoryStatistics
+	{
+		u64 ResidentBytes = 0; /**< Memory held by the loaded assets of the type. */
+		u32 ResidentCount = 0; /**< Number of the loaded assets of the type. */
+		u64 Budget        = 0; /**< Memory budget of the type, 0 means unlimited. */
+		u32 Evictions     = 0; /**< Number of assets evicted since the project was opened. */
+	};
+
+	/**
+	 * @brief Residency bookkeeping of a single asset.
+	 */
+	struct AssetResidency
+	{
+		AssetType Type      = AssetType::Unknown; /**< Type of the asset, Unknown if it was never loaded. */
+		u32 References      = 0;                  /**< Number of assets and components referencing the asset. */
+		u64 LastAccessFrame = 0;                  /**< Frame of the last access through the manager. */
+		u64 Size            = 0;                  /**< Memory held by the asset, 0 if it is not loaded. */
+	};
+
+	/**
+	 * @brief Asset being reloaded in the background, see EditorAssetManager::ReloadWithDependents().
+	 */
+	struct PendingReload
+	{
+		Scope<AssetLoadData> Data; /**< Result of the latest decode, complete once no decode is pending. */
+		u32 PendingDecodes = 0;    /**< Decodes not picked up yet, only the latest one read the current file. */
+	};
+
 	class EditorAssetManager final : public AssetManagerBase
 	{
 	public:
@@ -37,25 +77,33 @@ namespace SW
 		{
 			Asset* newAsset = new T(std::forward<Args...>(args...));
 
-			std::map<AssetHandle, AssetMetaData>& avail = m_AvailRegistry.GetAvailableAssetsRaw();
-
 			AssetMetaData metadata;
-			metadata.Handle = Random::CreateID();
-			metadata.Path   = path;
-			metadata.Type   = T::GetStaticType();
+			metadata.Handle           = Random::CreateID();
+			metadata.Path             = path;
+			metadata.Type             = T::GetStaticType();
+			metadata.ModificationTime = 0;
 
-			avail[metadata.Handle]      = metadata;
 			m_Registry[metadata.Handle] = newAsset;
+			m_Slots.Set(metadata.Handle, newAsset);
 
 			newAsset->m_Handle = metadata.Handle;
 
 			AssetLoader::Serialize(metadata);
 
+			// Registered with the time and hash of the written file, so the watched write does not reload the asset.
+			const std::filesystem::path fullPath = ProjectContext::Get()->GetAssetDirectory() / metadata.Path;
+
+			metadata.ModificationTime = FileSystem::GetLastWriteTime(fullPath);
+			Hash::GenerateFileHash(fullPath, metadata.ContentHash);
+
+			m_AvailRegistry.Register(metadata);
+
 			return (T**)&m_Registry[metadata.Handle];
 		}
 
 		/**
 		 * @brief Get the asset.
+		 * 		  If loading fails the slot holds a placeholder (textures and sprites) or nullptr until reloaded.
 		 * @warning If the asset is not available, the nullptr will be returned.
 		 *
 		 * @param handle The handle of the asset.
@@ -65,6 +113,7 @@ namespace SW
 
 		/**
 		 * @brief Get the asset.
+		 * 		  If loading fails the slot holds a placeholder (textures and sprites) or nullptr until reloaded.
 		 * @warning If the asset is not available, the nullptr will be returned.
 		 *
 		 * @param handle The handle of the asset.
@@ -81,9 +130,111 @@ namespace SW
 		/**
 		 * @brief Force reload the asset.
 		 * @param handle The handle of the asset.
+		 * @return Whether the asset was reloaded, the previous version is kept otherwise.
 		 */
 		bool ForceReload(AssetHandle handle) override;
 
+		/**
+		 * @brief Reloads the asset and all loaded assets depending on it in the background. The files are decoded
+		 * 		  on the worker threads, ProcessAsyncLoads() then swaps the assets in topological order (dependencies
+		 * 		  first). Until then the previous versions stay in use.
+		 * @note Assets which are not loaded are skipped, the next access loads their current version.
+		 *
+		 * @param handle The handle of the changed asset.
+		 * @return Whether any asset is being reloaded.
+		 */
+		bool ReloadWithDependents(AssetHandle handle) override;
+
+		/**
+		 * @brief Records that the asset being loaded depends on the asset without loading it through the manager.
+		 *
+		 * @param dependency The handle of the dependency.
+		 */
+		void RecordDependency(AssetHandle dependency) override;
+
+		/**
+		 * @brief Get the asset, if it is not loaded yet it is decoded on the worker threads and finished by
+		 * 		  ProcessAsyncLoads(). Until then the slot holds a placeholder (textures and sprites) or nullptr.
+		 *
+		 * @param handle The handle of the asset.
+		 * @return Asset** The asset slot, nullptr if the asset is not available.
+		 */
+		Asset** GetAssetRawAsync(AssetHandle handle) override;
+
+		/**
+		 * @brief Get the load state of the asset.
+		 *
+		 * @param handle The handle of the asset.
+		 * @return AssetState The state of the asset.
+		 */
+		AssetState GetAssetState(AssetHandle handle) const override;
+
+		/**
+		 * @brief Finishes the decoded assets on the main thread until the budget is exhausted.
+		 *
+		 * @param budget The time budget in milliseconds.
+		 */
+		void ProcessAsyncLoads(f32 budget) override;
+
+		/**
+		 * @brief Adds a reference to the asset, referenced assets are never evicted.
+		 *
+		 * @param handle The handle of the asset.
+		 */
+		void AddReference(AssetHandle handle) override;
+
+		/**
+		 * @brief Removes a reference added by AddReference().
+		 *
+		 * @param handle The handle of the asset.
+		 */
+		void RemoveReference(AssetHandle handle) override;
+
+		/**
+		 * @brief Evicts the least recently used unreferenced assets of the types exceeding their memory budget.
+		 * 		  Assets used during the last frame are kept.
+		 */
+		void EnforceMemoryBudgets() override;
+
+		/**
+		 * @brief Set the memory budget of the asset type.
+		 * @note Only textures, sprites and fonts can be evicted, budgets of other types are ignored.
+		 *
+		 * @param type The type of the assets.
+		 * @param bytes The budget in bytes, 0 means unlimited.
+		 */
+		void SetMemoryBudget(AssetType type, u64 bytes);
+
+		/**
+		 * @brief Get the memory statistics of all asset types that were loaded or have a budget.
+		 *
+		 * @return const std::map<AssetType, AssetMemoryStatistics>& The statistics per type.
+		 */
+		const std::map<AssetType, AssetMemoryStatistics>& GetMemoryStatistics() const { return m_MemoryStatistics; }
+
+		/**
+		 * @brief Get the assets the asset referenced while it was loading (e.g. the sprites of an animation).
+		 * @note Only known for the loaded assets.
+		 *
+		 * @param handle The handle of the asset.
+		 * @return const std::vector<AssetHandle>& The dependencies, empty if the asset is not loaded.
+		 */
+		const std::vector<AssetHandle>& GetDependencies(AssetHandle handle) const
+		{
+			return m_Dependencies.GetDependencies(handle);
+		}
+
+		/**
+		 * @brief Get the loaded assets which referenced the asset while they were loading.
+		 *
+		 * @param handle The handle of the asset.
+		 * @return const std::vector<AssetHandle>& The direct dependents.
+		 */
+		const std::vector<AssetHandle>& GetDependents(AssetHandle handle) const
+		{
+			return m_Dependencies.GetDependents(handle);
+		}
+
 		/**
 		 * @brief Count the assets.
 		 *
@@ -109,6 +260,105 @@ namespace SW
 	private:
 		std::unordered_map<AssetHandle, Asset*> m_Registry; // contains all loaded assets
 		// std::unordered_map<AssetHandle, Asset*> m_Cache; // contains all cached memory-only assets
+
+		Scope<AsyncAssetLoader> m_AsyncLoader; // created on the first asynchronous request
+		std::unordered_map<AssetHandle, AssetState> m_AsyncStates; // assets being loaded or failed to load
+
+		Sprite* m_PlaceholderSprite = nullptr; // shown in place of sprites which are still loading
+
+		std::unordered_map<AssetHandle, AssetResidency> m_Residency; // references and usage of the assets
+		std::map<AssetType, AssetMemoryStatistics> m_MemoryStatistics; // resident memory per asset type
+		std::vector<AssetHandle> m_LoadingStack; // assets being loaded, used to capture their dependencies
+		AssetDependencyGraph m_Dependencies;     // dependencies captured while the assets were loading
+		u64 m_FrameIndex = 1; // incremented every EnforceMemoryBudgets() call
+
+		std::unordered_map<AssetHandle, PendingReload> m_PendingReloads; // assets being reloaded in the background
+		std::deque<AssetHandle> m_ReloadOrder; // pending reloads in topological order, dependencies first
+
+		/**
+		 * @brief Get the worker threads decoding the assets, created on the first use.
+		 *
+		 * @return AsyncAssetLoader& The loader.
+		 */
+		AsyncAssetLoader& GetAsyncLoader();
+
+		/**
+		 * @brief Queues the loaded asset for the background reload, after all already queued ones.
+		 *
+		 * @param handle The handle of the asset.
+		 * @return Whether the asset is queued, false if it is not loaded.
+		 */
+		bool QueueReload(AssetHandle handle);
+
+		/**
+		 * @brief Drops the pending background reload of the asset, e.g. because it was unloaded.
+		 *
+		 * @param handle The handle of the asset.
+		 */
+		void CancelReload(AssetHandle handle);
+
+		/**
+		 * @brief Swaps the asset for its reloaded version, a failed reload keeps the previous version.
+		 *
+		 * @param handle The handle of the asset.
+		 * @param data The latest result of AssetLoader::DecodeAsset().
+		 */
+		void FinishReload(AssetHandle handle, AssetLoadData* data);
+
+		/**
+		 * @brief Marks the asset as used in this frame. Accesses made while another asset is loading are
+		 * 		  recorded as its dependencies and hold a reference until the dependent asset is unloaded.
+		 *
+		 * @param handle The handle of the accessed asset.
+		 */
+		void TrackAccess(AssetHandle handle);
+
+		/**
+		 * @brief Starts capturing the dependencies of the asset being loaded.
+		 *
+		 * @param handle The handle of the asset.
+		 */
+		void BeginLoad(AssetHandle handle);
+
+		/**
+		 * @brief Stops capturing the dependencies and accounts the memory of the loaded asset.
+		 *
+		 * @param metadata The metadata of the asset.
+		 * @param asset The loaded asset, nullptr if the load failed.
+		 */
+		void EndLoad(const AssetMetaData& metadata, const Asset* asset);
+
+		/**
+		 * @brief Removes the memory of the asset from the statistics and releases its dependencies (their references
+		 * 		  and edges).
+		 *
+		 * @param handle The handle of the asset being unloaded.
+		 */
+		void ReleaseResidency(AssetHandle handle);
+
+		/**
+		 * @brief Evicts the least recently used assets of the type until it fits its budget.
+		 *
+		 * @param type The type of the assets.
+		 * @param statistics The statistics of the type.
+		 */
+		void EvictAssets(AssetType type, AssetMemoryStatistics& statistics);
+
+		/**
+		 * @brief Get the placeholder shown while the asset of the given type is loading.
+		 *
+		 * @param type The type of the asset.
+		 * @return Asset* The placeholder, nullptr if the type has none.
+		 */
+		Asset* GetPlaceholder(AssetType type);
+
+		/**
+		 * @brief Check if the asset is one of the placeholders (not owned by the registry).
+		 *
+		 * @param asset The asset.
+		 * @return If the asset is a placeholder.
+		 */
+		bool IsPlaceholder(const Asset* asset) const;
 	};
 
 } // namespace SW
@@ -1,5 +1,12 @@
 #include "Font.hpp"
 
+#include <atomic>
+
+#include "DynamicGlyphAtlas.hpp"
+
+#undef INFINITE
+#include <msdf-atlas-gen/msdf-atlas-gen.h>
+
 #include "Core/OpenGL/Texture2D.hpp"
 #include "Core/Project/Project.hpp"
 #include "Core/Project/ProjectContext.hpp"
@@ -7,14 +14,24 @@
 namespace SW
 {
 
-	Font::Font(const FontSpecification& spec)
+	static std::atomic<u64> s_NextInstanceID = 1; // fonts are loaded on the asset loader workers too
+
+	Font::Font(const FontSpecification& spec) : m_InstanceID(s_NextInstanceID++)
 	{
+		if (spec.Charset == FontCharsetType::Dynamic)
+		{
+			m_DynamicAtlas = CreateScope<DynamicGlyphAtlas>(spec, m_Metrics);
+
+			return;
+		}
+
 		std::string path            = spec.Path.string();
 		msdfgen::FreetypeHandle* ft = msdfgen::initializeFreetype();
 
 		ASSERT(ft, "MSDFGEN failed to initialize");
 
-		msdfgen::FontHandle* font = msdfgen::loadFont(ft, path.c_str());
+		msdfgen::FontHandle* font = spec.Data ? msdfgen::loadFontData(ft, spec.Data, (int)spec.DataSize)
+		                                      : msdfgen::loadFont(ft, path.c_str());
 
 		ASSERT(font, "Failed to load the font: {}", path);
 		msdf_atlas::Charset charset;
@@ -30,13 +47,14 @@ namespace SW
 				charset.add(i);
 		}
 
-		m_Data.FontGeometry = msdf_atlas::FontGeometry(&m_Data.Glyphs);
-		m_Data.FontGeometry.loadCharset(font, 1.0, charset);
+		std::vector<msdf_atlas::GlyphGeometry> glyphs;
+		msdf_atlas::FontGeometry fontGeometry(&glyphs);
+		fontGeometry.loadCharset(font, 1.0, charset);
 
 		if (spec.ApplyMSDFColoring)
 		{
 			const f64 maxCornerAngle = 3.0;
-			for (msdf_atlas::GlyphGeometry& glyph : m_Data.Glyphs) // Apply MSDF edge coloring.
+			for (msdf_atlas::GlyphGeometry& glyph : glyphs) // Apply MSDF edge coloring.
 				glyph.edgeColoring(&msdfgen::edgeColoringInkTrap, maxCornerAngle, 0);
 		}
 
@@ -53,53 +71,188 @@ namespace SW
 		}
 		packer.setPixelRange(2.0);
 		packer.setMiterLimit(1.0);
-		packer.pack(m_Data.Glyphs.data(), (i32)m_Data.Glyphs.size());
+		packer.pack(glyphs.data(), (i32)glyphs.size());
 
 		i32 width = 0, height = 0;
 		packer.getDimensions(width, height);
 
-		if (spec.PreloadedAtlas)
+		msdf_atlas::ImmediateAtlasGenerator<
+		    f32,                       // pixel type of buffer for individual glyphs depends on generator function
+		    3,                         // number of atlas color channels
+		    msdf_atlas::msdfGenerator, // function to generate bitmaps for individual glyphs
+		    msdf_atlas::BitmapAtlasStorage<msdf_atlas::byte, 3> // class that stores the atlas bitmap
+		    >
+		    generator(width, height);
+
+		msdf_atlas::GeneratorAttributes attributes;
+		attributes.config.overlapSupport = true;
+		attributes.scanlinePass          = true;
+
+		generator.setAttributes(attributes);
+		generator.setThreadCount(4);
+		generator.generate(glyphs.data(), (i32)glyphs.size());
+
+		msdfgen::BitmapConstRef<u8, 3> bitmap = (msdfgen::BitmapConstRef<u8, 3>)generator.atlasStorage();
+
+		TextureSpecification texSpec;
+		texSpec.Width  = bitmap.width;
+		texSpec.Height = bitmap.height;
+		texSpec.Format = ImageFormat::RGB8;
+
+		m_AtlasTexture = new Texture2D(texSpec);
+		m_AtlasTexture->SetData((void*)bitmap.pixels, bitmap.width * bitmap.height * 3);
+
+		const msdfgen::FontMetrics& metrics = fontGeometry.getMetrics();
+
+		m_Metrics.LineHeight = metrics.lineHeight;
+		m_Metrics.AscenderY  = metrics.ascenderY;
+		m_Metrics.DescenderY = metrics.descenderY;
+
+		// Kerning is keyed by FreeType glyph indices, the renderer works with codepoints.
+		std::unordered_map<i32, u32> indexToCodepoint;
+
+		m_Glyphs.reserve(glyphs.size());
+
+		for (const msdf_atlas::GlyphGeometry& geometry : glyphs)
 		{
-			m_AtlasTexture = spec.PreloadedAtlas;
+			f64 al, ab, ar, at;
+			geometry.getQuadAtlasBounds(al, ab, ar, at);
+
+			f64 pl, pb, pr, pt;
+			geometry.getQuadPlaneBounds(pl, pb, pr, pt);
+
+			FontGlyph glyph;
+			glyph.Codepoint = (u32)geometry.getCodepoint();
+			glyph.Advance   = (f32)geometry.getAdvance();
+			glyph.PlaneMin  = {(f32)pl, (f32)pb};
+			glyph.PlaneMax  = {(f32)pr, (f32)pt};
+			glyph.AtlasMin  = {(f32)al, (f32)ab};
+			glyph.AtlasMax  = {(f32)ar, (f32)at};
+
+			m_Glyphs.emplace_back(glyph);
+
+			indexToCodepoint[geometry.getIndex()] = glyph.Codepoint;
 		}
-		else
+
+		for (auto&& [pair, offset] : fontGeometry.getKerning())
 		{
-			msdf_atlas::ImmediateAtlasGenerator<
-			    f32,                       // pixel type of buffer for individual glyphs depends on generator function
-			    3,                         // number of atlas color channels
-			    msdf_atlas::msdfGenerator, // function to generate bitmaps for individual glyphs
-			    msdf_atlas::BitmapAtlasStorage<msdf_atlas::byte, 3> // class that stores the atlas bitmap
-			    >
-			    generator(width, height);
-
-			msdf_atlas::GeneratorAttributes attributes;
-			attributes.config.overlapSupport = true;
-			attributes.scanlinePass          = true;
-
-			generator.setAttributes(attributes);
-			generator.setThreadCount(4);
-			generator.generate(m_Data.Glyphs.data(), (i32)m_Data.Glyphs.size());
-
-			msdfgen::BitmapConstRef<u8, 3> bitmap = (msdfgen::BitmapConstRef<u8, 3>)generator.atlasStorage();
-
-			TextureSpecification texSpec;
-			texSpec.Width  = bitmap.width;
-			texSpec.Height = bitmap.height;
-			texSpec.Format = ImageFormat::RGB8;
-
-			m_AtlasTexture = new Texture2D(texSpec);
-			m_AtlasTexture->SetData((void*)bitmap.pixels, bitmap.width * bitmap.height * 3);
+			auto first  = indexToCodepoint.find(pair.first);
+			auto second = indexToCodepoint.find(pair.second);
+
+			if (first != indexToCodepoint.end() && second != indexToCodepoint.end())
+				m_Kerning.emplace_back(FontKerning{first->second, second->second, (f32)offset});
 		}
 
+		BuildLookupTables();
+
 		msdfgen::destroyFont(font);
 		msdfgen::deinitializeFreetype(ft);
 
 		SYSTEM_INFO("Font `{}` created successfully!", path);
 	}
 
+	Font::Font(const FontMetrics& metrics, std::vector<FontGlyph>&& glyphs, std::vector<FontKerning>&& kerning,
+	           Texture2D* atlas)
+	    : m_Metrics(metrics), m_Glyphs(std::move(glyphs)), m_Kerning(std::move(kerning)), m_AtlasTexture(atlas),
+	      m_InstanceID(s_NextInstanceID++)
+	{
+		BuildLookupTables();
+	}
+
 	Font::~Font()
 	{
 		delete m_AtlasTexture;
 	}
 
+	const FontGlyph* Font::GetGlyph(u32 codepoint) const
+	{
+		if (codepoint < m_AsciiGlyphIndices.size())
+		{
+			const u32 index = m_AsciiGlyphIndices[codepoint];
+
+			return index ? &m_Glyphs[index - 1] : nullptr;
+		}
+
+		auto it = m_GlyphIndices.find(codepoint);
+
+		return it != m_GlyphIndices.end() ? &m_Glyphs[it->second] : nullptr;
+	}
+
+	const FontGlyph* Font::FindGlyph(u32 codepoint, Texture2D*& outAtlas)
+	{
+		if (m_DynamicAtlas)
+		{
+			const FontGlyph* glyph = m_DynamicAtlas->FindGlyph(codepoint, outAtlas);
+
+			if (!glyph && m_DynamicAtlas->IsMissing(codepoint))
+				glyph = m_DynamicAtlas->FindGlyph('?', outAtlas);
+
+			return glyph;
+		}
+
+		const FontGlyph* glyph = GetGlyph(codepoint);
+
+		outAtlas = m_AtlasTexture;
+
+		return glyph ? glyph : GetGlyph('?');
+	}
+
+	void Font::Update(u64 useIndex)
+	{
+		if (m_DynamicAtlas)
+			m_DynamicAtlas->Update(useIndex);
+	}
+
+	void Font::MarkAtlasUsed(const Texture2D* atlas, u64 useIndex)
+	{
+		if (m_DynamicAtlas)
+			m_DynamicAtlas->MarkUsed(atlas, useIndex);
+	}
+
+	u64 Font::GetLayoutGeneration() const
+	{
+		return m_DynamicAtlas ? m_DynamicAtlas->GetGeneration() : 0;
+	}
+
+	f64 Font::GetAdvance(const FontGlyph& glyph, u32 nextCodepoint) const
+	{
+		auto it = m_KerningOffsets.find((u64)glyph.Codepoint << 32 | nextCodepoint);
+
+		return it != m_KerningOffsets.end() ? (f64)glyph.Advance + it->second : (f64)glyph.Advance;
+	}
+
+	void Font::BuildLookupTables()
+	{
+		m_GlyphIndices.reserve(m_Glyphs.size());
+		m_KerningOffsets.reserve(m_Kerning.size());
+
+		for (u32 i = 0; i < (u32)m_Glyphs.size(); i++)
+		{
+			const u32 codepoint = m_Glyphs[i].Codepoint;
+
+			if (codepoint < m_AsciiGlyphIndices.size())
+				m_AsciiGlyphIndices[codepoint] = i + 1;
+			else
+				m_GlyphIndices[codepoint] = i;
+		}
+
+		for (const FontKerning& kerning : m_Kerning)
+		{
+			m_KerningOffsets[(u64)kerning.First << 32 | kerning.Second] = kerning.Offset;
+		}
+	}
+
+	Texture2D* Font::GetAtlasTexture() const
+	{
+		return m_DynamicAtlas ? m_DynamicAtlas->GetPage(0) : m_AtlasTexture;
+	}
+
+	u64 Font::GetMemorySize() const
+	{
+		if (m_DynamicAtlas)
+			return m_DynamicAtlas->GetMemorySize();
+
+		return m_AtlasTexture ? m_AtlasTexture->GetMemorySize() : 0;
+	}
+
 } // namespace SW
@@ -1,31 +1,52 @@
 /**
  * @file Font.hpp
  * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
- * @version 0.2.0
+ * @version 0.2.3
  * @date 2024-04-07
  *
  * @copyright Copyright (c) 2024 Tycjan Fortuna
  */
 #pragma once
 
-#undef INFINITE
-#include <msdf-atlas-gen/msdf-atlas-gen.h>
-
 #include "Asset/Asset.hpp"
 
 namespace SW
 {
 
 	class Texture2D;
+	class DynamicGlyphAtlas;
 
 	/**
-	 * @brief Struct representing the data required for Multi-channel Signed Distance Field (MSDF) rendering.
+	 * @brief Vertical metrics of the font, in em units.
 	 */
-	struct MSDFData final
+	struct FontMetrics
 	{
-		std::vector<msdf_atlas::GlyphGeometry> Glyphs; /**< Vector of glyph geometries. */
+		f64 LineHeight = 0.0; /**< Distance between the baselines of two consecutive lines. */
+		f64 AscenderY  = 0.0; /**< Top of the tallest glyphs relative to the baseline. */
+		f64 DescenderY = 0.0; /**< Bottom of the lowest glyphs relative to the baseline (negative). */
+	};
 
-		msdf_atlas::FontGeometry FontGeometry; /**< Font geometry data. */
+	/**
+	 * @brief Placement of a single glyph, everything the renderer needs to draw it.
+	 */
+	struct FontGlyph
+	{
+		u32 Codepoint;      /**< Unicode codepoint of the glyph. */
+		f32 Advance;        /**< Horizontal advance of the pen in em units. */
+		glm::vec2 PlaneMin; /**< Bottom left corner of the quad relative to the pen in em units. */
+		glm::vec2 PlaneMax; /**< Top right corner of the quad relative to the pen in em units. */
+		glm::vec2 AtlasMin; /**< Bottom left corner of the glyph inside the atlas in pixels. */
+		glm::vec2 AtlasMax; /**< Top right corner of the glyph inside the atlas in pixels. */
+	};
+
+	/**
+	 * @brief Kerning adjustment of a pair of glyphs.
+	 */
+	struct FontKerning
+	{
+		u32 First;  /**< Codepoint of the first glyph. */
+		u32 Second; /**< Codepoint of the glyph following the first one. */
+		f32 Offset; /**< Adjustment of the advance of the first glyph in em units. */
 	};
 
 	/**
@@ -35,6 +56,7 @@ namespace SW
 	{
 		ASCII = 0, /**< ASCII character set. */
 		ALL,       /**< All characters. */
+		Dynamic,   /**< Glyphs generated on demand, any unicode character. */
 	};
 
 	/**
@@ -43,12 +65,12 @@ namespace SW
 	struct FontSpecification
 	{
 		std::filesystem::path Path;                       /**< Path to the font file. */
+		const u8* Data          = nullptr;                /**< Font file in memory, used instead of Path. */
+		u64 DataSize            = 0;                      /**< Size of the font file in memory. */
 		FontCharsetType Charset = FontCharsetType::ASCII; /**< Character set type. */
-		Texture2D* PreloadedAtlas =
-		    nullptr; /**< Pointer to the preloaded atlas texture. (If not passed will be automaticaly created) */
-		bool ApplyMSDFColoring = true; /**< Flag indicating whether to apply MSDF coloring. */
-		int ForceWidth         = 0;    /**< Forced width of the font atlas. */
-		int ForceHeight        = 0;    /**< Forced height of the font atlas. */
+		bool ApplyMSDFColoring  = true;                   /**< Flag indicating whether to apply MSDF coloring. */
+		int ForceWidth          = 0;                      /**< Forced width of the font atlas. */
+		int ForceHeight         = 0;                      /**< Forced height of the font atlas. */
 	};
 
 	/**
@@ -58,11 +80,22 @@ namespace SW
 	{
 	public:
 		/**
-		 * @brief Constructor for the Font object.
+		 * @brief Constructor for the Font object, loads the font with FreeType and generates the MSDF atlas.
+		 * @note Fonts with FontCharsetType::Dynamic only load the metrics, glyphs are generated when first used.
 		 * @param spec FontSpecification structure.
 		 */
 		Font(const FontSpecification& spec);
 
+		/**
+		 * @brief Constructor for the Font object from already generated data (e.g. the font cache).
+		 * @param metrics Vertical metrics of the font.
+		 * @param glyphs Placements of all glyphs of the font.
+		 * @param kerning Kerning adjustments of the font.
+		 * @param atlas The atlas texture, owned by the font from now on.
+		 */
+		Font(const FontMetrics& metrics, std::vector<FontGlyph>&& glyphs, std::vector<FontKerning>&& kerning,
+		     Texture2D* atlas);
+
 		/**
 		 * @brief Destructor for the Font object.
 		 */
@@ -81,20 +114,107 @@ namespace SW
 		AssetType GetAssetType() const override { return AssetType::Font; }
 
 		/**
-		 * @brief Gets the MSDF data associated with the font.
-		 * @return A pointer to the MSDFData structure.
+		 * @brief Gets the vertical metrics of the font.
+		 * @return The metrics in em units.
+		 */
+		const FontMetrics& GetMetrics() const { return m_Metrics; }
+
+		/**
+		 * @brief Gets the placements of all glyphs of the font.
+		 * @return The glyphs.
+		 */
+		const std::vector<FontGlyph>& GetGlyphs() const { return m_Glyphs; }
+
+		/**
+		 * @brief Gets the kerning adjustments of the font.
+		 * @return The kerning pairs.
+		 */
+		const std::vector<FontKerning>& GetKerning() const { return m_Kerning; }
+
+		/**
+		 * @brief Finds the glyph of the codepoint.
+		 * @param codepoint The unicode codepoint.
+		 * @return The glyph, nullptr if the font does not contain it.
+		 */
+		const FontGlyph* GetGlyph(u32 codepoint) const;
+
+		/**
+		 * @brief Finds the glyph to draw for the codepoint, falls back to '?' if the font does not contain it.
+		 * @param codepoint The unicode codepoint.
+		 * @param outAtlas Receives the atlas texture containing the glyph.
+		 * @return The glyph, nullptr if it is still being generated (dynamic fonts) or there is no fallback.
+		 */
+		const FontGlyph* FindGlyph(u32 codepoint, Texture2D*& outAtlas);
+
+		/**
+		 * @brief Packs the glyphs generated since the last call into the atlas, no-op for static fonts.
+		 * @param useIndex Index of the current batch of draws, pages used by it are never evicted.
+		 */
+		void Update(u64 useIndex);
+
+		/**
+		 * @brief Marks the atlas as used by a batch of draws, dynamic fonts do not evict it while the batch is pending.
+		 * @param atlas The atlas texture.
+		 * @param useIndex Index of the batch of draws.
+		 */
+		void MarkAtlasUsed(const Texture2D* atlas, u64 useIndex);
+
+		/**
+		 * @brief Gets the identifier of this font instance, unlike the address it is never reused by another font.
+		 * @return The identifier.
+		 */
+		u64 GetInstanceID() const { return m_InstanceID; }
+
+		/**
+		 * @brief Gets the generation of the glyph placements, glyphs looked up in an older one may be outdated.
+		 * @return The generation, always 0 for static fonts.
+		 */
+		u64 GetLayoutGeneration() const;
+
+		/**
+		 * @brief Whether the glyphs are generated on demand.
+		 * @return True for fonts with FontCharsetType::Dynamic.
+		 */
+		bool IsDynamic() const { return m_DynamicAtlas != nullptr; }
+
+		/**
+		 * @brief Gets the advance of the glyph including the kerning with the following glyph.
+		 * @param glyph The glyph.
+		 * @param nextCodepoint The codepoint following the glyph.
+		 * @return The advance in em units.
 		 */
-		const MSDFData& GetMSDFData() const { return m_Data; }
+		f64 GetAdvance(const FontGlyph& glyph, u32 nextCodepoint) const;
 
 		/**
 		 * @brief Gets the atlas texture associated with the font.
-		 * @return A pointer to the Texture2D object representing the atlas texture.
+		 * @return A pointer to the Texture2D object representing the atlas texture (first page for dynamic fonts).
+		 */
+		Texture2D* GetAtlasTexture() const;
+
+		/**
+		 * @brief Gets the memory held by the font (the atlas texture).
+		 * @return The size in bytes.
 		 */
-		Texture2D* GetAtlasTexture() const { return m_AtlasTexture; }
+		u64 GetMemorySize() const override;
 
 	private:
-		MSDFData m_Data;                     /**< MSDFData structure. */
+		FontMetrics m_Metrics;              /**< Vertical metrics of the font. */
+		std::vector<FontGlyph> m_Glyphs;    /**< Placements of all glyphs. */
+		std::vector<FontKerning> m_Kerning; /**< Kerning adjustments. */
+
+		std::array<u32, 128> m_AsciiGlyphIndices = {}; /**< ASCII codepoint to index into m_Glyphs plus 1, 0 if none. */
+		std::unordered_map<u32, u32> m_GlyphIndices;   /**< Codepoint to index into m_Glyphs (non ASCII). */
+		std::unordered_map<u64, f32> m_KerningOffsets; /**< Codepoint pair (first << 32 | second) to offset. */
+
 		Texture2D* m_AtlasTexture = nullptr; /**< Pointer to the atlas texture. */
+		u64 m_InstanceID          = 0;       /**< Unique identifier of the instance. */
+
+		Scope<DynamicGlyphAtlas> m_DynamicAtlas; /**< Atlas filled on demand, nullptr for static fonts. */
+
+		/**
+		 * @brief Builds the lookup tables of the glyphs and the kerning pairs.
+		 */
+		void BuildLookupTables();
 	};
 
 } // namespace SW
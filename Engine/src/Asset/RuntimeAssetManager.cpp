@@ -1,6 +1,128 @@
 #include "RuntimeAssetManager.hpp"
 
+#include "AssetLoader.hpp"
+
 namespace SW
 {
 
-}
+	RuntimeAssetManager::RuntimeAssetManager(const std::filesystem::path& packPath)
+	    : AssetManagerBase(std::map<AssetHandle, AssetMetaData>())
+	{
+		if (!m_Pack.Open(packPath))
+		{
+			APP_ERROR("Failed to open the asset pack: {}", packPath);
+			return;
+		}
+
+		m_Pack.FillMetaData(m_AvailRegistry.GetAvailableAssetsRaw());
+	}
+
+	RuntimeAssetManager::~RuntimeAssetManager()
+	{
+		for (std::pair<AssetHandle, Asset*> pair : m_Registry)
+		{
+			delete pair.second;
+		}
+	}
+
+	Asset** RuntimeAssetManager::GetAssetRaw(AssetHandle handle)
+	{
+		Asset** element = &m_Registry[handle];
+
+		if (*element != nullptr)
+			return element;
+
+		if (!IsValid(handle))
+			return nullptr;
+
+		*element = LoadAsset(handle);
+
+		m_Slots.Set(handle, *element);
+
+		return element;
+	}
+
+	const Asset** RuntimeAssetManager::GetAsset(AssetHandle handle)
+	{
+		return const_cast<const Asset**>(GetAssetRaw(handle));
+	}
+
+	bool RuntimeAssetManager::ForceUnload(AssetHandle handle)
+	{
+		if (!ContainsAsset(handle))
+		{
+			return true; // Asset was not loaded
+		}
+
+		Asset* asset = m_Registry.at(handle);
+		if (asset)
+			delete asset;
+
+		m_Registry.erase(handle);
+		m_Slots.Set(handle, nullptr);
+
+		APP_INFO("Asset with handle {0} was unloaded", handle);
+
+		return true;
+	}
+
+	bool RuntimeAssetManager::ForceReload(AssetHandle handle)
+	{
+		if (!ContainsAsset(handle))
+			return false;
+
+		Asset* oldAsset = m_Registry[handle];
+
+		m_Registry[handle] = LoadAsset(handle);
+		m_Slots.Set(handle, m_Registry[handle]);
+
+		delete oldAsset;
+
+		APP_INFO("Asset with handle {0} was reloaded", handle);
+
+		return true;
+	}
+
+	AssetState RuntimeAssetManager::GetAssetState(AssetHandle handle) const
+	{
+		if (!IsValid(handle))
+			return AssetState::Invalid;
+
+		auto it = m_Registry.find(handle);
+
+		return it != m_Registry.end() && it->second ? AssetState::Loaded : AssetState::None;
+	}
+
+	const u8* RuntimeAssetManager::GetAssetData(AssetHandle handle, u64& outSize) const
+	{
+		const AssetPackEntry* entry = m_Pack.Find(handle);
+
+		if (!entry)
+		{
+			outSize = 0;
+			return nullptr;
+		}
+
+		outSize = entry->Size;
+
+		return m_Pack.GetData(*entry);
+	}
+
+	Asset* RuntimeAssetManager::LoadAsset(AssetHandle handle) const
+	{
+		const AssetPackEntry* entry = m_Pack.Find(handle);
+
+		if (!entry)
+			return nullptr;
+
+		const AssetMetaData& metadata = m_AvailRegistry.GetAssetMetaData(handle);
+
+		Asset* newAsset = AssetLoader::TryLoadAssetFromMemory(metadata, m_Pack.GetData(*entry), entry->Size);
+
+		if (newAsset)
+			newAsset->m_Handle = handle;
+
+		return newAsset;
+	}
+
+} // namespace SW
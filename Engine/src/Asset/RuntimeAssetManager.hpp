@@ -1,6 +1,105 @@
+/**
+ * @file RuntimeAssetManager.hpp
+ * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
+ * @version 0.1.0
+ * @date 2024-05-26
+ *
+ * @copyright Copyright (c) 2024 Tycjan Fortuna
+ */
 #pragma once
 
+#include "AssetManagerBase.hpp"
+#include "AssetPack.hpp"
+
 namespace SW
 {
 
-}
+	/**
+	 * @brief Asset manager of shipped games, all assets are read from a single cooked asset pack.
+	 * 		  The registry is built from the table of contents of the pack - the asset directory is never scanned
+	 * 		  and no loose files are opened.
+	 */
+	class RuntimeAssetManager final : public AssetManagerBase
+	{
+	public:
+		/**
+		 * @brief Opens the asset pack.
+		 * @warning If the pack can not be opened, no assets are available.
+		 *
+		 * @param packPath Path to the asset pack.
+		 */
+		explicit RuntimeAssetManager(const std::filesystem::path& packPath);
+
+		~RuntimeAssetManager() override;
+
+		/**
+		 * @brief Get the asset.
+		 * @warning If the asset is not available, the nullptr will be returned.
+		 *
+		 * @param handle The handle of the asset.
+		 * @return Asset** The asset.
+		 */
+		Asset** GetAssetRaw(AssetHandle handle) override;
+
+		/**
+		 * @brief Get the asset.
+		 * @warning If the asset is not available, the nullptr will be returned.
+		 *
+		 * @param handle The handle of the asset.
+		 * @return const Asset* The asset.
+		 */
+		const Asset** GetAsset(AssetHandle handle) override;
+
+		/**
+		 * @brief Force unload the asset.
+		 * @param handle The handle of the asset.
+		 */
+		bool ForceUnload(AssetHandle handle) override;
+
+		/**
+		 * @brief Force reload the asset (from the pack).
+		 * @param handle The handle of the asset.
+		 */
+		bool ForceReload(AssetHandle handle) override;
+
+		/**
+		 * @brief Get the load state of the asset.
+		 * @note Assets from the pack are always loaded synchronously.
+		 *
+		 * @param handle The handle of the asset.
+		 * @return AssetState The state of the asset.
+		 */
+		AssetState GetAssetState(AssetHandle handle) const override;
+
+		/**
+		 * @brief Get the cooked blob of the asset, it points straight into the mapped pack.
+		 *
+		 * @param handle The handle of the asset.
+		 * @param outSize The size of the blob in bytes.
+		 * @return Pointer to the blob, nullptr if the asset is not in the pack.
+		 */
+		const u8* GetAssetData(AssetHandle handle, u64& outSize) const;
+
+		/**
+		 * @brief Check if contains the asset.
+		 *
+		 * @param handle The handle of the asset.
+		 * @return If the asset is contained.
+		 */
+		bool ContainsAsset(AssetHandle handle) const { return m_Registry.find(handle) != m_Registry.end(); }
+
+	private:
+		AssetPack m_Pack; /**< The mapped asset pack, must outlive all loaded assets. */
+
+		std::unordered_map<AssetHandle, Asset*> m_Registry; // contains all loaded assets
+
+		/**
+		 * @brief Loads the asset from its blob in the pack.
+		 *
+		 * @param handle The handle of the asset.
+		 * @return The loaded asset, nullptr if the asset is not in the pack.
+		 */
+		Asset* LoadAsset(AssetHandle handle) const;
+	};
+
+} // namespace SW
@@ -24,6 +24,8 @@ namespace SW
 		static AssetType GetStaticType() { return AssetType::Sprite; }
 		AssetType GetAssetType() const override { return AssetType::Sprite; }
 
+		u64 GetMemorySize() const override { return sizeof(Sprite); } // the texture is accounted on its own
+
 		Texture2D* GetTexture() const { return *m_Texture; }
 		Texture2D** GetTextureRaw() const { return m_Texture; }
 
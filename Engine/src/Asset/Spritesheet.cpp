@@ -0,0 +1,71 @@
+#include "Spritesheet.hpp"
+
+#include "Core/Hash.hpp"
+
+namespace SW
+{
+
+	AssetHandle Spritesheet::GetSpriteHandle(AssetHandle spritesheet, std::string_view name)
+	{
+		const AssetHandle handle = Hash::GenerateXXHash(name.data(), name.size(), spritesheet);
+
+		return handle ? handle : 1; // 0 is reserved for no asset
+	}
+
+	SpriteTexCoords Spritesheet::GetTexCoords(const SpriteData& sprite, glm::vec2 textureSize) const
+	{
+		const f32 x      = sprite.Position.x + CenterOffset.x; // 0 -> texWidth
+		const f32 y      = sprite.Position.y + CenterOffset.y; // 0 -> texHeight
+		const f32 width  = sprite.Size.x;
+		const f32 height = sprite.Size.y;
+
+		SpriteTexCoords coords;
+		coords.LeftDown  = {x / textureSize.x, 1.0f - y / textureSize.y};
+		coords.RightDown = {(x + width) / textureSize.x, 1.0f - y / textureSize.y};
+		coords.UpRight   = {(x + width) / textureSize.x, 1.0f - (y + height) / textureSize.y};
+		coords.UpLeft    = {x / textureSize.x, 1.0f - (y + height) / textureSize.y};
+
+		return coords;
+	}
+
+	const SpriteData* Spritesheet::FindSprite(AssetHandle handle) const
+	{
+		for (const SpriteData& sprite : Sprites)
+		{
+			if (sprite.Handle == handle)
+				return &sprite;
+		}
+
+		return nullptr;
+	}
+
+	void Spritesheet::UpdateSpriteHandles(AssetHandle spritesheet)
+	{
+		std::unordered_set<std::string> names;
+		names.reserve(Sprites.size());
+
+		for (SpriteData& sprite : Sprites)
+		{
+			// Handles are derived from the names, a duplicate would resolve to the first sprite of the same name
+			if (!names.insert(sprite.Name).second)
+			{
+				std::string name;
+				int ct = 2;
+
+				do
+				{
+					name = std::format("{} ({})", sprite.Name, ct++);
+				} while (names.contains(name));
+
+				SYSTEM_WARN("Spritesheet {} has more than one sprite named {}, renamed to {}", spritesheet,
+				            sprite.Name, name);
+
+				sprite.Name = name;
+				names.insert(name);
+			}
+
+			sprite.Handle = GetSpriteHandle(spritesheet, sprite.Name);
+		}
+	}
+
+} // namespace SW
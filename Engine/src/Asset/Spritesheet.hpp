@@ -1,7 +1,7 @@
 /**
  * @file Spritesheet.hpp
  * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
- * @version 0.1.1
+ * @version 0.1.3
  * @date 2024-04-07
  *
  * @copyright Copyright (c) 2024 Tycjan Fortuna
@@ -23,8 +23,27 @@ namespace SW
 		std::string Name;
 		glm::vec2 Position = glm::vec2(0.0f);
 		glm::vec2 Size     = glm::vec2(32.0f);
+		AssetHandle Handle = 0; // handle of the sprite sub-asset, derived from the spritesheet handle and the name
 	};
 
+	/**
+	 * @brief Texture coordinates of a sprite cut from a spritesheet.
+	 */
+	struct SpriteTexCoords
+	{
+		glm::vec2 LeftDown  = glm::vec2(0.f, 0.f);
+		glm::vec2 RightDown = glm::vec2(1.f, 0.f);
+		glm::vec2 UpRight   = glm::vec2(1.f, 1.f);
+		glm::vec2 UpLeft    = glm::vec2(0.f, 1.f);
+	};
+
+	/**
+	 * @brief Texture with rectangles cut out as sprites.
+	 *
+	 * 		  Every sprite is a sub-asset of the spritesheet - it has its own handle (see GetSpriteHandle()) but no
+	 * 		  file, it is cut from the loaded spritesheet on request. A whole animation is then loaded with a single
+	 * 		  read of the spritesheet file. Sprites exported to their own files keep working as before.
+	 */
 	class Spritesheet final : public Asset
 	{
 	public:
@@ -33,6 +52,40 @@ namespace SW
 		static AssetType GetStaticType() { return AssetType::Spritesheet; }
 		AssetType GetAssetType() const override { return AssetType::Spritesheet; }
 
+		/**
+		 * @brief Derives the handle of the sprite sub-asset, it stays the same as long as the sprite's name does.
+		 *
+		 * @param spritesheet The handle of the spritesheet.
+		 * @param name The name of the sprite.
+		 * @return The handle of the sprite.
+		 */
+		static AssetHandle GetSpriteHandle(AssetHandle spritesheet, std::string_view name);
+
+		/**
+		 * @brief Computes the texture coordinates of the sprite.
+		 *
+		 * @param sprite The sprite.
+		 * @param textureSize The size of the spritesheet texture in pixels.
+		 * @return The texture coordinates.
+		 */
+		SpriteTexCoords GetTexCoords(const SpriteData& sprite, glm::vec2 textureSize) const;
+
+		/**
+		 * @brief Finds the sprite by the handle of its sub-asset.
+		 *
+		 * @param handle The handle of the sprite.
+		 * @return The sprite, nullptr if the spritesheet has no such sprite.
+		 */
+		const SpriteData* FindSprite(AssetHandle handle) const;
+
+		/**
+		 * @brief Assigns the handles of all sprites, call after the sprites were added or renamed.
+		 * @note Sprites sharing the name of an earlier sprite are renamed (with a warning) to keep the handles unique.
+		 *
+		 * @param spritesheet The handle of the spritesheet.
+		 */
+		void UpdateSpriteHandles(AssetHandle spritesheet);
+
 		Texture2D* GetSpritesheetTexture() const { return m_SpritesheetTexture ? *m_SpritesheetTexture : nullptr; }
 		void SetSpritesheetTexture(Texture2D** texture) { m_SpritesheetTexture = texture; }
 
@@ -46,6 +99,7 @@ namespace SW
 
 		glm::vec2 CenterOffset = glm::vec2(0.f, 0.f);
 		glm::vec2 ViewPos      = glm::vec2(0.f, 0.f);
+		glm::vec2 TextureSize  = glm::vec2(0.f, 0.f); // size of the texture when saved, 0 if unknown
 
 		std::filesystem::path ExportPath; // where all sprites should be exported
 
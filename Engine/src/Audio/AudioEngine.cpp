@@ -12,7 +12,7 @@ namespace SW
 	ma_engine AudioEngine::engine;
 
 	std::vector<SoundInstance*> AudioEngine::s_ActiveInstances;
-	std::unordered_map<std::string, AudioEvent> AudioEngine::s_AudioEvents;
+	std::unordered_map<StringId, AudioEvent> AudioEngine::s_AudioEvents;
 
 	void AudioEngine::Initialize()
 	{
@@ -104,20 +104,22 @@ namespace SW
 		return &s_ActiveInstances.back();
 	}
 
-	SoundInstance** AudioEngine::DispatchAudioEvent(const std::string& name)
+	SoundInstance** AudioEngine::DispatchAudioEvent(StringId name)
 	{
-		if (s_AudioEvents.find(name) == s_AudioEvents.end())
+		auto it = s_AudioEvents.find(name);
+
+		if (it == s_AudioEvents.end())
 		{
-			APP_ERROR("Audio event with name '{0}' not found", name);
+			APP_ERROR("Audio event with name '{0}' ({1:#x}) not found", name.GetDebugName(), name.GetHash());
 
 			return nullptr;
 		}
 
-		AudioEvent& event = s_AudioEvents[name];
+		AudioEvent& event = it->second;
 
 		if (event.Handle == 0)
 		{
-			APP_ERROR("Audio event '{0}' has no sound assigned", name);
+			APP_ERROR("Audio event '{0}' has no sound assigned", event.Name);
 			return nullptr;
 		}
 
@@ -28,18 +28,18 @@ namespace SW
 		static SoundInstance** PlaySound3D(const SoundSpecification& spec, const glm::vec3& position,
 		                                   const glm::vec3& direction);
 
-		static SoundInstance** DispatchAudioEvent(const std::string& name);
+		static SoundInstance** DispatchAudioEvent(StringId name);
 
 		static ma_engine* Get() { return &engine; }
 
-		static std::unordered_map<std::string, AudioEvent>& GetAudioEvents() { return s_AudioEvents; }
+		static std::unordered_map<StringId, AudioEvent>& GetAudioEvents() { return s_AudioEvents; }
 
 		static void ClearActiveInstances();
 
 	private:
 		static ma_engine engine;
 		static std::vector<SoundInstance*> s_ActiveInstances;
-		static std::unordered_map<std::string, AudioEvent> s_AudioEvents;
+		static std::unordered_map<StringId, AudioEvent> s_AudioEvents;
 	};
 
 } // namespace SW
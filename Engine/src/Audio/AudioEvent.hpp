@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Asset/Asset.hpp"
+#include "Core/StringId.hpp"
 #include "SoundInstance.hpp"
 
 namespace SW
@@ -14,6 +15,8 @@ namespace SW
 
 	struct AudioEvent
 	{
+		std::string Name; // the events are keyed by its StringId
+
 		AssetHandle Handle                = 0;
 		f32 Volume                        = 1.0f;
 		f32 Pitch                         = 1.0f;
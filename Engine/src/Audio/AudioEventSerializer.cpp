@@ -6,19 +6,19 @@ namespace SW
 {
 
 	void AudioEventSerializer::Serialize(const std::filesystem::path& path,
-	                                     const std::unordered_map<std::string, AudioEvent>& audioEvents)
+	                                     const std::unordered_map<StringId, AudioEvent>& audioEvents)
 	{
 		YAML::Emitter output;
 
 		output << YAML::BeginMap;
 		output << YAML::Key << "AudioEvents" << YAML::Value << YAML::BeginSeq;
 
-		for (auto&& [key, event] : audioEvents)
+		for (auto&& [id, event] : audioEvents)
 		{
 			output << YAML::BeginMap;
 
 			output << YAML::Key << "Handle" << YAML::Value << event.Handle;
-			output << YAML::Key << "Key" << YAML::Value << key;
+			output << YAML::Key << "Key" << YAML::Value << event.Name;
 			output << YAML::Key << "Volume" << YAML::Value << event.Volume;
 			output << YAML::Key << "Pitch" << YAML::Value << event.Pitch;
 			output << YAML::Key << "TriggerType" << YAML::Value << (int)event.TriggerType;
@@ -36,7 +36,7 @@ namespace SW
 	}
 
 	void AudioEventSerializer::Deserialize(const std::filesystem::path& path,
-	                                       std::unordered_map<std::string, AudioEvent>& outAudioEvents)
+	                                       std::unordered_map<StringId, AudioEvent>& outAudioEvents)
 	{
 		const YAML::Node registry = YAML::LoadFile(path.string());
 
@@ -45,13 +45,14 @@ namespace SW
 		for (const YAML::Node& event : audioEvents)
 		{
 			AudioEvent audioEvent;
+			audioEvent.Name        = TryDeserializeNode<std::string>(event, "Key", "Unnamed");
 			audioEvent.Handle      = TryDeserializeNode<AssetHandle>(event, "Handle", 0);
 			audioEvent.Volume      = TryDeserializeNode<f32>(event, "Volume", 1.0f);
 			audioEvent.Pitch       = TryDeserializeNode<f32>(event, "Pitch", 1.0f);
 			audioEvent.TriggerType = (AudioEventTriggerType)TryDeserializeNode<int>(event, "TriggerType", 0);
 			audioEvent.Looping     = TryDeserializeNode<bool>(event, "Looping", false);
 
-			outAudioEvents[TryDeserializeNode<std::string>(event, "Key", "Unnamed")] = audioEvent;
+			outAudioEvents[StringId(audioEvent.Name)] = audioEvent;
 		}
 	}
 
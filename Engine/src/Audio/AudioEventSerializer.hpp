@@ -9,10 +9,10 @@ namespace SW
 	{
 	public:
 		static void Serialize(const std::filesystem::path& path,
-		                      const std::unordered_map<std::string, AudioEvent>& audioEvents);
+		                      const std::unordered_map<StringId, AudioEvent>& audioEvents);
 
 		static void Deserialize(const std::filesystem::path& path,
-		                        std::unordered_map<std::string, AudioEvent>& outAudioEvents);
+		                        std::unordered_map<StringId, AudioEvent>& outAudioEvents);
 	};
 
 } // namespace SW
@@ -9,12 +9,37 @@ namespace SW
 		    ma_sound_init_from_file(AudioEngine::Get(), path.string().c_str(), 0, nullptr, nullptr, &m_Handle);
 
 		ASSERT(result == MA_SUCCESS, "Failed to load sound file: {}", path);
+
+		std::error_code error;
+		const u64 size = std::filesystem::file_size(path, error);
+
+		m_MemorySize = error ? 0 : size;
+	}
+
+	Sound::Sound(const std::string& name, const u8* data, u64 size) : m_MemorySize(size), m_EncodedDataName(name)
+	{
+		ma_resource_manager* manager = ma_engine_get_resource_manager(AudioEngine::Get());
+
+		// The resource manager decodes straight from the given memory, no copy is made.
+		ma_result result = ma_resource_manager_register_encoded_data(manager, name.c_str(), data, (size_t)size);
+
+		ASSERT(result == MA_SUCCESS, "Failed to register sound data: {}", name);
+
+		result = ma_sound_init_from_file(AudioEngine::Get(), name.c_str(), 0, nullptr, nullptr, &m_Handle);
+
+		ASSERT(result == MA_SUCCESS, "Failed to load sound from memory: {}", name);
 	}
 
 	Sound::~Sound()
 	{
 		ma_sound_stop(&m_Handle);
 		ma_sound_uninit(&m_Handle);
+
+		if (!m_EncodedDataName.empty())
+		{
+			ma_resource_manager_unregister_data(ma_engine_get_resource_manager(AudioEngine::Get()),
+			                                    m_EncodedDataName.c_str());
+		}
 	}
 
 } // namespace SW
@@ -10,6 +10,17 @@ namespace SW
 	{
 	public:
 		Sound(const std::filesystem::path& path);
+
+		/**
+		 * @brief Creates the sound from an encoded file (wav, mp3...) already in memory.
+		 * @warning The data must stay valid for the whole lifetime of the sound (and its instances).
+		 *
+		 * @param name Unique name the data is registered under in the resource manager.
+		 * @param data Encoded sound bytes.
+		 * @param size Size of the data in bytes.
+		 */
+		Sound(const std::string& name, const u8* data, u64 size);
+
 		~Sound();
 
 		/**
@@ -27,8 +38,17 @@ namespace SW
 		 */
 		AssetType GetAssetType() const override { return AssetType::Audio; }
 
+		/**
+		 * @brief Gets the size of the encoded sound data kept in memory.
+		 */
+		u64 GetMemorySize() const override { return m_MemorySize; }
+
 	private:
 		ma_sound m_Handle;
+
+		u64 m_MemorySize = 0; // encoded data size, the resource manager keeps it in memory
+
+		std::string m_EncodedDataName; // empty if the sound was loaded from file
 	};
 
 } // namespace SW
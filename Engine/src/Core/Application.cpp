@@ -4,6 +4,7 @@
 #include "Core/KeyCode.hpp"
 #include "Events/Event.hpp"
 #include "GUI/GuiLayer.hpp"
+#include "OpenGL/TextureUploader.hpp"
 #include "Renderer/RendererAPI.hpp"
 #include "Scripting/ScriptingCore.hpp"
 #include "Utils/FileSystem.hpp"
@@ -38,6 +39,7 @@ namespace SW
 		FileSystem::Initialize();
 		AssetManager::Initialize();
 		RendererAPI::Initialize();
+		TextureUploader::Initialize();
 
 		if (m_Specification.EnableCSharpSupport)
 			ScriptingCore::Get().InitializeHost();
@@ -70,6 +72,7 @@ namespace SW
 		EventSystem::Shutdown();
 		FileSystem::Shutdown();
 		AssetManager::Shutdown();
+		TextureUploader::Shutdown();
 		RendererAPI::Shutdown();
 
 		if (m_Specification.EnableCSharpSupport)
@@ -97,6 +100,10 @@ namespace SW
 
 			m_Window->OnUpdate();
 
+			TextureUploader::Update();
+			AssetManager::ProcessAsyncLoads(m_Specification.AssetLoadBudget);
+			AssetManager::EnforceMemoryBudgets();
+
 			{
 				PROFILE_SCOPE("Application::Update()");
 
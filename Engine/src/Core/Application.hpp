@@ -33,6 +33,7 @@ namespace SW
 		bool DisableToolbar      = false;      /** @brief Whether the default window's toolbar should be visible. */
 		bool Fullscreen          = false;      /** @brief Whether the window on start should be full screen. */
 		bool EnableCSharpSupport = true;       /** @brief Whether the C# host should be initialized. */
+		f32 AssetLoadBudget      = 2.f;        /** @brief Per frame time (ms) for finishing async asset loads. */
 	};
 
 	/**
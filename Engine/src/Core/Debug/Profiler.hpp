@@ -18,7 +18,8 @@
 	#define PROFILE_SCOPE_DYNAMIC(NAME) \
 		ZoneScoped;                     \
 		ZoneName(NAME, strlen(NAME))
-	#define PROFILE_THREAD(...) tracy::SetThreadName(__VA_ARGS__)
+	#define PROFILE_THREAD(...)       tracy::SetThreadName(__VA_ARGS__)
+	#define PROFILE_PLOT(NAME, VALUE) TracyPlot(NAME, VALUE)
 
 #else
 
@@ -27,5 +28,6 @@
 	#define PROFILE_SCOPE(...)
 	#define PROFILE_SCOPE_DYNAMIC(NAME)
 	#define PROFILE_THREAD(...)
+	#define PROFILE_PLOT(NAME, VALUE)
 
 #endif
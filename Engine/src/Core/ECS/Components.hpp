@@ -1,7 +1,7 @@
 /**
  * @file Components.hpp
  * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
- * @version 0.1.6
+ * @version 0.1.8
  * @date 2024-03-09
  *
  * @copyright Copyright (c) 2024 Tycjan Fortuna
@@ -10,11 +10,13 @@
 
 #include "Asset/Animation2D.hpp"
 #include "Asset/Asset.hpp"
+#include "Asset/AssetSlotMap.hpp"
 #include "Audio/SoundInstance.hpp"
 #include "Audio/SoundListener.hpp"
 #include "Core/Math/Math.hpp"
 #include "Core/Scene/SceneCamera.hpp"
 #include "Core/Scripting/CSharpObject.hpp"
+#include "Core/StringId.hpp"
 #include "Core/Utils/Random.hpp"
 
 namespace SW
@@ -88,6 +90,8 @@ namespace SW
 		f32 TilingFactor   = 1.0f;
 		int ZIndex         = 0;
 
+		mutable AssetSlot Slot; // Handle resolved by the renderer, see AssetManager::Resolve()
+
 		SpriteComponent() = default;
 		SpriteComponent(const glm::vec4& color) : Color(color) {}
 		SpriteComponent(AssetHandle handle, const glm::vec4& tint = glm::vec4(1.f), f32 tilingFactor = 1.f)
@@ -108,7 +112,7 @@ namespace SW
 
 		Animation2D** CurrentAnimation = nullptr;
 
-		std::unordered_map<std::string, Animation2D**> Animations;
+		std::unordered_map<StringId, NamedAsset<Animation2D>> Animations; // keyed by the id of the name
 	};
 
 	/**
@@ -140,6 +144,8 @@ namespace SW
 
 		f32 Kerning     = 0.0f; /**< Kerning of the text. */
 		f32 LineSpacing = 0.0f; /**< Line spacing of the text. */
+
+		mutable AssetSlot Slot; /**< Handle resolved by the renderer, see AssetManager::Resolve(). */
 	};
 
 	/**
@@ -213,6 +219,9 @@ namespace SW
 		f32 LinearDamping  = 0.0f; /**< The linear damping of the rigid body. */
 		f32 AngularDamping = 0.0f; /**< The angular damping of the rigid body. */
 
+		u16 CollisionLayer = 0x0001; /**< The layer bit(s) all colliders of the body belong to. */
+		u16 CollisionMask  = 0xFFFF; /**< The layers all colliders of the body collide with. */
+
 		bool AutoMass   = true; /**< Whether the body's mass should be determined automatically or based on set mass */
 		bool AllowSleep = true; /**< Set this flag to false if this body should never fall asleep. */
 		bool InitiallyAwake = true;  /**< Is this body initially awake or sleeping? */
@@ -1,6 +1,212 @@
 #include "Hash.hpp"
 
+#include "Core/Utils/MappedFile.hpp"
+
 namespace SW
 {
 
-}
+	static constexpr u64 Prime1 = 0x9E3779B185EBCA87ull;
+	static constexpr u64 Prime2 = 0xC2B2AE3D27D4EB4Full;
+	static constexpr u64 Prime3 = 0x165667B19E3779F9ull;
+	static constexpr u64 Prime4 = 0x85EBCA77C2B2AE63ull;
+	static constexpr u64 Prime5 = 0x27D4EB2F165667C5ull;
+
+	static inline u64 RotateLeft(u64 value, u32 bits)
+	{
+		return (value << bits) | (value >> (64 - bits));
+	}
+
+	static inline u64 Read64(const u8* data)
+	{
+		u64 value;
+		std::memcpy(&value, data, sizeof(u64)); // unaligned, little endian on every supported platform
+
+		return value;
+	}
+
+	static inline u32 Read32(const u8* data)
+	{
+		u32 value;
+		std::memcpy(&value, data, sizeof(u32));
+
+		return value;
+	}
+
+	static inline u64 Round(u64 accumulator, u64 input)
+	{
+		accumulator += input * Prime2;
+		accumulator = RotateLeft(accumulator, 31);
+
+		return accumulator * Prime1;
+	}
+
+	static inline u64 MergeRound(u64 hash, u64 accumulator)
+	{
+		hash ^= Round(0, accumulator);
+
+		return hash * Prime1 + Prime4;
+	}
+
+	StreamingHash::StreamingHash(u64 seed)
+	{
+		Reset(seed);
+	}
+
+	void StreamingHash::Reset(u64 seed)
+	{
+		m_Accumulators[0] = seed + Prime1 + Prime2;
+		m_Accumulators[1] = seed + Prime2;
+		m_Accumulators[2] = seed;
+		m_Accumulators[3] = seed - Prime1;
+
+		m_Seed       = seed;
+		m_TotalSize  = 0;
+		m_BufferSize = 0;
+	}
+
+	void StreamingHash::Update(const void* data, u64 size)
+	{
+		if (size == 0)
+			return;
+
+		const u8* input = static_cast<const u8*>(data);
+		const u8* end   = input + size;
+
+		m_TotalSize += size;
+
+		if (m_BufferSize + size < StripeSize)
+		{
+			std::memcpy(m_Buffer + m_BufferSize, input, size);
+			m_BufferSize += (u32)size;
+
+			return;
+		}
+
+		if (m_BufferSize != 0) // complete the buffered stripe first
+		{
+			const u64 missing = StripeSize - m_BufferSize;
+
+			std::memcpy(m_Buffer + m_BufferSize, input, missing);
+			input += missing;
+
+			for (u32 lane = 0; lane < 4; lane++)
+			{
+				m_Accumulators[lane] = Round(m_Accumulators[lane], Read64(m_Buffer + lane * 8));
+			}
+
+			m_BufferSize = 0;
+		}
+
+		// Locals keep the lanes in registers, the four chains do not depend on each other.
+		u64 v1 = m_Accumulators[0];
+		u64 v2 = m_Accumulators[1];
+		u64 v3 = m_Accumulators[2];
+		u64 v4 = m_Accumulators[3];
+
+		for (; end - input >= (std::ptrdiff_t)StripeSize; input += StripeSize)
+		{
+			v1 = Round(v1, Read64(input));
+			v2 = Round(v2, Read64(input + 8));
+			v3 = Round(v3, Read64(input + 16));
+			v4 = Round(v4, Read64(input + 24));
+		}
+
+		m_Accumulators[0] = v1;
+		m_Accumulators[1] = v2;
+		m_Accumulators[2] = v3;
+		m_Accumulators[3] = v4;
+
+		m_BufferSize = (u32)(end - input);
+		std::memcpy(m_Buffer, input, m_BufferSize);
+	}
+
+	u64 StreamingHash::Digest() const
+	{
+		u64 hash;
+
+		if (m_TotalSize >= StripeSize)
+		{
+			hash = RotateLeft(m_Accumulators[0], 1) + RotateLeft(m_Accumulators[1], 7) +
+			       RotateLeft(m_Accumulators[2], 12) + RotateLeft(m_Accumulators[3], 18);
+
+			for (u64 accumulator : m_Accumulators)
+			{
+				hash = MergeRound(hash, accumulator);
+			}
+		}
+		else
+		{
+			hash = m_Seed + Prime5;
+		}
+
+		hash += m_TotalSize;
+
+		const u8* input = m_Buffer;
+		const u8* end   = m_Buffer + m_BufferSize;
+
+		for (; end - input >= 8; input += 8)
+		{
+			hash ^= Round(0, Read64(input));
+			hash = RotateLeft(hash, 27) * Prime1 + Prime4;
+		}
+
+		if (end - input >= 4)
+		{
+			hash ^= (u64)Read32(input) * Prime1;
+			hash = RotateLeft(hash, 23) * Prime2 + Prime3;
+
+			input += 4;
+		}
+
+		for (; input < end; input++)
+		{
+			hash ^= (u64)(*input) * Prime5;
+			hash = RotateLeft(hash, 11) * Prime1;
+		}
+
+		// Avalanche, every input bit affects every output bit.
+		hash ^= hash >> 33;
+		hash *= Prime2;
+		hash ^= hash >> 29;
+		hash *= Prime3;
+		hash ^= hash >> 32;
+
+		return hash;
+	}
+
+	u64 Hash::GenerateXXHash(const void* data, u64 size, u64 seed)
+	{
+		StreamingHash hash(seed);
+		hash.Update(data, size);
+
+		return hash.Digest();
+	}
+
+	bool Hash::GenerateFileHash(const std::filesystem::path& path, u64& outHash)
+	{
+		PROFILE_FUNCTION();
+
+		std::error_code error;
+
+		const u64 size = (u64)std::filesystem::file_size(path, error);
+
+		if (error)
+			return false;
+
+		if (size == 0) // empty files can not be mapped
+		{
+			outHash = GenerateXXHash(nullptr, 0);
+			return true;
+		}
+
+		MappedFile file;
+
+		if (!file.Open(path))
+			return false;
+
+		outHash = GenerateXXHash(file.GetData(), file.GetSize());
+
+		return true;
+	}
+
+} // namespace SW
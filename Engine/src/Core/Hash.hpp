@@ -1,7 +1,7 @@
 /**
  * @file Hash.hpp
  * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
- * @version 0.1.0
+ * @version 0.2.1
  * @date 2024-03-09
  *
  * @copyright Copyright (c) 2024 Tycjan Fortuna
@@ -11,30 +11,123 @@
 namespace SW
 {
 
+	/**
+	 * @brief Streaming 64 bit XXH64 hash, fast non-cryptographic hash of arbitrary long inputs.
+	 *
+	 * 		  The input is consumed in 32 byte stripes by four independent accumulators, so the multiplications of
+	 * 		  the lanes run in parallel. Feeding the input in any number of pieces gives the same result.
+	 */
+	class StreamingHash final
+	{
+	public:
+		/**
+		 * @brief Starts a new hash.
+		 *
+		 * @param seed The seed of the hash.
+		 */
+		explicit StreamingHash(u64 seed = 0);
+
+		/**
+		 * @brief Starts a new hash, the consumed input is dropped.
+		 *
+		 * @param seed The seed of the hash.
+		 */
+		void Reset(u64 seed = 0);
+
+		/**
+		 * @brief Consumes the next piece of the input.
+		 *
+		 * @param data The bytes to consume.
+		 * @param size The number of bytes.
+		 */
+		void Update(const void* data, u64 size);
+
+		/**
+		 * @brief Computes the hash of the input consumed so far, more input can follow.
+		 *
+		 * @return The hash.
+		 */
+		u64 Digest() const;
+
+	private:
+		static constexpr u64 StripeSize = 32; /**< Bytes consumed by one round of the accumulators. */
+
+		u64 m_Accumulators[4] = {}; /**< Lanes of the hash, one 8 byte word of every stripe each. */
+		u64 m_Seed            = 0;  /**< The seed of the hash. */
+		u64 m_TotalSize       = 0;  /**< Number of bytes consumed. */
+
+		u8 m_Buffer[StripeSize] = {}; /**< Bytes not forming a whole stripe yet. */
+		u32 m_BufferSize        = 0;  /**< Number of bytes in the buffer. */
+	};
+
 	class Hash
 	{
 	public:
 		static constexpr u32 GenerateFNVHash(std::string_view str)
 		{
-			constexpr u32 FNV_PRIME    = 16777619u;
-			constexpr u32 OFFSET_BASIS = 2166136261u;
+			u32 hash = AppendFNVHash(FNV_OFFSET_BASIS, str);
 
-			const u64 length = str.length();
-			const char* data = str.data();
+			hash ^= '\0';
+			hash *= FNV_PRIME;
 
-			u32 hash = OFFSET_BASIS;
+			return hash;
+		}
 
-			for (u64 i = 0; i < length; ++i)
-			{
-				hash ^= *data++;
-				hash *= FNV_PRIME;
-			}
+		/**
+		 * @brief Same as GenerateFNVHash() of "scope.name" (e.g. a field of a script), the string is not built.
+		 *
+		 * @param scope The part before the dot.
+		 * @param name The part after the dot.
+		 * @return The hash.
+		 */
+		static constexpr u32 GenerateFNVHash(std::string_view scope, std::string_view name)
+		{
+			u32 hash = AppendFNVHash(FNV_OFFSET_BASIS, scope);
+
+			hash ^= '.';
+			hash *= FNV_PRIME;
+
+			hash = AppendFNVHash(hash, name);
 
 			hash ^= '\0';
 			hash *= FNV_PRIME;
 
 			return hash;
 		}
+
+		/**
+		 * @brief Hashes the bytes with XXH64 (see StreamingHash).
+		 *
+		 * @param data The bytes to hash.
+		 * @param size The number of bytes.
+		 * @param seed The seed of the hash.
+		 * @return The hash.
+		 */
+		static u64 GenerateXXHash(const void* data, u64 size, u64 seed = 0);
+
+		/**
+		 * @brief Hashes the contents of the file, the file is memory mapped instead of read.
+		 *
+		 * @param path Path to the file.
+		 * @param outHash The hash of the contents.
+		 * @return Whether the file could be read.
+		 */
+		static bool GenerateFileHash(const std::filesystem::path& path, u64& outHash);
+
+	private:
+		static constexpr u32 FNV_PRIME        = 16777619u;
+		static constexpr u32 FNV_OFFSET_BASIS = 2166136261u;
+
+		static constexpr u32 AppendFNVHash(u32 hash, std::string_view str)
+		{
+			for (const char c : str)
+			{
+				hash ^= c;
+				hash *= FNV_PRIME;
+			}
+
+			return hash;
+		}
 	};
 
 } // namespace SW
@@ -1,12 +1,23 @@
 #include "Texture2D.hpp"
 
+#include <algorithm>
+
 #include <glad/glad.h>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include "Core/Project/Project.hpp"
 #include "Core/Project/ProjectContext.hpp"
+#include "Core/Utils/BlockCompression.hpp"
 #include <stb_image.h>
 
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+	#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
+
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+	#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
 namespace SW
 {
 
@@ -28,6 +39,57 @@ namespace SW
 		return 0;
 	}
 
+	// Bytes per texel of the uncompressed internal formats, RGB8 is padded to 4 bytes by the drivers.
+	static u64 GetTexelSize(GLenum internalFormat)
+	{
+		switch (internalFormat)
+		{
+		case GL_R8:
+		case GL_RED:
+			return 1;
+		case GL_RG8:
+			return 2;
+		default:
+			return 4;
+		}
+	}
+
+	static i32 GetMipLevelCount(i32 width, i32 height)
+	{
+		i32 levels = 1;
+
+		for (i32 size = std::max(width, height); size > 1; size /= 2)
+			levels++;
+
+		return levels;
+	}
+
+	static u64 GetMipChainSize(i32 width, i32 height, i32 levelCount, u64 texelSize)
+	{
+		u64 size = 0;
+
+		for (i32 level = 0; level < levelCount; level++)
+		{
+			size += (u64)std::max(width >> level, 1) * (u64)std::max(height >> level, 1) * texelSize;
+		}
+
+		return size;
+	}
+
+	// Copies the pixels into a staging buffer if one is free, the driver then does not copy them out of client memory.
+	static TextureStagingBuffer StageClientData(const void* data, u64 size)
+	{
+		if (size < TextureUploader::MinStagedSize)
+			return {};
+
+		TextureStagingBuffer staging = TextureUploader::Stage(size);
+
+		if (staging)
+			std::memcpy(staging.Data, data, size);
+
+		return staging;
+	}
+
 	Texture2D::Texture2D(const char* filepath, bool flipped /*= true*/)
 	{
 		LoadTextureData(filepath, flipped);
@@ -38,9 +100,10 @@ namespace SW
 		m_InternalFormat = GL_RGBA8;
 		m_DataFormat     = GL_RGBA;
 
-		m_Width    = (i32)width;
-		m_Height   = (i32)height;
-		m_Channels = 0;
+		m_Width      = (i32)width;
+		m_Height     = (i32)height;
+		m_Channels   = 0;
+		m_MemorySize = (u64)m_Width * m_Height * 4;
 
 		glCreateTextures(GL_TEXTURE_2D, 1, &m_Handle);
 		glTextureStorage2D(m_Handle, 1, GL_RGBA8, m_Width, m_Height);
@@ -59,6 +122,77 @@ namespace SW
 		LoadTextureData(texturePath.string().c_str(), flipped);
 	}
 
+	Texture2D::Texture2D(const u8* data, u64 size, bool flipped /*= true*/)
+	{
+		LoadTextureData(data, size, flipped);
+	}
+
+	Texture2D::Texture2D(const u8* pixels, i32 width, i32 height, i32 channels)
+	{
+		m_Width    = width;
+		m_Height   = height;
+		m_Channels = channels;
+
+		UploadTextureData(pixels);
+	}
+
+	Texture2D::Texture2D(ImageFormat format, const std::vector<TextureMipLevel>& levels, const u8* data)
+	{
+		ASSERT(!levels.empty(), "Texture must have at least one mip level!");
+
+		ASSERT(format == ImageFormat::RGBA8 || format == ImageFormat::BC1 || format == ImageFormat::BC3,
+		       "Mip levels must be RGBA8, BC1 or BC3!");
+
+		if (TextureUploader::IsFormatSupported(format))
+		{
+			TextureStagingBuffer staging = StageClientData(data, levels.back().Offset + levels.back().Size);
+
+			UploadLevels(format, levels, staging ? TextureUploader::BeginUpload(staging) : data);
+
+			if (staging)
+				m_UploadTicket = TextureUploader::EndUpload(staging);
+
+			return;
+		}
+
+		m_Width      = levels[0].Width;
+		m_Height     = levels[0].Height;
+		m_Channels   = 4;
+		m_DataFormat = GL_RGBA;
+		m_MemorySize = 0;
+
+		CreateStorage(GL_RGBA8, (i32)levels.size());
+
+		std::vector<u8> decoded; // blocks the GPU cannot sample
+
+		for (i32 level = 0; level < (i32)levels.size(); level++)
+		{
+			const TextureMipLevel& mip = levels[level];
+
+			decoded.resize((u64)mip.Width * mip.Height * 4);
+
+			if (format == ImageFormat::BC1)
+				BlockCompression::DecodeBC1(data + mip.Offset, mip.Width, mip.Height, decoded.data());
+			else
+				BlockCompression::DecodeBC3(data + mip.Offset, mip.Width, mip.Height, decoded.data());
+
+			glTextureSubImage2D(m_Handle, level, 0, 0, mip.Width, mip.Height, GL_RGBA, GL_UNSIGNED_BYTE,
+			                    decoded.data());
+
+			m_MemorySize += decoded.size();
+		}
+	}
+
+	Texture2D::Texture2D(ImageFormat format, const std::vector<TextureMipLevel>& levels, TextureStagingBuffer& staging)
+	{
+		ASSERT(!levels.empty(), "Texture must have at least one mip level!");
+		ASSERT(staging && TextureUploader::IsFormatSupported(format), "Levels must be staged in a supported format!");
+
+		UploadLevels(format, levels, TextureUploader::BeginUpload(staging));
+
+		m_UploadTicket = TextureUploader::EndUpload(staging);
+	}
+
 	Texture2D::Texture2D(const TextureSpecification& spec)
 	{
 		switch (spec.Format)
@@ -78,11 +212,16 @@ namespace SW
 			m_InternalFormat = GL_RGBA8;
 			break;
 		}
+		default: {
+			ASSERT(false, "Block compressed textures can only be created from their mip levels!");
+			break;
+		}
 		}
 
-		m_Width    = (i32)spec.Width;
-		m_Height   = (i32)spec.Height;
-		m_Channels = DataFormatToChannels(m_DataFormat);
+		m_Width      = (i32)spec.Width;
+		m_Height     = (i32)spec.Height;
+		m_Channels   = DataFormatToChannels(m_DataFormat);
+		m_MemorySize = (u64)m_Width * m_Height * GetTexelSize(m_InternalFormat);
 
 		glCreateTextures(GL_TEXTURE_2D, 1, &m_Handle);
 		glTextureStorage2D(m_Handle, 1, m_InternalFormat, m_Width, m_Height);
@@ -131,21 +270,21 @@ namespace SW
 		glDeleteTextures(1, &m_Handle);
 		glDeleteFramebuffers(2, fboIds);
 
-		m_Handle = newTextureHandle;
-		m_Width  = newWidth;
-		m_Height = newHeight;
+		m_Handle     = newTextureHandle;
+		m_Width      = newWidth;
+		m_Height     = newHeight;
+		m_MemorySize = (u64)m_Width * m_Height * GetTexelSize(m_InternalFormat);
 	}
 
-	const char* Texture2D::GetBytes() const
+	std::vector<u8> Texture2D::GetBytes() const
 	{
-		GLint bpp  = DataFormatToChannels(m_DataFormat);
-		GLint size = m_Width * m_Height * bpp;
+		const size_t size = (size_t)m_Width * (size_t)m_Height * (size_t)DataFormatToChannels(m_DataFormat);
 
-		char* data = new char[size];
+		std::vector<u8> data(size);
 
-		glBindTexture(GL_TEXTURE_2D, m_Handle);
-		glGetTexImage(GL_TEXTURE_2D, 0, m_DataFormat, GL_UNSIGNED_BYTE, data);
-		glBindTexture(GL_TEXTURE_2D, 0);
+		glPixelStorei(GL_PACK_ALIGNMENT, 1); // rows of RGB textures are not 4 byte aligned
+		glGetTextureImage(m_Handle, 0, m_DataFormat, GL_UNSIGNED_BYTE, (GLsizei)size, data.data());
+		glPixelStorei(GL_PACK_ALIGNMENT, 4);
 
 		return data;
 	}
@@ -156,7 +295,33 @@ namespace SW
 
 		ASSERT(size == m_Width * m_Height * bpp, "Data must be entire texture!");
 
-		glTextureSubImage2D(m_Handle, 0, 0, 0, m_Width, m_Height, m_DataFormat, GL_UNSIGNED_BYTE, data);
+		TextureStagingBuffer staging = StageClientData(data, size);
+		const void* pixels           = staging ? TextureUploader::BeginUpload(staging) : data;
+
+		glTextureSubImage2D(m_Handle, 0, 0, 0, m_Width, m_Height, m_DataFormat, GL_UNSIGNED_BYTE, pixels);
+
+		if (staging)
+			m_UploadTicket = TextureUploader::EndUpload(staging);
+	}
+
+	bool Texture2D::IsReady() const
+	{
+		return TextureUploader::IsComplete(m_UploadTicket);
+	}
+
+	void Texture2D::SetSubData(const void* data, i32 x, i32 y, i32 width, i32 height)
+	{
+		ASSERT(x >= 0 && y >= 0 && x + width <= m_Width && y + height <= m_Height,
+		       "Region must be inside the texture!");
+
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1); // rows of RGB regions are not 4 byte aligned
+		glTextureSubImage2D(m_Handle, 0, x, y, width, height, m_DataFormat, GL_UNSIGNED_BYTE, data);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	}
+
+	void Texture2D::Clear()
+	{
+		glClearTexImage(m_Handle, 0, m_DataFormat, GL_UNSIGNED_BYTE, nullptr); // no data clears to zero
 	}
 
 	void Texture2D::LoadTextureData(const char* filepath, bool flipped)
@@ -166,41 +331,136 @@ namespace SW
 
 		ASSERT(data, "Failed to load the image: {}", filepath);
 
+		UploadTextureData(data);
+
+		stbi_image_free(data);
+
+		SYSTEM_INFO("Texture2D `{}` created successfully!", filepath);
+	}
+
+	void Texture2D::LoadTextureData(const u8* encoded, u64 size, bool flipped)
+	{
+		ASSERT(size <= (u64)std::numeric_limits<int>::max(), "Encoded image is too big!");
+
+		stbi_set_flip_vertically_on_load(flipped);
+		stbi_uc* data = stbi_load_from_memory(encoded, (int)size, &m_Width, &m_Height, &m_Channels, 0);
+
+		ASSERT(data, "Failed to load the image from memory: {}", stbi_failure_reason());
+
+		UploadTextureData(data);
+
+		stbi_image_free(data);
+	}
+
+	void Texture2D::UploadTextureData(const u8* data)
+	{
 		GLenum internalFormat = 0, dataFormat = 0;
 
-		if (m_Channels == 4)
+		switch (m_Channels)
 		{
+		case 1: {
+			internalFormat = GL_R8;
+			dataFormat     = GL_RED;
+			break;
+		}
+		case 2: {
+			internalFormat = GL_RG8;
+			dataFormat     = GL_RG;
+			break;
+		}
+		case 3: {
+			internalFormat = GL_RGB8;
+			dataFormat     = GL_RGB;
+			break;
+		}
+		case 4: {
 			internalFormat = GL_RGBA8;
 			dataFormat     = GL_RGBA;
+			break;
+		}
+		default: {
+			SYSTEM_ERROR("Texture2D format not yet supported!");
+			break;
+		}
 		}
-		else if (m_Channels == 3)
+
+		const i32 levelCount = GetMipLevelCount(m_Width, m_Height);
+
+		CreateStorage(internalFormat, levelCount);
+
+		// Grey images are sampled like the RGBA ones, as stb_image would expand them.
+		if (m_Channels == 1 || m_Channels == 2)
 		{
-			internalFormat = GL_RGB8;
-			dataFormat     = GL_RGB;
+			const GLint alpha     = m_Channels == 1 ? GL_ONE : GL_GREEN;
+			const GLint swizzle[] = {GL_RED, GL_RED, GL_RED, alpha};
+
+			glTextureParameteriv(m_Handle, GL_TEXTURE_SWIZZLE_RGBA, swizzle);
 		}
-		else
+
+		TextureStagingBuffer staging = StageClientData(data, (u64)m_Width * m_Height * m_Channels);
+		const u8* pixels             = staging ? TextureUploader::BeginUpload(staging) : data;
+
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1); // rows of RGB and grey images are not 4 byte aligned
+		glTextureSubImage2D(m_Handle, 0, 0, 0, m_Width, m_Height, dataFormat, GL_UNSIGNED_BYTE, pixels);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+		if (staging)
+			m_UploadTicket = TextureUploader::EndUpload(staging);
+
+		glGenerateTextureMipmap(m_Handle);
+
+		m_DataFormat     = dataFormat;
+		m_InternalFormat = internalFormat;
+		m_MemorySize     = GetMipChainSize(m_Width, m_Height, levelCount, GetTexelSize(internalFormat));
+	}
+
+	void Texture2D::UploadLevels(ImageFormat format, const std::vector<TextureMipLevel>& levels, const u8* data)
+	{
+		const bool isCompressed = format == ImageFormat::BC1 || format == ImageFormat::BC3;
+
+		const GLenum internalFormat = format == ImageFormat::BC1   ? GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+		                              : format == ImageFormat::BC3 ? GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+		                                                           : GL_RGBA8;
+
+		m_Width      = levels[0].Width;
+		m_Height     = levels[0].Height;
+		m_Channels   = 4;
+		m_DataFormat = GL_RGBA; // compressed textures are read back decompressed
+		m_MemorySize = 0;
+
+		CreateStorage(internalFormat, (i32)levels.size());
+
+		for (i32 level = 0; level < (i32)levels.size(); level++)
 		{
-			SYSTEM_ERROR("Texture2D format not yet supported!");
+			const TextureMipLevel& mip = levels[level];
+
+			if (isCompressed)
+			{
+				glCompressedTextureSubImage2D(m_Handle, level, 0, 0, mip.Width, mip.Height, internalFormat,
+				                              (GLsizei)mip.Size, data + mip.Offset);
+			}
+			else
+			{
+				glTextureSubImage2D(m_Handle, level, 0, 0, mip.Width, mip.Height, GL_RGBA, GL_UNSIGNED_BYTE,
+				                    data + mip.Offset);
+			}
+
+			m_MemorySize += mip.Size;
 		}
+	}
 
+	void Texture2D::CreateStorage(u32 internalFormat, i32 levelCount)
+	{
 		glCreateTextures(GL_TEXTURE_2D, 1, &m_Handle);
-		glTextureStorage2D(m_Handle, 1, internalFormat, m_Width, m_Height);
+		glTextureStorage2D(m_Handle, levelCount, internalFormat, m_Width, m_Height);
 
-		glTextureParameteri(m_Handle, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+		glTextureParameteri(m_Handle, GL_TEXTURE_MIN_FILTER, levelCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
 		glTextureParameteri(m_Handle, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
 		glTextureParameteri(m_Handle, GL_TEXTURE_WRAP_S, GL_REPEAT);
 		glTextureParameteri(m_Handle, GL_TEXTURE_WRAP_T, GL_REPEAT);
 
-		glTextureSubImage2D(m_Handle, 0, 0, 0, m_Width, m_Height, dataFormat, GL_UNSIGNED_BYTE, data);
-		glGenerateTextureMipmap(m_Handle);
-
-		stbi_image_free(data);
-
-		m_DataFormat     = dataFormat;
 		m_InternalFormat = internalFormat;
-
-		SYSTEM_INFO("Texture2D `{}` created successfully!", filepath);
 	}
 
 } // namespace SW
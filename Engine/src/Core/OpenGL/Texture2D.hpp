@@ -1,7 +1,7 @@
 /**
  * @file Texture2D.hpp
  * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
- * @version 0.1.5
+ * @version 0.1.10
  * @date 2024-04-06
  *
  * @copyright Copyright (c) 2024 Tycjan Fortuna
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Asset/Asset.hpp"
+#include "TextureUploader.hpp"
 
 namespace SW
 {
@@ -20,8 +21,21 @@ namespace SW
 	{
 		None = 0, /**< No format specified */
 		RED,
-		RGB8, /**< RGB format with 8 bits per channel */
-		RGBA8 /**< RGBA format with 8 bits per channel */
+		RGB8,  /**< RGB format with 8 bits per channel */
+		RGBA8, /**< RGBA format with 8 bits per channel */
+		BC1,   /**< Block compressed RGB, 8 bytes per 4x4 pixels (cooked textures only) */
+		BC3    /**< Block compressed RGBA, 16 bytes per 4x4 pixels (cooked textures only) */
+	};
+
+	/**
+	 * @brief Represents a single mip level of a texture created from already prepared levels.
+	 */
+	struct TextureMipLevel final
+	{
+		i32 Width  = 0; /**< The width of the level */
+		i32 Height = 0; /**< The height of the level */
+		u64 Offset = 0; /**< Offset of the pixels (or blocks) of the level in the data of the texture */
+		u64 Size   = 0; /**< Size of the pixels (or blocks) of the level in bytes */
 	};
 
 	/**
@@ -56,6 +70,45 @@ namespace SW
 		 */
 		Texture2D(const std::filesystem::path& filepath, bool flipped = true);
 
+		/**
+		 * @brief Construct a new Texture 2D from an encoded image (png, jpg...) already in memory
+		 *
+		 * @param data Encoded image bytes, only read during construction
+		 * @param size Size of the encoded image in bytes
+		 * @param flipped Whether the texture should be flipped vertically (must be for OpenGL related textures)
+		 */
+		Texture2D(const u8* data, u64 size, bool flipped = true);
+
+		/**
+		 * @brief Construct a new Texture 2D from already decoded pixels (e.g. decoded on a worker thread)
+		 *
+		 * @param pixels Decoded pixels, only read during construction
+		 * @param width Width of the texture
+		 * @param height Height of the texture
+		 * @param channels Number of channels of the pixels (1 to 4)
+		 */
+		Texture2D(const u8* pixels, i32 width, i32 height, i32 channels);
+
+		/**
+		 * @brief Construct a new Texture 2D from prepared mip levels (e.g. a cooked texture), nothing is generated
+		 * @note Block compressed levels are decoded on the CPU if the GPU does not support the format.
+		 *
+		 * @param format Format of the levels (RGBA8, BC1 or BC3)
+		 * @param levels The mip levels, the first one is the full size texture
+		 * @param data Pixels (or blocks) of all levels, only read during construction
+		 */
+		Texture2D(ImageFormat format, const std::vector<TextureMipLevel>& levels, const u8* data);
+
+		/**
+		 * @brief Construct a new Texture 2D from mip levels already staged by the TextureUploader (e.g. on a worker
+		 * 		  thread), the GPU copies them asynchronously - see IsReady
+		 *
+		 * @param format Format of the levels, TextureUploader::IsFormatSupported must be true for it
+		 * @param levels The mip levels, the first one is the full size texture
+		 * @param staging The staged pixels (or blocks) of all levels, handed over to the uploader and emptied
+		 */
+		Texture2D(ImageFormat format, const std::vector<TextureMipLevel>& levels, TextureStagingBuffer& staging);
+
 		/**
 		 * @brief Construct a new Texture 2D
 		 *
@@ -129,19 +182,34 @@ namespace SW
 		void ChangeSize(i32 newWidth, i32 newHeight);
 
 		/**
-		 * @brief Get the bytes of the texture
-		 * @warning Returned pointer must be freed by the caller!!
+		 * @brief Read the pixels of the texture back from the GPU
+		 * @warning Stalls until the GPU finishes all work on the texture, keep it out of per frame code.
 		 *
-		 * @return const char*
+		 * @return std::vector<u8> Tightly packed pixels
 		 */
-		const char* GetBytes() const;
+		std::vector<u8> GetBytes() const;
 
 		/**
-		 * @brief Get only the estimated size of the texture on the GPU
+		 * @brief Get only the estimated size of the texture on the GPU (all mip levels)
 		 *
-		 * @return u32
+		 * @return u64
+		 */
+		u64 GetEstimatedSize() const { return m_MemorySize; }
+
+		/**
+		 * @brief Get the memory held by the texture (estimated GPU size)
+		 *
+		 * @return u64
 		 */
-		u32 GetEstimatedSize() const { return (u32)m_Width * m_Height * 4; }
+		u64 GetMemorySize() const override { return GetEstimatedSize(); }
+
+		/**
+		 * @brief Check whether the GPU finished copying the pixels of the texture out of the staging buffer
+		 * @note The texture can be drawn before, the GPU orders the copy before the sampling.
+		 *
+		 * @return bool
+		 */
+		bool IsReady() const;
 
 		/**
 		 * @brief Set the texture data
@@ -149,6 +217,22 @@ namespace SW
 		 */
 		void SetData(void* data, u32 size);
 
+		/**
+		 * @brief Set the data of a region of the texture
+		 *
+		 * @param data Tightly packed pixels of the region, in the format of the texture
+		 * @param x Left edge of the region
+		 * @param y Bottom edge of the region
+		 * @param width Width of the region
+		 * @param height Height of the region
+		 */
+		void SetSubData(const void* data, i32 x, i32 y, i32 width, i32 height);
+
+		/**
+		 * @brief Fill the base level of the texture with zeros
+		 */
+		void Clear();
+
 		/**
 		 * @brief Check if two textures are the same
 		 *
@@ -158,12 +242,14 @@ namespace SW
 		bool operator==(const Texture2D& other) const { return m_Handle == ((Texture2D&)other).m_Handle; }
 
 	private:
-		u32 m_Handle;         /** @brief OpenGL texture handle */
-		i32 m_Width;          /** @brief Texture width */
-		i32 m_Height;         /** @brief Texture height */
-		i32 m_Channels;       /** @brief Texture channels */
-		u32 m_DataFormat;     /** @brief Texture data format */
-		u32 m_InternalFormat; /** @brief Texture internal format */
+		u32 m_Handle;           /** @brief OpenGL texture handle */
+		i32 m_Width;            /** @brief Texture width */
+		i32 m_Height;           /** @brief Texture height */
+		i32 m_Channels;         /** @brief Texture channels */
+		u32 m_DataFormat;       /** @brief Texture data format */
+		u32 m_InternalFormat;   /** @brief Texture internal format */
+		u64 m_MemorySize   = 0; /** @brief Estimated size of the texture on the GPU */
+		u64 m_UploadTicket = 0; /** @brief Ticket of the last staged upload, 0 if uploaded from client memory */
 
 		/**
 		 * Loads the texture data from the specified file.
@@ -172,6 +258,40 @@ namespace SW
 		 * @param flipped  Indicates whether the texture should be vertically flipped during loading.
 		 */
 		void LoadTextureData(const char* filepath, bool flipped);
+
+		/**
+		 * Loads the texture data from an encoded image in memory.
+		 *
+		 * @param encoded  The encoded image bytes.
+		 * @param size     The size of the encoded image in bytes.
+		 * @param flipped  Indicates whether the texture should be vertically flipped during loading.
+		 */
+		void LoadTextureData(const u8* encoded, u64 size, bool flipped);
+
+		/**
+		 * Creates the OpenGL texture from the decoded pixels (m_Width, m_Height and m_Channels must be set).
+		 * The whole mip chain is allocated and generated by the GPU.
+		 *
+		 * @param data The decoded pixels.
+		 */
+		void UploadTextureData(const u8* data);
+
+		/**
+		 * Creates the OpenGL texture from prepared mip levels in a format the GPU supports.
+		 *
+		 * @param format The format of the levels.
+		 * @param levels The mip levels, the first one is the full size texture.
+		 * @param data   Pixels (or blocks) of all levels, or the offset in the bound pixel unpack buffer.
+		 */
+		void UploadLevels(ImageFormat format, const std::vector<TextureMipLevel>& levels, const u8* data);
+
+		/**
+		 * Creates the OpenGL texture with the storage for the levels and sets the filtering and wrapping.
+		 *
+		 * @param internalFormat The internal format of the texture.
+		 * @param levelCount The number of mip levels.
+		 */
+		void CreateStorage(u32 internalFormat, i32 levelCount);
 	};
 
 } // namespace SW
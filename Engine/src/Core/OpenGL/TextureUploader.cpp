@@ -0,0 +1,322 @@
+#include "TextureUploader.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+
+#include <glad/glad.h>
+
+#include "Texture2D.hpp"
+
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+	#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
+
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+	#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
+namespace SW
+{
+
+	/**
+	 * @brief Single persistently mapped staging buffer.
+	 */
+	struct StagingPage final
+	{
+		u32 Buffer          = 0;       /**< OpenGL buffer handle */
+		u8* Data            = nullptr; /**< Persistently mapped memory of the buffer */
+		u64 Offset          = 0;       /**< Bump allocator, start of the next region */
+		u32 LiveAllocations = 0;       /**< Staged or pending regions, the page is reused once it drops to 0 */
+	};
+
+	/**
+	 * @brief Copy issued by the main thread that the GPU may not have finished yet.
+	 */
+	struct PendingUpload final
+	{
+		GLsync Fence = nullptr;       /**< Signaled once the copy is done */
+		TextureStagingBuffer Staging; /**< Region recycled after the copy */
+		u64 Ticket = 0;               /**< Ticket of the upload */
+	};
+
+	struct TextureUploaderData final
+	{
+		std::array<StagingPage, TextureUploader::PageCount> Pages;
+		u32 CurrentPage    = 0;
+		bool IsInitialized = false;
+
+		std::atomic<bool> SupportsBC1 = false;
+		std::atomic<bool> SupportsBC3 = false;
+
+		std::mutex PagesMutex; /**< Guards Pages, CurrentPage, IsInitialized and Statistics. */
+
+		// Main thread only.
+		std::deque<PendingUpload> Pending;
+		u64 LastTicket      = 0;
+		u64 CompletedTicket = 0;
+
+		TextureUploadStatistics Statistics;
+
+		std::chrono::steady_clock::time_point WindowStart;
+		u64 WindowBytes = 0;
+	};
+
+	static TextureUploaderData s_Data;
+
+	static u64 AlignRegion(u64 size)
+	{
+		return (size + TextureUploader::Alignment - 1) & ~(TextureUploader::Alignment - 1);
+	}
+
+	// Must be called with the pages mutex locked.
+	static void ReleaseRegion(const TextureStagingBuffer& staging)
+	{
+		StagingPage& page = s_Data.Pages[staging.Page];
+
+		ASSERT(page.LiveAllocations > 0, "Staging buffer released twice!");
+
+		page.LiveAllocations--;
+		s_Data.Statistics.StagingUsed -= AlignRegion(staging.Size);
+	}
+
+	void TextureUploader::Initialize()
+	{
+		PROFILE_FUNCTION();
+
+		GLint count = 0;
+		glGetIntegerv(GL_NUM_COMPRESSED_TEXTURE_FORMATS, &count);
+
+		std::vector<GLint> formats((size_t)count);
+		glGetIntegerv(GL_COMPRESSED_TEXTURE_FORMATS, formats.data());
+
+		const auto isSupported = [&formats](GLint format) {
+			return std::find(formats.begin(), formats.end(), format) != formats.end();
+		};
+
+		s_Data.SupportsBC1 = isSupported(GL_COMPRESSED_RGB_S3TC_DXT1_EXT);
+		s_Data.SupportsBC3 = isSupported(GL_COMPRESSED_RGBA_S3TC_DXT5_EXT);
+
+		constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+		std::scoped_lock lock(s_Data.PagesMutex);
+
+		for (StagingPage& page : s_Data.Pages)
+		{
+			glCreateBuffers(1, &page.Buffer);
+			glNamedBufferStorage(page.Buffer, (GLsizeiptr)PageSize, nullptr, flags);
+
+			page.Data = (u8*)glMapNamedBufferRange(page.Buffer, 0, (GLsizeiptr)PageSize, flags);
+
+			ASSERT(page.Data, "Failed to map the texture staging buffer!");
+		}
+
+		s_Data.IsInitialized              = true;
+		s_Data.Statistics.StagingCapacity = PageSize * PageCount;
+		s_Data.WindowStart                = std::chrono::steady_clock::now();
+	}
+
+	void TextureUploader::Shutdown()
+	{
+		PROFILE_FUNCTION();
+
+		if (!s_Data.IsInitialized)
+			return;
+
+		for (PendingUpload& upload : s_Data.Pending)
+		{
+			glClientWaitSync(upload.Fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+			glDeleteSync(upload.Fence);
+		}
+
+		s_Data.Pending.clear();
+
+		std::scoped_lock lock(s_Data.PagesMutex);
+
+		for (StagingPage& page : s_Data.Pages)
+		{
+			glUnmapNamedBuffer(page.Buffer);
+			glDeleteBuffers(1, &page.Buffer);
+
+			page = StagingPage();
+		}
+
+		s_Data.IsInitialized = false;
+	}
+
+	void TextureUploader::Update()
+	{
+		PROFILE_FUNCTION();
+
+		u64 completedBytes = 0;
+		u32 completedCount = 0;
+
+		// Copies finish in the order they were issued, the first unsignaled fence ends the scan.
+		while (!s_Data.Pending.empty())
+		{
+			PendingUpload& upload = s_Data.Pending.front();
+
+			const GLenum status = glClientWaitSync(upload.Fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+
+			if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+				break;
+
+			glDeleteSync(upload.Fence);
+
+			{
+				std::scoped_lock lock(s_Data.PagesMutex);
+
+				ReleaseRegion(upload.Staging);
+			}
+
+			completedBytes += upload.Staging.Size;
+			completedCount++;
+
+			s_Data.CompletedTicket = upload.Ticket;
+			s_Data.Pending.pop_front();
+		}
+
+		const auto now     = std::chrono::steady_clock::now();
+		const f32 duration = std::chrono::duration<f32>(now - s_Data.WindowStart).count();
+
+		std::scoped_lock lock(s_Data.PagesMutex);
+
+		s_Data.Statistics.UploadedBytes += completedBytes;
+		s_Data.Statistics.UploadedTextures += completedCount;
+		s_Data.Statistics.PendingUploads = (u32)s_Data.Pending.size();
+
+		s_Data.WindowBytes += completedBytes;
+
+		if (duration >= 1.f)
+		{
+			s_Data.Statistics.Bandwidth = (f32)s_Data.WindowBytes / duration;
+
+			s_Data.WindowBytes = 0;
+			s_Data.WindowStart = now;
+		}
+	}
+
+	bool TextureUploader::IsFormatSupported(ImageFormat format)
+	{
+		switch (format)
+		{
+		case ImageFormat::BC1:
+			return s_Data.SupportsBC1;
+		case ImageFormat::BC3:
+			return s_Data.SupportsBC3;
+		case ImageFormat::None:
+			return false;
+		default:
+			return true;
+		}
+	}
+
+	TextureStagingBuffer TextureUploader::Stage(u64 size)
+	{
+		std::scoped_lock lock(s_Data.PagesMutex);
+
+		if (!s_Data.IsInitialized || size == 0)
+			return {};
+
+		const u64 alignedSize = AlignRegion(size);
+
+		if (alignedSize > PageSize)
+		{
+			s_Data.Statistics.DirectUploads++;
+			return {};
+		}
+
+		if (s_Data.Pages[s_Data.CurrentPage].Offset + alignedSize > PageSize)
+		{
+			// Next free page, the current one included - it may have been released since it filled up.
+			bool found = false;
+
+			for (u32 i = 1; i <= PageCount && !found; i++)
+			{
+				const u32 index = (s_Data.CurrentPage + i) % PageCount;
+
+				if (s_Data.Pages[index].LiveAllocations == 0)
+				{
+					s_Data.CurrentPage         = index;
+					s_Data.Pages[index].Offset = 0;
+
+					found = true;
+				}
+			}
+
+			if (!found)
+			{
+				s_Data.Statistics.DirectUploads++;
+				return {};
+			}
+		}
+
+		StagingPage& page = s_Data.Pages[s_Data.CurrentPage];
+
+		TextureStagingBuffer staging;
+		staging.Data   = page.Data + page.Offset;
+		staging.Size   = size;
+		staging.Offset = page.Offset;
+		staging.Page   = s_Data.CurrentPage;
+
+		page.Offset += alignedSize;
+		page.LiveAllocations++;
+
+		s_Data.Statistics.StagingUsed += alignedSize;
+
+		return staging;
+	}
+
+	void TextureUploader::Release(TextureStagingBuffer& staging)
+	{
+		if (!staging)
+			return;
+
+		std::scoped_lock lock(s_Data.PagesMutex);
+
+		if (s_Data.IsInitialized) // the pool is gone after the shutdown
+			ReleaseRegion(staging);
+
+		staging = {};
+	}
+
+	const u8* TextureUploader::BeginUpload(const TextureStagingBuffer& staging)
+	{
+		ASSERT(staging, "Nothing is staged!");
+
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, s_Data.Pages[staging.Page].Buffer);
+
+		return reinterpret_cast<const u8*>((uintptr_t)staging.Offset);
+	}
+
+	u64 TextureUploader::EndUpload(TextureStagingBuffer& staging)
+	{
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+		PendingUpload upload;
+		upload.Fence   = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		upload.Staging = staging;
+		upload.Ticket  = ++s_Data.LastTicket;
+
+		s_Data.Pending.emplace_back(upload);
+
+		staging = {};
+
+		return upload.Ticket;
+	}
+
+	bool TextureUploader::IsComplete(u64 ticket)
+	{
+		return ticket <= s_Data.CompletedTicket;
+	}
+
+	TextureUploadStatistics TextureUploader::GetStatistics()
+	{
+		std::scoped_lock lock(s_Data.PagesMutex);
+
+		return s_Data.Statistics;
+	}
+
+} // namespace SW
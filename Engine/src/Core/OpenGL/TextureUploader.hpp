@@ -0,0 +1,136 @@
+/**
+ * @file TextureUploader.hpp
+ * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
+ * @version 0.1.0
+ * @date 2024-06-03
+ *
+ * @copyright Copyright (c) 2024 Tycjan Fortuna
+ */
+#pragma once
+
+namespace SW
+{
+
+	enum class ImageFormat;
+
+	/**
+	 * @brief Region of a persistently mapped pixel unpack buffer holding the pixels of a single upload.
+	 */
+	struct TextureStagingBuffer final
+	{
+		u8* Data   = nullptr; /**< Mapped memory of the region, nullptr if nothing is staged */
+		u64 Size   = 0;       /**< Size of the staged data in bytes */
+		u64 Offset = 0;       /**< Offset of the region in the buffer, passed to OpenGL instead of a pointer */
+		u32 Page   = 0;       /**< Index of the buffer in the staging pool */
+
+		explicit operator bool() const { return Data != nullptr; }
+	};
+
+	/**
+	 * @brief Upload bandwidth statistics of the TextureUploader.
+	 */
+	struct TextureUploadStatistics final
+	{
+		u64 UploadedBytes    = 0;   /**< Bytes copied by the GPU from the staging buffers since the start */
+		u32 UploadedTextures = 0;   /**< Number of finished uploads since the start */
+		u32 PendingUploads   = 0;   /**< Number of copies the GPU has not finished yet */
+		u32 DirectUploads    = 0;   /**< Uploads from client memory - the pool was full or the image too big */
+		u64 StagingUsed      = 0;   /**< Bytes of the staging pool held by staged or pending uploads */
+		u64 StagingCapacity  = 0;   /**< Size of the staging pool */
+		f32 Bandwidth        = 0.f; /**< Bytes per second copied during the last second */
+	};
+
+	/**
+	 * @brief Streams texture data to the GPU through a pool of persistently mapped pixel unpack buffers.
+	 * 		  Worker threads stage the pixels straight into the mapped memory, the main thread only issues the
+	 * 		  copies and fences them. Regions are recycled once the GPU signals the fence of their copy, so loading
+	 * 		  a level never waits for the driver to copy the pixels out of client memory.
+	 * @note Every region lives in a page with a bump allocator, a page is reused once all its regions are released.
+	 */
+	class TextureUploader final
+	{
+	public:
+		static constexpr u64 PageSize      = 32 * 1024 * 1024; /**< Size of a single staging buffer */
+		static constexpr u32 PageCount     = 4;                /**< Number of staging buffers in the pool */
+		static constexpr u64 Alignment     = 256;              /**< Alignment of the regions in the buffers */
+		static constexpr u64 MinStagedSize = 64 * 1024;        /**< Smaller uploads go straight from client memory */
+
+		/**
+		 * @brief Creates and maps the staging buffers.
+		 * @warning Must be called from the main thread, after the OpenGL context is created.
+		 */
+		static void Initialize();
+
+		/**
+		 * @brief Waits for the pending copies and releases the staging buffers.
+		 * @warning Must be called from the main thread, before the OpenGL context is destroyed.
+		 */
+		static void Shutdown();
+
+		/**
+		 * @brief Polls the fences of the pending copies, recycles the finished regions and updates the statistics.
+		 * @note Called once per frame from the main thread, never blocks.
+		 */
+		static void Update();
+
+		/**
+		 * @brief Checks whether textures of the format can be uploaded from a staging buffer as they are.
+		 * @note Safe to call from worker threads. Block compressed formats depend on the GPU.
+		 *
+		 * @param format The format of the texture.
+		 * @return Whether the format is supported.
+		 */
+		static bool IsFormatSupported(ImageFormat format);
+
+		/**
+		 * @brief Reserves a region of the staging pool.
+		 * @note Safe to call from worker threads.
+		 *
+		 * @param size The size of the data in bytes.
+		 * @return The region, empty if the pool is full or the data does not fit a single page.
+		 */
+		static TextureStagingBuffer Stage(u64 size);
+
+		/**
+		 * @brief Returns the region of a never uploaded staging buffer to the pool.
+		 * @note Safe to call from worker threads, empty staging buffers are ignored.
+		 *
+		 * @param staging The staging buffer, emptied.
+		 */
+		static void Release(TextureStagingBuffer& staging);
+
+		/**
+		 * @brief Binds the buffer of the region as the pixel unpack buffer.
+		 * @warning Must be called from the main thread, pair with EndUpload.
+		 *
+		 * @param staging The staging buffer.
+		 * @return The pointer to pass to the OpenGL upload calls instead of the pixels.
+		 */
+		static const u8* BeginUpload(const TextureStagingBuffer& staging);
+
+		/**
+		 * @brief Unbinds the pixel unpack buffer and fences the issued copies, the region is recycled once done.
+		 * @warning Must be called from the main thread.
+		 *
+		 * @param staging The staging buffer, emptied.
+		 * @return The ticket of the upload.
+		 */
+		static u64 EndUpload(TextureStagingBuffer& staging);
+
+		/**
+		 * @brief Checks whether the GPU finished the upload.
+		 *
+		 * @param ticket The ticket of the upload, 0 for uploads from client memory.
+		 * @return Whether the upload is complete.
+		 */
+		static bool IsComplete(u64 ticket);
+
+		/**
+		 * @brief Gets the upload bandwidth statistics.
+		 *
+		 * @return The statistics.
+		 */
+		static TextureUploadStatistics GetStatistics();
+	};
+
+} // namespace SW
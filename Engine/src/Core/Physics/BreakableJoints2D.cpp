@@ -0,0 +1,102 @@
+#include "BreakableJoints2D.hpp"
+
+#include <box2d/box2d.h>
+
+namespace SW
+{
+
+	void BreakableJoints2D::Add(b2Joint* joint, u32 owner, JointType2D type, f32 breakingForce,
+	                            f32 breakingTorque /*= FLT_MAX*/)
+	{
+		if (!joint)
+			return;
+
+		if (breakingForce >= FLT_MAX && breakingTorque >= FLT_MAX)
+			return;
+
+		m_Joints.emplace_back(joint);
+		m_ForceThresholdsSq.emplace_back(breakingForce >= FLT_MAX ? FLT_MAX : breakingForce * breakingForce);
+		m_TorqueThresholds.emplace_back(breakingTorque);
+		m_Owners.emplace_back(owner);
+		m_Types.emplace_back(type);
+	}
+
+	void BreakableJoints2D::Remove(const b2Joint* joint)
+	{
+		for (size_t i = 0; i < m_Joints.size(); i++)
+		{
+			if (m_Joints[i] == joint)
+			{
+				RemoveAt(i);
+
+				return;
+			}
+		}
+	}
+
+	void BreakableJoints2D::RemoveAttachedTo(b2Body* body)
+	{
+		if (m_Joints.empty())
+			return;
+
+		for (b2JointEdge* edge = body->GetJointList(); edge; edge = edge->next)
+		{
+			Remove(edge->joint);
+		}
+	}
+
+	void BreakableJoints2D::Evaluate(f32 invDt, std::vector<BrokenJoint2D>& outBroken)
+	{
+		size_t i = 0;
+
+		while (i < m_Joints.size())
+		{
+			b2Joint* joint = m_Joints[i];
+
+			const bool broken = joint->GetReactionForce(invDt).LengthSquared() > m_ForceThresholdsSq[i] ||
+			                    (m_TorqueThresholds[i] < FLT_MAX &&
+			                     glm::abs(joint->GetReactionTorque(invDt)) > m_TorqueThresholds[i]);
+
+			if (!broken)
+			{
+				i++;
+
+				continue;
+			}
+
+			outBroken.push_back({joint, m_Owners[i], m_Types[i]});
+
+			RemoveAt(i); // the last entry lands at i, evaluate it in the next iteration
+		}
+	}
+
+	void BreakableJoints2D::Clear()
+	{
+		m_Joints.clear();
+		m_ForceThresholdsSq.clear();
+		m_TorqueThresholds.clear();
+		m_Owners.clear();
+		m_Types.clear();
+	}
+
+	void BreakableJoints2D::RemoveAt(size_t index)
+	{
+		const size_t last = m_Joints.size() - 1;
+
+		if (index != last)
+		{
+			m_Joints[index]            = m_Joints[last];
+			m_ForceThresholdsSq[index] = m_ForceThresholdsSq[last];
+			m_TorqueThresholds[index]  = m_TorqueThresholds[last];
+			m_Owners[index]            = m_Owners[last];
+			m_Types[index]             = m_Types[last];
+		}
+
+		m_Joints.pop_back();
+		m_ForceThresholdsSq.pop_back();
+		m_TorqueThresholds.pop_back();
+		m_Owners.pop_back();
+		m_Types.pop_back();
+	}
+
+} // namespace SW
@@ -0,0 +1,106 @@
+/**
+ * @file BreakableJoints2D.hpp
+ * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
+ * @version 0.1.0
+ * @date 2024-05-20
+ *
+ * @copyright Copyright (c) 2024 Tycjan Fortuna
+ */
+#pragma once
+
+class b2Body;
+class b2Joint;
+
+namespace SW
+{
+
+	/**
+	 * @brief Type of the joint component owning the runtime joint.
+	 */
+	enum class JointType2D : u8
+	{
+		Distance = 0,
+		Revolution,
+		Prismatic,
+		Spring,
+		Wheel
+	};
+
+	/**
+	 * @brief Joint which exceeded its breaking threshold during the last evaluation.
+	 */
+	struct BrokenJoint2D
+	{
+		b2Joint* Joint   = nullptr;               /**< The runtime joint (still alive, caller destroys it). */
+		u32 Owner        = 0;                     /**< The entt handle of the entity owning the joint component. */
+		JointType2D Type = JointType2D::Distance; /**< The type of the owning joint component. */
+	};
+
+	/**
+	 * @brief Compact list of joints that can actually break.
+	 * 		  Joints with infinite breaking force and torque are never registered, so their
+	 * 		  reaction forces are never queried. Thresholds are stored contiguously (squared force)
+	 * 		  to keep the per substep evaluation a tight linear loop.
+	 */
+	class BreakableJoints2D final
+	{
+	public:
+		/**
+		 * @brief Registers the joint if any of its thresholds is finite.
+		 *
+		 * @param joint The runtime joint.
+		 * @param owner The entt handle of the entity owning the joint component.
+		 * @param type The type of the owning joint component.
+		 * @param breakingForce The breaking force of the joint (FLT_MAX - unbreakable).
+		 * @param breakingTorque The breaking torque of the joint (FLT_MAX - unbreakable).
+		 */
+		void Add(b2Joint* joint, u32 owner, JointType2D type, f32 breakingForce, f32 breakingTorque = FLT_MAX);
+
+		/**
+		 * @brief Unregisters the joint (e.g. it was destroyed externally).
+		 *
+		 * @param joint The runtime joint.
+		 */
+		void Remove(const b2Joint* joint);
+
+		/**
+		 * @brief Unregisters all joints attached to the body.
+		 * @note Must be called before the body is destroyed as box2d destroys attached joints implicitly.
+		 *
+		 * @param body The body about to be destroyed.
+		 */
+		void RemoveAttachedTo(b2Body* body);
+
+		/**
+		 * @brief Checks all registered joints against their thresholds.
+		 * 		  Joints that broke are removed from the list and appended to the output.
+		 *
+		 * @param invDt The inverse of the physics step time.
+		 * @param outBroken Joints that exceeded the thresholds.
+		 */
+		void Evaluate(f32 invDt, std::vector<BrokenJoint2D>& outBroken);
+
+		/**
+		 * @brief Removes all registered joints.
+		 */
+		void Clear();
+
+		/**
+		 * @brief Number of registered joints.
+		 */
+		u32 GetCount() const { return (u32)m_Joints.size(); }
+
+	private:
+		std::vector<b2Joint*> m_Joints;       /**< The runtime joints. */
+		std::vector<f32> m_ForceThresholdsSq; /**< Squared breaking forces, parallel to m_Joints. */
+		std::vector<f32> m_TorqueThresholds;  /**< Breaking torques, parallel to m_Joints. */
+		std::vector<u32> m_Owners;            /**< Owner entities, parallel to m_Joints. */
+		std::vector<JointType2D> m_Types;     /**< Owner component types, parallel to m_Joints. */
+
+		/**
+		 * @brief Swap-removes the entry at the index.
+		 */
+		void RemoveAt(size_t index);
+	};
+
+} // namespace SW
@@ -1,6 +1,7 @@
 #include "Physics2DContactListener.hpp"
 #include "Core/ECS/Entity.hpp"
 #include "Core/Physics/PhysicsUtils.hpp"
+#include "Core/Physics/StaticColliderBaker2D.hpp"
 
 namespace SW
 {
@@ -33,10 +34,16 @@ namespace SW
 		const bool isFirstFixtureSensor  = firstFixture->IsSensor();
 		const bool isSecondFixtureSensor = secondFixture->IsSensor();
 
-		const Entity firstEntity  = {static_cast<entt::entity>(static_cast<u32>(firstFixture->GetUserData().pointer)),
-		                             m_Scene};
-		const Entity secondEntity = {static_cast<entt::entity>(static_cast<u32>(secondFixture->GetUserData().pointer)),
-		                             m_Scene};
+		const Entity firstEntity  = GetContactEntity(contact, firstFixture, secondFixture);
+		const Entity secondEntity = GetContactEntity(contact, secondFixture, firstFixture);
+
+		// Fixture detached from the simulation (its component was removed), destroyed with the next batch
+		if (!firstEntity || !secondEntity)
+			return;
+
+		// Remember which sources of the baked colliders were resolved, so the end event reports the same entities
+		if (IsBakedFixture(firstFixture) || IsBakedFixture(secondFixture))
+			m_BakedContacts[contact] = {static_cast<u32>(firstEntity), static_cast<u32>(secondEntity)};
 
 		const bool isFirstEntityFluid  = firstEntity.HasComponent<BuoyancyEffector2DComponent>();
 		const bool isSecondEntityFluid = secondEntity.HasComponent<BuoyancyEffector2DComponent>();
@@ -76,10 +83,29 @@ namespace SW
 		const bool isFirstFixtureSensor  = firstFixture->IsSensor();
 		const bool isSecondFixtureSensor = secondFixture->IsSensor();
 
-		const Entity firstEntity  = {static_cast<entt::entity>(static_cast<u32>(firstFixture->GetUserData().pointer)),
-		                             m_Scene};
-		const Entity secondEntity = {static_cast<entt::entity>(static_cast<u32>(secondFixture->GetUserData().pointer)),
-		                             m_Scene};
+		Entity firstEntity;
+		Entity secondEntity;
+
+		if (const auto it = m_BakedContacts.find(contact); it != m_BakedContacts.end())
+		{
+			firstEntity  = {static_cast<entt::entity>(it->second.first), m_Scene};
+			secondEntity = {static_cast<entt::entity>(it->second.second), m_Scene};
+
+			m_BakedContacts.erase(it);
+		}
+		else
+		{
+			firstEntity  = GetContactEntity(contact, firstFixture, secondFixture);
+			secondEntity = GetContactEntity(contact, secondFixture, firstFixture);
+		}
+
+		if (!firstEntity || !secondEntity)
+		{
+			m_BuoyancyFluidFixturePairs.erase(std::make_pair(firstFixture, secondFixture));
+			m_BuoyancyFluidFixturePairs.erase(std::make_pair(secondFixture, firstFixture));
+
+			return;
+		}
 
 		const bool isFirstEntityFluid  = firstEntity.HasComponent<BuoyancyEffector2DComponent>();
 		const bool isSecondEntityFluid = secondEntity.HasComponent<BuoyancyEffector2DComponent>();
@@ -111,6 +137,39 @@ namespace SW
 		onContactEnd(secondEntity, firstEntity, isSecondFixtureSensor);
 	}
 
+	bool Physics2DContactListener::IsBakedFixture(const b2Fixture* fixture)
+	{
+		return (fixture->GetUserData().pointer & BakedColliderFlag2D) != 0;
+	}
+
+	Entity Physics2DContactListener::GetContactEntity(b2Contact* contact, const b2Fixture* fixture,
+	                                                  const b2Fixture* other) const
+	{
+		const u64 userData = fixture->GetUserData().pointer;
+
+		if (!IsBakedFixture(fixture))
+			return {static_cast<entt::entity>(static_cast<u32>(userData)), m_Scene};
+
+		// Sensor contacts have no manifold - the center of the other fixture is used instead
+		glm::vec2 point;
+
+		if (contact->GetManifold()->pointCount > 0)
+		{
+			b2WorldManifold worldManifold;
+			contact->GetWorldManifold(&worldManifold);
+
+			point = {worldManifold.points[0].x, worldManifold.points[0].y};
+		}
+		else
+		{
+			const b2Vec2 center = other->GetAABB(0).GetCenter();
+
+			point = {center.x, center.y};
+		}
+
+		return m_Scene->GetPhysicsEntity2D(userData, point);
+	}
+
 	void Physics2DContactListener::PreSolve(b2Contact* /*contact*/, const b2Manifold* /*oldManifold*/)
 	{
 	}
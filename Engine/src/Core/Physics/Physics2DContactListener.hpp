@@ -15,6 +15,7 @@
 namespace SW
 {
 
+	class Entity;
 	class Scene;
 
 	class Physics2DContactListener final : public b2ContactListener
@@ -36,6 +37,23 @@ namespace SW
 		Scene* m_Scene = nullptr;
 
 		std::set<std::pair<b2Fixture*, b2Fixture*>> m_BuoyancyFluidFixturePairs;
+
+		std::unordered_map<b2Contact*, std::pair<u32, u32>> m_BakedContacts; /**< Entities of baked contacts. */
+
+		/**
+		 * @brief Whether the fixture is a merged baked static collider (shared by several entities).
+		 */
+		static bool IsBakedFixture(const b2Fixture* fixture);
+
+		/**
+		 * @brief Resolves the entity owning the fixture of the contact.
+		 *
+		 * @param contact The contact.
+		 * @param fixture The fixture to resolve.
+		 * @param other The other fixture of the contact.
+		 * @return The entity owning the fixture (closest source for merged baked colliders).
+		 */
+		Entity GetContactEntity(b2Contact* contact, const b2Fixture* fixture, const b2Fixture* other) const;
 	};
 
 } // namespace SW
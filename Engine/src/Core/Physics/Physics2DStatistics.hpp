@@ -0,0 +1,42 @@
+/**
+ * @file Physics2DStatistics.hpp
+ * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
+ * @version 0.1.1
+ * @date 2024-05-22
+ *
+ * @copyright Copyright (c) 2024 Tycjan Fortuna
+ */
+#pragma once
+
+namespace SW
+{
+
+	/**
+	 * @struct Physics2DStatistics
+	 * @brief Physics cost of the last runtime frame.
+	 * 		  Box2D timings come from b2World::GetProfile and are summed over all substeps of the frame.
+	 */
+	struct Physics2DStatistics
+	{
+		f32 StepMs       = 0.f; /**< Total b2World::Step time. */
+		f32 CollideMs    = 0.f; /**< Narrow phase (contact update) time. */
+		f32 SolveMs      = 0.f; /**< Constraint solver time. */
+		f32 BroadphaseMs = 0.f; /**< Broad phase (proxy update and pair finding) time. */
+
+		f32 TransformWriteBackMs = 0.f; /**< Time spent copying body transforms back to the entities. */
+		f32 JointBreakMs         = 0.f; /**< Time spent checking and breaking breakable joints. */
+		f32 BuoyancyMs           = 0.f; /**< Time spent applying buoyancy forces. */
+
+		u32 SubSteps       = 0; /**< Number of fixed physics steps taken this frame. */
+		u32 BodyCount      = 0; /**< Number of bodies in the world. */
+		u32 AwakeBodyCount = 0; /**< Number of awake bodies in the world. */
+		u32 ContactCount   = 0; /**< Number of contacts (including non touching ones). */
+		u32 JointCount     = 0; /**< Number of joints in the world. */
+
+		/**
+		 * @brief Total physics frame cost (box2d and engine side).
+		 */
+		f32 GetTotalMs() const { return StepMs + TransformWriteBackMs + JointBreakMs + BuoyancyMs; }
+	};
+
+} // namespace SW
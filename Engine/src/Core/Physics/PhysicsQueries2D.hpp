@@ -0,0 +1,90 @@
+/**
+ * @file PhysicsQueries2D.hpp
+ * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
+ * @version 0.1.0
+ * @date 2024-05-21
+ *
+ * @copyright Copyright (c) 2024 Tycjan Fortuna
+ */
+#pragma once
+
+namespace SW
+{
+
+	/**
+	 * @brief Collision layer mask matching every layer.
+	 */
+	inline constexpr u32 AllCollisionLayers = 0xFFFF;
+
+	/**
+	 * @warning All the structures below are shared with C# (Engine.ScriptCore/src/Physics/PhysicsQueries2D.cs)
+	 * 			and passed by pointer - keep the layouts in sync!
+	 */
+
+	/**
+	 * @brief Ray cast from origin along direction, reporting the closest hit.
+	 */
+	struct RayCastQuery2D
+	{
+		glm::vec2 Origin    = glm::vec2(0.f);      /**< The start point of the ray. */
+		glm::vec2 Direction = glm::vec2(1.f, 0.f); /**< The direction of the ray (does not have to be normalized). */
+		f32 MaxDistance     = 1.f;                 /**< The length of the ray. */
+		u32 LayerMask       = AllCollisionLayers;  /**< Only colliders on these layers are reported. */
+	};
+
+	/**
+	 * @brief Result of a ray or shape cast. EntityID is 0 when nothing was hit.
+	 */
+	struct RayCastHit2D
+	{
+		u64 EntityID     = 0;              /**< The ID of the hit entity. */
+		glm::vec2 Point  = glm::vec2(0.f); /**< The world point of the hit. */
+		glm::vec2 Normal = glm::vec2(0.f); /**< The surface normal at the hit point. */
+		f32 Fraction     = 0.f;            /**< The fraction [0 - 1] along the cast at which the hit occurred. */
+		f32 Distance     = 0.f;            /**< The distance along the cast at which the hit occurred. */
+	};
+
+	/**
+	 * @brief Axis aligned box overlap query.
+	 */
+	struct AABBQuery2D
+	{
+		glm::vec2 Min = glm::vec2(0.f);     /**< The lower bound of the box. */
+		glm::vec2 Max = glm::vec2(0.f);     /**< The upper bound of the box. */
+		u32 LayerMask = AllCollisionLayers; /**< Only colliders on these layers are reported. */
+	};
+
+	/**
+	 * @brief Circle overlap query.
+	 */
+	struct CircleQuery2D
+	{
+		glm::vec2 Center = glm::vec2(0.f);     /**< The center of the circle. */
+		f32 Radius       = 1.f;                /**< The radius of the circle. */
+		u32 LayerMask    = AllCollisionLayers; /**< Only colliders on these layers are reported. */
+	};
+
+	/**
+	 * @brief Shape swept by the shape cast.
+	 */
+	enum class ShapeCastShape2D : u32
+	{
+		Circle = 0, /**< Circle of ShapeCastQuery2D::Radius. */
+		Box    = 1  /**< Box of ShapeCastQuery2D::HalfExtents rotated by ShapeCastQuery2D::Angle. */
+	};
+
+	/**
+	 * @brief Sweeps the shape from origin by translation, reporting the first hit.
+	 */
+	struct ShapeCastQuery2D
+	{
+		glm::vec2 Origin       = glm::vec2(0.f);           /**< The start position of the shape. */
+		glm::vec2 Translation  = glm::vec2(1.f, 0.f);      /**< The sweep translation. */
+		glm::vec2 HalfExtents  = glm::vec2(0.5f);          /**< The half extents of the box shape. */
+		f32 Radius             = 0.5f;                     /**< The radius of the circle shape. */
+		f32 Angle              = 0.f;                      /**< The rotation of the box shape (in radians). */
+		u32 LayerMask          = AllCollisionLayers;       /**< Only colliders on these layers are reported. */
+		ShapeCastShape2D Shape = ShapeCastShape2D::Circle; /**< The shape to sweep. */
+	};
+
+} // namespace SW
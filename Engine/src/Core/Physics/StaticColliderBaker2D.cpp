@@ -0,0 +1,140 @@
+#include "StaticColliderBaker2D.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+
+namespace SW
+{
+
+	/**
+	 * @brief Tolerance [m] under which box edges are considered touching / equal.
+	 */
+	static constexpr f32 s_MergeTolerance = 0.001f;
+
+	static i64 Quantize(f32 value)
+	{
+		return (i64)std::llround(value / s_MergeTolerance);
+	}
+
+	struct MergeGroup
+	{
+		glm::vec2 Min                     = glm::vec2(0.f);
+		glm::vec2 Max                     = glm::vec2(0.f);
+		StaticColliderMaterial2D Material = {};
+		std::vector<u32> Sources          = {};
+	};
+
+	void StaticColliderBaker2D::Merge(std::vector<StaticBox2D>& boxes, std::vector<BakedStaticBox2D>& outBaked)
+	{
+		PROFILE_FUNCTION();
+
+		outBaked.clear();
+
+		if (boxes.empty())
+			return;
+
+		std::vector<u32> order(boxes.size());
+
+		for (u32 i = 0; i < (u32)order.size(); i++)
+		{
+			order[i] = i;
+		}
+
+		// Horizontal pass - boxes sharing the vertical extent, sorted left to right
+		std::sort(order.begin(), order.end(), [&boxes](u32 lhs, u32 rhs) {
+			const StaticBox2D& a = boxes[lhs];
+			const StaticBox2D& b = boxes[rhs];
+
+			return std::tuple(a.Material, Quantize(a.Min.y), Quantize(a.Max.y), a.Min.x) <
+			       std::tuple(b.Material, Quantize(b.Min.y), Quantize(b.Max.y), b.Min.x);
+		});
+
+		std::vector<MergeGroup> runs;
+
+		for (u32 index : order)
+		{
+			const StaticBox2D& box = boxes[index];
+
+			if (!runs.empty())
+			{
+				MergeGroup& run = runs.back();
+
+				// Only touching boxes - an overlapping one would make the source of a point ambiguous
+				if (run.Material == box.Material && Quantize(run.Min.y) == Quantize(box.Min.y) &&
+				    Quantize(run.Max.y) == Quantize(box.Max.y) && Quantize(run.Max.x) == Quantize(box.Min.x))
+				{
+					run.Max.x = box.Max.x;
+					run.Sources.emplace_back(index);
+
+					continue;
+				}
+			}
+
+			runs.push_back({box.Min, box.Max, box.Material, {index}});
+		}
+
+		// Vertical pass - runs sharing the horizontal extent, sorted bottom to top
+		std::sort(runs.begin(), runs.end(), [](const MergeGroup& a, const MergeGroup& b) {
+			return std::tuple(a.Material, Quantize(a.Min.x), Quantize(a.Max.x), a.Min.y) <
+			       std::tuple(b.Material, Quantize(b.Min.x), Quantize(b.Max.x), b.Min.y);
+		});
+
+		std::vector<MergeGroup> merged;
+
+		for (MergeGroup& run : runs)
+		{
+			if (!merged.empty())
+			{
+				MergeGroup& group = merged.back();
+
+				if (group.Material == run.Material && Quantize(group.Min.x) == Quantize(run.Min.x) &&
+				    Quantize(group.Max.x) == Quantize(run.Max.x) && Quantize(group.Max.y) == Quantize(run.Min.y))
+				{
+					group.Max.y = run.Max.y;
+					group.Sources.insert(group.Sources.end(), run.Sources.begin(), run.Sources.end());
+
+					continue;
+				}
+			}
+
+			merged.emplace_back(std::move(run));
+		}
+
+		// Reorder the sources so every baked box references a contiguous range
+		std::vector<StaticBox2D> sources;
+		sources.reserve(boxes.size());
+
+		outBaked.reserve(merged.size());
+
+		for (const MergeGroup& group : merged)
+		{
+			outBaked.push_back({group.Min, group.Max, group.Material, (u32)sources.size(), (u32)group.Sources.size()});
+
+			for (u32 index : group.Sources)
+			{
+				sources.emplace_back(boxes[index]);
+			}
+		}
+
+		boxes = std::move(sources);
+	}
+
+	u32 StaticColliderBaker2D::FindSource(const BakedStaticBox2D& baked, const StaticBox2D* sources, glm::vec2 point)
+	{
+		// Hit and contact points lie on the surface (or slightly off it) - they belong to the sources under them
+		point = glm::clamp(point, baked.Min, baked.Max);
+
+		for (u32 i = 0; i < baked.SourceCount; i++)
+		{
+			const StaticBox2D& source = sources[baked.FirstSource + i];
+
+			if (glm::all(glm::greaterThanEqual(point, source.Min - s_MergeTolerance)) &&
+			    glm::all(glm::lessThanEqual(point, source.Max + s_MergeTolerance)))
+				return baked.FirstSource + i;
+		}
+
+		return baked.FirstSource; // unreachable - the sources cover the baked box
+	}
+
+} // namespace SW
@@ -0,0 +1,102 @@
+/**
+ * @file StaticColliderBaker2D.hpp
+ * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
+ * @version 0.1.1
+ * @date 2024-05-23
+ *
+ * @copyright Copyright (c) 2024 Tycjan Fortuna
+ */
+#pragma once
+
+namespace SW
+{
+
+	/**
+	 * @brief Fixture user data flag marking a baked fixture shared by several entities.
+	 * 		  The lower 32 bits hold the index of the baked collider instead of the entt handle.
+	 */
+	inline constexpr u64 BakedColliderFlag2D = 1ull << 32;
+
+	/**
+	 * @brief Fixture properties which have to match for two colliders to be merged.
+	 */
+	struct StaticColliderMaterial2D
+	{
+		f32 Friction             = 0.f; /**< The friction coefficient. */
+		f32 Restitution          = 0.f; /**< The restitution (elasticity). */
+		f32 RestitutionThreshold = 0.f; /**< The restitution velocity threshold. */
+		u16 CollisionLayer       = 0;   /**< The filter category bits. */
+		u16 CollisionMask        = 0;   /**< The filter mask bits. */
+
+		auto operator<=>(const StaticColliderMaterial2D&) const = default;
+	};
+
+	/**
+	 * @brief World space axis aligned box collider of a static entity.
+	 */
+	struct StaticBox2D
+	{
+		glm::vec2 Min = glm::vec2(0.f);         /**< The lower bound of the box. */
+		glm::vec2 Max = glm::vec2(0.f);         /**< The upper bound of the box. */
+		StaticColliderMaterial2D Material = {}; /**< The fixture properties of the box. */
+		u32 Entity                        = 0;  /**< The entt handle of the source entity. */
+	};
+
+	/**
+	 * @brief Box covering one or more touching source boxes.
+	 * 		  Sources are the range [FirstSource, FirstSource + SourceCount) of the baked source list, they do not
+	 * 		  overlap and cover the whole box - every point of the box belongs to exactly one source entity.
+	 */
+	struct BakedStaticBox2D
+	{
+		glm::vec2 Min = glm::vec2(0.f);         /**< The lower bound of the box. */
+		glm::vec2 Max = glm::vec2(0.f);         /**< The upper bound of the box. */
+		StaticColliderMaterial2D Material = {}; /**< The fixture properties of the box. */
+		u32 FirstSource                   = 0;  /**< Index of the first source box. */
+		u32 SourceCount                   = 0;  /**< Number of source boxes. */
+	};
+
+	/**
+	 * @brief Result of baking the static colliders of a scene.
+	 */
+	struct StaticColliderBakeInfo2D
+	{
+		u32 SourceColliders = 0; /**< Number of static colliders taken by the bake. */
+		u32 BakedFixtures   = 0; /**< Number of fixtures they were baked into. */
+		u32 MergedBoxes     = 0; /**< Number of fixtures covering more than one source box. */
+	};
+
+	/**
+	 * @brief Merges touching axis aligned static boxes into larger rectangles.
+	 * 		  Boxes are first joined into horizontal runs (same vertical extent) and the runs are then stacked
+	 * 		  vertically (same horizontal extent). Only touching (not overlapping) boxes with equal materials are
+	 * 		  merged, so the entity of a point on a merged fixture is known exactly.
+	 * 		  Tile maps collapse from one fixture per tile to a handful of fixtures, which shrinks the broadphase
+	 * 		  and removes the internal edges objects used to snag on.
+	 */
+	class StaticColliderBaker2D final
+	{
+	public:
+		/**
+		 * @brief Merges the boxes.
+		 *
+		 * @param boxes The source boxes. Reordered so that sources of every baked box are contiguous.
+		 * @param outBaked The merged boxes.
+		 */
+		static void Merge(std::vector<StaticBox2D>& boxes, std::vector<BakedStaticBox2D>& outBaked);
+
+		/**
+		 * @brief Finds the source box under the point.
+		 * 		  The point is clamped onto the baked box first, so surface points of contacts and hits resolve to
+		 * 		  the source they touch. Only a point exactly on an edge shared by two sources matches both (the
+		 * 		  first one is returned).
+		 *
+		 * @param baked The baked box.
+		 * @param sources The baked source list.
+		 * @param point The world point (e.g. contact or hit point).
+		 * @return The index of the source box in the baked source list.
+		 */
+		static u32 FindSource(const BakedStaticBox2D& baked, const StaticBox2D* sources, glm::vec2 point);
+	};
+
+} // namespace SW
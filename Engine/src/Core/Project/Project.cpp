@@ -16,11 +16,34 @@ namespace SW
 
 	void Project::Initialize()
 	{
+		// Shipped games read everything from the cooked pack - no directory walk, no registry file.
+		if (!m_Config.AssetPackPath.empty() && FileSystem::Exists(m_Config.AssetPackPath))
+		{
+			m_AssetManager = new RuntimeAssetManager(m_Config.AssetPackPath);
+
+			return;
+		}
+
 		FileSystem::CreateEmptyDirectoryIfNotExists(m_Config.AssetsDirectory / "cache");
-		FileSystem::CreateEmptyDirectoryIfNotExists(m_Config.AssetsDirectory / "cache" / "thumbnails");
 		FileSystem::CreateEmptyDirectoryIfNotExists(m_Config.AssetsDirectory / "cache" / "fonts");
+		FileSystem::CreateEmptyDirectoryIfNotExists(m_Config.AssetsDirectory / "cache" / "textures");
+
+		// Font caches used to be named [handle]_[lastModified].cache, they would never be read again.
+		for (const std::filesystem::directory_entry& entry :
+		     std::filesystem::directory_iterator(m_Config.AssetsDirectory / "cache" / "fonts"))
+		{
+			if (entry.path().extension() == ".cache")
+				std::filesystem::remove(entry.path());
+		}
+
+		EditorAssetManager* assetManager = new EditorAssetManager();
+
+		for (auto&& [type, megabytes] : m_Config.AssetMemoryBudgets)
+		{
+			assetManager->SetMemoryBudget(type, megabytes * 1024 * 1024);
+		}
 
-		m_AssetManager = new EditorAssetManager();
+		m_AssetManager = assetManager;
 	}
 
 } // namespace SW
@@ -1,7 +1,7 @@
 /**
  * @file Project.hpp
  * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
- * @version 0.1.1
+ * @version 0.1.2
  * @date 2024-03-12
  *
  * @copyright Copyright (c) 2024 Tycjan Fortuna
@@ -9,7 +9,9 @@
 #pragma once
 
 #include "Asset/AssetManagerBase.hpp"
+#include "Asset/Cache/TextureCache.hpp"
 #include "Asset/EditorAssetManager.hpp"
+#include "Asset/RuntimeAssetManager.hpp"
 
 namespace SW
 {
@@ -25,6 +27,16 @@ namespace SW
 		    "assets/assets.sw_registry"; /**< The path to the asset registry file. */
 		std::filesystem::path AudioRegistryPath =
 		    "assets/audio.sw_registry"; /**< The path to the audio registry file. */
+		std::filesystem::path AssetPackPath; /**< The path to the cooked asset pack (shipped games only). */
+
+		std::map<AssetType, u64> AssetMemoryBudgets = {
+		    {AssetType::Texture2D, 1024},
+		    {AssetType::Sprite, 1},
+		    {AssetType::Font, 256},
+		}; /**< Resident memory budget per asset type in MB (editor only), unlisted types are unlimited. */
+
+		TextureCompressionMode TextureCompression =
+		    TextureCompressionMode::None; /**< How textures are cooked (editor cache and asset pack). */
 	};
 
 	/**
@@ -90,6 +102,10 @@ namespace SW
 		ProjectConfig& GetConfig() { return m_Config; }
 
 		EditorAssetManager* GetEditorAssetManager() const { return dynamic_cast<EditorAssetManager*>(m_AssetManager); }
+		RuntimeAssetManager* GetRuntimeAssetManager() const
+		{
+			return dynamic_cast<RuntimeAssetManager*>(m_AssetManager);
+		}
 		AssetManagerBase* GetAssetManager() const { return m_AssetManager; }
 
 	private:
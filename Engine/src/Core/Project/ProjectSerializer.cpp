@@ -22,6 +22,17 @@ namespace SW
 				out << YAML::Key << "AssetDirectory" << YAML::Value << config.AssetsDirectory.string();
 				out << YAML::Key << "AssetRegistryPath" << YAML::Value << config.AssetRegistryPath.string();
 				out << YAML::Key << "AudioRegistryPath" << YAML::Value << config.AudioRegistryPath.string();
+				out << YAML::Key << "AssetPackPath" << YAML::Value << config.AssetPackPath.string();
+
+				out << YAML::Key << "AssetMemoryBudgets" << YAML::Value << YAML::BeginMap; // in MB
+				for (auto&& [type, megabytes] : config.AssetMemoryBudgets)
+				{
+					out << YAML::Key << Asset::GetStringifiedAssetType(type) << YAML::Value << megabytes;
+				}
+				out << YAML::EndMap;
+
+				out << YAML::Key << "TextureCompression" << YAML::Value
+				    << TextureCache::GetStringifiedCompressionMode(config.TextureCompression);
 				out << YAML::EndMap; // Project
 			}
 			out << YAML::EndMap; // Root
@@ -44,6 +55,22 @@ namespace SW
 		    TryDeserializeNode<std::string>(projectNode, "AssetRegistryPath", "assets/assets.sw_registry");
 		deserialized.AudioRegistryPath =
 		    TryDeserializeNode<std::string>(projectNode, "AudioRegistryPath", "assets/audio.sw_registry");
+		deserialized.AssetPackPath = TryDeserializeNode<std::string>(projectNode, "AssetPackPath", "");
+
+		deserialized.TextureCompression = TextureCache::GetCompressionModeFromStringified(
+		    TryDeserializeNode<std::string>(projectNode, "TextureCompression", "None"));
+
+		if (YAML::Node budgets = projectNode["AssetMemoryBudgets"]) // older projects keep the default budgets
+		{
+			deserialized.AssetMemoryBudgets.clear();
+
+			for (auto budget : budgets)
+			{
+				const AssetType type = Asset::GetAssetTypeFromStringified(budget.first.as<std::string>());
+
+				deserialized.AssetMemoryBudgets[type] = budget.second.as<u64>();
+			}
+		}
 
 		Project* newProject = new Project(deserialized);
 
@@ -1,5 +1,7 @@
 #include "Renderer2D.hpp"
 
+#include <algorithm>
+
 #include "Asset/AssetManager.hpp"
 #include "Asset/Font.hpp"
 #include "Asset/Sprite.hpp"
@@ -9,6 +11,7 @@
 #include "Core/OpenGL/Texture2D.hpp"
 #include "Core/OpenGL/VertexArray.hpp"
 #include "Core/OpenGL/VertexBuffer.hpp"
+#include "Core/Utils/Utils.hpp"
 #include "GUI/Editor/EditorResources.hpp"
 #include "RendererAPI.hpp"
 
@@ -100,6 +103,10 @@ namespace SW
 		u32 TextureSlotIndex     = 1; // 0 = white texture
 		u32 FontTextureSlotIndex = 0;
 
+		u64 BatchIndex = 0; // incremented by every StartBatch(), dynamic font pages used by the batch are kept
+
+		TextLayout ScratchTextLayout; // layout of strings drawn without a retained layout
+
 		f32 LineWidth = 2.0f;
 
 		glm::vec4 QuadVertexPositions[4] = {};
@@ -314,6 +321,8 @@ namespace SW
 
 		s_Data.TextureSlotIndex     = 1;
 		s_Data.FontTextureSlotIndex = 0;
+
+		s_Data.BatchIndex++;
 	}
 
 	void Renderer2D::Flush()
@@ -384,11 +393,12 @@ namespace SW
 
 		if (sprite.Handle)
 		{
-			Sprite** spriteAsset = AssetManager::GetAssetRaw<Sprite>(sprite.Handle);
+			// Placeholder until loaded, the cached slot goes stale once the sprite is loaded or reloaded
+			Sprite* spriteAsset = AssetManager::ResolveAsync<Sprite>(sprite.Handle, sprite.Slot);
 
 			Texture2D* texture = nullptr;
 			if (spriteAsset)
-				texture = (*spriteAsset)->GetTexture();
+				texture = spriteAsset->GetTexture();
 			else
 				texture = EditorResources::MissingAssetIcon;
 
@@ -408,10 +418,13 @@ namespace SW
 				s_Data.TextureSlotIndex++;
 			}
 
-			texCoords[0] = (*spriteAsset)->TexCordUpLeft;
-			texCoords[1] = (*spriteAsset)->TexCordUpRight;
-			texCoords[2] = (*spriteAsset)->TexCordRightDown;
-			texCoords[3] = (*spriteAsset)->TexCordLeftDown;
+			if (spriteAsset)
+			{
+				texCoords[0] = spriteAsset->TexCordUpLeft;
+				texCoords[1] = spriteAsset->TexCordUpRight;
+				texCoords[2] = spriteAsset->TexCordRightDown;
+				texCoords[3] = spriteAsset->TexCordLeftDown;
+			}
 		}
 
 		for (int i = 0; i < 4; i++)
@@ -432,24 +445,62 @@ namespace SW
 
 	void Renderer2D::DrawQuad(const glm::mat4& transform, AnimatedSpriteComponent& asc, f32 time, int entityID /*= -1*/)
 	{
+		Animation2D* animation = *asc.CurrentAnimation;
+
+		if (animation->Sprites.empty())
+			return;
+
+		if (!animation->IsBaked() && animation->CanBake())
+			animation->Bake(); // editor loads and outdated packed clips, retried until the sprites load
+
 		if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
 			FlushAndReset();
 
 		f32 textureIndex = 0.f; // White Texture
 
-		glm::vec2 texCoords[4] = {{0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}};
+		glm::vec2 texCoords[4];
+		Texture2D* texture = nullptr;
 
-		u64 framesCount = (*asc.CurrentAnimation)->Sprites.size();
+		if (animation->IsBaked())
+		{
+			const AnimationClip& clip = animation->GetClip();
 
-		asc.CurrentFrame = (int)(time * (*asc.CurrentAnimation)->Speed) % framesCount;
+			asc.CurrentFrame = (int)animation->GetFrameIndex(time);
 
-		if (asc.CurrentFrame >= framesCount)
-		{
-			asc.CurrentFrame = 0;
+			const glm::vec4& frame = clip.TexCoords[asc.CurrentFrame];
+
+			texture      = *clip.Texture;
+			texCoords[0] = {frame.x, frame.y};
+			texCoords[1] = {frame.z, frame.y};
+			texCoords[2] = {frame.z, frame.w};
+			texCoords[3] = {frame.x, frame.w};
 		}
+		else
+		{
+			const u64 framesCount = animation->Sprites.size();
+
+			asc.CurrentFrame = (int)((u64)std::max(time * animation->Speed, 0.f) % framesCount);
+
+			const Sprite* sprite = *animation->Sprites[asc.CurrentFrame];
+
+			texture = sprite->GetTexture();
 
-		Sprite** sprite    = (*asc.CurrentAnimation)->Sprites[asc.CurrentFrame];
-		Texture2D* texture = (*sprite)->GetTexture();
+			texCoords[0] = animation->ReverseAlongX
+			                   ? (animation->ReverseAlongY ? sprite->TexCordRightDown : sprite->TexCordUpRight)
+			                   : (animation->ReverseAlongY ? sprite->TexCordLeftDown : sprite->TexCordUpLeft);
+
+			texCoords[1] = animation->ReverseAlongX
+			                   ? (animation->ReverseAlongY ? sprite->TexCordLeftDown : sprite->TexCordUpLeft)
+			                   : (animation->ReverseAlongY ? sprite->TexCordRightDown : sprite->TexCordUpRight);
+
+			texCoords[2] = animation->ReverseAlongX
+			                   ? (animation->ReverseAlongY ? sprite->TexCordUpLeft : sprite->TexCordLeftDown)
+			                   : (animation->ReverseAlongY ? sprite->TexCordUpRight : sprite->TexCordRightDown);
+
+			texCoords[3] = animation->ReverseAlongX
+			                   ? (animation->ReverseAlongY ? sprite->TexCordUpRight : sprite->TexCordRightDown)
+			                   : (animation->ReverseAlongY ? sprite->TexCordUpLeft : sprite->TexCordLeftDown);
+		}
 
 		for (u32 i = 1; i < s_Data.TextureSlotIndex; i++)
 		{
@@ -467,26 +518,6 @@ namespace SW
 			s_Data.TextureSlotIndex++;
 		}
 
-		texCoords[0] =
-		    (*asc.CurrentAnimation)->ReverseAlongX
-		        ? ((*asc.CurrentAnimation)->ReverseAlongY ? (*sprite)->TexCordRightDown : (*sprite)->TexCordUpRight)
-		        : ((*asc.CurrentAnimation)->ReverseAlongY ? (*sprite)->TexCordLeftDown : (*sprite)->TexCordUpLeft);
-
-		texCoords[1] =
-		    (*asc.CurrentAnimation)->ReverseAlongX
-		        ? ((*asc.CurrentAnimation)->ReverseAlongY ? (*sprite)->TexCordLeftDown : (*sprite)->TexCordUpLeft)
-		        : ((*asc.CurrentAnimation)->ReverseAlongY ? (*sprite)->TexCordRightDown : (*sprite)->TexCordUpRight);
-
-		texCoords[2] =
-		    (*asc.CurrentAnimation)->ReverseAlongX
-		        ? ((*asc.CurrentAnimation)->ReverseAlongY ? (*sprite)->TexCordUpLeft : (*sprite)->TexCordLeftDown)
-		        : ((*asc.CurrentAnimation)->ReverseAlongY ? (*sprite)->TexCordUpRight : (*sprite)->TexCordRightDown);
-
-		texCoords[3] =
-		    (*asc.CurrentAnimation)->ReverseAlongX
-		        ? ((*asc.CurrentAnimation)->ReverseAlongY ? (*sprite)->TexCordUpRight : (*sprite)->TexCordRightDown)
-		        : ((*asc.CurrentAnimation)->ReverseAlongY ? (*sprite)->TexCordUpLeft : (*sprite)->TexCordLeftDown);
-
 		for (int i = 0; i < 4; i++)
 		{
 			s_Data.QuadVertexBufferPtr->Position     = glm::vec3(transform * s_Data.QuadVertexPositions[i]);
@@ -611,60 +642,94 @@ namespace SW
 
 	void Renderer2D::DrawString(const glm::mat4& transform, const TextComponent& text, int entityID)
 	{
-		Font** fontAsset = AssetManager::GetAssetRaw<Font>(text.Handle);
+		TextLayout& layout = s_Data.ScratchTextLayout;
+		layout.IsComplete  = false;
+
+		DrawString(transform, text, layout, entityID);
+	}
+
+	void Renderer2D::DrawString(const glm::mat4& transform, const TextComponent& text, TextLayout& layout,
+	                            int entityID)
+	{
+		Font* font = AssetManager::ResolveAsync<Font>(text.Handle, text.Slot);
 
-		if (!fontAsset)
+		if (!font) // not available or still loading
 		{
 			DrawMissingTextureQuad(transform, entityID);
 
 			return;
 		}
 
-		DrawString(text.TextString, fontAsset, transform, text.Color, text.Kerning, text.LineSpacing, entityID);
+		font->Update(s_Data.BatchIndex); // may evict dynamic atlas pages, check the layout afterwards
+
+		const bool isValid = layout.IsComplete && layout.FontHandle == text.Handle &&
+		                     layout.FontInstance == font->GetInstanceID() &&
+		                     layout.FontGeneration == font->GetLayoutGeneration() && layout.Kerning == text.Kerning &&
+		                     layout.LineSpacing == text.LineSpacing && layout.Text == text.TextString;
+
+		if (!isValid)
+		{
+			BuildTextLayout(text.TextString, font, text.Kerning, text.LineSpacing, layout);
+
+			layout.FontHandle = text.Handle;
+		}
+
+		DrawTextLayout(transform, layout, text.Color, entityID);
 	}
 
 	void Renderer2D::DrawString(const std::string& string, Font** font, const glm::mat4& transform,
 	                            const glm::vec4& color, f32 kerning /*= 0.0f*/, f32 lineSpacing /*= 0.0f*/,
 	                            int entityID /*= -1*/)
 	{
-		f32 textureIndex = 0.f;
+		(*font)->Update(s_Data.BatchIndex);
 
-		Texture2D* atlasTexture                      = (*font)->GetAtlasTexture();
-		const msdf_atlas::FontGeometry& fontGeometry = (*font)->GetMSDFData().FontGeometry;
-		const msdfgen::FontMetrics& fontMetrics      = fontGeometry.getMetrics();
+		BuildTextLayout(string, *font, kerning, lineSpacing, s_Data.ScratchTextLayout);
+		DrawTextLayout(transform, s_Data.ScratchTextLayout, color, entityID);
+	}
 
-		for (u32 i = 1; i < s_Data.FontTextureSlotIndex; i++)
-		{
-			if (*s_Data.FontTextureSlots[i] == *atlasTexture)
-			{
-				textureIndex = static_cast<f32>(i);
-				break;
-			}
-		}
+	void Renderer2D::BuildTextLayout(const std::string& string, Font* font, f32 kerning, f32 lineSpacing,
+	                                 TextLayout& outLayout)
+	{
+		PROFILE_FUNCTION();
 
-		if (textureIndex == 0.0f)
-		{
-			textureIndex                                         = (f32)s_Data.FontTextureSlotIndex;
-			s_Data.FontTextureSlots[s_Data.FontTextureSlotIndex] = atlasTexture;
-			s_Data.FontTextureSlotIndex++;
-		}
+		outLayout.Text           = string;
+		outLayout.FontHandle     = 0;
+		outLayout.FontAsset      = font;
+		outLayout.FontInstance   = font->GetInstanceID();
+		outLayout.FontGeneration = font->GetLayoutGeneration();
+		outLayout.Kerning        = kerning;
+		outLayout.LineSpacing    = lineSpacing;
+		outLayout.IsComplete     = true;
+
+		outLayout.Quads.clear();
+
+		const FontMetrics& fontMetrics = font->GetMetrics();
 
 		f64 x       = 0.0;
-		f64 fsScale = 1.0 / (fontMetrics.ascenderY - fontMetrics.descenderY);
+		f64 fsScale = 1.0 / (fontMetrics.AscenderY - fontMetrics.DescenderY);
 		f64 y       = 0.0;
 
-		const f32 spaceGlyphAdvance = (f32)fontGeometry.getGlyph(' ')->getAdvance();
+		Texture2D* spaceAtlas       = nullptr;
+		const FontGlyph* spaceGlyph = font->FindGlyph(' ', spaceAtlas);
+		const f32 spaceGlyphAdvance = spaceGlyph ? spaceGlyph->Advance : 0.f;
+
+		size_t offset = 0;
 
-		for (size_t i = 0; i < string.size(); i++)
+		u32 nextCharacter = offset < string.size() ? String::DecodeUTF8(string, offset) : 0;
+
+		while (nextCharacter != 0)
 		{
-			msdf_atlas::unicode_t character = string[i];
+			const u32 character = nextCharacter;
+
+			nextCharacter = offset < string.size() ? String::DecodeUTF8(string, offset) : 0;
+
 			if (character == '\r')
 				continue;
 
 			if (character == '\n')
 			{
 				x = 0;
-				y -= fsScale * fontMetrics.lineHeight + lineSpacing;
+				y -= fsScale * fontMetrics.LineHeight + lineSpacing;
 				continue;
 			}
 
@@ -672,13 +737,8 @@ namespace SW
 			{
 				f32 advance = spaceGlyphAdvance;
 
-				if (i < string.size() - 1)
-				{
-					char nextCharacter = string[i + 1];
-					double dAdvance;
-					fontGeometry.getAdvance(dAdvance, character, nextCharacter);
-					advance = (f32)dAdvance;
-				}
+				if (spaceGlyph && nextCharacter != 0)
+					advance = (f32)font->GetAdvance(*spaceGlyph, nextCharacter);
 
 				x += fsScale * advance + kerning;
 
@@ -692,72 +752,129 @@ namespace SW
 				continue;
 			}
 
-			const msdf_atlas::GlyphGeometry* glyph = fontGeometry.getGlyph(character);
+			Texture2D* glyphAtlas  = nullptr;
+			const FontGlyph* glyph = font->FindGlyph(character, glyphAtlas);
 
 			if (!glyph)
-				glyph = fontGeometry.getGlyph('?');
+			{
+				if (!font->IsDynamic())
+					return;
 
-			if (!glyph)
-				return;
+				outLayout.IsComplete = false; // still being generated, built again in a later frame
+
+				x += fsScale * spaceGlyphAdvance + kerning;
+
+				continue;
+			}
 
-			f64 al, ab, ar, at;
-			glyph->getQuadAtlasBounds(al, ab, ar, at);
-			glm::vec2 texCoordMin((f32)al, (f32)ab);
-			glm::vec2 texCoordMax((f32)ar, (f32)at);
+			TextGlyphQuad& quad = outLayout.Quads.emplace_back();
+			quad.Atlas          = glyphAtlas;
 
-			f64 pl, pb, pr, pt;
-			glyph->getQuadPlaneBounds(pl, pb, pr, pt);
-			glm::vec2 quadMin((f32)pl, (f32)pb);
-			glm::vec2 quadMax((f32)pr, (f32)pt);
+			quad.PlaneMin = glyph->PlaneMin * (f32)fsScale + glm::vec2(x, y);
+			quad.PlaneMax = glyph->PlaneMax * (f32)fsScale + glm::vec2(x, y);
 
-			quadMin *= fsScale, quadMax *= fsScale;
-			quadMin += glm::vec2(x, y);
-			quadMax += glm::vec2(x, y);
+			const glm::vec2 texelSize =
+			    glm::vec2(1.0f / (f32)glyphAtlas->GetWidth(), 1.0f / (f32)glyphAtlas->GetHeight());
 
-			f32 texelWidth  = 1.0f / (f32)atlasTexture->GetWidth();
-			f32 texelHeight = 1.0f / (f32)atlasTexture->GetHeight();
-			texCoordMin *= glm::vec2(texelWidth, texelHeight);
-			texCoordMax *= glm::vec2(texelWidth, texelHeight);
+			quad.TexCoordMin = glyph->AtlasMin * texelSize;
+			quad.TexCoordMax = glyph->AtlasMax * texelSize;
 
-			s_Data.TextVertexBufferPtr->Position = transform * glm::vec4(quadMin, 0.0f, 1.0f);
+			if (nextCharacter != 0)
+			{
+				const f64 advance = font->GetAdvance(*glyph, nextCharacter);
+
+				x += fsScale * advance + kerning;
+			}
+		}
+	}
+
+	void Renderer2D::DrawTextLayout(const glm::mat4& transform, const TextLayout& layout, const glm::vec4& color,
+	                                int entityID /*= -1*/)
+	{
+		// Corners lie on the z = 0 plane, so transforming them only needs the x and y axes and the origin.
+		const glm::vec3 axisX  = glm::vec3(transform[0]);
+		const glm::vec3 axisY  = glm::vec3(transform[1]);
+		const glm::vec3 origin = glm::vec3(transform[3]);
+
+		Texture2D* atlasTexture = nullptr;
+		f32 textureIndex        = 0.f;
+
+		for (const TextGlyphQuad& quad : layout.Quads)
+		{
+			if (s_Data.TextIndexCount >= Renderer2DData::MaxIndices)
+			{
+				FlushAndReset();
+
+				atlasTexture = nullptr;
+			}
+
+			if (quad.Atlas != atlasTexture)
+			{
+				u32 slot = s_Data.FontTextureSlotIndex;
+
+				for (u32 i = 0; i < s_Data.FontTextureSlotIndex; i++)
+				{
+					if (*s_Data.FontTextureSlots[i] == *quad.Atlas)
+					{
+						slot = i;
+						break;
+					}
+				}
+
+				if (slot == Renderer2DData::MaxTextureSlots)
+				{
+					FlushAndReset();
+
+					slot = 0;
+				}
+
+				if (slot == s_Data.FontTextureSlotIndex)
+				{
+					s_Data.FontTextureSlots[slot] = quad.Atlas;
+					s_Data.FontTextureSlotIndex++;
+				}
+
+				textureIndex = (f32)slot;
+				atlasTexture = quad.Atlas;
+
+				layout.FontAsset->MarkAtlasUsed(quad.Atlas, s_Data.BatchIndex);
+			}
+
+			const glm::vec3 minX = axisX * quad.PlaneMin.x;
+			const glm::vec3 maxX = axisX * quad.PlaneMax.x;
+			const glm::vec3 minY = origin + axisY * quad.PlaneMin.y;
+			const glm::vec3 maxY = origin + axisY * quad.PlaneMax.y;
+
+			s_Data.TextVertexBufferPtr->Position = minY + minX;
 			s_Data.TextVertexBufferPtr->Color    = color;
-			s_Data.TextVertexBufferPtr->TexCoord = texCoordMin;
+			s_Data.TextVertexBufferPtr->TexCoord = quad.TexCoordMin;
 			s_Data.TextVertexBufferPtr->TexIndex = textureIndex;
 			s_Data.TextVertexBufferPtr->EntityID = entityID;
 			s_Data.TextVertexBufferPtr++;
 
-			s_Data.TextVertexBufferPtr->Position = transform * glm::vec4(quadMin.x, quadMax.y, 0.0f, 1.0f);
+			s_Data.TextVertexBufferPtr->Position = maxY + minX;
 			s_Data.TextVertexBufferPtr->Color    = color;
-			s_Data.TextVertexBufferPtr->TexCoord = {texCoordMin.x, texCoordMax.y};
+			s_Data.TextVertexBufferPtr->TexCoord = {quad.TexCoordMin.x, quad.TexCoordMax.y};
 			s_Data.TextVertexBufferPtr->TexIndex = textureIndex;
 			s_Data.TextVertexBufferPtr->EntityID = entityID;
 			s_Data.TextVertexBufferPtr++;
 
-			s_Data.TextVertexBufferPtr->Position = transform * glm::vec4(quadMax, 0.0f, 1.0f);
+			s_Data.TextVertexBufferPtr->Position = maxY + maxX;
 			s_Data.TextVertexBufferPtr->Color    = color;
-			s_Data.TextVertexBufferPtr->TexCoord = texCoordMax;
+			s_Data.TextVertexBufferPtr->TexCoord = quad.TexCoordMax;
 			s_Data.TextVertexBufferPtr->TexIndex = textureIndex;
 			s_Data.TextVertexBufferPtr->EntityID = entityID;
 			s_Data.TextVertexBufferPtr++;
 
-			s_Data.TextVertexBufferPtr->Position = transform * glm::vec4(quadMax.x, quadMin.y, 0.0f, 1.0f);
+			s_Data.TextVertexBufferPtr->Position = minY + maxX;
 			s_Data.TextVertexBufferPtr->Color    = color;
-			s_Data.TextVertexBufferPtr->TexCoord = {texCoordMax.x, texCoordMin.y};
+			s_Data.TextVertexBufferPtr->TexCoord = {quad.TexCoordMax.x, quad.TexCoordMin.y};
 			s_Data.TextVertexBufferPtr->TexIndex = textureIndex;
 			s_Data.TextVertexBufferPtr->EntityID = entityID;
 			s_Data.TextVertexBufferPtr++;
 
 			s_Data.TextIndexCount += 6;
 			s_Data.Stats.QuadCount++;
-
-			if (i < string.size() - 1)
-			{
-				f64 advance                         = glyph->getAdvance();
-				msdf_atlas::unicode_t nextCharacter = string[i + 1];
-				fontGeometry.getAdvance(advance, character, nextCharacter);
-
-				x += fsScale * advance + kerning;
-			}
 		}
 	}
 
@@ -1,7 +1,7 @@
 /**
  * @file Renderer2D.hpp
  * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
- * @version 0.2.3
+ * @version 0.2.4
  * @date 2024-04-12
  *
  * @copyright Copyright (c) 2024 Tycjan Fortuna
@@ -10,6 +10,7 @@
 
 #include "Core/ECS/Components.hpp"
 #include "Core/Scene/SceneCamera.hpp"
+#include "TextLayout.hpp"
 
 namespace SW
 {
@@ -173,8 +174,42 @@ namespace SW
 		 */
 		static void DrawString(const glm::mat4& transform, const TextComponent& text, int entityID = -1);
 
+		/**
+		 * Draws a string using a retained layout, the layout is only built again when the text component changes.
+		 *
+		 * @param transform The transformation matrix to apply to the string.
+		 * @param text The text component containing the string to draw.
+		 * @param layout The layout of the text component, kept by the caller between frames.
+		 * @param entityID The ID of the entity associated with the string (optional, default is -1).
+		 */
+		static void DrawString(const glm::mat4& transform, const TextComponent& text, TextLayout& layout,
+		                       int entityID = -1);
+
 		static void DrawString(const std::string& string, Font** font, const glm::mat4& transform,
 		                       const glm::vec4& color, f32 kerning = 0.0f, f32 lineSpacing = 0.0f, int entityID = -1);
+
+		/**
+		 * Lays out a string - looks up the glyphs and places their quads in the local space of the text.
+		 *
+		 * @param string The UTF-8 string to lay out.
+		 * @param font The font of the string.
+		 * @param kerning Extra advance between the glyphs.
+		 * @param lineSpacing Extra distance between the lines.
+		 * @param outLayout The layout to fill, its font handle is reset to 0.
+		 */
+		static void BuildTextLayout(const std::string& string, Font* font, f32 kerning, f32 lineSpacing,
+		                            TextLayout& outLayout);
+
+		/**
+		 * Draws a laid out string.
+		 *
+		 * @param transform The transformation matrix to apply to the string.
+		 * @param layout The layout of the string.
+		 * @param color The color of the string.
+		 * @param entityID The ID of the entity associated with the string (optional, default is -1).
+		 */
+		static void DrawTextLayout(const glm::mat4& transform, const TextLayout& layout, const glm::vec4& color,
+		                           int entityID = -1);
 	};
 
 } // namespace SW
@@ -0,0 +1,52 @@
+/**
+ * @file TextLayout.hpp
+ * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
+ * @version 0.1.0
+ * @date 2024-06-01
+ *
+ * @copyright Copyright (c) 2024 Tycjan Fortuna
+ */
+#pragma once
+
+#include "Asset/Asset.hpp"
+
+namespace SW
+{
+
+	class Font;
+	class Texture2D;
+
+	/**
+	 * @brief Single glyph quad of a laid out string, in the local space of the text.
+	 */
+	struct TextGlyphQuad
+	{
+		glm::vec2 PlaneMin;    /**< Bottom left corner of the quad. */
+		glm::vec2 PlaneMax;    /**< Top right corner of the quad. */
+		glm::vec2 TexCoordMin; /**< Bottom left texture coordinate inside the atlas. */
+		glm::vec2 TexCoordMax; /**< Top right texture coordinate inside the atlas. */
+		Texture2D* Atlas;      /**< Atlas texture (page of dynamic fonts) containing the glyph. */
+	};
+
+	/**
+	 * @brief Shaped string ready to be drawn, only the quads' corners are transformed each frame.
+	 *
+	 * 		  Holds the inputs it was built from, Renderer2D builds it again when any of them changes.
+	 * 		  Layouts with glyphs still being generated by a dynamic font are incomplete and built every frame until
+	 * 		  all glyphs arrive.
+	 */
+	struct TextLayout
+	{
+		AssetHandle FontHandle = 0;       /**< Handle of the font asset. */
+		Font* FontAsset        = nullptr; /**< The font the layout was built with. */
+		u64 FontInstance       = 0;       /**< Instance identifier of the font, changes when the font is reloaded. */
+		u64 FontGeneration     = 0;       /**< Atlas generation of the font (see Font::GetLayoutGeneration()). */
+		f32 Kerning            = 0.f;     /**< Extra advance between the glyphs. */
+		f32 LineSpacing        = 0.f;     /**< Extra distance between the lines. */
+		bool IsComplete        = false;   /**< Whether every glyph was available when the layout was built. */
+
+		std::string Text;                 /**< The laid out string. */
+		std::vector<TextGlyphQuad> Quads; /**< The glyph quads. */
+	};
+
+} // namespace SW
@@ -1,5 +1,6 @@
 #include "Scene.hpp"
 
+#include <box2d/b2_distance.h>
 #include <box2d/box2d.h>
 #include <entt.hpp>
 
@@ -10,11 +11,13 @@
 #include "Core/ECS/Components.hpp"
 #include "Core/ECS/Entity.hpp"
 #include "Core/Editor/EditorCamera.hpp"
+#include "Core/Physics/BreakableJoints2D.hpp"
 #include "Core/Physics/Physics2DContactListener.hpp"
 #include "Core/Renderer/Camera.hpp"
 #include "Core/Renderer/Renderer2D.hpp"
 #include "Core/Scripting/ScriptingCore.hpp"
 #include "Core/Utils/Random.hpp"
+#include "Core/Utils/Timer.hpp"
 
 namespace SW
 {
@@ -37,10 +40,34 @@ namespace SW
 
 	Scene::Scene() : m_Registry(this)
 	{
-		// entt::registry& reg = m_Registry.GetRegistryHandle();
-
-		// This enables creating entities in runtime
-		// reg.on_construct<RigidBody2DComponent>().connect<&Scene::OnRigidBody2DComponentCreated>(this);
+		entt::registry& reg = m_Registry.GetRegistryHandle();
+
+		// This enables creating and removing physics components in runtime
+		reg.on_construct<RigidBody2DComponent>().connect<&Scene::OnRigidBody2DComponentCreated>(this);
+		reg.on_destroy<RigidBody2DComponent>().connect<&Scene::OnRigidBody2DComponentDestroyed>(this);
+
+		reg.on_construct<BoxCollider2DComponent>()
+		    .connect<&Scene::OnCollider2DComponentCreated<BoxCollider2DComponent>>(this);
+		reg.on_construct<CircleCollider2DComponent>()
+		    .connect<&Scene::OnCollider2DComponentCreated<CircleCollider2DComponent>>(this);
+		reg.on_construct<PolygonCollider2DComponent>()
+		    .connect<&Scene::OnCollider2DComponentCreated<PolygonCollider2DComponent>>(this);
+
+		reg.on_destroy<BoxCollider2DComponent>()
+		    .connect<&Scene::OnCollider2DComponentDestroyed<BoxCollider2DComponent>>(this);
+		reg.on_destroy<CircleCollider2DComponent>()
+		    .connect<&Scene::OnCollider2DComponentDestroyed<CircleCollider2DComponent>>(this);
+		reg.on_destroy<PolygonCollider2DComponent>()
+		    .connect<&Scene::OnCollider2DComponentDestroyed<PolygonCollider2DComponent>>(this);
+
+		// Keeps referenced assets resident (see AssetManager::EnforceMemoryBudgets())
+		reg.on_construct<SpriteComponent>().connect<&Scene::OnAssetComponentChanged<SpriteComponent>>(this);
+		reg.on_update<SpriteComponent>().connect<&Scene::OnAssetComponentChanged<SpriteComponent>>(this);
+		reg.on_destroy<SpriteComponent>().connect<&Scene::OnAssetComponentDestroyed<SpriteComponent>>(this);
+
+		reg.on_construct<TextComponent>().connect<&Scene::OnAssetComponentChanged<TextComponent>>(this);
+		reg.on_update<TextComponent>().connect<&Scene::OnAssetComponentChanged<TextComponent>>(this);
+		reg.on_destroy<TextComponent>().connect<&Scene::OnAssetComponentDestroyed<TextComponent>>(this);
 	}
 
 	Scene::~Scene()
@@ -66,6 +93,30 @@ namespace SW
 		return entity;
 	}
 
+	void Scene::CreateEntitiesWithIDs(const u64* ids, u32 count, std::vector<entt::entity>& outHandles)
+	{
+		PROFILE_FUNCTION();
+
+		entt::registry& registry = m_Registry.GetRegistryHandle();
+
+		outHandles.resize(count);
+		registry.create(outHandles.begin(), outHandles.end());
+
+		const std::vector<IDComponent> idComponents(ids, ids + count);
+
+		registry.insert<IDComponent>(outHandles.begin(), outHandles.end(), idComponents.begin());
+		registry.insert<TagComponent>(outHandles.begin(), outHandles.end());
+		registry.insert<TransformComponent>(outHandles.begin(), outHandles.end());
+		registry.insert<RelationshipComponent>(outHandles.begin(), outHandles.end());
+
+		m_EntityMap.reserve(m_EntityMap.size() + count);
+
+		for (u32 i = 0; i < count; i++)
+		{
+			m_EntityMap[ids[i]] = {outHandles[i], this};
+		}
+	}
+
 	template <typename T>
 	static void RemoveReferencedConnections(entt::registry& registry, u64 id)
 	{
@@ -103,13 +154,6 @@ namespace SW
 		RemoveReferencedConnections<SpringJoint2DComponent>(registry, id);
 		RemoveReferencedConnections<WheelJoint2DComponent>(registry, id);
 
-		if (IsPlaying() && entity.HasComponent<RigidBody2DComponent>())
-		{
-			b2Body* body = (b2Body*)entity.GetComponent<RigidBody2DComponent>().Handle;
-
-			m_PhysicsWorld2D->DestroyBody(body);
-		}
-
 		if (entity.HasComponent<ScriptComponent>())
 		{
 			ScriptComponent& sc = entity.GetComponent<ScriptComponent>();
@@ -242,16 +286,6 @@ namespace SW
 		if (scale)
 			dst.GetTransform().Scale = *scale;
 
-		if (IsPlaying())
-		{
-			if (src.HasComponent<RigidBody2DComponent>())
-			{
-				RigidBody2DComponent& rbc = dst.GetComponent<RigidBody2DComponent>();
-
-				CreateRigidbody2D(dst, dst.GetWorldSpaceTransform(), rbc);
-			}
-		}
-
 		if (src.HasComponent<ScriptComponent>())
 		{
 			ScriptComponent& sc = dst.GetComponent<ScriptComponent>();
@@ -304,8 +338,13 @@ namespace SW
 			sc.Instance.Invoke("OnCreate");
 		}
 
+		BakeStaticColliders2D();
+
 		for (auto&& [handle, rbc] : m_Registry.GetEntitiesWith<RigidBody2DComponent>().each())
 		{
+			if (m_BakedStaticBody2D && rbc.Handle == m_BakedStaticBody2D)
+				continue;
+
 			Entity entity = {handle, this};
 
 			CreateRigidbody2D(entity, entity.GetWorldSpaceTransform(), rbc);
@@ -315,30 +354,43 @@ namespace SW
 		     m_Registry.GetEntitiesWith<RigidBody2DComponent, DistanceJoint2DComponent>().each())
 		{
 			CreateDistanceJoint2D(rbc, djc);
+
+			m_BreakableJoints2D.Add((b2Joint*)djc.RuntimeJoint, (u32)handle, JointType2D::Distance, djc.BreakingForce);
 		}
 
 		for (auto&& [handle, rbc, rjc] :
 		     m_Registry.GetEntitiesWith<RigidBody2DComponent, RevolutionJoint2DComponent>().each())
 		{
 			CreateRevolutionJoint2D(rbc, rjc);
+
+			m_BreakableJoints2D.Add((b2Joint*)rjc.RuntimeJoint, (u32)handle, JointType2D::Revolution, rjc.BreakingForce,
+			                        rjc.BreakingTorque);
 		}
 
 		for (auto&& [handle, rbc, pjc] :
 		     m_Registry.GetEntitiesWith<RigidBody2DComponent, PrismaticJoint2DComponent>().each())
 		{
 			CreatePrismaticJoint2D(rbc, pjc);
+
+			m_BreakableJoints2D.Add((b2Joint*)pjc.RuntimeJoint, (u32)handle, JointType2D::Prismatic, pjc.BreakingForce,
+			                        pjc.BreakingTorque);
 		}
 
 		for (auto&& [handle, rbc, sjc] :
 		     m_Registry.GetEntitiesWith<RigidBody2DComponent, SpringJoint2DComponent>().each())
 		{
 			CreateSpringJoint2D(rbc, sjc);
+
+			m_BreakableJoints2D.Add((b2Joint*)sjc.RuntimeJoint, (u32)handle, JointType2D::Spring, sjc.BreakingForce);
 		}
 
 		for (auto&& [handle, rbc, wjc] :
 		     m_Registry.GetEntitiesWith<RigidBody2DComponent, WheelJoint2DComponent>().each())
 		{
 			CreateWheelJoint2D(rbc, wjc);
+
+			m_BreakableJoints2D.Add((b2Joint*)wjc.RuntimeJoint, (u32)handle, JointType2D::Wheel, wjc.BreakingForce,
+			                        wjc.BreakingTorque);
 		}
 
 		for (auto&& [handle, tc, asc] : m_Registry.GetEntitiesWith<TransformComponent, AudioSourceComponent>().each())
@@ -422,6 +474,18 @@ namespace SW
 
 		AudioEngine::ClearActiveInstances();
 
+		m_BreakableJoints2D.Clear();
+		m_PhysicsStatistics2D = {};
+
+		m_PendingRigidBodies2D.clear();
+		m_PendingBodyDestructions2D.clear();
+		m_PendingFixtureDestructions2D.clear();
+
+		m_BakedStaticBody2D = nullptr;
+		m_BakedStaticSources2D.clear();
+		m_BakedStaticBoxes2D.clear();
+		m_StaticColliderBakeInfo2D = {};
+
 		delete m_PhysicsWorld2D;
 		m_PhysicsWorld2D = nullptr;
 
@@ -441,6 +505,8 @@ namespace SW
 		{
 			Entity entity = {handle, this};
 
+			m_SpriteReferences.Set((u32)handle, sc.Handle); // picks up handles assigned in place
+
 			Renderer2D::DrawQuad(entity.GetWorldSpaceTransformMatrix(), sc, (int)handle);
 		}
 
@@ -465,139 +531,115 @@ namespace SW
 		{
 			Entity entity = {handle, this};
 
+			m_FontReferences.Set((u32)handle, tc.Handle); // picks up handles assigned in place
+
 			if (!tc.Handle)
 				continue;
 
-			Renderer2D::DrawString(entity.GetWorldSpaceTransformMatrix(), tc, (int)handle);
+			Renderer2D::DrawString(entity.GetWorldSpaceTransformMatrix(), tc, m_TextLayouts[handle], (int)handle);
 		}
 	}
 
-	void Scene::OnUpdateRuntime(Timestep dt)
+	void Scene::OnUpdatePhysics2D(Timestep dt)
 	{
 		PROFILE_FUNCTION();
 
-		m_AnimationTime += dt;
+		constexpr f32 physicsStepRate = 50.0f;
+		constexpr f32 physicsTs       = 1.0f / physicsStepRate;
 
-#pragma region Physics
-		if (m_SceneState != SceneState::Pause)
-		{
-			PROFILE_SCOPE("Scene::OnUpdateRuntime() - Physics update");
+		m_PhysicsFrameAccumulator += dt;
 
-			constexpr f32 physicsStepRate = 50.0f;
-			constexpr f32 physicsTs       = 1.0f / physicsStepRate;
+		m_PhysicsStatistics2D = {};
 
-			m_PhysicsFrameAccumulator += dt;
+		while (m_PhysicsFrameAccumulator >= physicsTs)
+		{
+			// Bodies and fixtures queued by the callbacks of the previous substep, destroying the fixtures ends
+			// their contacts before the buoyancy pairs of the listener are stepped again.
+			FlushPhysicsCommands2D();
 
-			while (m_PhysicsFrameAccumulator >= physicsTs)
-			{
-				m_PhysicsContactListener2D->Step(physicsTs);
-				m_PhysicsWorld2D->Step(physicsTs, static_cast<int32_t>(m_VelocityIterations),
-				                       static_cast<int32_t>(m_PositionIterations));
+			Timer timer;
 
-				m_PhysicsFrameAccumulator -= physicsTs;
-			}
+			m_PhysicsContactListener2D->Step(physicsTs);
 
-			for (auto&& [handle, tc, rbc] :
-			     m_Registry.GetEntitiesWith<TransformComponent, RigidBody2DComponent>().each())
-			{
-				const b2Body* body = static_cast<b2Body*>(rbc.Handle);
+			m_PhysicsStatistics2D.BuoyancyMs += timer.ElapsedMillis();
 
-				if (!body->IsAwake())
-					continue;
+			m_PhysicsWorld2D->Step(physicsTs, static_cast<int32_t>(m_VelocityIterations),
+			                       static_cast<int32_t>(m_PositionIterations));
 
-				const b2Vec2 position = body->GetPosition();
+			const b2Profile& profile = m_PhysicsWorld2D->GetProfile();
 
-				Entity entity = {handle, this};
+			m_PhysicsStatistics2D.StepMs       += profile.step;
+			m_PhysicsStatistics2D.CollideMs    += profile.collide;
+			m_PhysicsStatistics2D.SolveMs      += profile.solve;
+			m_PhysicsStatistics2D.BroadphaseMs += profile.broadphase;
 
-				tc.Position.x = position.x;
-				tc.Position.y = position.y;
-				tc.Rotation.z = body->GetAngle();
+			timer.Reset();
 
-				entity.ConvertToLocalSpace();
-			}
+			BreakJoints2D(physicsStepRate);
 
-			for (auto&& [handle, djc] : m_Registry.GetEntitiesWith<DistanceJoint2DComponent>().each())
-			{
-				if (djc.RuntimeJoint)
-				{
-					b2Joint* joint = (b2Joint*)(djc.RuntimeJoint);
+			m_PhysicsStatistics2D.JointBreakMs += timer.ElapsedMillis();
+			m_PhysicsStatistics2D.SubSteps++;
 
-					if (joint->GetReactionForce(physicsStepRate).LengthSquared() >
-					    djc.BreakingForce * djc.BreakingForce)
-					{
-						m_PhysicsWorld2D->DestroyJoint(joint);
+			m_PhysicsFrameAccumulator -= physicsTs;
+		}
 
-						djc.RuntimeJoint = nullptr;
-					}
-				}
-			}
+		Timer writeBackTimer;
 
-			for (auto&& [handle, rjc] : m_Registry.GetEntitiesWith<RevolutionJoint2DComponent>().each())
-			{
-				if (rjc.RuntimeJoint)
-				{
-					b2Joint* joint = (b2Joint*)(rjc.RuntimeJoint);
+		for (auto&& [handle, tc, rbc] :
+		     m_Registry.GetEntitiesWith<TransformComponent, RigidBody2DComponent>().each())
+		{
+			const b2Body* body = static_cast<b2Body*>(rbc.Handle);
 
-					if (joint->GetReactionForce(physicsStepRate).LengthSquared() >
-					        rjc.BreakingForce * rjc.BreakingForce ||
-					    joint->GetReactionTorque(physicsStepRate) > rjc.BreakingTorque)
-					{
-						m_PhysicsWorld2D->DestroyJoint(joint);
+			if (!body || !body->IsAwake()) // body added inside of a physics callback is created with the next batch
+				continue;
 
-						rjc.RuntimeJoint = nullptr;
-					}
-				}
-			}
+			const b2Vec2 position = body->GetPosition();
 
-			for (auto&& [handle, pjc] : m_Registry.GetEntitiesWith<PrismaticJoint2DComponent>().each())
-			{
-				if (pjc.RuntimeJoint)
-				{
-					b2Joint* joint = (b2Joint*)(pjc.RuntimeJoint);
+			Entity entity = {handle, this};
 
-					if (joint->GetReactionForce(physicsStepRate).LengthSquared() >
-					        pjc.BreakingForce * pjc.BreakingForce ||
-					    joint->GetReactionTorque(physicsStepRate) > pjc.BreakingTorque)
-					{
-						m_PhysicsWorld2D->DestroyJoint(joint);
+			tc.Position.x = position.x;
+			tc.Position.y = position.y;
+			tc.Rotation.z = body->GetAngle();
 
-						pjc.RuntimeJoint = nullptr;
-					}
-				}
-			}
+			entity.ConvertToLocalSpace();
+		}
 
-			for (auto&& [handle, sjc] : m_Registry.GetEntitiesWith<SpringJoint2DComponent>().each())
-			{
-				if (sjc.RuntimeJoint)
-				{
-					b2Joint* joint = (b2Joint*)(sjc.RuntimeJoint);
+		m_PhysicsStatistics2D.TransformWriteBackMs = writeBackTimer.ElapsedMillis();
 
-					if (joint->GetReactionForce(physicsStepRate).LengthSquared() >
-					    sjc.BreakingForce * sjc.BreakingForce)
-					{
-						m_PhysicsWorld2D->DestroyJoint(joint);
+		// Counted on the world - baked static entities share one body
+		for (const b2Body* body = m_PhysicsWorld2D->GetBodyList(); body; body = body->GetNext())
+		{
+			if (body->IsAwake())
+				m_PhysicsStatistics2D.AwakeBodyCount++;
+		}
 
-						sjc.RuntimeJoint = nullptr;
-					}
-				}
-			}
+		m_PhysicsStatistics2D.BodyCount    = (u32)m_PhysicsWorld2D->GetBodyCount();
+		m_PhysicsStatistics2D.ContactCount = (u32)m_PhysicsWorld2D->GetContactCount();
+		m_PhysicsStatistics2D.JointCount   = (u32)m_PhysicsWorld2D->GetJointCount();
+
+		PROFILE_PLOT("Physics2D - Step (ms)", m_PhysicsStatistics2D.StepMs);
+		PROFILE_PLOT("Physics2D - Collide (ms)", m_PhysicsStatistics2D.CollideMs);
+		PROFILE_PLOT("Physics2D - Solve (ms)", m_PhysicsStatistics2D.SolveMs);
+		PROFILE_PLOT("Physics2D - Broadphase (ms)", m_PhysicsStatistics2D.BroadphaseMs);
+		PROFILE_PLOT("Physics2D - Transform write-back (ms)", m_PhysicsStatistics2D.TransformWriteBackMs);
+		PROFILE_PLOT("Physics2D - Joint breaking (ms)", m_PhysicsStatistics2D.JointBreakMs);
+		PROFILE_PLOT("Physics2D - Buoyancy (ms)", m_PhysicsStatistics2D.BuoyancyMs);
+		PROFILE_PLOT("Physics2D - Bodies", (i64)m_PhysicsStatistics2D.BodyCount);
+		PROFILE_PLOT("Physics2D - Awake bodies", (i64)m_PhysicsStatistics2D.AwakeBodyCount);
+		PROFILE_PLOT("Physics2D - Contacts", (i64)m_PhysicsStatistics2D.ContactCount);
+		PROFILE_PLOT("Physics2D - Joints", (i64)m_PhysicsStatistics2D.JointCount);
+	}
 
-			for (auto&& [handle, wjc] : m_Registry.GetEntitiesWith<WheelJoint2DComponent>().each())
-			{
-				if (wjc.RuntimeJoint)
-				{
-					b2Joint* joint = (b2Joint*)(wjc.RuntimeJoint);
+	void Scene::OnUpdateRuntime(Timestep dt)
+	{
+		PROFILE_FUNCTION();
 
-					if (joint->GetReactionForce(physicsStepRate).LengthSquared() >
-					        wjc.BreakingForce * wjc.BreakingForce ||
-					    joint->GetReactionTorque(physicsStepRate) > wjc.BreakingTorque)
-					{
-						m_PhysicsWorld2D->DestroyJoint(joint);
+		m_AnimationTime += dt;
 
-						wjc.RuntimeJoint = nullptr;
-					}
-				}
-			}
+#pragma region Physics
+		if (m_SceneState != SceneState::Pause)
+		{
+			OnUpdatePhysics2D(dt);
 
 			for (auto&& [handle, tc, asc] :
 			     m_Registry.GetEntitiesWith<TransformComponent, AudioSourceComponent>().each())
@@ -703,6 +745,8 @@ namespace SW
 		{
 			Entity entity = {handle, this};
 
+			m_SpriteReferences.Set((u32)handle, sc.Handle); // picks up handles assigned in place
+
 			Renderer2D::DrawQuad(entity.GetWorldSpaceTransformMatrix(), sc, (int)handle);
 		}
 
@@ -727,10 +771,12 @@ namespace SW
 		{
 			Entity entity = {handle, this};
 
+			m_FontReferences.Set((u32)handle, tc.Handle); // picks up handles assigned in place
+
 			if (!tc.Handle)
 				continue;
 
-			Renderer2D::DrawString(entity.GetWorldSpaceTransformMatrix(), tc, (int)handle);
+			Renderer2D::DrawString(entity.GetWorldSpaceTransformMatrix(), tc, m_TextLayouts[handle], (int)handle);
 		}
 	}
 
@@ -969,6 +1015,8 @@ namespace SW
 		fixtureDef.restitution          = rbc.Restitution;
 		fixtureDef.restitutionThreshold = rbc.RestitutionThreshold;
 		fixtureDef.isSensor             = bcc.IsSensor;
+		fixtureDef.filter.categoryBits  = rbc.CollisionLayer;
+		fixtureDef.filter.maskBits      = rbc.CollisionMask;
 
 		b2Body* body       = static_cast<b2Body*>(rbc.Handle);
 		b2Fixture* fixture = body->CreateFixture(&fixtureDef);
@@ -991,6 +1039,8 @@ namespace SW
 		fixtureDef.restitution          = rbc.Restitution;
 		fixtureDef.restitutionThreshold = rbc.RestitutionThreshold;
 		fixtureDef.isSensor             = ccc.IsSensor;
+		fixtureDef.filter.categoryBits  = rbc.CollisionLayer;
+		fixtureDef.filter.maskBits      = rbc.CollisionMask;
 
 		b2Body* body       = static_cast<b2Body*>(rbc.Handle);
 		b2Fixture* fixture = body->CreateFixture(&fixtureDef);
@@ -1023,6 +1073,8 @@ namespace SW
 		fixtureDef.restitution          = rbc.Restitution;
 		fixtureDef.restitutionThreshold = rbc.RestitutionThreshold;
 		fixtureDef.isSensor             = pcc.IsSensor;
+		fixtureDef.filter.categoryBits  = rbc.CollisionLayer;
+		fixtureDef.filter.maskBits      = rbc.CollisionMask;
 
 		b2Body* body       = static_cast<b2Body*>(rbc.Handle);
 		b2Fixture* fixture = body->CreateFixture(&fixtureDef);
@@ -1179,16 +1231,964 @@ namespace SW
 		wjc.RuntimeJoint = m_PhysicsWorld2D->CreateJoint(&jointDef);
 	}
 
-	// void Scene::OnRigidBody2DComponentCreated(entt::registry& registry, entt::entity handle)
-	//{
-	//	if (!IsPlaying())
-	//		return;
+	void Scene::BreakJoints2D(f32 invDt)
+	{
+		m_BrokenJoints2D.clear();
+		m_BreakableJoints2D.Evaluate(invDt, m_BrokenJoints2D);
+
+		for (const BrokenJoint2D& broken : m_BrokenJoints2D)
+		{
+			m_PhysicsWorld2D->DestroyJoint(broken.Joint);
+
+			Entity owner = {static_cast<entt::entity>(broken.Owner), this};
+
+			u64 connectedEntityID = 0;
+
+			switch (broken.Type)
+			{
+			case JointType2D::Distance:
+			{
+				DistanceJoint2DComponent& djc = owner.GetComponent<DistanceJoint2DComponent>();
+				djc.RuntimeJoint              = nullptr;
+				connectedEntityID             = djc.ConnectedEntityID;
+			}
+			break;
+			case JointType2D::Revolution:
+			{
+				RevolutionJoint2DComponent& rjc = owner.GetComponent<RevolutionJoint2DComponent>();
+				rjc.RuntimeJoint                = nullptr;
+				connectedEntityID               = rjc.ConnectedEntityID;
+			}
+			break;
+			case JointType2D::Prismatic:
+			{
+				PrismaticJoint2DComponent& pjc = owner.GetComponent<PrismaticJoint2DComponent>();
+				pjc.RuntimeJoint               = nullptr;
+				connectedEntityID              = pjc.ConnectedEntityID;
+			}
+			break;
+			case JointType2D::Spring:
+			{
+				SpringJoint2DComponent& sjc = owner.GetComponent<SpringJoint2DComponent>();
+				sjc.RuntimeJoint            = nullptr;
+				connectedEntityID           = sjc.ConnectedEntityID;
+			}
+			break;
+			case JointType2D::Wheel:
+			{
+				WheelJoint2DComponent& wjc = owner.GetComponent<WheelJoint2DComponent>();
+				wjc.RuntimeJoint           = nullptr;
+				connectedEntityID          = wjc.ConnectedEntityID;
+			}
+			break;
+			default:
+				ASSERT(false, "Unknown joint type!");
+				break;
+			}
+
+			if (owner.HasComponent<ScriptComponent>())
+			{
+				ScriptComponent& sc = owner.GetComponent<ScriptComponent>();
+
+				if (sc.Instance.IsValid())
+					sc.Instance.Invoke<u64>("OnJoint2DBreakInternal", connectedEntityID);
+			}
+		}
+	}
+
+	static StaticColliderMaterial2D GetStaticColliderMaterial2D(const RigidBody2DComponent& rbc)
+	{
+		return {rbc.Friction, rbc.Restitution, rbc.RestitutionThreshold, rbc.CollisionLayer, rbc.CollisionMask};
+	}
+
+	static b2FixtureDef GetStaticFixtureDef2D(const b2Shape* shape, const StaticColliderMaterial2D& material,
+	                                          u64 userData)
+	{
+		b2FixtureDef fixtureDef;
+		fixtureDef.shape                = shape;
+		fixtureDef.userData.pointer     = userData;
+		fixtureDef.density              = 0.0f;
+		fixtureDef.friction             = material.Friction;
+		fixtureDef.restitution          = material.Restitution;
+		fixtureDef.restitutionThreshold = material.RestitutionThreshold;
+		fixtureDef.filter.categoryBits  = material.CollisionLayer;
+		fixtureDef.filter.maskBits      = material.CollisionMask;
+
+		return fixtureDef;
+	}
+
+	template <typename T>
+	static void CollectJointConnections(entt::registry& registry, std::unordered_set<u64>& outConnected)
+	{
+		for (entt::entity handle : registry.view<T>())
+		{
+			const T& component = registry.get<T>(handle);
+
+			if (component.ConnectedEntityID)
+				outConnected.insert(component.ConnectedEntityID);
+		}
+	}
+
+	static StaticColliderBakeInfo2D GetStaticColliderBakeInfo2D(const std::vector<StaticBox2D>& boxes,
+	                                                            const std::vector<BakedStaticBox2D>& baked,
+	                                                            const std::vector<Entity>& others)
+	{
+		StaticColliderBakeInfo2D info;
+		info.SourceColliders = (u32)boxes.size();
+		info.BakedFixtures   = (u32)baked.size();
+
+		for (const BakedStaticBox2D& box : baked)
+		{
+			if (box.SourceCount > 1)
+				info.MergedBoxes++;
+		}
+
+		for (Entity entity : others)
+		{
+			const u32 colliders = (u32)entity.HasComponent<BoxCollider2DComponent>() +
+			                      (u32)entity.HasComponent<PolygonCollider2DComponent>();
+
+			info.SourceColliders += colliders;
+			info.BakedFixtures += colliders;
+		}
+
+		return info;
+	}
+
+	void Scene::GatherStaticColliders2D(std::vector<StaticBox2D>& outBoxes, std::vector<Entity>& outOthers)
+	{
+		entt::registry& registry = m_Registry.GetRegistryHandle();
+
+		std::unordered_set<u64> connectedEntities;
+		CollectJointConnections<DistanceJoint2DComponent>(registry, connectedEntities);
+		CollectJointConnections<RevolutionJoint2DComponent>(registry, connectedEntities);
+		CollectJointConnections<PrismaticJoint2DComponent>(registry, connectedEntities);
+		CollectJointConnections<SpringJoint2DComponent>(registry, connectedEntities);
+		CollectJointConnections<WheelJoint2DComponent>(registry, connectedEntities);
+
+		for (auto&& [handle, id, rbc] : m_Registry.GetEntitiesWith<IDComponent, RigidBody2DComponent>().each())
+		{
+			if (rbc.Type != PhysicBodyType::Static || connectedEntities.contains(id.ID))
+				continue;
+
+			if (registry.any_of<ScriptComponent, CircleCollider2DComponent, BuoyancyEffector2DComponent,
+			                    DistanceJoint2DComponent, RevolutionJoint2DComponent, PrismaticJoint2DComponent,
+			                    SpringJoint2DComponent, WheelJoint2DComponent>(handle))
+				continue;
+
+			const BoxCollider2DComponent* bcc     = registry.try_get<BoxCollider2DComponent>(handle);
+			const PolygonCollider2DComponent* pcc = registry.try_get<PolygonCollider2DComponent>(handle);
+
+			if ((!bcc && !pcc) || (bcc && bcc->IsSensor) || (pcc && (pcc->IsSensor || pcc->Vertices.size() < 3)))
+				continue;
+
+			Entity entity = {handle, this};
+
+			const TransformComponent tc = entity.GetWorldSpaceTransform();
+
+			const f32 quarterTurns   = glm::round(tc.Rotation.z / glm::half_pi<f32>());
+			const bool isAxisAligned = glm::abs(tc.Rotation.z - quarterTurns * glm::half_pi<f32>()) < 0.0001f;
+
+			if (pcc || !isAxisAligned)
+			{
+				outOthers.emplace_back(entity);
+
+				continue;
+			}
+
+			const glm::vec2 scale  = {tc.Scale.x, tc.Scale.y};
+			const glm::vec2 offset = scale * bcc->Offset;
+			const f32 cos          = glm::cos(tc.Rotation.z);
+			const f32 sin          = glm::sin(tc.Rotation.z);
+
+			const glm::vec2 center = {tc.Position.x + cos * offset.x - sin * offset.y,
+			                          tc.Position.y + sin * offset.x + cos * offset.y};
+
+			glm::vec2 halfExtents = glm::abs(scale * bcc->Size);
+
+			if ((i32)quarterTurns % 2 != 0)
+				std::swap(halfExtents.x, halfExtents.y);
+
+			outBoxes.push_back(
+			    {center - halfExtents, center + halfExtents, GetStaticColliderMaterial2D(rbc), (u32)handle});
+		}
+	}
+
+	void Scene::BakeStaticColliders2D()
+	{
+		PROFILE_FUNCTION();
+
+		std::vector<Entity> others;
+		GatherStaticColliders2D(m_BakedStaticSources2D, others);
+
+		if (m_BakedStaticSources2D.empty() && others.empty())
+			return;
+
+		StaticColliderBaker2D::Merge(m_BakedStaticSources2D, m_BakedStaticBoxes2D);
+
+		b2BodyDef definition;
+		definition.type = b2_staticBody;
+
+		m_BakedStaticBody2D = m_PhysicsWorld2D->CreateBody(&definition);
+
+		for (u32 i = 0; i < (u32)m_BakedStaticBoxes2D.size(); i++)
+		{
+			const BakedStaticBox2D& box = m_BakedStaticBoxes2D[i];
+
+			if (box.SourceCount == 1)
+			{
+				CreateBakedStaticBox2D(m_BakedStaticSources2D[box.FirstSource]);
+
+				continue;
+			}
+
+			const glm::vec2 halfExtents = (box.Max - box.Min) * 0.5f;
+			const glm::vec2 center      = (box.Max + box.Min) * 0.5f;
+
+			b2PolygonShape boxShape;
+			boxShape.SetAsBox(halfExtents.x, halfExtents.y, {center.x, center.y}, 0.0f);
+
+			const b2FixtureDef fixtureDef = GetStaticFixtureDef2D(&boxShape, box.Material, BakedColliderFlag2D | i);
+
+			b2Fixture* fixture = m_BakedStaticBody2D->CreateFixture(&fixtureDef);
+
+			for (u32 source = box.FirstSource; source < box.FirstSource + box.SourceCount; source++)
+			{
+				Entity entity = {static_cast<entt::entity>(m_BakedStaticSources2D[source].Entity), this};
+
+				entity.GetComponent<RigidBody2DComponent>().Handle   = m_BakedStaticBody2D;
+				entity.GetComponent<BoxCollider2DComponent>().Handle = fixture;
+			}
+		}
 
-	//	Entity entity = { handle, this };
+		// Rotated boxes and polygons can not be merged, they are only moved to the shared body (in world space)
+		for (Entity entity : others)
+		{
+			RigidBody2DComponent& rbc = entity.GetComponent<RigidBody2DComponent>();
+			rbc.Handle                = m_BakedStaticBody2D;
+
+			const TransformComponent tc = entity.GetWorldSpaceTransform();
+			const b2Transform transform({tc.Position.x, tc.Position.y}, b2Rot(tc.Rotation.z));
+
+			const StaticColliderMaterial2D material = GetStaticColliderMaterial2D(rbc);
+
+			if (entity.HasComponent<BoxCollider2DComponent>())
+			{
+				BoxCollider2DComponent& bcc = entity.GetComponent<BoxCollider2DComponent>();
+
+				const b2Vec2 offset = b2Mul(transform, b2Vec2(tc.Scale.x * bcc.Offset.x, tc.Scale.y * bcc.Offset.y));
+
+				b2PolygonShape boxShape;
+				boxShape.SetAsBox(tc.Scale.x * bcc.Size.x, tc.Scale.y * bcc.Size.y, offset, tc.Rotation.z);
+
+				const b2FixtureDef fixtureDef = GetStaticFixtureDef2D(&boxShape, material, (u32)entity);
+
+				bcc.Handle = m_BakedStaticBody2D->CreateFixture(&fixtureDef);
+			}
+
+			if (entity.HasComponent<PolygonCollider2DComponent>())
+			{
+				PolygonCollider2DComponent& pcc = entity.GetComponent<PolygonCollider2DComponent>();
+
+				std::vector<b2Vec2> vertices(pcc.Vertices.size());
+
+				for (u64 i = 0; i < pcc.Vertices.size(); ++i)
+				{
+					const glm::vec2 vertex = pcc.Vertices[i] + pcc.Offset;
+
+					vertices[i] = b2Mul(transform, b2Vec2(vertex.x, vertex.y));
+				}
+
+				b2PolygonShape polygonShape;
+				polygonShape.Set(vertices.data(), (i32)vertices.size());
+
+				const b2FixtureDef fixtureDef = GetStaticFixtureDef2D(&polygonShape, material, (u32)entity);
+
+				pcc.Handle = m_BakedStaticBody2D->CreateFixture(&fixtureDef);
+			}
+		}
+
+		m_StaticColliderBakeInfo2D = GetStaticColliderBakeInfo2D(m_BakedStaticSources2D, m_BakedStaticBoxes2D, others);
+
+		SYSTEM_DEBUG("Baked {} static colliders into {} fixtures ({} merged boxes)",
+		             m_StaticColliderBakeInfo2D.SourceColliders, m_StaticColliderBakeInfo2D.BakedFixtures,
+		             m_StaticColliderBakeInfo2D.MergedBoxes);
+	}
+
+	void Scene::CreateBakedStaticBox2D(const StaticBox2D& source)
+	{
+		const glm::vec2 halfExtents = (source.Max - source.Min) * 0.5f;
+		const glm::vec2 center      = (source.Max + source.Min) * 0.5f;
+
+		b2PolygonShape boxShape;
+		boxShape.SetAsBox(halfExtents.x, halfExtents.y, {center.x, center.y}, 0.0f);
+
+		const b2FixtureDef fixtureDef = GetStaticFixtureDef2D(&boxShape, source.Material, source.Entity);
+
+		Entity entity = {static_cast<entt::entity>(source.Entity), this};
+
+		entity.GetComponent<RigidBody2DComponent>().Handle   = m_BakedStaticBody2D;
+		entity.GetComponent<BoxCollider2DComponent>().Handle = m_BakedStaticBody2D->CreateFixture(&fixtureDef);
+	}
+
+	StaticColliderBakeInfo2D Scene::PreviewStaticColliderBake2D()
+	{
+		PROFILE_FUNCTION();
+
+		std::vector<StaticBox2D> boxes;
+		std::vector<Entity> others;
+		GatherStaticColliders2D(boxes, others);
+
+		std::vector<BakedStaticBox2D> baked;
+		StaticColliderBaker2D::Merge(boxes, baked);
+
+		return GetStaticColliderBakeInfo2D(boxes, baked, others);
+	}
+
+	void Scene::UnbakeStaticCollider2D(Entity entity)
+	{
+		if (!m_BakedStaticBody2D || !entity.HasComponent<RigidBody2DComponent>())
+			return;
+
+		RigidBody2DComponent& rbc = entity.GetComponent<RigidBody2DComponent>();
+
+		if (rbc.Handle != m_BakedStaticBody2D)
+			return;
+
+		RemoveBakedStaticCollider2D(entity);
+
+		CreateRigidbody2D(entity, entity.GetWorldSpaceTransform(), rbc);
+	}
+
+	void Scene::RemoveBakedStaticCollider2D(Entity entity)
+	{
+		if (entity.HasComponent<BoxCollider2DComponent>())
+		{
+			BoxCollider2DComponent& bcc = entity.GetComponent<BoxCollider2DComponent>();
+
+			b2Fixture* fixture = static_cast<b2Fixture*>(bcc.Handle);
+			const u64 userData = fixture->GetUserData().pointer;
+
+			m_BakedStaticBody2D->DestroyFixture(fixture);
+
+			// The merged box is gone - the remaining sources get their own boxes back
+			if (userData & BakedColliderFlag2D)
+			{
+				const BakedStaticBox2D& box = m_BakedStaticBoxes2D[static_cast<u32>(userData)];
+
+				for (u32 source = box.FirstSource; source < box.FirstSource + box.SourceCount; source++)
+				{
+					if (m_BakedStaticSources2D[source].Entity != (u32)entity)
+						CreateBakedStaticBox2D(m_BakedStaticSources2D[source]);
+				}
+			}
 
-	//	RigidBody2DComponent& rbc = entity.GetComponent<RigidBody2DComponent>();
+			bcc.Handle = nullptr;
+		}
 
-	//	CreateRigidbody2D(entity, entity.GetWorldSpaceTransform(), rbc);
-	//}
+		if (entity.HasComponent<PolygonCollider2DComponent>())
+		{
+			PolygonCollider2DComponent& pcc = entity.GetComponent<PolygonCollider2DComponent>();
+
+			m_BakedStaticBody2D->DestroyFixture(static_cast<b2Fixture*>(pcc.Handle));
+
+			pcc.Handle = nullptr;
+		}
+
+		entity.GetComponent<RigidBody2DComponent>().Handle = nullptr;
+	}
+
+	Entity Scene::GetPhysicsEntity2D(u64 userData, glm::vec2 point)
+	{
+		if (userData & BakedColliderFlag2D)
+		{
+			const BakedStaticBox2D& box = m_BakedStaticBoxes2D[static_cast<u32>(userData)];
+			const u32 source            = StaticColliderBaker2D::FindSource(box, m_BakedStaticSources2D.data(), point);
+
+			userData = m_BakedStaticSources2D[source].Entity;
+		}
+
+		return {static_cast<entt::entity>(static_cast<u32>(userData)), this};
+	}
+
+	const StaticBox2D* Scene::GetBakedStaticSources2D(u64 userData, u32* outCount) const
+	{
+		if (!(userData & BakedColliderFlag2D))
+		{
+			*outCount = 0;
+			return nullptr;
+		}
+
+		const BakedStaticBox2D& box = m_BakedStaticBoxes2D[static_cast<u32>(userData)];
+
+		*outCount = box.SourceCount;
+
+		return m_BakedStaticSources2D.data() + box.FirstSource;
+	}
+
+	static bool PassesQueryFilter2D(const b2Fixture* fixture, u32 layerMask)
+	{
+		return !fixture->IsSensor() && (fixture->GetFilterData().categoryBits & layerMask) != 0;
+	}
+
+	static u64 GetQueriedEntityID(Scene* scene, uintptr_t userData, const b2Vec2& point)
+	{
+		return scene->GetPhysicsEntity2D(userData, {point.x, point.y}).GetID();
+	}
+
+	class ClosestRayCastCallback2D final : public b2RayCastCallback
+	{
+	public:
+		ClosestRayCastCallback2D(u32 layerMask) : m_LayerMask(layerMask) {}
+
+		f32 ReportFixture(b2Fixture* fixture, const b2Vec2& point, const b2Vec2& normal, f32 fraction) override
+		{
+			if (!PassesQueryFilter2D(fixture, m_LayerMask))
+				return -1.0f; // ignore the fixture and continue
+
+			Fixture  = fixture;
+			Point    = point;
+			Normal   = normal;
+			Fraction = fraction;
+
+			return fraction; // clip the ray, only closer fixtures will be reported from now on
+		}
+
+		b2Fixture* Fixture = nullptr;
+		b2Vec2 Point       = b2Vec2_zero;
+		b2Vec2 Normal      = b2Vec2_zero;
+		f32 Fraction       = 1.0f;
+
+	private:
+		u32 m_LayerMask = AllCollisionLayers;
+	};
+
+	class OverlapQueryCallback2D final : public b2QueryCallback
+	{
+	public:
+		OverlapQueryCallback2D(const Scene* scene, const b2Shape* shape, const b2Transform& transform, u32 layerMask,
+		                       u64* outHandles, u32 capacity)
+		    : m_Scene(scene), m_Transform(transform), m_Shape(shape), m_LayerMask(layerMask),
+		      m_OutHandles(outHandles), m_Capacity(capacity)
+		{
+		}
+
+		bool ReportFixture(b2Fixture* fixture) override
+		{
+			if (!PassesQueryFilter2D(fixture, m_LayerMask))
+				return true;
+
+			const b2Transform& transform = fixture->GetBody()->GetTransform();
+
+			u32 sourceCount            = 0;
+			const StaticBox2D* sources = m_Scene->GetBakedStaticSources2D(fixture->GetUserData().pointer, &sourceCount);
+
+			// Baked fixture covers several entities - every source box touched by the query is reported
+			if (sources)
+			{
+				for (u32 i = 0; i < sourceCount; i++)
+				{
+					const glm::vec2 halfExtents = (sources[i].Max - sources[i].Min) * 0.5f;
+					const glm::vec2 center      = (sources[i].Max + sources[i].Min) * 0.5f;
+
+					b2PolygonShape box;
+					box.SetAsBox(halfExtents.x, halfExtents.y, {center.x, center.y}, 0.0f);
+
+					if (b2TestOverlap(m_Shape, 0, &box, 0, m_Transform, transform) && !Report(sources[i].Entity))
+						return false;
+				}
+
+				return true;
+			}
+
+			const b2Shape* shape = fixture->GetShape();
+
+			for (i32 child = 0; child < shape->GetChildCount(); child++)
+			{
+				if (b2TestOverlap(m_Shape, 0, shape, child, m_Transform, transform))
+					return Report(fixture->GetUserData().pointer);
+			}
+
+			return true;
+		}
+
+		u32 Count = 0;
+
+	private:
+		const Scene* m_Scene = nullptr;
+		b2Transform m_Transform;
+		const b2Shape* m_Shape = nullptr;
+		u32 m_LayerMask        = AllCollisionLayers;
+		u64* m_OutHandles      = nullptr;
+		u32 m_Capacity         = 0;
+
+		/**
+		 * @brief Adds the entt handle to the results.
+		 * @return False once the buffer is full and the query has to stop.
+		 */
+		bool Report(u64 handle)
+		{
+			// Entity with multiple colliders is reported once
+			for (u32 i = 0; i < Count; i++)
+			{
+				if (m_OutHandles[i] == handle)
+					return true;
+			}
+
+			m_OutHandles[Count++] = handle;
+
+			return Count < m_Capacity;
+		}
+	};
+
+	class ShapeCastCallback2D final : public b2QueryCallback
+	{
+	public:
+		ShapeCastCallback2D(const b2Shape* shape, const b2Transform& transform, const b2Vec2& translation,
+		                    u32 layerMask)
+		    : m_LayerMask(layerMask)
+		{
+			m_Input.proxyB.Set(shape, 0);
+			m_Input.transformB   = transform;
+			m_Input.translationB = translation;
+		}
+
+		bool ReportFixture(b2Fixture* fixture) override
+		{
+			if (!PassesQueryFilter2D(fixture, m_LayerMask))
+				return true;
+
+			const b2Shape* shape = fixture->GetShape();
+
+			m_Input.transformA = fixture->GetBody()->GetTransform();
+
+			for (i32 child = 0; child < shape->GetChildCount(); child++)
+			{
+				m_Input.proxyA.Set(shape, child);
+
+				b2ShapeCastOutput output;
+
+				if (b2ShapeCast(&output, &m_Input) && output.lambda < Fraction)
+				{
+					Fixture  = fixture;
+					Point    = output.point;
+					Normal   = output.normal;
+					Fraction = output.lambda;
+				}
+			}
+
+			return true;
+		}
+
+		b2Fixture* Fixture = nullptr;
+		b2Vec2 Point       = b2Vec2_zero;
+		b2Vec2 Normal      = b2Vec2_zero;
+		f32 Fraction       = FLT_MAX;
+
+	private:
+		b2ShapeCastInput m_Input;
+		u32 m_LayerMask = AllCollisionLayers;
+	};
+
+	static u32 QueryOverlaps2D(Scene* scene, const b2World* world, const b2Shape& shape, u32 layerMask,
+	                           u64* outEntityIDs, u32 capacity)
+	{
+		b2Transform transform;
+		transform.SetIdentity();
+
+		b2AABB aabb;
+		shape.ComputeAABB(&aabb, transform, 0);
+
+		// The buffer first collects the entt handles (for deduplication) and is remapped to IDs afterwards
+		OverlapQueryCallback2D callback(scene, &shape, transform, layerMask, outEntityIDs, capacity);
+		world->QueryAABB(&callback, aabb);
+
+		for (u32 i = 0; i < callback.Count; i++)
+		{
+			Entity entity = {static_cast<entt::entity>(static_cast<u32>(outEntityIDs[i])), scene};
+
+			outEntityIDs[i] = entity.GetID();
+		}
+
+		return callback.Count;
+	}
+
+	bool Scene::RayCast2D(const RayCastQuery2D& query, RayCastHit2D* outHit)
+	{
+		*outHit = RayCastHit2D();
+
+		if (!m_PhysicsWorld2D)
+			return false;
+
+		const f32 length = glm::length(query.Direction);
+
+		if (length <= FLT_EPSILON || query.MaxDistance <= 0.0f)
+			return false;
+
+		const glm::vec2 end = query.Origin + query.Direction / length * query.MaxDistance;
+
+		ClosestRayCastCallback2D callback(query.LayerMask);
+		m_PhysicsWorld2D->RayCast(&callback, {query.Origin.x, query.Origin.y}, {end.x, end.y});
+
+		if (!callback.Fixture)
+			return false;
+
+		outHit->EntityID = GetQueriedEntityID(this, callback.Fixture->GetUserData().pointer, callback.Point);
+		outHit->Point    = {callback.Point.x, callback.Point.y};
+		outHit->Normal   = {callback.Normal.x, callback.Normal.y};
+		outHit->Fraction = callback.Fraction;
+		outHit->Distance = callback.Fraction * query.MaxDistance;
+
+		return true;
+	}
+
+	void Scene::RayCast2DBatch(const RayCastQuery2D* queries, u32 count, RayCastHit2D* outHits)
+	{
+		PROFILE_FUNCTION();
+
+		for (u32 i = 0; i < count; i++)
+		{
+			RayCast2D(queries[i], &outHits[i]);
+		}
+	}
+
+	u32 Scene::OverlapAABB2D(const AABBQuery2D& query, u64* outEntityIDs, u32 capacity)
+	{
+		if (!m_PhysicsWorld2D || !capacity)
+			return 0;
+
+		const glm::vec2 halfExtents = (query.Max - query.Min) * 0.5f;
+		const glm::vec2 center      = (query.Max + query.Min) * 0.5f;
+
+		if (halfExtents.x <= 0.0f || halfExtents.y <= 0.0f)
+			return 0;
+
+		b2PolygonShape box;
+		box.SetAsBox(halfExtents.x, halfExtents.y, {center.x, center.y}, 0.0f);
+
+		return QueryOverlaps2D(this, m_PhysicsWorld2D, box, query.LayerMask, outEntityIDs, capacity);
+	}
+
+	void Scene::OverlapAABB2DBatch(const AABBQuery2D* queries, u32 count, u64* outEntityIDs, u32 capacityPerQuery,
+	                               u32* outCounts)
+	{
+		PROFILE_FUNCTION();
+
+		for (u32 i = 0; i < count; i++)
+		{
+			outCounts[i] = OverlapAABB2D(queries[i], outEntityIDs + (size_t)i * capacityPerQuery, capacityPerQuery);
+		}
+	}
+
+	u32 Scene::OverlapCircle2D(const CircleQuery2D& query, u64* outEntityIDs, u32 capacity)
+	{
+		if (!m_PhysicsWorld2D || !capacity || query.Radius <= 0.0f)
+			return 0;
+
+		b2CircleShape circle;
+		circle.m_p.Set(query.Center.x, query.Center.y);
+		circle.m_radius = query.Radius;
+
+		return QueryOverlaps2D(this, m_PhysicsWorld2D, circle, query.LayerMask, outEntityIDs, capacity);
+	}
+
+	void Scene::OverlapCircle2DBatch(const CircleQuery2D* queries, u32 count, u64* outEntityIDs,
+	                                 u32 capacityPerQuery, u32* outCounts)
+	{
+		PROFILE_FUNCTION();
+
+		for (u32 i = 0; i < count; i++)
+		{
+			outCounts[i] = OverlapCircle2D(queries[i], outEntityIDs + (size_t)i * capacityPerQuery, capacityPerQuery);
+		}
+	}
+
+	bool Scene::ShapeCast2D(const ShapeCastQuery2D& query, RayCastHit2D* outHit)
+	{
+		*outHit = RayCastHit2D();
+
+		if (!m_PhysicsWorld2D)
+			return false;
+
+		b2CircleShape circle;
+		b2PolygonShape box;
+
+		const b2Shape* shape = nullptr;
+
+		switch (query.Shape)
+		{
+		case ShapeCastShape2D::Circle:
+		{
+			if (query.Radius <= 0.0f)
+				return false;
+
+			circle.m_radius = query.Radius;
+			shape           = &circle;
+		}
+		break;
+		case ShapeCastShape2D::Box:
+		{
+			if (query.HalfExtents.x <= 0.0f || query.HalfExtents.y <= 0.0f)
+				return false;
+
+			box.SetAsBox(query.HalfExtents.x, query.HalfExtents.y);
+			shape = &box;
+		}
+		break;
+		default:
+			SYSTEM_ERROR("Unknown shape cast shape: {}", (u32)query.Shape);
+			return false;
+		}
+
+		const b2Vec2 translation = {query.Translation.x, query.Translation.y};
+
+		const b2Transform startTransform({query.Origin.x, query.Origin.y}, b2Rot(query.Angle));
+		const b2Transform endTransform(startTransform.p + translation, startTransform.q);
+
+		b2AABB startAABB;
+		b2AABB endAABB;
+		shape->ComputeAABB(&startAABB, startTransform, 0);
+		shape->ComputeAABB(&endAABB, endTransform, 0);
+
+		b2AABB sweptAABB;
+		sweptAABB.Combine(startAABB, endAABB);
+
+		ShapeCastCallback2D callback(shape, startTransform, translation, query.LayerMask);
+		m_PhysicsWorld2D->QueryAABB(&callback, sweptAABB);
+
+		if (!callback.Fixture)
+			return false;
+
+		outHit->EntityID = GetQueriedEntityID(this, callback.Fixture->GetUserData().pointer, callback.Point);
+		outHit->Point    = {callback.Point.x, callback.Point.y};
+		outHit->Normal   = {callback.Normal.x, callback.Normal.y};
+		outHit->Fraction = callback.Fraction;
+		outHit->Distance = callback.Fraction * translation.Length();
+
+		return true;
+	}
+
+	void Scene::ShapeCast2DBatch(const ShapeCastQuery2D* queries, u32 count, RayCastHit2D* outHits)
+	{
+		PROFILE_FUNCTION();
+
+		for (u32 i = 0; i < count; i++)
+		{
+			ShapeCast2D(queries[i], &outHits[i]);
+		}
+	}
+
+	/**
+	 * @brief Takes the fixture out of the simulation until it is destroyed with the next batch.
+	 * 		  Filtering everything out ends its contacts, the cleared user data makes the listener ignore them.
+	 */
+	static void DetachFixture2D(b2Fixture* fixture)
+	{
+		b2Filter filter;
+		filter.categoryBits = 0;
+		filter.maskBits     = 0;
+
+		fixture->SetFilterData(filter);
+		fixture->GetUserData().pointer = static_cast<u32>(entt::entity(entt::null));
+	}
+
+	void Scene::FlushPhysicsCommands2D()
+	{
+		if (!m_PhysicsWorld2D || m_PhysicsWorld2D->IsLocked())
+			return;
+
+		if (m_PendingRigidBodies2D.empty() && m_PendingBodyDestructions2D.empty() &&
+		    m_PendingFixtureDestructions2D.empty())
+			return;
+
+		PROFILE_FUNCTION();
+
+		// Fixtures go first, their bodies might be queued as well
+		for (b2Fixture* fixture : m_PendingFixtureDestructions2D)
+		{
+			fixture->GetBody()->DestroyFixture(fixture);
+		}
+
+		for (b2Body* body : m_PendingBodyDestructions2D)
+		{
+			m_BreakableJoints2D.RemoveAttachedTo(body);
+			m_PhysicsWorld2D->DestroyBody(body);
+		}
+
+		m_PendingFixtureDestructions2D.clear();
+		m_PendingBodyDestructions2D.clear();
+
+		entt::registry& registry = m_Registry.GetRegistryHandle();
+
+		for (entt::entity handle : m_PendingRigidBodies2D)
+		{
+			// The entity (or its body) might have been removed after it was queued
+			if (!registry.valid(handle) || !registry.all_of<RigidBody2DComponent>(handle))
+				continue;
+
+			Entity entity             = {handle, this};
+			RigidBody2DComponent& rbc = entity.GetComponent<RigidBody2DComponent>();
+
+			// Collider added to a baked entity - it gets its own body with all of its colliders
+			if (m_BakedStaticBody2D && rbc.Handle == m_BakedStaticBody2D)
+			{
+				UnbakeStaticCollider2D(entity);
+
+				continue;
+			}
+
+			const TransformComponent tc = entity.GetWorldSpaceTransform();
+
+			if (!rbc.Handle)
+			{
+				CreateRigidbody2D(entity, tc, rbc);
+
+				continue;
+			}
+
+			// Collider added to an existing body (entities queued twice end up here with nothing to do)
+			if (BoxCollider2DComponent* bcc = registry.try_get<BoxCollider2DComponent>(handle); bcc && !bcc->Handle)
+				CreateBoxCollider2D(entity, tc, rbc, *bcc);
+
+			if (CircleCollider2DComponent* ccc = registry.try_get<CircleCollider2DComponent>(handle);
+			    ccc && !ccc->Handle)
+				CreateCircleCollider2D(entity, tc, rbc, *ccc);
+
+			if (PolygonCollider2DComponent* pcc = registry.try_get<PolygonCollider2DComponent>(handle);
+			    pcc && !pcc->Handle)
+				CreatePolygonCollider2D(entity, rbc, *pcc);
+		}
+
+		m_PendingRigidBodies2D.clear();
+	}
+
+	void Scene::OnRigidBody2DComponentCreated(entt::registry& registry, entt::entity handle)
+	{
+		// A copied component (DuplicateEntity, prefabs) still points at the body of its source
+		registry.get<RigidBody2DComponent>(handle).Handle = nullptr;
+
+		if (!IsPlaying() || !m_PhysicsWorld2D)
+			return;
+
+		m_PendingRigidBodies2D.emplace_back(handle);
+	}
+
+	void Scene::OnRigidBody2DComponentDestroyed(entt::registry& registry, entt::entity handle)
+	{
+		if (!m_PhysicsWorld2D)
+			return;
+
+		RigidBody2DComponent& rbc = registry.get<RigidBody2DComponent>(handle);
+
+		if (!rbc.Handle)
+			return;
+
+		// Baked entity shares the body (and maybe a fixture) with other entities - move it out first
+		if (rbc.Handle == m_BakedStaticBody2D)
+		{
+			if (m_PhysicsWorld2D->IsLocked())
+			{
+				SYSTEM_WARN("Baked static collider of entity {} can not be removed inside of a physics callback!",
+				            registry.get<IDComponent>(handle).ID);
+				return;
+			}
+
+			// Only the entity's fixtures go, the body stays with the other baked entities
+			RemoveBakedStaticCollider2D({handle, this});
+
+			return;
+		}
+
+		b2Body* body = static_cast<b2Body*>(rbc.Handle);
+
+		for (b2Fixture* fixture = body->GetFixtureList(); fixture; fixture = fixture->GetNext())
+		{
+			DetachFixture2D(fixture);
+		}
+
+		m_PendingBodyDestructions2D.emplace_back(body);
+
+		// Fixtures are destroyed together with the body
+		rbc.Handle = nullptr;
+
+		if (BoxCollider2DComponent* bcc = registry.try_get<BoxCollider2DComponent>(handle))
+			bcc->Handle = nullptr;
+
+		if (CircleCollider2DComponent* ccc = registry.try_get<CircleCollider2DComponent>(handle))
+			ccc->Handle = nullptr;
+
+		if (PolygonCollider2DComponent* pcc = registry.try_get<PolygonCollider2DComponent>(handle))
+			pcc->Handle = nullptr;
+	}
+
+	template <typename T>
+	void Scene::OnCollider2DComponentCreated(entt::registry& registry, entt::entity handle)
+	{
+		registry.get<T>(handle).Handle = nullptr; // a copied component still points at the fixture of its source
+
+		if (!IsPlaying() || !m_PhysicsWorld2D || !registry.all_of<RigidBody2DComponent>(handle))
+			return;
+
+		m_PendingRigidBodies2D.emplace_back(handle);
+	}
+
+	template <typename T>
+	void Scene::OnCollider2DComponentDestroyed(entt::registry& registry, entt::entity handle)
+	{
+		if (!m_PhysicsWorld2D)
+			return;
+
+		T& collider = registry.get<T>(handle);
+
+		if (!collider.Handle)
+			return;
+
+		if (static_cast<b2Fixture*>(collider.Handle)->GetBody() == m_BakedStaticBody2D)
+		{
+			if (m_PhysicsWorld2D->IsLocked())
+			{
+				SYSTEM_WARN("Baked static collider of entity {} can not be removed inside of a physics callback!",
+				            registry.get<IDComponent>(handle).ID);
+				return;
+			}
+
+			// The remaining colliders get the entity's own body with the next batch, none if it is being destroyed
+			RemoveBakedStaticCollider2D({handle, this});
+
+			m_PendingRigidBodies2D.emplace_back(handle);
+
+			return;
+		}
+
+		b2Fixture* fixture = static_cast<b2Fixture*>(collider.Handle);
+
+		DetachFixture2D(fixture);
+
+		m_PendingFixtureDestructions2D.emplace_back(fixture);
+
+		collider.Handle = nullptr;
+	}
+
+	template <typename T>
+	void Scene::OnAssetComponentChanged(entt::registry& registry, entt::entity handle)
+	{
+		AssetReferenceTracker& references = std::is_same_v<T, SpriteComponent> ? m_SpriteReferences : m_FontReferences;
+
+		references.Set((u32)handle, registry.get<T>(handle).Handle);
+
+		if constexpr (std::is_same_v<T, TextComponent>)
+			m_TextLayouts.erase(handle);
+	}
+
+	template <typename T>
+	void Scene::OnAssetComponentDestroyed(entt::registry& /*registry*/, entt::entity handle)
+	{
+		AssetReferenceTracker& references = std::is_same_v<T, SpriteComponent> ? m_SpriteReferences : m_FontReferences;
+
+		references.Remove((u32)handle);
+
+		if constexpr (std::is_same_v<T, TextComponent>)
+			m_TextLayouts.erase(handle);
+	}
 
 } // namespace SW
@@ -1,7 +1,7 @@
 /**
  * @file Scene.hpp
  * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
- * @version 0.2.0
+ * @version 0.2.5
  * @date 2024-04-13
  *
  * @copyright Copyright (c) 2024 Tycjan Fortuna
@@ -9,12 +9,20 @@
 #pragma once
 
 #include "Asset/Asset.hpp"
+#include "Asset/AssetReferenceTracker.hpp"
 #include "Core/ECS/Components.hpp"
 #include "Core/ECS/EntityRegistry.hpp"
+#include "Core/Physics/BreakableJoints2D.hpp"
+#include "Core/Physics/Physics2DStatistics.hpp"
+#include "Core/Physics/PhysicsQueries2D.hpp"
+#include "Core/Physics/StaticColliderBaker2D.hpp"
+#include "Core/Renderer/TextLayout.hpp"
 #include "Core/Scripting/ScriptStorage.hpp"
 #include "Core/Timestep.hpp"
 #include <queue>
 
+class b2Body;
+class b2Fixture;
 class b2World;
 
 namespace SW
@@ -76,6 +84,14 @@ namespace SW
 		 */
 		Entity CreateEntityWithID(u64 id, const std::string& tag = "Entity");
 
+		/**
+		 * @brief Creates entities in bulk, each with the required components (ID, tag, transform, relationship).
+		 * @param ids The ids to assign to the entities.
+		 * @param count The number of entities to create.
+		 * @param outHandles The created entity handles (in order of ids).
+		 */
+		void CreateEntitiesWithIDs(const u64* ids, u32 count, std::vector<entt::entity>& outHandles);
+
 		/**
 		 * @brief Destroys the specified entity in the scene.
 		 * @param entity The entity to destroy.
@@ -117,6 +133,13 @@ namespace SW
 		 */
 		void OnUpdateRuntime(Timestep dt);
 
+		/**
+		 * @brief Steps the 2D physics world with the fixed substeps owed for the timestep and writes the bodies
+		 * 		  back into the transforms. Called by OnUpdateRuntime() while the scene is not paused.
+		 * @param dt The timestep since the last update.
+		 */
+		void OnUpdatePhysics2D(Timestep dt);
+
 		/**
 		 * @brief Handles viewport resize events.
 		 * @param width The new width of the viewport.
@@ -286,11 +309,152 @@ namespace SW
 
 		const ScriptStorage& GetScriptStorageC() const { return m_ScriptStorage; }
 
+		/**
+		 * @brief Gets the physics cost of the last runtime frame.
+		 *
+		 * @return The physics statistics (zeroed when the scene is not simulated).
+		 */
+		const Physics2DStatistics& GetPhysicsStatistics2D() const { return m_PhysicsStatistics2D; }
+
 		Entity InstantiatePrefab(const Prefab* prefab, const glm::vec3* position = nullptr,
 		                         const glm::vec3* rotation = nullptr, const glm::vec3* scale = nullptr);
 
 		void SortSpritesByDepth();
 
+		/**
+		 * @brief Casts a ray against the physics world and reports the closest hit.
+		 * @note Sensors are ignored. Only valid while the scene is playing.
+		 *
+		 * @param query The ray to cast.
+		 * @param outHit The closest hit (EntityID is 0 if nothing was hit).
+		 * @return Whether anything was hit.
+		 */
+		bool RayCast2D(const RayCastQuery2D& query, RayCastHit2D* outHit);
+
+		/**
+		 * @brief Casts count rays, writing one hit per query.
+		 *
+		 * @param queries The rays to cast.
+		 * @param count The number of queries.
+		 * @param outHits Caller provided buffer of at least count hits.
+		 */
+		void RayCast2DBatch(const RayCastQuery2D* queries, u32 count, RayCastHit2D* outHits);
+
+		/**
+		 * @brief Collects entities whose colliders overlap the box.
+		 * @note Sensors are ignored. Only valid while the scene is playing.
+		 *
+		 * @param query The box to test.
+		 * @param outEntityIDs Caller provided buffer for the overlapping entity IDs.
+		 * @param capacity The capacity of the buffer.
+		 * @return The number of IDs written.
+		 */
+		u32 OverlapAABB2D(const AABBQuery2D& query, u64* outEntityIDs, u32 capacity);
+
+		/**
+		 * @brief Runs count box overlaps. Query i writes to outEntityIDs[i * capacityPerQuery].
+		 *
+		 * @param queries The boxes to test.
+		 * @param count The number of queries.
+		 * @param outEntityIDs Caller provided buffer of at least count * capacityPerQuery IDs.
+		 * @param capacityPerQuery The number of IDs reserved per query.
+		 * @param outCounts Caller provided buffer of at least count entries, receives the number of IDs per query.
+		 */
+		void OverlapAABB2DBatch(const AABBQuery2D* queries, u32 count, u64* outEntityIDs, u32 capacityPerQuery,
+		                        u32* outCounts);
+
+		/**
+		 * @brief Collects entities whose colliders overlap the circle.
+		 * @note Sensors are ignored. Only valid while the scene is playing.
+		 *
+		 * @param query The circle to test.
+		 * @param outEntityIDs Caller provided buffer for the overlapping entity IDs.
+		 * @param capacity The capacity of the buffer.
+		 * @return The number of IDs written.
+		 */
+		u32 OverlapCircle2D(const CircleQuery2D& query, u64* outEntityIDs, u32 capacity);
+
+		/**
+		 * @brief Runs count circle overlaps. Query i writes to outEntityIDs[i * capacityPerQuery].
+		 *
+		 * @param queries The circles to test.
+		 * @param count The number of queries.
+		 * @param outEntityIDs Caller provided buffer of at least count * capacityPerQuery IDs.
+		 * @param capacityPerQuery The number of IDs reserved per query.
+		 * @param outCounts Caller provided buffer of at least count entries, receives the number of IDs per query.
+		 */
+		void OverlapCircle2DBatch(const CircleQuery2D* queries, u32 count, u64* outEntityIDs, u32 capacityPerQuery,
+		                          u32* outCounts);
+
+		/**
+		 * @brief Sweeps a circle or box through the physics world and reports the first hit.
+		 * @note Sensors are ignored. Only valid while the scene is playing.
+		 *
+		 * @param query The shape and sweep to cast.
+		 * @param outHit The first hit (EntityID is 0 if nothing was hit).
+		 * @return Whether anything was hit.
+		 */
+		bool ShapeCast2D(const ShapeCastQuery2D& query, RayCastHit2D* outHit);
+
+		/**
+		 * @brief Sweeps count shapes, writing one hit per query.
+		 *
+		 * @param queries The shapes to cast.
+		 * @param count The number of queries.
+		 * @param outHits Caller provided buffer of at least count hits.
+		 */
+		void ShapeCast2DBatch(const ShapeCastQuery2D* queries, u32 count, RayCastHit2D* outHits);
+
+		/**
+		 * @brief Creates the queued rigidbodies and colliders and destroys the queued ones in one batch.
+		 * 		  Called before every physics substep, scripts accessing a body added in the same frame flush earlier.
+		 * @note Does nothing while the physics world is locked (inside of the physics step callbacks).
+		 */
+		void FlushPhysicsCommands2D();
+
+		/**
+		 * @brief Resolves the entity owning a physics fixture.
+		 * 		  Baked static fixtures are shared by several entities - the source under the point is returned.
+		 *
+		 * @param userData The user data of the fixture.
+		 * @param point The world point of the contact or hit.
+		 * @return The entity owning the fixture.
+		 */
+		Entity GetPhysicsEntity2D(u64 userData, glm::vec2 point);
+
+		/**
+		 * @brief Gets the source boxes a baked static fixture was merged from.
+		 *
+		 * @param userData The user data of the fixture.
+		 * @param outCount The number of source boxes (0 for fixtures which are not baked).
+		 * @return The source boxes or nullptr for fixtures which are not baked.
+		 */
+		const StaticBox2D* GetBakedStaticSources2D(u64 userData, u32* outCount) const;
+
+		/**
+		 * @brief Computes what the static collider bake would produce for the current state of the scene.
+		 * @note Does not require the physics world, used by the editor to preview the bake. Nothing is stored - the
+		 * 		 bake runs at runtime start from the current colliders, so no edit can leave an outdated bake behind.
+		 *
+		 * @return The bake result.
+		 */
+		StaticColliderBakeInfo2D PreviewStaticColliderBake2D();
+
+		/**
+		 * @brief Gets the result of the static collider bake done at runtime start.
+		 *
+		 * @return The bake result (zeroed when the scene is not simulated).
+		 */
+		const StaticColliderBakeInfo2D& GetStaticColliderBake2D() const { return m_StaticColliderBakeInfo2D; }
+
+		/**
+		 * @brief Moves the entity's colliders out of the baked static body into its own body.
+		 * 		  Must be called before a baked entity is moved. Does nothing if the entity is not baked.
+		 *
+		 * @param entity The entity to unbake.
+		 */
+		void UnbakeStaticCollider2D(Entity entity);
+
 	private:
 		Entity CreatePrefabricatedEntity(Entity src, std::unordered_map<u64, Entity>& duplicatedEntities,
 		                                 const glm::vec3* position = nullptr, const glm::vec3* rotation = nullptr,
@@ -320,8 +484,28 @@ namespace SW
 		u32 m_PositionIterations      = 3;    /**< The number of position iterations for the physics simulation. */
 		f32 m_PhysicsFrameAccumulator = 0.0f; /**< The frame accumulator for the physics simulation. */
 
+		BreakableJoints2D m_BreakableJoints2D;           /**< Joints with finite breaking thresholds. */
+		std::vector<BrokenJoint2D> m_BrokenJoints2D = {}; /**< Joints broken in the current substep. (scratch) */
+
+		Physics2DStatistics m_PhysicsStatistics2D; /**< The physics cost of the last runtime frame. */
+
+		std::vector<entt::entity> m_PendingRigidBodies2D       = {}; /**< Entities with bodies / colliders to create. */
+		std::vector<b2Body*> m_PendingBodyDestructions2D       = {}; /**< Detached bodies to destroy. */
+		std::vector<b2Fixture*> m_PendingFixtureDestructions2D = {}; /**< Detached fixtures to destroy. */
+
+		b2Body* m_BakedStaticBody2D = nullptr; /**< Static body holding all baked static colliders. */
+
+		std::vector<StaticBox2D> m_BakedStaticSources2D;     /**< Source boxes of the baked boxes. */
+		std::vector<BakedStaticBox2D> m_BakedStaticBoxes2D;  /**< Baked boxes (merged fixture user data index). */
+		StaticColliderBakeInfo2D m_StaticColliderBakeInfo2D; /**< The result of the runtime bake. */
+
 		ScriptStorage m_ScriptStorage; /**< The script storage of the scene. */
 
+		AssetReferenceTracker m_SpriteReferences; /**< Sprites referenced by the sprite components. */
+		AssetReferenceTracker m_FontReferences;   /**< Fonts referenced by the text components. */
+
+		std::unordered_map<entt::entity, TextLayout> m_TextLayouts; /**< Retained layouts of the text components. */
+
 		f32 m_AnimationTime = 0.f; /**< The time elapsed since the last frame. Used for proper 2D animation display. */
 
 		/**
@@ -405,14 +589,109 @@ namespace SW
 		 */
 		void CreateWheelJoint2D(const RigidBody2DComponent& rbc, WheelJoint2DComponent& wjc);
 
+		/**
+		 * @brief Collects the static colliders which can be baked.
+		 * 		  Candidates are non sensor box and polygon colliders of static bodies. Entities with scripts,
+		 * 		  circle colliders, buoyancy effectors or joints (owned or referencing them) are skipped.
+		 *
+		 * @param outBoxes Axis aligned boxes (candidates for merging).
+		 * @param outOthers Entities with rotated boxes or polygons (attached to the baked body as they are).
+		 */
+		void GatherStaticColliders2D(std::vector<StaticBox2D>& outBoxes, std::vector<Entity>& outOthers);
+
+		/**
+		 * @brief Bakes the static colliders into a single static body before the rigidbodies are created.
+		 * 		  Touching axis aligned boxes are merged, the remaining colliders are attached as they are.
+		 */
+		void BakeStaticColliders2D();
+
+		/**
+		 * @brief Attaches an individual box fixture for the source box to the baked body.
+		 *
+		 * @param source The source box.
+		 */
+		void CreateBakedStaticBox2D(const StaticBox2D& source);
+
+		/**
+		 * @brief Destroys the entity's fixtures on the baked static body and clears its physics handles.
+		 * 		  The other sources of a merged box get their own boxes back, the entity is left without a body.
+		 *
+		 * @param entity The baked entity.
+		 */
+		void RemoveBakedStaticCollider2D(Entity entity);
+
+		/**
+		 * @brief Checks the breakable joints after a physics substep.
+		 * 		  Broken joints are destroyed and the owning entity's script receives OnJoint2DBreak event.
+		 *
+		 * @param invDt The inverse of the physics step time.
+		 */
+		void BreakJoints2D(f32 invDt);
+
 		/**
 		 * @brief Function bound to the event of creating a rigidbody2D component.
-		 * 		  Used to register the rigidbody2D component in the physics world at runtime.
+		 * 		  Drops the handle copied from another entity and queues the body to be created in the physics
+		 * 		  world with the next batch (runtime only).
 		 *
 		 * @param registry The registry of the scene.
 		 * @param handle The entity handle of the entity with the rigidbody2D component.
 		 */
-		// void OnRigidBody2DComponentCreated(entt::registry& registry, entt::entity handle);
+		void OnRigidBody2DComponentCreated(entt::registry& registry, entt::entity handle);
+
+		/**
+		 * @brief Function bound to the event of destroying a rigidbody2D component.
+		 * 		  Detaches the body from the simulation and queues it to be destroyed with the next batch.
+		 *
+		 * @param registry The registry of the scene.
+		 * @param handle The entity handle of the entity with the rigidbody2D component.
+		 */
+		void OnRigidBody2DComponentDestroyed(entt::registry& registry, entt::entity handle);
+
+		/**
+		 * @brief Function bound to the event of creating a collider component.
+		 * 		  Drops the handle copied from another entity and queues the fixture to be created with the next
+		 * 		  batch (runtime only).
+		 *
+		 * @tparam T The type of the collider component.
+		 * @param registry The registry of the scene.
+		 * @param handle The entity handle of the entity with the collider component.
+		 */
+		template <typename T>
+		void OnCollider2DComponentCreated(entt::registry& registry, entt::entity handle);
+
+		/**
+		 * @brief Function bound to the event of destroying a collider component.
+		 * 		  Detaches the fixture from the simulation and queues it to be destroyed with the next batch.
+		 *
+		 * @tparam T The type of the collider component.
+		 * @param registry The registry of the scene.
+		 * @param handle The entity handle of the entity with the collider component.
+		 */
+		template <typename T>
+		void OnCollider2DComponentDestroyed(entt::registry& registry, entt::entity handle);
+
+		/**
+		 * @brief Function bound to the events of creating and patching a component holding an asset handle.
+		 * 		  Moves the entity's asset reference to the current handle and drops the retained text layout.
+		 * @note Handles assigned in place are picked up by the render loops, text layouts compare their inputs.
+		 *
+		 * @tparam T The type of the component (SpriteComponent or TextComponent).
+		 * @param registry The registry of the scene.
+		 * @param handle The entity handle of the entity with the component.
+		 */
+		template <typename T>
+		void OnAssetComponentChanged(entt::registry& registry, entt::entity handle);
+
+		/**
+		 * @brief Function bound to the event of destroying a component holding an asset handle.
+		 * 		  Releases the entity's asset reference and drops the retained text layout.
+		 *
+		 * @tparam T The type of the component (SpriteComponent or TextComponent).
+		 * @param registry The registry of the scene.
+		 * @param handle The entity handle of the entity with the component.
+		 */
+		template <typename T>
+		void OnAssetComponentDestroyed(entt::registry& registry, entt::entity handle);
 	};
 
 } // namespace SW
@@ -0,0 +1,1374 @@
+#include "SceneBinarySerializer.hpp"
+
+#include <entt.hpp>
+#include <span>
+
+#include "Asset/AssetManager.hpp"
+#include "Core/ECS/Components.hpp"
+#include "Core/Scene/Scene.hpp"
+#include "Core/Scene/SceneDependencies.hpp"
+#include "Core/Scene/SceneSerializer.hpp"
+#include "Core/Scripting/ScriptingCore.hpp"
+#include "Core/Utils/MappedFile.hpp"
+
+namespace SW
+{
+
+	/**
+	 * @brief Type of a section. Values are part of the file format - append only!
+	 */
+	enum class SceneSection : u32
+	{
+		Strings = 0,         /**< u32 offsets[count + 1] followed by the characters. */
+		EntityIDs,           /**< u64 per entity. */
+		EntityTags,          /**< u32 string index per entity. */
+		Transforms,          /**< TransformRecord per entity. */
+		Parents,             /**< u64 parent ID per entity. */
+		ChildRanges,         /**< RangeRecord into Children per entity. */
+		Children,            /**< u64 child IDs pool. */
+		Sprites,             /**< SpriteRecord. */
+		AnimatedSprites,     /**< AnimatedSpriteRecord. */
+		Animations,          /**< AnimationRecord pool. */
+		Circles,             /**< CircleRecord. */
+		Texts,               /**< TextRecord. */
+		Scripts,             /**< ScriptRecord. */
+		ScriptFields,        /**< ScriptFieldRecord pool. */
+		Cameras,             /**< CameraRecord. */
+		RigidBodies2D,       /**< RigidBody2DRecord. */
+		BoxColliders2D,      /**< BoxCollider2DRecord. */
+		CircleColliders2D,   /**< CircleCollider2DRecord. */
+		PolygonColliders2D,  /**< PolygonCollider2DRecord. */
+		PolygonVertices2D,   /**< glm::vec2 pool. */
+		BuoyancyEffectors2D, /**< BuoyancyEffector2DRecord. */
+		DistanceJoints2D,    /**< DistanceJoint2DRecord. */
+		RevolutionJoints2D,  /**< RevolutionJoint2DRecord. */
+		PrismaticJoints2D,   /**< PrismaticJoint2DRecord. */
+		SpringJoints2D,      /**< SpringJoint2DRecord. */
+		WheelJoints2D,       /**< WheelJoint2DRecord. */
+		AudioSources,        /**< AudioSourceRecord. */
+		AudioListeners,      /**< u32 entity index per listener (no data). */
+		Dependencies,        /**< AssetHandle per dependency of the scene, see SceneDependencies. */
+
+		Count
+	};
+
+	struct SceneBinaryHeader
+	{
+		u32 Magic;
+		u32 Version;
+		u32 EntityCount;
+		u32 SectionCount;
+		u64 SectionTableOffset;
+	};
+
+	struct SceneSectionEntry
+	{
+		u32 Type;   /**< The SceneSection. */
+		u32 Count;  /**< Number of elements (records) in the section. */
+		u64 Offset; /**< Offset of the section from the beginning of the file. */
+		u64 Size;   /**< Size of the section in bytes. */
+	};
+
+	/**
+	 * @note Records are written as raw bytes - they have explicit padding so no byte of the file is indeterminate.
+	 */
+
+	struct TransformRecord
+	{
+		glm::vec3 Position;
+		glm::vec3 Rotation;
+		glm::vec3 Scale;
+	};
+
+	struct RangeRecord
+	{
+		u32 First;
+		u32 Count;
+	};
+
+	struct SpriteRecord
+	{
+		u64 Handle;
+		glm::vec4 Color;
+		f32 TilingFactor;
+		i32 ZIndex;
+	};
+
+	struct AnimatedSpriteRecord
+	{
+		u64 CurrentAnimation;
+		u64 DefaultAnimation;
+		i32 CurrentFrame;
+		RangeRecord Animations;
+		u32 Padding;
+	};
+
+	struct AnimationRecord
+	{
+		u64 Handle;
+		u32 Name;
+		u32 Padding;
+	};
+
+	struct CircleRecord
+	{
+		glm::vec4 Color;
+		f32 Thickness;
+		f32 Fade;
+	};
+
+	struct TextRecord
+	{
+		u64 Font;
+		glm::vec4 Color;
+		u32 Text;
+		f32 Kerning;
+		f32 LineSpacing;
+		u32 Padding;
+	};
+
+	struct ScriptRecord
+	{
+		u64 ScriptID;
+		RangeRecord Fields;
+	};
+
+	struct ScriptFieldRecord
+	{
+		u64 Value; /**< Bits of the value, the type decides how many of them are used. */
+		u32 ID;
+		u32 Type;
+	};
+
+	struct CameraRecord
+	{
+		f32 AspectRatio;
+		f32 OrthographicSize;
+		f32 OrthographicNear;
+		f32 OrthographicFar;
+		f32 PerspectiveFOV;
+		f32 PerspectiveNear;
+		f32 PerspectiveFar;
+		u8 ProjectionType;
+		u8 Primary;
+		u8 Padding[2];
+	};
+
+	struct RigidBody2DRecord
+	{
+		f32 GravityScale;
+		f32 Mass;
+		f32 Friction;
+		f32 Restitution;
+		f32 RestitutionThreshold;
+		f32 LinearDamping;
+		f32 AngularDamping;
+		u16 CollisionLayer;
+		u16 CollisionMask;
+		u8 Type;
+		u8 AutoMass;
+		u8 AllowSleep;
+		u8 InitiallyAwake;
+		u8 FixedRotation;
+		u8 IsBullet;
+		u8 Padding[2];
+	};
+
+	struct BoxCollider2DRecord
+	{
+		glm::vec2 Size;
+		glm::vec2 Offset;
+		f32 Density;
+		u8 IsSensor;
+		u8 Padding[3];
+	};
+
+	struct CircleCollider2DRecord
+	{
+		glm::vec2 Offset;
+		f32 Radius;
+		f32 Density;
+		u8 IsSensor;
+		u8 Padding[3];
+	};
+
+	struct PolygonCollider2DRecord
+	{
+		glm::vec2 Offset;
+		f32 Density;
+		RangeRecord Vertices;
+		u8 IsSensor;
+		u8 Padding[3];
+	};
+
+	struct BuoyancyEffector2DRecord
+	{
+		f32 Density;
+		f32 DragMultiplier;
+		f32 FlowMagnitude;
+		f32 FlowAngle;
+	};
+
+	struct DistanceJoint2DRecord
+	{
+		u64 ConnectedEntityID;
+		glm::vec2 OriginAnchor;
+		glm::vec2 ConnectedAnchor;
+		f32 Length;
+		f32 MinLength;
+		f32 MaxLength;
+		f32 BreakingForce;
+		u8 EnableCollision;
+		u8 AutoLength;
+		u8 Padding[6];
+	};
+
+	struct RevolutionJoint2DRecord
+	{
+		u64 ConnectedEntityID;
+		glm::vec2 OriginAnchor;
+		f32 LowerAngle;
+		f32 UpperAngle;
+		f32 MotorSpeed;
+		f32 MaxMotorTorque;
+		f32 BreakingForce;
+		f32 BreakingTorque;
+		u8 EnableLimit;
+		u8 EnableMotor;
+		u8 EnableCollision;
+		u8 Padding[5];
+	};
+
+	struct PrismaticJoint2DRecord
+	{
+		u64 ConnectedEntityID;
+		glm::vec2 OriginAnchor;
+		f32 Angle;
+		f32 LowerTranslation;
+		f32 UpperTranslation;
+		f32 MotorSpeed;
+		f32 MaxMotorForce;
+		f32 BreakingForce;
+		f32 BreakingTorque;
+		u8 EnableLimit;
+		u8 EnableMotor;
+		u8 EnableCollision;
+		u8 Padding[1];
+	};
+
+	struct SpringJoint2DRecord
+	{
+		u64 ConnectedEntityID;
+		glm::vec2 OriginAnchor;
+		glm::vec2 ConnectedAnchor;
+		f32 Length;
+		f32 MinLength;
+		f32 MaxLength;
+		f32 BreakingForce;
+		f32 Frequency;
+		f32 DampingRatio;
+		u8 EnableCollision;
+		u8 AutoLength;
+		u8 Padding[6];
+	};
+
+	struct WheelJoint2DRecord
+	{
+		u64 ConnectedEntityID;
+		glm::vec2 OriginAnchor;
+		f32 Frequency;
+		f32 DampingRatio;
+		f32 LowerTranslation;
+		f32 UpperTranslation;
+		f32 MotorSpeed;
+		f32 MaxMotorTorque;
+		f32 BreakingForce;
+		f32 BreakingTorque;
+		u8 EnableLimit;
+		u8 EnableMotor;
+		u8 EnableCollision;
+		u8 Padding[5];
+	};
+
+	struct AudioSourceRecord
+	{
+		u64 Handle;
+		f32 Volume;
+		f32 Pitch;
+		f32 RollOff;
+		f32 MinGain;
+		f32 MaxGain;
+		f32 MinDistance;
+		f32 MaxDistance;
+		f32 DopplerFactor;
+		u8 Looping;
+		u8 PlayOnCreate;
+		u8 Is3D;
+		u8 Attenuation;
+		u8 Padding[4];
+	};
+
+	static_assert(sizeof(SceneBinaryHeader) == 24);
+	static_assert(sizeof(SceneSectionEntry) == 24);
+	static_assert(sizeof(TransformRecord) == 36);
+	static_assert(sizeof(SpriteRecord) == 32);
+	static_assert(sizeof(AnimatedSpriteRecord) == 32);
+	static_assert(sizeof(AnimationRecord) == 16);
+	static_assert(sizeof(CircleRecord) == 24);
+	static_assert(sizeof(TextRecord) == 40);
+	static_assert(sizeof(ScriptRecord) == 16);
+	static_assert(sizeof(ScriptFieldRecord) == 16);
+	static_assert(sizeof(CameraRecord) == 32);
+	static_assert(sizeof(RigidBody2DRecord) == 40);
+	static_assert(sizeof(BoxCollider2DRecord) == 24);
+	static_assert(sizeof(CircleCollider2DRecord) == 20);
+	static_assert(sizeof(PolygonCollider2DRecord) == 24);
+	static_assert(sizeof(BuoyancyEffector2DRecord) == 16);
+	static_assert(sizeof(DistanceJoint2DRecord) == 48);
+	static_assert(sizeof(RevolutionJoint2DRecord) == 48);
+	static_assert(sizeof(PrismaticJoint2DRecord) == 48);
+	static_assert(sizeof(SpringJoint2DRecord) == 56);
+	static_assert(sizeof(WheelJoint2DRecord) == 56);
+	static_assert(sizeof(AudioSourceRecord) == 48);
+
+	static constexpr u64 s_SectionAlignment = 8;
+
+	static u64 AlignSection(u64 offset)
+	{
+		return (offset + s_SectionAlignment - 1) & ~(s_SectionAlignment - 1);
+	}
+
+	template <typename T>
+	static std::span<const T> GetPoolRange(std::span<const T> pool, RangeRecord range)
+	{
+		if (range.First > pool.size() || range.Count > pool.size() - range.First)
+			return {};
+
+		return pool.subspan(range.First, range.Count);
+	}
+
+	/**
+	 * @brief Accumulates the sections in memory and writes the whole file at once.
+	 */
+	class SceneBinaryWriter final
+	{
+	public:
+		SceneBinaryWriter() { m_Buffer.resize(sizeof(SceneBinaryHeader)); }
+
+		u32 AddString(const std::string& string)
+		{
+			auto [it, inserted] = m_StringIndices.try_emplace(string, (u32)m_Strings.size());
+
+			if (inserted)
+				m_Strings.emplace_back(&it->first);
+
+			return it->second;
+		}
+
+		template <typename T>
+		void WriteColumn(SceneSection type, const std::vector<T>& column)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+
+			if (column.empty())
+				return;
+
+			const u64 offset = BeginSection();
+
+			Append(column.data(), column.size() * sizeof(T));
+
+			EndSection(type, (u32)column.size(), offset);
+		}
+
+		template <typename Record>
+		void WriteComponentSection(SceneSection type, const std::vector<u32>& entities,
+		                           const std::vector<Record>& records)
+		{
+			static_assert(std::is_trivially_copyable_v<Record>);
+
+			if (entities.empty())
+				return;
+
+			const u64 offset = BeginSection();
+
+			Append(entities.data(), entities.size() * sizeof(u32));
+			m_Buffer.resize(AlignSection(m_Buffer.size()), 0);
+			Append(records.data(), records.size() * sizeof(Record));
+
+			EndSection(type, (u32)entities.size(), offset);
+		}
+
+		bool WriteToFile(const std::filesystem::path& path, u32 entityCount)
+		{
+			WriteStrings();
+
+			const u64 tableOffset = AlignSection(m_Buffer.size());
+
+			m_Buffer.resize(tableOffset, 0);
+			Append(m_Sections.data(), m_Sections.size() * sizeof(SceneSectionEntry));
+
+			const SceneBinaryHeader header = {SceneBinarySerializer::Magic, SceneBinarySerializer::Version,
+			                                  entityCount, (u32)m_Sections.size(), tableOffset};
+
+			std::memcpy(m_Buffer.data(), &header, sizeof(SceneBinaryHeader));
+
+			// A failed or interrupted write must not leave a truncated scene behind - the file is replaced in one step
+			std::filesystem::path temporaryPath = path;
+			temporaryPath += ".tmp";
+
+			{
+				std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+
+				if (!file)
+					return false;
+
+				file.write(reinterpret_cast<const char*>(m_Buffer.data()), (std::streamsize)m_Buffer.size());
+
+				if (!file)
+				{
+					file.close();
+					std::filesystem::remove(temporaryPath);
+
+					return false;
+				}
+			}
+
+			std::error_code error;
+			std::filesystem::rename(temporaryPath, path, error);
+
+			if (error)
+			{
+				SYSTEM_WARN("Failed to replace the binary scene {}: {}", path, error.message());
+
+				std::filesystem::remove(temporaryPath, error);
+
+				return false;
+			}
+
+			return true;
+		}
+
+	private:
+		std::vector<u8> m_Buffer;
+		std::vector<SceneSectionEntry> m_Sections;
+
+		std::vector<const std::string*> m_Strings;
+		std::unordered_map<std::string, u32> m_StringIndices;
+
+		u64 BeginSection()
+		{
+			m_Buffer.resize(AlignSection(m_Buffer.size()), 0);
+
+			return m_Buffer.size();
+		}
+
+		void EndSection(SceneSection type, u32 count, u64 offset)
+		{
+			m_Sections.push_back({(u32)type, count, offset, m_Buffer.size() - offset});
+		}
+
+		void Append(const void* data, u64 size)
+		{
+			const u8* bytes = static_cast<const u8*>(data);
+
+			m_Buffer.insert(m_Buffer.end(), bytes, bytes + size);
+		}
+
+		void WriteStrings()
+		{
+			if (m_Strings.empty())
+				return;
+
+			std::vector<u32> offsets;
+			offsets.reserve(m_Strings.size() + 1);
+
+			u32 characters = 0;
+
+			for (const std::string* string : m_Strings)
+			{
+				offsets.emplace_back(characters);
+				characters += (u32)string->size();
+			}
+
+			offsets.emplace_back(characters);
+
+			const u64 offset = BeginSection();
+
+			Append(offsets.data(), offsets.size() * sizeof(u32));
+
+			for (const std::string* string : m_Strings)
+			{
+				Append(string->data(), string->size());
+			}
+
+			EndSection(SceneSection::Strings, (u32)m_Strings.size(), offset);
+		}
+	};
+
+	/**
+	 * @brief Validated view of a mapped binary scene.
+	 */
+	class SceneBinaryReader final
+	{
+	public:
+		bool Open(const std::filesystem::path& path)
+		{
+			if (!m_File.Open(path))
+				return false;
+
+			return Open(m_File.GetData(), m_File.GetSize());
+		}
+
+		bool Open(const u8* data, u64 size)
+		{
+			m_Data = data;
+
+			if (!data || size < sizeof(SceneBinaryHeader))
+				return false;
+
+			std::memcpy(&m_Header, data, sizeof(SceneBinaryHeader));
+
+			if (m_Header.Magic != SceneBinarySerializer::Magic)
+			{
+				SYSTEM_ERROR("Data is not a binary scene!");
+				return false;
+			}
+
+			if (m_Header.Version != SceneBinarySerializer::Version)
+			{
+				SYSTEM_ERROR("Binary scene has version {}, expected {}. Convert the scene again.", m_Header.Version,
+				             SceneBinarySerializer::Version);
+				return false;
+			}
+
+			const u64 tableSize = (u64)m_Header.SectionCount * sizeof(SceneSectionEntry);
+
+			if (m_Header.SectionTableOffset % s_SectionAlignment != 0 || m_Header.SectionTableOffset > size ||
+			    tableSize > size - m_Header.SectionTableOffset)
+				return false;
+
+			const SceneSectionEntry* table =
+			    reinterpret_cast<const SceneSectionEntry*>(data + m_Header.SectionTableOffset);
+
+			for (u32 i = 0; i < m_Header.SectionCount; i++)
+			{
+				const SceneSectionEntry& entry = table[i];
+
+				if (entry.Type >= (u32)SceneSection::Count)
+					continue; // written by a newer tool, not known here
+
+				if (entry.Offset % s_SectionAlignment != 0 || entry.Offset > size || entry.Size > size - entry.Offset)
+				{
+					SYSTEM_ERROR("Binary scene is corrupted (section {} out of bounds)!", entry.Type);
+					return false;
+				}
+
+				m_Sections[entry.Type] = &entry;
+			}
+
+			return ReadStrings();
+		}
+
+		u32 GetEntityCount() const { return m_Header.EntityCount; }
+
+		template <typename T>
+		std::span<const T> GetColumn(SceneSection type) const
+		{
+			const SceneSectionEntry* entry = m_Sections[(u32)type];
+
+			if (!entry)
+				return {};
+
+			if (entry->Size != (u64)entry->Count * sizeof(T))
+			{
+				SYSTEM_ERROR("Binary scene section {} has invalid size, skipped.", (u32)type);
+				return {};
+			}
+
+			return {reinterpret_cast<const T*>(m_Data + entry->Offset), entry->Count};
+		}
+
+		template <typename Record>
+		bool GetComponents(SceneSection type, std::span<const u32>& entities, std::span<const Record>& records) const
+		{
+			const SceneSectionEntry* entry = m_Sections[(u32)type];
+
+			if (!entry)
+				return false;
+
+			const u64 recordsOffset = AlignSection((u64)entry->Count * sizeof(u32));
+
+			if (entry->Size != recordsOffset + (u64)entry->Count * sizeof(Record))
+			{
+				SYSTEM_ERROR("Binary scene section {} has invalid size, skipped.", (u32)type);
+				return false;
+			}
+
+			const u8* section = m_Data + entry->Offset;
+
+			entities = {reinterpret_cast<const u32*>(section), entry->Count};
+			records  = {reinterpret_cast<const Record*>(section + recordsOffset), entry->Count};
+
+			return true;
+		}
+
+		std::string_view GetString(u32 index) const
+		{
+			if (index >= m_StringCount)
+				return {};
+
+			return {m_Characters + m_StringOffsets[index], m_StringOffsets[index + 1] - m_StringOffsets[index]};
+		}
+
+	private:
+		MappedFile m_File;
+
+		const u8* m_Data = nullptr;
+
+		SceneBinaryHeader m_Header = {};
+
+		std::array<const SceneSectionEntry*, (u32)SceneSection::Count> m_Sections = {};
+
+		const u32* m_StringOffsets = nullptr;
+		const char* m_Characters   = nullptr;
+		u32 m_StringCount          = 0;
+
+		bool ReadStrings()
+		{
+			const SceneSectionEntry* entry = m_Sections[(u32)SceneSection::Strings];
+
+			if (!entry)
+				return true;
+
+			const u64 offsetsSize = ((u64)entry->Count + 1) * sizeof(u32);
+
+			if (entry->Size < offsetsSize)
+				return false;
+
+			const u8* section = m_Data + entry->Offset;
+
+			m_StringOffsets = reinterpret_cast<const u32*>(section);
+			m_Characters    = reinterpret_cast<const char*>(section + offsetsSize);
+			m_StringCount   = entry->Count;
+
+			for (u32 i = 0; i < m_StringCount; i++)
+			{
+				if (m_StringOffsets[i] > m_StringOffsets[i + 1])
+					return false;
+			}
+
+			return m_StringOffsets[m_StringCount] <= entry->Size - offsetsSize;
+		}
+	};
+
+	template <typename Component, typename Record, typename Func>
+	static void WriteComponents(SceneBinaryWriter& writer, SceneSection type, entt::registry& registry,
+	                            const std::vector<entt::entity>& entities, Func&& toRecord)
+	{
+		std::vector<u32> indices;
+		std::vector<Record> records;
+
+		for (u32 i = 0; i < (u32)entities.size(); i++)
+		{
+			if (const Component* component = registry.try_get<Component>(entities[i]))
+			{
+				Record record = {};
+				toRecord(*component, record);
+
+				indices.emplace_back(i);
+				records.emplace_back(record);
+			}
+		}
+
+		writer.WriteComponentSection(type, indices, records);
+	}
+
+	template <typename Component, typename Record, typename Func>
+	static void ReadComponents(const SceneBinaryReader& reader, SceneSection type, entt::registry& registry,
+	                           const std::vector<entt::entity>& handles, Func&& fromRecord)
+	{
+		std::span<const u32> indices;
+		std::span<const Record> records;
+
+		if (!reader.GetComponents(type, indices, records))
+			return;
+
+		std::vector<entt::entity> targets;
+		std::vector<Component> components;
+
+		targets.reserve(indices.size());
+		components.reserve(indices.size());
+
+		for (size_t i = 0; i < indices.size(); i++)
+		{
+			if (indices[i] >= handles.size())
+			{
+				SYSTEM_ERROR("Binary scene section {} references invalid entity {}, skipped.", (u32)type, indices[i]);
+				continue;
+			}
+
+			targets.emplace_back(handles[indices[i]]);
+			fromRecord(records[i], components.emplace_back(), indices[i]);
+		}
+
+		registry.insert<Component>(targets.begin(), targets.end(), std::make_move_iterator(components.begin()));
+	}
+
+	bool SceneBinarySerializer::Serialize(Scene* scene, const std::filesystem::path& path)
+	{
+		PROFILE_FUNCTION();
+
+		entt::registry& registry = scene->GetRegistry().GetRegistryHandle();
+
+		std::map<u64, entt::entity> sortedEntities;
+
+		for (auto&& [handle, idc] : scene->GetRegistry().GetEntitiesWith<IDComponent>().each())
+			sortedEntities[idc.ID] = handle;
+
+		std::vector<entt::entity> entities;
+		std::vector<u64> ids;
+
+		entities.reserve(sortedEntities.size());
+		ids.reserve(sortedEntities.size());
+
+		for (auto [id, handle] : sortedEntities)
+		{
+			ids.emplace_back(id);
+			entities.emplace_back(handle);
+		}
+
+		SceneBinaryWriter writer;
+
+		std::vector<u32> tags(entities.size());
+		std::vector<TransformRecord> transforms(entities.size());
+		std::vector<u64> parents(entities.size());
+		std::vector<RangeRecord> childRanges(entities.size());
+		std::vector<u64> children;
+
+		for (size_t i = 0; i < entities.size(); i++)
+		{
+			const TransformComponent& tc    = registry.get<TransformComponent>(entities[i]);
+			const RelationshipComponent& rc = registry.get<RelationshipComponent>(entities[i]);
+
+			tags[i]        = writer.AddString(registry.get<TagComponent>(entities[i]).Tag);
+			transforms[i]  = {tc.Position, tc.Rotation, tc.Scale};
+			parents[i]     = rc.ParentID;
+			childRanges[i] = {(u32)children.size(), (u32)rc.ChildrenIDs.size()};
+
+			children.insert(children.end(), rc.ChildrenIDs.begin(), rc.ChildrenIDs.end());
+		}
+
+		writer.WriteColumn(SceneSection::EntityIDs, ids);
+		writer.WriteColumn(SceneSection::EntityTags, tags);
+		writer.WriteColumn(SceneSection::Transforms, transforms);
+		writer.WriteColumn(SceneSection::Parents, parents);
+		writer.WriteColumn(SceneSection::ChildRanges, childRanges);
+		writer.WriteColumn(SceneSection::Children, children);
+
+		WriteComponents<SpriteComponent, SpriteRecord>(
+		    writer, SceneSection::Sprites, registry, entities,
+		    [](const SpriteComponent& sc, SpriteRecord& record) {
+			    record = {sc.Handle, sc.Color, sc.TilingFactor, sc.ZIndex};
+		    });
+
+		std::vector<AnimationRecord> animations;
+
+		WriteComponents<AnimatedSpriteComponent, AnimatedSpriteRecord>(
+		    writer, SceneSection::AnimatedSprites, registry, entities,
+		    [&writer, &animations](const AnimatedSpriteComponent& asc, AnimatedSpriteRecord& record) {
+			    record.CurrentAnimation = asc.CurrentAnimation ? (*asc.CurrentAnimation)->GetHandle() : 0u;
+			    record.DefaultAnimation = asc.DefaultAnimation ? (*asc.DefaultAnimation)->GetHandle() : 0u;
+			    record.CurrentFrame     = asc.CurrentFrame;
+			    record.Animations       = {(u32)animations.size(), (u32)asc.Animations.size()};
+
+			    for (auto&& [id, anim] : asc.Animations)
+			    {
+				    animations.push_back({(*anim.Value)->GetHandle(), writer.AddString(anim.Name), 0});
+			    }
+		    });
+
+		writer.WriteColumn(SceneSection::Animations, animations);
+
+		WriteComponents<CircleComponent, CircleRecord>(
+		    writer, SceneSection::Circles, registry, entities,
+		    [](const CircleComponent& cc, CircleRecord& record) { record = {cc.Color, cc.Thickness, cc.Fade}; });
+
+		WriteComponents<TextComponent, TextRecord>(
+		    writer, SceneSection::Texts, registry, entities,
+		    [&writer](const TextComponent& tc, TextRecord& record) {
+			    record = {tc.Handle, tc.Color, writer.AddString(tc.TextString), tc.Kerning, tc.LineSpacing, 0};
+		    });
+
+		if (!registry.view<ScriptComponent>().empty())
+		{
+			ScriptingCore& core = ScriptingCore::Get();
+
+			const ScriptStorage& storage = scene->GetScriptStorageC();
+
+			std::vector<u32> indices;
+			std::vector<ScriptRecord> scripts;
+			std::vector<ScriptFieldRecord> scriptFields;
+
+			for (u32 i = 0; i < (u32)entities.size(); i++)
+			{
+				const ScriptComponent* sc = registry.try_get<ScriptComponent>(entities[i]);
+
+				if (!sc)
+					continue;
+
+				ScriptRecord record = {sc->ScriptID, {(u32)scriptFields.size(), 0}};
+
+				const auto it = storage.EntityStorage.find(ids[i]);
+
+				if (core.IsValidScript(sc->ScriptID) && it != storage.EntityStorage.end())
+				{
+					const auto& scriptMetadata = core.GetScriptMetadata(sc->ScriptID);
+
+					for (const auto& [fieldID, fieldStorage] : it->second.Fields)
+					{
+						if (fieldStorage.IsArray())
+							continue;
+
+						const DataType type = scriptMetadata.Fields.at(fieldID).Type;
+
+						scriptFields.push_back({GetFieldValueBits(fieldStorage, type), fieldID, (u32)type});
+					}
+				}
+
+				record.Fields.Count = (u32)scriptFields.size() - record.Fields.First;
+
+				indices.emplace_back(i);
+				scripts.emplace_back(record);
+			}
+
+			writer.WriteComponentSection(SceneSection::Scripts, indices, scripts);
+			writer.WriteColumn(SceneSection::ScriptFields, scriptFields);
+		}
+
+		WriteComponents<CameraComponent, CameraRecord>(
+		    writer, SceneSection::Cameras, registry, entities, [](const CameraComponent& cc, CameraRecord& record) {
+			    record.AspectRatio      = cc.Camera.GetAspectRatio();
+			    record.OrthographicSize = cc.Camera.GetOrthographicSize();
+			    record.OrthographicNear = cc.Camera.GetOrthographicNearClip();
+			    record.OrthographicFar  = cc.Camera.GetOrthographicFarClip();
+			    record.PerspectiveFOV   = cc.Camera.GetPerspectiveVerticalFOV();
+			    record.PerspectiveNear  = cc.Camera.GetPerspectiveNearClip();
+			    record.PerspectiveFar   = cc.Camera.GetPerspectiveFarClip();
+			    record.ProjectionType   = (u8)cc.Camera.GetProjectionType();
+			    record.Primary          = cc.Primary;
+		    });
+
+		WriteComponents<RigidBody2DComponent, RigidBody2DRecord>(
+		    writer, SceneSection::RigidBodies2D, registry, entities,
+		    [](const RigidBody2DComponent& rbc, RigidBody2DRecord& record) {
+			    record.GravityScale         = rbc.GravityScale;
+			    record.Mass                 = rbc.Mass;
+			    record.Friction             = rbc.Friction;
+			    record.Restitution          = rbc.Restitution;
+			    record.RestitutionThreshold = rbc.RestitutionThreshold;
+			    record.LinearDamping        = rbc.LinearDamping;
+			    record.AngularDamping       = rbc.AngularDamping;
+			    record.CollisionLayer       = rbc.CollisionLayer;
+			    record.CollisionMask        = rbc.CollisionMask;
+			    record.Type                 = (u8)rbc.Type;
+			    record.AutoMass             = rbc.AutoMass;
+			    record.AllowSleep           = rbc.AllowSleep;
+			    record.InitiallyAwake       = rbc.InitiallyAwake;
+			    record.FixedRotation        = rbc.FixedRotation;
+			    record.IsBullet             = rbc.IsBullet;
+		    });
+
+		WriteComponents<BoxCollider2DComponent, BoxCollider2DRecord>(
+		    writer, SceneSection::BoxColliders2D, registry, entities,
+		    [](const BoxCollider2DComponent& bcc, BoxCollider2DRecord& record) {
+			    record = {bcc.Size, bcc.Offset, bcc.Density, bcc.IsSensor, {}};
+		    });
+
+		WriteComponents<CircleCollider2DComponent, CircleCollider2DRecord>(
+		    writer, SceneSection::CircleColliders2D, registry, entities,
+		    [](const CircleCollider2DComponent& ccc, CircleCollider2DRecord& record) {
+			    record = {ccc.Offset, ccc.Radius, ccc.Density, ccc.IsSensor, {}};
+		    });
+
+		std::vector<glm::vec2> vertices;
+
+		WriteComponents<PolygonCollider2DComponent, PolygonCollider2DRecord>(
+		    writer, SceneSection::PolygonColliders2D, registry, entities,
+		    [&vertices](const PolygonCollider2DComponent& pcc, PolygonCollider2DRecord& record) {
+			    record = {pcc.Offset, pcc.Density, {(u32)vertices.size(), (u32)pcc.Vertices.size()}, pcc.IsSensor, {}};
+
+			    vertices.insert(vertices.end(), pcc.Vertices.begin(), pcc.Vertices.end());
+		    });
+
+		writer.WriteColumn(SceneSection::PolygonVertices2D, vertices);
+
+		WriteComponents<BuoyancyEffector2DComponent, BuoyancyEffector2DRecord>(
+		    writer, SceneSection::BuoyancyEffectors2D, registry, entities,
+		    [](const BuoyancyEffector2DComponent& bec, BuoyancyEffector2DRecord& record) {
+			    record = {bec.Density, bec.DragMultiplier, bec.FlowMagnitude, bec.FlowAngle};
+		    });
+
+		WriteComponents<DistanceJoint2DComponent, DistanceJoint2DRecord>(
+		    writer, SceneSection::DistanceJoints2D, registry, entities,
+		    [](const DistanceJoint2DComponent& djc, DistanceJoint2DRecord& record) {
+			    record = {djc.ConnectedEntityID, djc.OriginAnchor, djc.ConnectedAnchor, djc.Length, djc.MinLength,
+			              djc.MaxLength, djc.BreakingForce, djc.EnableCollision, djc.AutoLength, {}};
+		    });
+
+		WriteComponents<RevolutionJoint2DComponent, RevolutionJoint2DRecord>(
+		    writer, SceneSection::RevolutionJoints2D, registry, entities,
+		    [](const RevolutionJoint2DComponent& rjc, RevolutionJoint2DRecord& record) {
+			    record = {rjc.ConnectedEntityID, rjc.OriginAnchor, rjc.LowerAngle, rjc.UpperAngle, rjc.MotorSpeed,
+			              rjc.MaxMotorTorque, rjc.BreakingForce, rjc.BreakingTorque, rjc.EnableLimit, rjc.EnableMotor,
+			              rjc.EnableCollision, {}};
+		    });
+
+		WriteComponents<PrismaticJoint2DComponent, PrismaticJoint2DRecord>(
+		    writer, SceneSection::PrismaticJoints2D, registry, entities,
+		    [](const PrismaticJoint2DComponent& pjc, PrismaticJoint2DRecord& record) {
+			    record = {pjc.ConnectedEntityID, pjc.OriginAnchor, pjc.Angle, pjc.LowerTranslation,
+			              pjc.UpperTranslation, pjc.MotorSpeed, pjc.MaxMotorForce, pjc.BreakingForce,
+			              pjc.BreakingTorque, pjc.EnableLimit, pjc.EnableMotor, pjc.EnableCollision, {}};
+		    });
+
+		WriteComponents<SpringJoint2DComponent, SpringJoint2DRecord>(
+		    writer, SceneSection::SpringJoints2D, registry, entities,
+		    [](const SpringJoint2DComponent& sjc, SpringJoint2DRecord& record) {
+			    record = {sjc.ConnectedEntityID, sjc.OriginAnchor, sjc.ConnectedAnchor, sjc.Length, sjc.MinLength,
+			              sjc.MaxLength, sjc.BreakingForce, sjc.Frequency, sjc.DampingRatio, sjc.EnableCollision,
+			              sjc.AutoLength, {}};
+		    });
+
+		WriteComponents<WheelJoint2DComponent, WheelJoint2DRecord>(
+		    writer, SceneSection::WheelJoints2D, registry, entities,
+		    [](const WheelJoint2DComponent& wjc, WheelJoint2DRecord& record) {
+			    record = {wjc.ConnectedEntityID, wjc.OriginAnchor, wjc.Frequency, wjc.DampingRatio,
+			              wjc.LowerTranslation, wjc.UpperTranslation, wjc.MotorSpeed, wjc.MaxMotorTorque,
+			              wjc.BreakingForce, wjc.BreakingTorque, wjc.EnableLimit, wjc.EnableMotor, wjc.EnableCollision,
+			              {}};
+		    });
+
+		WriteComponents<AudioSourceComponent, AudioSourceRecord>(
+		    writer, SceneSection::AudioSources, registry, entities,
+		    [](const AudioSourceComponent& asc, AudioSourceRecord& record) {
+			    record = {asc.Handle, asc.Volume, asc.Pitch, asc.RollOff, asc.MinGain, asc.MaxGain, asc.MinDistance,
+			              asc.MaxDistance, asc.DopplerFactor, asc.Looping, asc.PlayOnCreate, asc.Is3D,
+			              (u8)asc.Attenuation, {}};
+		    });
+
+		std::vector<u32> listeners;
+
+		for (u32 i = 0; i < (u32)entities.size(); i++)
+		{
+			if (registry.all_of<AudioListenerComponent>(entities[i]))
+				listeners.emplace_back(i);
+		}
+
+		writer.WriteColumn(SceneSection::AudioListeners, listeners);
+		writer.WriteColumn(SceneSection::Dependencies, SceneDependencies::Collect(scene));
+
+		if (!writer.WriteToFile(path, (u32)entities.size()))
+		{
+			APP_ERROR("Failed to write the binary scene: {}", path);
+			return false;
+		}
+
+		return true;
+	}
+
+	static Scene* DeserializeScene(const SceneBinaryReader& reader)
+	{
+		Scene* scene = new Scene();
+
+		const std::span<const u64> ids = reader.GetColumn<u64>(SceneSection::EntityIDs);
+
+		if (ids.size() != reader.GetEntityCount())
+		{
+			APP_ERROR("Error while deserializing the binary scene, invalid entities section!");
+			return scene;
+		}
+
+		entt::registry& registry = scene->GetRegistry().GetRegistryHandle();
+
+		std::vector<entt::entity> handles;
+
+		scene->CreateEntitiesWithIDs(ids.data(), (u32)ids.size(), handles);
+
+		// Required components were already emplaced by the scene - fill them column by column
+		const std::span<const u32> tags = reader.GetColumn<u32>(SceneSection::EntityTags);
+
+		if (tags.size() == handles.size())
+		{
+			for (size_t i = 0; i < handles.size(); i++)
+				registry.get<TagComponent>(handles[i]).Tag = reader.GetString(tags[i]);
+		}
+
+		const std::span<const TransformRecord> transforms = reader.GetColumn<TransformRecord>(SceneSection::Transforms);
+
+		if (transforms.size() == handles.size())
+		{
+			for (size_t i = 0; i < handles.size(); i++)
+			{
+				TransformComponent& tc = registry.get<TransformComponent>(handles[i]);
+
+				tc.Position = transforms[i].Position;
+				tc.Rotation = transforms[i].Rotation;
+				tc.Scale    = transforms[i].Scale;
+			}
+		}
+
+		const std::span<const u64> parents         = reader.GetColumn<u64>(SceneSection::Parents);
+		const std::span<const RangeRecord> ranges = reader.GetColumn<RangeRecord>(SceneSection::ChildRanges);
+		const std::span<const u64> children        = reader.GetColumn<u64>(SceneSection::Children);
+
+		if (parents.size() == handles.size() && ranges.size() == handles.size())
+		{
+			for (size_t i = 0; i < handles.size(); i++)
+			{
+				RelationshipComponent& rc = registry.get<RelationshipComponent>(handles[i]);
+
+				const std::span<const u64> childIDs = GetPoolRange(children, ranges[i]);
+
+				rc.ParentID = parents[i];
+				rc.ChildrenIDs.assign(childIDs.begin(), childIDs.end());
+			}
+		}
+
+		ReadComponents<SpriteComponent, SpriteRecord>(
+		    reader, SceneSection::Sprites, registry, handles,
+		    [](const SpriteRecord& record, SpriteComponent& sc, u32 /*index*/) {
+			    sc.Color        = record.Color;
+			    sc.TilingFactor = record.TilingFactor;
+			    sc.ZIndex       = record.ZIndex;
+
+			    if (record.Handle == 0 || AssetManager::IsValid(record.Handle))
+				    sc.Handle = record.Handle;
+			    else
+				    APP_ERROR("SceneBinarySerializer - Invalid ID: {} for sprite, skipping.", record.Handle);
+		    });
+
+		const std::span<const AnimationRecord> animations =
+		    reader.GetColumn<AnimationRecord>(SceneSection::Animations);
+
+		ReadComponents<AnimatedSpriteComponent, AnimatedSpriteRecord>(
+		    reader, SceneSection::AnimatedSprites, registry, handles,
+		    [&reader, animations](const AnimatedSpriteRecord& record, AnimatedSpriteComponent& asc, u32 /*index*/) {
+			    asc.CurrentFrame = record.CurrentFrame;
+			    asc.CurrentAnimation =
+			        record.CurrentAnimation ? AssetManager::GetAssetRaw<Animation2D>(record.CurrentAnimation) : nullptr;
+			    asc.DefaultAnimation =
+			        record.DefaultAnimation ? AssetManager::GetAssetRaw<Animation2D>(record.DefaultAnimation) : nullptr;
+
+			    for (const AnimationRecord& animation : GetPoolRange(animations, record.Animations))
+			    {
+				    Animation2D** anim = AssetManager::GetAssetRaw<Animation2D>(animation.Handle);
+
+				    if (anim && *anim)
+				    {
+					    const std::string_view name = reader.GetString(animation.Name);
+
+					    asc.Animations[StringId(name)] = {std::string(name), anim};
+				    }
+				    else
+					    APP_ERROR("SceneBinarySerializer - Invalid ID: {} for animation, skipping.", animation.Handle);
+			    }
+		    });
+
+		ReadComponents<CircleComponent, CircleRecord>(
+		    reader, SceneSection::Circles, registry, handles,
+		    [](const CircleRecord& record, CircleComponent& cc, u32 /*index*/) {
+			    cc.Color     = record.Color;
+			    cc.Thickness = record.Thickness;
+			    cc.Fade      = record.Fade;
+		    });
+
+		ReadComponents<TextComponent, TextRecord>(
+		    reader, SceneSection::Texts, registry, handles,
+		    [&reader](const TextRecord& record, TextComponent& tc, u32 /*index*/) {
+			    tc.TextString  = reader.GetString(record.Text);
+			    tc.Handle      = record.Font;
+			    tc.Color       = record.Color;
+			    tc.Kerning     = record.Kerning;
+			    tc.LineSpacing = record.LineSpacing;
+		    });
+
+		const std::span<const ScriptFieldRecord> scriptFields =
+		    reader.GetColumn<ScriptFieldRecord>(SceneSection::ScriptFields);
+
+		ReadComponents<ScriptComponent, ScriptRecord>(
+		    reader, SceneSection::Scripts, registry, handles,
+		    [&reader, scene, ids, scriptFields](const ScriptRecord& record, ScriptComponent& sc, u32 index) {
+			    ScriptingCore& core = ScriptingCore::Get();
+
+			    if (!core.IsValidScript(record.ScriptID))
+				    return;
+
+			    sc.ScriptID = record.ScriptID;
+
+			    const u64 id               = ids[index];
+			    const auto& scriptMetadata = core.GetScriptMetadata(record.ScriptID);
+
+			    scene->GetScriptStorage().InitializeEntityStorage(record.ScriptID, id);
+
+			    auto& entityStorage = scene->GetScriptStorage().EntityStorage.at(id);
+
+			    for (const ScriptFieldRecord& field : GetPoolRange(scriptFields, record.Fields))
+			    {
+				    const auto it = scriptMetadata.Fields.find(field.ID);
+
+				    // Skip fields which were removed or changed type since the scene was converted
+				    if (it == scriptMetadata.Fields.end() || (u32)it->second.Type != field.Type)
+					    continue;
+
+				    FieldStorage& fieldStorage = entityStorage.Fields[field.ID];
+
+				    if (!fieldStorage.IsArray())
+					    SetFieldValueBits(fieldStorage, it->second.Type, field.Value);
+			    }
+		    });
+
+		ReadComponents<CameraComponent, CameraRecord>(
+		    reader, SceneSection::Cameras, registry, handles,
+		    [](const CameraRecord& record, CameraComponent& cc, u32 /*index*/) {
+			    cc.Camera  = SceneCamera(record.AspectRatio);
+			    cc.Primary = record.Primary;
+
+			    cc.Camera.SetOrthographic(record.OrthographicSize, record.OrthographicNear, record.OrthographicFar);
+			    cc.Camera.SetPerspective(record.PerspectiveFOV, record.PerspectiveNear, record.PerspectiveFar);
+			    cc.Camera.SetProjectionType((ProjectionType)record.ProjectionType);
+		    });
+
+		ReadComponents<RigidBody2DComponent, RigidBody2DRecord>(
+		    reader, SceneSection::RigidBodies2D, registry, handles,
+		    [](const RigidBody2DRecord& record, RigidBody2DComponent& rbc, u32 /*index*/) {
+			    rbc.Type                 = (PhysicBodyType)record.Type;
+			    rbc.GravityScale         = record.GravityScale;
+			    rbc.Mass                 = record.Mass;
+			    rbc.Friction             = record.Friction;
+			    rbc.Restitution          = record.Restitution;
+			    rbc.RestitutionThreshold = record.RestitutionThreshold;
+			    rbc.LinearDamping        = record.LinearDamping;
+			    rbc.AngularDamping       = record.AngularDamping;
+			    rbc.CollisionLayer       = record.CollisionLayer;
+			    rbc.CollisionMask        = record.CollisionMask;
+			    rbc.AutoMass             = record.AutoMass;
+			    rbc.AllowSleep           = record.AllowSleep;
+			    rbc.InitiallyAwake       = record.InitiallyAwake;
+			    rbc.FixedRotation        = record.FixedRotation;
+			    rbc.IsBullet             = record.IsBullet;
+		    });
+
+		ReadComponents<BoxCollider2DComponent, BoxCollider2DRecord>(
+		    reader, SceneSection::BoxColliders2D, registry, handles,
+		    [](const BoxCollider2DRecord& record, BoxCollider2DComponent& bcc, u32 /*index*/) {
+			    bcc.Size     = record.Size;
+			    bcc.Offset   = record.Offset;
+			    bcc.Density  = record.Density;
+			    bcc.IsSensor = record.IsSensor;
+		    });
+
+		ReadComponents<CircleCollider2DComponent, CircleCollider2DRecord>(
+		    reader, SceneSection::CircleColliders2D, registry, handles,
+		    [](const CircleCollider2DRecord& record, CircleCollider2DComponent& ccc, u32 /*index*/) {
+			    ccc.Radius   = record.Radius;
+			    ccc.Offset   = record.Offset;
+			    ccc.Density  = record.Density;
+			    ccc.IsSensor = record.IsSensor;
+		    });
+
+		const std::span<const glm::vec2> vertices = reader.GetColumn<glm::vec2>(SceneSection::PolygonVertices2D);
+
+		ReadComponents<PolygonCollider2DComponent, PolygonCollider2DRecord>(
+		    reader, SceneSection::PolygonColliders2D, registry, handles,
+		    [vertices](const PolygonCollider2DRecord& record, PolygonCollider2DComponent& pcc, u32 /*index*/) {
+			    const std::span<const glm::vec2> polygon = GetPoolRange(vertices, record.Vertices);
+
+			    pcc.Vertices.assign(polygon.begin(), polygon.end());
+			    pcc.Offset   = record.Offset;
+			    pcc.Density  = record.Density;
+			    pcc.IsSensor = record.IsSensor;
+		    });
+
+		ReadComponents<BuoyancyEffector2DComponent, BuoyancyEffector2DRecord>(
+		    reader, SceneSection::BuoyancyEffectors2D, registry, handles,
+		    [](const BuoyancyEffector2DRecord& record, BuoyancyEffector2DComponent& bec, u32 /*index*/) {
+			    bec.Density        = record.Density;
+			    bec.DragMultiplier = record.DragMultiplier;
+			    bec.FlowMagnitude  = record.FlowMagnitude;
+			    bec.FlowAngle      = record.FlowAngle;
+		    });
+
+		ReadComponents<DistanceJoint2DComponent, DistanceJoint2DRecord>(
+		    reader, SceneSection::DistanceJoints2D, registry, handles,
+		    [](const DistanceJoint2DRecord& record, DistanceJoint2DComponent& djc, u32 /*index*/) {
+			    djc.ConnectedEntityID = record.ConnectedEntityID;
+			    djc.EnableCollision   = record.EnableCollision;
+			    djc.AutoLength        = record.AutoLength;
+			    djc.OriginAnchor      = record.OriginAnchor;
+			    djc.ConnectedAnchor   = record.ConnectedAnchor;
+			    djc.Length            = record.Length;
+			    djc.MinLength         = record.MinLength;
+			    djc.MaxLength         = record.MaxLength;
+			    djc.BreakingForce     = record.BreakingForce;
+		    });
+
+		ReadComponents<RevolutionJoint2DComponent, RevolutionJoint2DRecord>(
+		    reader, SceneSection::RevolutionJoints2D, registry, handles,
+		    [](const RevolutionJoint2DRecord& record, RevolutionJoint2DComponent& rjc, u32 /*index*/) {
+			    rjc.ConnectedEntityID = record.ConnectedEntityID;
+			    rjc.OriginAnchor      = record.OriginAnchor;
+			    rjc.LowerAngle        = record.LowerAngle;
+			    rjc.UpperAngle        = record.UpperAngle;
+			    rjc.MotorSpeed        = record.MotorSpeed;
+			    rjc.MaxMotorTorque    = record.MaxMotorTorque;
+			    rjc.BreakingForce     = record.BreakingForce;
+			    rjc.BreakingTorque    = record.BreakingTorque;
+			    rjc.EnableLimit       = record.EnableLimit;
+			    rjc.EnableMotor       = record.EnableMotor;
+			    rjc.EnableCollision   = record.EnableCollision;
+		    });
+
+		ReadComponents<PrismaticJoint2DComponent, PrismaticJoint2DRecord>(
+		    reader, SceneSection::PrismaticJoints2D, registry, handles,
+		    [](const PrismaticJoint2DRecord& record, PrismaticJoint2DComponent& pjc, u32 /*index*/) {
+			    pjc.ConnectedEntityID = record.ConnectedEntityID;
+			    pjc.OriginAnchor      = record.OriginAnchor;
+			    pjc.Angle             = record.Angle;
+			    pjc.LowerTranslation  = record.LowerTranslation;
+			    pjc.UpperTranslation  = record.UpperTranslation;
+			    pjc.MotorSpeed        = record.MotorSpeed;
+			    pjc.MaxMotorForce     = record.MaxMotorForce;
+			    pjc.BreakingForce     = record.BreakingForce;
+			    pjc.BreakingTorque    = record.BreakingTorque;
+			    pjc.EnableLimit       = record.EnableLimit;
+			    pjc.EnableMotor       = record.EnableMotor;
+			    pjc.EnableCollision   = record.EnableCollision;
+		    });
+
+		ReadComponents<SpringJoint2DComponent, SpringJoint2DRecord>(
+		    reader, SceneSection::SpringJoints2D, registry, handles,
+		    [](const SpringJoint2DRecord& record, SpringJoint2DComponent& sjc, u32 /*index*/) {
+			    sjc.ConnectedEntityID = record.ConnectedEntityID;
+			    sjc.EnableCollision   = record.EnableCollision;
+			    sjc.AutoLength        = record.AutoLength;
+			    sjc.OriginAnchor      = record.OriginAnchor;
+			    sjc.ConnectedAnchor   = record.ConnectedAnchor;
+			    sjc.Length            = record.Length;
+			    sjc.MinLength         = record.MinLength;
+			    sjc.MaxLength         = record.MaxLength;
+			    sjc.BreakingForce     = record.BreakingForce;
+			    sjc.Frequency         = record.Frequency;
+			    sjc.DampingRatio      = record.DampingRatio;
+		    });
+
+		ReadComponents<WheelJoint2DComponent, WheelJoint2DRecord>(
+		    reader, SceneSection::WheelJoints2D, registry, handles,
+		    [](const WheelJoint2DRecord& record, WheelJoint2DComponent& wjc, u32 /*index*/) {
+			    wjc.ConnectedEntityID = record.ConnectedEntityID;
+			    wjc.OriginAnchor      = record.OriginAnchor;
+			    wjc.Frequency         = record.Frequency;
+			    wjc.DampingRatio      = record.DampingRatio;
+			    wjc.LowerTranslation  = record.LowerTranslation;
+			    wjc.UpperTranslation  = record.UpperTranslation;
+			    wjc.MotorSpeed        = record.MotorSpeed;
+			    wjc.MaxMotorTorque    = record.MaxMotorTorque;
+			    wjc.BreakingForce     = record.BreakingForce;
+			    wjc.BreakingTorque    = record.BreakingTorque;
+			    wjc.EnableLimit       = record.EnableLimit;
+			    wjc.EnableMotor       = record.EnableMotor;
+			    wjc.EnableCollision   = record.EnableCollision;
+		    });
+
+		ReadComponents<AudioSourceComponent, AudioSourceRecord>(
+		    reader, SceneSection::AudioSources, registry, handles,
+		    [](const AudioSourceRecord& record, AudioSourceComponent& asc, u32 /*index*/) {
+			    asc.Handle        = record.Handle;
+			    asc.Volume        = record.Volume;
+			    asc.Pitch         = record.Pitch;
+			    asc.Looping       = record.Looping;
+			    asc.PlayOnCreate  = record.PlayOnCreate;
+			    asc.Is3D          = record.Is3D;
+			    asc.Attenuation   = (AttenuationType)record.Attenuation;
+			    asc.RollOff       = record.RollOff;
+			    asc.MinGain       = record.MinGain;
+			    asc.MaxGain       = record.MaxGain;
+			    asc.MinDistance   = record.MinDistance;
+			    asc.MaxDistance   = record.MaxDistance;
+			    asc.DopplerFactor = record.DopplerFactor;
+		    });
+
+		std::vector<entt::entity> listeners;
+
+		for (u32 index : reader.GetColumn<u32>(SceneSection::AudioListeners))
+		{
+			if (index < handles.size())
+				listeners.emplace_back(handles[index]);
+		}
+
+		registry.insert<AudioListenerComponent>(listeners.begin(), listeners.end());
+
+		return scene;
+	}
+
+	Scene* SceneBinarySerializer::Deserialize(const std::filesystem::path& path)
+	{
+		PROFILE_FUNCTION();
+
+		SceneBinaryReader reader;
+
+		if (!reader.Open(path))
+		{
+			APP_ERROR("Error while deserializing the binary scene: {}", path);
+			return new Scene();
+		}
+
+		return DeserializeScene(reader);
+	}
+
+	Scene* SceneBinarySerializer::Deserialize(const u8* data, u64 size)
+	{
+		PROFILE_FUNCTION();
+
+		SceneBinaryReader reader;
+
+		if (!reader.Open(data, size))
+		{
+			APP_ERROR("Error while deserializing the binary scene from memory!");
+			return new Scene();
+		}
+
+		return DeserializeScene(reader);
+	}
+
+	std::vector<AssetHandle> SceneBinarySerializer::DeserializeDependencies(const std::filesystem::path& path)
+	{
+		SceneBinaryReader reader;
+
+		if (!reader.Open(path))
+		{
+			APP_ERROR("Error while reading the dependencies of the binary scene: {}", path);
+			return {};
+		}
+
+		const std::span<const AssetHandle> dependencies = reader.GetColumn<AssetHandle>(SceneSection::Dependencies);
+
+		return {dependencies.begin(), dependencies.end()};
+	}
+
+	bool SceneBinarySerializer::Convert(const std::filesystem::path& yamlPath, const std::filesystem::path& binaryPath)
+	{
+		PROFILE_FUNCTION();
+
+		Scene* scene = SceneSerializer::Deserialize(yamlPath);
+
+		const bool result = Serialize(scene, binaryPath);
+
+		delete scene;
+
+		if (result)
+			APP_INFO("Converted scene {} to {}", yamlPath, binaryPath);
+
+		return result;
+	}
+
+} // namespace SW
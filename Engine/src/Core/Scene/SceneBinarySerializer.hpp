@@ -0,0 +1,89 @@
+/**
+ * @file SceneBinarySerializer.hpp
+ * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
+ * @version 0.1.1
+ * @date 2024-05-25
+ *
+ * @copyright Copyright (c) 2024 Tycjan Fortuna
+ */
+#pragma once
+
+#include "Asset/Asset.hpp"
+
+namespace SW
+{
+
+	class Scene;
+
+	/**
+	 * @brief Class responsible for the binary (runtime) scene format.
+	 * 		  YAML (.sw_scene) stays the source control format, the binary file (.sw_scenebin) is cooked from it.
+	 *
+	 * 		  Layout: header, sections (8 byte aligned), section table.
+	 * 		  Every component type is stored in its own section as two columns - indices of the owning entities and
+	 * 		  packed records - so loading is a linear walk over mapped memory followed by one bulk insert per type.
+	 * 		  Strings (tags, texts, animation names) live in a single string table referenced by index.
+	 * @note Bump the version whenever any record layout changes, files with a different version are rejected.
+	 */
+	class SceneBinarySerializer final
+	{
+	public:
+		static constexpr u32 Magic   = 0x42535753; /**< "SWSB" */
+		static constexpr u32 Version = 1;          /**< Current version of the format. */
+
+		static constexpr const char* Extension = ".sw_scenebin"; /**< File extension of the binary scenes. */
+
+		/**
+		 * @brief Serializes scene to a binary file.
+		 *
+		 * @param scene Scene to serialize.
+		 * @param path Path to file.
+		 * @return Whether the operation was successful.
+		 */
+		static bool Serialize(Scene* scene, const std::filesystem::path& path);
+
+		/**
+		 * @brief Deserializes scene from a binary file.
+		 *
+		 * @param path Path to file.
+		 * @return The deserialized scene (empty if the file is invalid).
+		 */
+		[[nodiscard]] static Scene* Deserialize(const std::filesystem::path& path);
+
+		/**
+		 * @brief Deserializes scene from binary data already in memory (e.g. a blob of a mapped asset pack).
+		 * @note The data is only read during the call, it does not have to outlive the scene.
+		 *
+		 * @param data Beginning of the binary scene (8 byte aligned).
+		 * @param size Size of the data in bytes.
+		 * @return The deserialized scene (empty if the data is invalid).
+		 */
+		[[nodiscard]] static Scene* Deserialize(const u8* data, u64 size);
+
+		/**
+		 * @brief Reads the dependency manifest of the binary scene (see SceneDependencies) without deserializing it.
+		 *
+		 * @param path Path to file.
+		 * @return The handles of the dependencies, empty if the file is invalid or has no manifest.
+		 */
+		static std::vector<AssetHandle> DeserializeDependencies(const std::filesystem::path& path);
+
+		/**
+		 * @brief Cooks the YAML scene into the binary format.
+		 *
+		 * @param yamlPath Path to the source .sw_scene file.
+		 * @param binaryPath Path to the output .sw_scenebin file.
+		 * @return Whether the operation was successful.
+		 */
+		static bool Convert(const std::filesystem::path& yamlPath, const std::filesystem::path& binaryPath);
+
+		/**
+		 * @brief Checks whether the path points to a binary scene (by extension).
+		 *
+		 * @param path Path to file.
+		 * @return True if the path has the binary scene extension.
+		 */
+		static bool IsBinaryScene(const std::filesystem::path& path) { return path.extension() == Extension; }
+	};
+
+} // namespace SW
@@ -0,0 +1,118 @@
+#include "SceneDependencies.hpp"
+
+#include "Asset/Animation2D.hpp"
+#include "Asset/AssetManager.hpp"
+#include "Asset/Prefab.hpp"
+#include "Core/Scene/Scene.hpp"
+
+namespace SW
+{
+
+	/**
+	 * @brief State of a single collection, shared by the nested prefab scenes.
+	 */
+	struct DependencyCollection
+	{
+		std::unordered_set<AssetHandle> Visited; /**< Assets already collected or being collected. */
+		std::vector<AssetHandle> Handles;        /**< Collected assets, dependencies first. */
+	};
+
+	static void CollectScene(Scene* scene, DependencyCollection& collection);
+
+	static void CollectAsset(AssetHandle handle, DependencyCollection& collection)
+	{
+		if (handle == 0 || !AssetManager::IsValid(handle) || !collection.Visited.insert(handle).second)
+			return;
+
+		if (AssetManager::GetAssetMetaData(handle).Type == AssetType::FontSource)
+			return; // a dependency of the fonts, read from its file by them and never loaded on its own
+
+		Asset** asset = AssetManager::GetAssetRaw(handle); // the dependencies are captured while the asset loads
+
+		// Copied - loading the dependencies below may rehash the storage of the manager.
+		const std::vector<AssetHandle> dependencies = AssetManager::GetAssetDependencies(handle);
+
+		for (const AssetHandle dependency : dependencies)
+		{
+			CollectAsset(dependency, collection);
+		}
+
+		// Components of the prefab entities only keep handles, those are not loaded together with the prefab.
+		if (asset && *asset && (*asset)->GetAssetType() == AssetType::Prefab)
+			CollectScene(static_cast<Prefab*>(*asset)->GetSceneRaw(), collection);
+
+		collection.Handles.emplace_back(handle); // after its dependencies
+	}
+
+	static void CollectAnimation(Animation2D** animation, DependencyCollection& collection)
+	{
+		if (animation && *animation)
+			CollectAsset((*animation)->GetHandle(), collection);
+	}
+
+	static void CollectScene(Scene* scene, DependencyCollection& collection)
+	{
+		EntityRegistry& registry = scene->GetRegistry();
+
+		for (auto&& [handle, sc] : registry.GetEntitiesWith<SpriteComponent>().each())
+		{
+			CollectAsset(sc.Handle, collection);
+		}
+
+		for (auto&& [handle, asc] : registry.GetEntitiesWith<AnimatedSpriteComponent>().each())
+		{
+			CollectAnimation(asc.DefaultAnimation, collection);
+			CollectAnimation(asc.CurrentAnimation, collection);
+
+			for (auto&& [id, animation] : asc.Animations)
+			{
+				CollectAnimation(animation.Value, collection);
+			}
+		}
+
+		for (auto&& [handle, tc] : registry.GetEntitiesWith<TextComponent>().each())
+		{
+			CollectAsset(tc.Handle, collection);
+		}
+
+		for (auto&& [handle, asc] : registry.GetEntitiesWith<AudioSourceComponent>().each())
+		{
+			CollectAsset(asc.Handle, collection);
+		}
+
+		for (auto&& [entityID, storage] : scene->GetScriptStorageC().EntityStorage)
+		{
+			for (auto&& [fieldID, field] : storage.Fields)
+			{
+				if (field.GetType() != DataType::Prefab)
+					continue;
+
+				if (!field.IsArray())
+				{
+					CollectAsset(field.GetValue<u64>(), collection);
+					continue;
+				}
+
+				for (u32 i = 0; i < (u32)field.GetLength(); i++)
+				{
+					CollectAsset(field.GetValue<u64>(i), collection);
+				}
+			}
+		}
+	}
+
+	std::vector<AssetHandle> SceneDependencies::Collect(Scene* scene)
+	{
+		if (!ProjectContext::HasContext() || !ProjectContext::Get()->GetEditorAssetManager())
+			return {};
+
+		PROFILE_FUNCTION();
+
+		DependencyCollection collection;
+
+		CollectScene(scene, collection);
+
+		return std::move(collection.Handles);
+	}
+
+} // namespace SW
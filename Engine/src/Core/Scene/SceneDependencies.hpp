@@ -0,0 +1,36 @@
+/**
+ * @file SceneDependencies.hpp
+ * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
+ * @version 0.1.0
+ * @date 2024-06-03
+ *
+ * @copyright Copyright (c) 2024 Tycjan Fortuna
+ */
+#pragma once
+
+#include "Asset/Asset.hpp"
+
+namespace SW
+{
+
+	class Scene;
+
+	/**
+	 * @brief Builds the dependency manifest of a scene - every asset the scene needs, so all of them can be
+	 * 		  preloaded (see AssetPreloader) before the scene is opened instead of being loaded one by one on use.
+	 */
+	class SceneDependencies final
+	{
+	public:
+		/**
+		 * @brief Collects the assets referenced by the entities of the scene and, transitively, the assets those
+		 * 		  reference (textures of sprites, sprites of animations, entities of prefabs, ...).
+		 * @note Referenced assets are loaded to learn their dependencies, meant for the editor (e.g. on save).
+		 *
+		 * @param scene The scene.
+		 * @return The handles, every asset comes after its dependencies. Empty without an editor project.
+		 */
+		static std::vector<AssetHandle> Collect(Scene* scene);
+	};
+
+} // namespace SW
@@ -1,11 +1,17 @@
 #include "SceneSerializer.hpp"
 #include "Scene.hpp"
+#include "SceneBinarySerializer.hpp"
+#include "SceneDependencies.hpp"
 
+#include <algorithm>
 #include <fstream>
+#include <future>
+#include <thread>
 
 #include "Asset/AssetManager.hpp"
 #include "Audio/SoundInstance.hpp"
 #include "Core/Scripting/ScriptingCore.hpp"
+#include "Core/Utils/MappedFile.hpp"
 #include "Core/Utils/SerializationUtils.hpp"
 
 namespace SW
@@ -13,9 +19,22 @@ namespace SW
 
 	void SceneSerializer::Serialize(Scene* scene, const std::filesystem::path& path)
 	{
+		if (SceneBinarySerializer::IsBinaryScene(path))
+		{
+			SceneBinarySerializer::Serialize(scene, path);
+			return;
+		}
+
 		YAML::Emitter output;
 
 		output << YAML::BeginMap;
+
+		// Written first, so DeserializeDependencies() does not have to parse the entities.
+		output << YAML::Key << "Dependencies" << YAML::Value << YAML::Flow << YAML::BeginSeq;
+		for (const AssetHandle handle : SceneDependencies::Collect(scene))
+			output << handle;
+		output << YAML::EndSeq;
+
 		output << YAML::Key << "Entities" << YAML::Value << YAML::BeginSeq;
 
 		std::map<u64, Entity> sortedEntities;
@@ -95,13 +114,13 @@ namespace SW
 
 			output << YAML::Key << "Animations" << YAML::Value << YAML::BeginSeq;
 
-			for (auto&& [name, anim] : asc.Animations)
+			for (auto&& [id, anim] : asc.Animations)
 			{
 				output << YAML::BeginMap;
 				output << YAML::Key << "Animation";
 				output << YAML::BeginMap;
-				output << YAML::Key << "Name" << YAML::Value << name;
-				output << YAML::Key << "AnimationHandle" << YAML::Value << (*anim)->GetHandle();
+				output << YAML::Key << "Name" << YAML::Value << anim.Name;
+				output << YAML::Key << "AnimationHandle" << YAML::Value << (*anim.Value)->GetHandle();
 				output << YAML::EndMap;
 				output << YAML::EndMap;
 			}
@@ -291,6 +310,8 @@ namespace SW
 			output << YAML::Key << "AllowSleep" << YAML::Value << rbc.AllowSleep;
 			output << YAML::Key << "InitiallyAwake" << YAML::Value << rbc.InitiallyAwake;
 			output << YAML::Key << "IsBullet" << YAML::Value << rbc.IsBullet;
+			output << YAML::Key << "CollisionLayer" << YAML::Value << rbc.CollisionLayer;
+			output << YAML::Key << "CollisionMask" << YAML::Value << rbc.CollisionMask;
 			output << YAML::EndMap;
 		}
 
@@ -494,10 +515,169 @@ namespace SW
 		output << YAML::EndMap; // End Entity content
 	}
 
+	/**
+	 * @brief Minimum number of entities worth a worker thread, smaller scenes are parsed on the calling thread.
+	 */
+	static constexpr u32 MinEntitiesPerWorker = 256;
+
+	/**
+	 * @brief Splits the items of the top level entities sequence of a scene file into ranges of whole items.
+	 * @note Only the block layout written by Serialize() is recognized.
+	 *
+	 * @param text The scene file.
+	 * @param maxRanges Maximum number of ranges.
+	 * @param outRanges The ranges, each one parses on its own once prefixed with the "Entities:" key.
+	 * @return Whether the layout was recognized, otherwise the file has to be parsed as a whole.
+	 */
+	static bool SplitEntities(std::string_view text, u32 maxRanges, std::vector<std::string_view>& outRanges)
+	{
+		constexpr std::string_view key = "Entities:";
+
+		std::vector<size_t> items; // offsets of the lines starting the items
+
+		size_t end    = text.size();
+		size_t indent = std::string_view::npos;
+		bool isInside = false;
+
+		for (size_t offset = 0; offset < text.size();)
+		{
+			const size_t lineOffset = offset;
+			const size_t lineEnd    = std::min(text.find('\n', offset), text.size());
+
+			const std::string_view line = text.substr(lineOffset, lineEnd - lineOffset);
+
+			offset = lineEnd + 1;
+
+			if (!isInside)
+			{
+				if (!line.starts_with(key))
+					continue;
+
+				if (line.find_first_not_of(" \t\r", key.size()) != std::string_view::npos)
+					return false; // flow sequence or the first item on the same line
+
+				isInside = true;
+				continue;
+			}
+
+			const size_t lineIndent = line.find_first_not_of(' ');
+
+			if (lineIndent == std::string_view::npos || line[lineIndent] == '#' || line[lineIndent] == '\r')
+				continue; // blank line or comment
+
+			if (indent == std::string_view::npos)
+				indent = lineIndent;
+
+			const bool isItem = lineIndent == indent && line[lineIndent] == '-' &&
+			                    (lineIndent + 1 == line.size() || line[lineIndent + 1] == ' ' ||
+			                     line[lineIndent + 1] == '\r');
+
+			if (lineIndent < indent || (lineIndent == indent && !isItem))
+			{
+				end = lineOffset; // next top level key
+				break;
+			}
+
+			if (isItem)
+				items.emplace_back(lineOffset);
+		}
+
+		if (items.empty())
+			return false;
+
+		const u32 rangeCount = std::clamp((u32)items.size() / MinEntitiesPerWorker, 1u, std::max(maxRanges, 1u));
+
+		for (u32 i = 0; i < rangeCount; i++)
+		{
+			const size_t first = items[items.size() * i / rangeCount];
+			const size_t last  = i + 1 < rangeCount ? items[items.size() * (i + 1) / rangeCount] : end;
+
+			outRanges.emplace_back(text.substr(first, last - first));
+		}
+
+		return true;
+	}
+
+	u32 SceneSerializer::ParseEntitiesParallel(const std::filesystem::path& path, u32 maxWorkers,
+	                                           ParsedEntities& outEntities)
+	{
+		PROFILE_FUNCTION();
+
+		MappedFile file;
+
+		if (!std::filesystem::exists(path) || !file.Open(path))
+			return 0;
+
+		const std::string_view text(reinterpret_cast<const char*>(file.GetData()), file.GetSize());
+
+		std::vector<std::string_view> ranges;
+
+		if (!SplitEntities(text, maxWorkers, ranges) || ranges.size() < 2)
+			return 0;
+
+		// Every worker loads its own document, nodes of a single document can not be shared between threads.
+		std::vector<std::future<ParsedEntities>> workers;
+		workers.reserve(ranges.size());
+
+		for (const std::string_view range : ranges)
+		{
+			workers.emplace_back(std::async(std::launch::async, [range]() {
+				std::string document = "Entities:\n";
+				document.append(range);
+
+				ParsedEntities entities;
+				SceneSerializer::ParseEntitiesNode(YAML::Load(document)["Entities"], entities);
+
+				return entities;
+			}));
+		}
+
+		bool isParsed = true;
+
+		for (std::future<ParsedEntities>& worker : workers)
+		{
+			try
+			{
+				ParsedEntities entities = worker.get();
+
+				if (isParsed)
+					outEntities.Append(std::move(entities));
+			}
+			catch (const YAML::Exception& e)
+			{
+				APP_WARN("Failed to parse a part of the scene: {} on its own, parsing it as a whole. {}", path.string(),
+				         e.what());
+
+				isParsed = false;
+			}
+		}
+
+		if (!isParsed)
+		{
+			outEntities = {};
+			return 0;
+		}
+
+		return (u32)ranges.size();
+	}
+
 	Scene* SceneSerializer::Deserialize(const std::filesystem::path& path)
 	{
+		if (SceneBinarySerializer::IsBinaryScene(path))
+			return SceneBinarySerializer::Deserialize(path);
+
+		PROFILE_FUNCTION();
+
 		Scene* scene = new Scene();
 
+		ParsedEntities entities;
+
+		if (ParseEntitiesParallel(path, std::thread::hardware_concurrency(), entities))
+		{
+			CommitEntities(entities, scene);
+			return scene;
+		}
+
 		try
 		{
 			YAML::Node data = YAML::LoadFile(path.string());
@@ -508,9 +688,9 @@ namespace SW
 				return scene;
 			}
 
-			YAML::Node entities = data["Entities"];
+			YAML::Node entitiesNode = data["Entities"];
 
-			DeserializeEntitiesNode(entities, scene);
+			DeserializeEntitiesNode(entitiesNode, scene);
 		}
 		catch (const YAML::ParserException& e)
 		{
@@ -521,96 +701,246 @@ namespace SW
 		return scene;
 	}
 
+	std::vector<AssetHandle> SceneSerializer::DeserializeDependencies(const std::filesystem::path& path)
+	{
+		if (SceneBinarySerializer::IsBinaryScene(path))
+			return SceneBinarySerializer::DeserializeDependencies(path);
+
+		std::ifstream file(path);
+
+		if (!file)
+			return {};
+
+		std::string header;
+
+		for (std::string line; std::getline(file, line) && !line.starts_with("Entities:");)
+		{
+			header += line;
+			header += '\n';
+		}
+
+		std::vector<AssetHandle> dependencies;
+
+		try
+		{
+			YAML::Node data = YAML::Load(header);
+
+			for (const YAML::Node& dependency : data["Dependencies"])
+			{
+				dependencies.emplace_back(dependency.as<AssetHandle>());
+			}
+		}
+		catch (const YAML::Exception& e)
+		{
+			APP_ERROR("Error while reading the dependencies of the scene: {}, {}", path.string(), e.what());
+			return {};
+		}
+
+		return dependencies;
+	}
+
+	template <typename T>
+	static void AppendComponents(ParsedComponents<T>& components, ParsedComponents<T>&& other, u32 offset)
+	{
+		for (const u32 index : other.Indices)
+			components.Indices.emplace_back(index + offset);
+
+		components.Components.insert(components.Components.end(), std::make_move_iterator(other.Components.begin()),
+		                             std::make_move_iterator(other.Components.end()));
+	}
+
+	template <typename T>
+	static void AppendColumn(std::vector<T>& column, std::vector<T>&& other)
+	{
+		column.insert(column.end(), std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+	}
+
+	void ParsedEntities::Append(ParsedEntities&& other)
+	{
+		const u32 offset = (u32)IDs.size();
+
+		AppendColumn(IDs, std::move(other.IDs));
+		AppendColumn(Tags, std::move(other.Tags));
+		AppendColumn(Transforms, std::move(other.Transforms));
+		AppendColumn(Relationships, std::move(other.Relationships));
+
+		AppendComponents(Sprites, std::move(other.Sprites), offset);
+		AppendComponents(AnimatedSprites, std::move(other.AnimatedSprites), offset);
+		AppendComponents(Circles, std::move(other.Circles), offset);
+		AppendComponents(Texts, std::move(other.Texts), offset);
+		AppendComponents(Scripts, std::move(other.Scripts), offset);
+		AppendComponents(Cameras, std::move(other.Cameras), offset);
+		AppendComponents(RigidBodies, std::move(other.RigidBodies), offset);
+		AppendComponents(BoxColliders, std::move(other.BoxColliders), offset);
+		AppendComponents(CircleColliders, std::move(other.CircleColliders), offset);
+		AppendComponents(PolygonColliders, std::move(other.PolygonColliders), offset);
+		AppendComponents(BuoyancyEffectors, std::move(other.BuoyancyEffectors), offset);
+		AppendComponents(DistanceJoints, std::move(other.DistanceJoints), offset);
+		AppendComponents(RevolutionJoints, std::move(other.RevolutionJoints), offset);
+		AppendComponents(PrismaticJoints, std::move(other.PrismaticJoints), offset);
+		AppendComponents(SpringJoints, std::move(other.SpringJoints), offset);
+		AppendComponents(WheelJoints, std::move(other.WheelJoints), offset);
+		AppendComponents(AudioSources, std::move(other.AudioSources), offset);
+	}
+
+	template <typename T>
+	static T& EmplaceComponent(ParsedComponents<T>& components, u32 index)
+	{
+		components.Indices.emplace_back(index);
+
+		return components.Components.emplace_back();
+	}
+
+	static u64 ParseFieldValueBits(const YAML::Node& field, DataType type)
+	{
+		switch (type)
+		{
+		case DataType::Byte:
+			return ToValueBits(TryDeserializeNode<u8>(field, "Value", 0));
+		case DataType::Short:
+			return ToValueBits(TryDeserializeNode<i16>(field, "Value", 0));
+		case DataType::UShort:
+			return ToValueBits(TryDeserializeNode<u16>(field, "Value", 0));
+		case DataType::Int:
+			return ToValueBits(TryDeserializeNode<i32>(field, "Value", 0));
+		case DataType::UInt:
+			return ToValueBits(TryDeserializeNode<u32>(field, "Value", 0));
+		case DataType::Long:
+			return ToValueBits(TryDeserializeNode<i64>(field, "Value", 0));
+		case DataType::ULong:
+		case DataType::Entity:
+		case DataType::Prefab:
+			return ToValueBits(TryDeserializeNode<u64>(field, "Value", 0));
+		case DataType::Float:
+			return ToValueBits(TryDeserializeNode<f32>(field, "Value", 0.0f));
+		case DataType::Double:
+			return ToValueBits(TryDeserializeNode<f64>(field, "Value", 0.0));
+		case DataType::Bool:
+			return ToValueBits(TryDeserializeNode<bool>(field, "Value", false));
+		default:
+			return 0;
+		}
+	}
+
+	template <typename Component>
+	static void InsertComponents(entt::registry& registry, const std::vector<entt::entity>& handles,
+	                             ParsedComponents<Component>& components)
+	{
+		if (components.Indices.empty())
+			return;
+
+		std::vector<entt::entity> targets;
+		targets.reserve(components.Indices.size());
+
+		for (const u32 index : components.Indices)
+			targets.emplace_back(handles[index]);
+
+		registry.insert<Component>(targets.begin(), targets.end(),
+		                           std::make_move_iterator(components.Components.begin()));
+	}
+
 	void SceneSerializer::DeserializeEntitiesNode(YAML::Node& entitiesNode, Scene* scene)
 	{
-		for (auto entity : entitiesNode)
+		ParsedEntities entities;
+
+		ParseEntitiesNode(entitiesNode, entities);
+		CommitEntities(entities, scene);
+	}
+
+	void SceneSerializer::ParseEntitiesNode(const YAML::Node& entitiesNode, ParsedEntities& outEntities)
+	{
+		for (const YAML::Node& entityNode : entitiesNode)
 		{
-			YAML::Node idComponent = entity["Entity"]["IDComponent"];
+			const YAML::Node entity = entityNode["Entity"];
+
+			const u32 index = (u32)outEntities.IDs.size();
+
+			YAML::Node idComponent = entity["IDComponent"];
 
 			u64 id = TryDeserializeNode<u64>(idComponent, "ID", 0);
 
 			APP_TRACE("Deserializing entity with ID: {}", id);
 
-			YAML::Node tagComponent = entity["Entity"]["TagComponent"];
-			std::string tag         = TryDeserializeNode<std::string>(tagComponent, "Tag", "Entity");
+			YAML::Node tagComponent = entity["TagComponent"];
 
-			Entity deserialized = scene->CreateEntityWithID(id, tag);
+			outEntities.IDs.emplace_back(id);
+			outEntities.Tags.emplace_back(TryDeserializeNode<std::string>(tagComponent, "Tag", "Entity"));
 
-			if (YAML::Node transformComponent = entity["Entity"]["TransformComponent"])
-			{
-				TransformComponent& tc = deserialized.GetComponent<TransformComponent>();
+			TransformComponent& tc = outEntities.Transforms.emplace_back();
 
+			if (YAML::Node transformComponent = entity["TransformComponent"])
+			{
 				tc.Position = TryDeserializeNode<glm::vec3>(transformComponent, "Transform", glm::vec3(0.0f));
 				tc.Rotation = TryDeserializeNode<glm::vec3>(transformComponent, "Rotation", glm::vec3(0.0f));
 				tc.Scale    = TryDeserializeNode<glm::vec3>(transformComponent, "Scale", glm::vec3(1.0f));
 			}
 
-			if (YAML::Node spriteComponent = entity["Entity"]["SpriteComponent"])
+			RelationshipComponent& rsc = outEntities.Relationships.emplace_back();
+
+			if (YAML::Node relationshipComponent = entity["RelationshipComponent"])
 			{
-				SpriteComponent& sc = deserialized.AddComponent<SpriteComponent>();
+				rsc.ParentID = TryDeserializeNode<u64>(relationshipComponent, "ParentID", 0);
 
-				sc.Color  = TryDeserializeNode<glm::vec4>(spriteComponent, "Color", glm::vec4(1.0f));
-				sc.ZIndex = TryDeserializeNode<i32>(spriteComponent, "ZIndex", 0);
+				const u64 childCount = TryDeserializeNode<u64>(relationshipComponent, "ChildrenCount", 0);
+
+				rsc.ChildrenIDs.reserve(childCount);
 
-				const AssetHandle handle = TryDeserializeNode<AssetHandle>(spriteComponent, "AssetHandle", 0);
+				const YAML::Node children = relationshipComponent["ChildrenIDs"];
 
-				if (handle == 0 || AssetManager::IsValid(handle))
-				{
-					sc.Handle = handle;
-				}
-				else
+				if (children && childCount > 0)
 				{
-					APP_ERROR("SceneSerializer - Invalid ID: {} for sprite, skipping.", handle);
+					for (size_t i = 0; i < childCount; i++)
+					{
+						u64 child = TryDeserializeNode<u64>(children, std::to_string(i), 0);
+
+						if (child)
+							rsc.ChildrenIDs.push_back(child);
+					}
 				}
 			}
 
-			if (YAML::Node animatedSpriteComponent = entity["Entity"]["AnimatedSpriteComponent"])
+			if (YAML::Node spriteComponent = entity["SpriteComponent"])
 			{
-				AnimatedSpriteComponent& asc = deserialized.AddComponent<AnimatedSpriteComponent>();
+				SpriteComponent& sc = EmplaceComponent(outEntities.Sprites, index);
 
-				asc.CurrentFrame = TryDeserializeNode<int>(animatedSpriteComponent, "CurrentFrame", 0);
-				AssetHandle currentAnimHandle =
-				    TryDeserializeNode<AssetHandle>(animatedSpriteComponent, "CurrentAnimationHandle", 0);
-				AssetHandle defaultAnimHandle =
-				    TryDeserializeNode<AssetHandle>(animatedSpriteComponent, "DefaultAnimationHandle", 0);
+				sc.Color  = TryDeserializeNode<glm::vec4>(spriteComponent, "Color", glm::vec4(1.0f));
+				sc.ZIndex = TryDeserializeNode<i32>(spriteComponent, "ZIndex", 0);
+				sc.Handle = TryDeserializeNode<AssetHandle>(spriteComponent, "AssetHandle", 0); // validated on commit
+			}
 
+			if (YAML::Node animatedSpriteComponent = entity["AnimatedSpriteComponent"])
+			{
+				ParsedAnimatedSprite& asc = EmplaceComponent(outEntities.AnimatedSprites, index);
+
+				asc.CurrentFrame = TryDeserializeNode<int>(animatedSpriteComponent, "CurrentFrame", 0);
 				asc.CurrentAnimation =
-				    currentAnimHandle ? AssetManager::GetAssetRaw<Animation2D>(currentAnimHandle) : nullptr;
+				    TryDeserializeNode<AssetHandle>(animatedSpriteComponent, "CurrentAnimationHandle", 0);
 				asc.DefaultAnimation =
-				    defaultAnimHandle ? AssetManager::GetAssetRaw<Animation2D>(defaultAnimHandle) : nullptr;
+				    TryDeserializeNode<AssetHandle>(animatedSpriteComponent, "DefaultAnimationHandle", 0);
 
 				YAML::Node animations = animatedSpriteComponent["Animations"];
 				for (YAML::Node animation : animations)
 				{
 					const AssetHandle animHandle =
 					    TryDeserializeNode<AssetHandle>(animation["Animation"], "AnimationHandle", 0);
-					Animation2D** anim = AssetManager::GetAssetRaw<Animation2D>(animHandle);
-
-					if (anim && *anim)
-					{
-						std::string key = TryDeserializeNode<std::string>(animation["Animation"], "Name", "Unnamed");
+					std::string key = TryDeserializeNode<std::string>(animation["Animation"], "Name", "Unnamed");
 
-						asc.Animations[key] = anim;
-					}
-					else
-					{
-						APP_ERROR("SceneSerializer - Invalid ID: {} for animation, skipping.", animHandle);
-					}
+					asc.Animations.emplace_back(std::move(key), animHandle);
 				}
 			}
 
-			if (YAML::Node circleComponent = entity["Entity"]["CircleComponent"])
+			if (YAML::Node circleComponent = entity["CircleComponent"])
 			{
-				CircleComponent& cc = deserialized.AddComponent<CircleComponent>();
+				CircleComponent& cc = EmplaceComponent(outEntities.Circles, index);
 
 				cc.Color     = TryDeserializeNode<glm::vec4>(circleComponent, "Color", glm::vec4(1.0f));
 				cc.Thickness = TryDeserializeNode<f32>(circleComponent, "Thickness", 1.0f);
 				cc.Fade      = TryDeserializeNode<bool>(circleComponent, "Fade", false);
 			}
 
-			if (YAML::Node textComponent = entity["Entity"]["TextComponent"])
+			if (YAML::Node textComponent = entity["TextComponent"])
 			{
-				TextComponent& tc = deserialized.AddComponent<TextComponent>();
+				TextComponent& tc = EmplaceComponent(outEntities.Texts, index);
 
 				tc.TextString  = TryDeserializeNode<std::string>(textComponent, "TextString", "Text");
 				tc.Color       = TryDeserializeNode<glm::vec4>(textComponent, "Color", glm::vec4(1.0f));
@@ -619,125 +949,30 @@ namespace SW
 				tc.Handle      = TryDeserializeNode<AssetHandle>(textComponent, "AssetHandle", 0);
 			}
 
-			if (YAML::Node relationshipComponent = entity["Entity"]["RelationshipComponent"])
-			{
-				RelationshipComponent& rsc = deserialized.GetComponent<RelationshipComponent>();
-				rsc.ParentID               = TryDeserializeNode<u64>(relationshipComponent, "ParentID", 0);
-
-				const u64 childCount = TryDeserializeNode<u64>(relationshipComponent, "ChildrenCount", 0);
-
-				rsc.ChildrenIDs.clear();
-				rsc.ChildrenIDs.reserve(childCount);
-
-				const YAML::Node children = relationshipComponent["ChildrenIDs"];
-
-				if (children && childCount > 0)
-				{
-					for (size_t i = 0; i < childCount; i++)
-					{
-						u64 child = TryDeserializeNode<u64>(children, std::to_string(i), 0);
-
-						if (child)
-							rsc.ChildrenIDs.push_back(child);
-					}
-				}
-			}
-
-			if (YAML::Node scriptComponent = entity["Entity"]["ScriptComponent"])
+			if (YAML::Node scriptComponent = entity["ScriptComponent"])
 			{
-				ScriptComponent& sc = deserialized.AddComponent<ScriptComponent>();
+				ParsedScript& sc = EmplaceComponent(outEntities.Scripts, index);
 
-				u64 scriptId = TryDeserializeNode<u64>(scriptComponent, "ScriptID", 0);
+				sc.ScriptID = TryDeserializeNode<u64>(scriptComponent, "ScriptID", 0);
 
-				ScriptingCore& core = ScriptingCore::Get();
-
-				if (core.IsValidScript(scriptId))
+				for (YAML::Node field : scriptComponent["Fields"])
 				{
-					sc.ScriptID = scriptId;
-
-					const auto& scriptMetadata = core.GetScriptMetadata(scriptId);
+					ParsedScriptField& parsedField = sc.Fields.emplace_back();
 
-					scene->GetScriptStorage().InitializeEntityStorage(scriptId, id);
+					parsedField.ID   = TryDeserializeNode<u32>(field, "ID", 0);
+					parsedField.Type = DataTypeFromString(TryDeserializeNode<std::string>(field, "Type", "Byte"));
+					parsedField.Bits = ParseFieldValueBits(field, parsedField.Type);
 
-					for (YAML::Node field : scriptComponent["Fields"])
-					{
-						u32 fieldID           = TryDeserializeNode<u32>(field, "ID", 0);
-						std::string fieldName = TryDeserializeNode<std::string>(field, "Name", "Field");
-
-						if (scriptMetadata.Fields.contains(fieldID))
-						{
-							const auto& fieldMetadata = scriptMetadata.Fields.at(fieldID);
-							auto& fieldStorage        = scene->GetScriptStorage().EntityStorage.at(id).Fields[fieldID];
-							if (fieldStorage.IsArray())
-							{
-							}
-							else
-							{
-								switch (fieldMetadata.Type)
-								{
-								case DataType::Byte: {
-									fieldStorage.SetValue(TryDeserializeNode<u8>(field, "Value", 0));
-								}
-								break;
-								case DataType::Short: {
-									fieldStorage.SetValue(TryDeserializeNode<i16>(field, "Value", 0));
-								}
-								break;
-								case DataType::UShort: {
-									fieldStorage.SetValue(TryDeserializeNode<u16>(field, "Value", 0));
-								}
-								break;
-								case DataType::Int: {
-									fieldStorage.SetValue(TryDeserializeNode<i32>(field, "Value", 0));
-								}
-								break;
-								case DataType::UInt: {
-									fieldStorage.SetValue(TryDeserializeNode<u32>(field, "Value", 0));
-								}
-								break;
-								case DataType::Long: {
-									fieldStorage.SetValue(TryDeserializeNode<i64>(field, "Value", 0));
-								}
-								break;
-								case DataType::ULong: {
-									fieldStorage.SetValue(TryDeserializeNode<u64>(field, "Value", 0));
-								}
-								break;
-								case DataType::Float: {
-									fieldStorage.SetValue(TryDeserializeNode<f32>(field, "Value", 0.0f));
-								}
-								break;
-								case DataType::Double: {
-									fieldStorage.SetValue(TryDeserializeNode<f64>(field, "Value", 0.0));
-								}
-								break;
-								case DataType::Bool: {
-									fieldStorage.SetValue(TryDeserializeNode<bool>(field, "Value", false));
-								}
-								break;
-								case DataType::Entity: {
-									fieldStorage.SetValue(TryDeserializeNode<u64>(field, "Value", 0));
-								}
-								break;
-								case DataType::Prefab: {
-									fieldStorage.SetValue(TryDeserializeNode<u64>(field, "Value", 0));
-								}
-								break;
-								default:
-									break;
-								}
-							}
-						}
-					}
+					if (const YAML::Node value = field["Value"]; value && value.IsScalar())
+						parsedField.Value = value.Scalar();
 				}
 			}
 
-			if (YAML::Node cameraComponent = entity["Entity"]["CameraComponent"])
+			if (YAML::Node cameraComponent = entity["CameraComponent"])
 			{
-				SceneCamera camera = {TryDeserializeNode<f32>(cameraComponent, "AspectRatio", 0.0f)};
-
-				CameraComponent& cc = deserialized.AddComponent<CameraComponent>(camera);
+				CameraComponent& cc = EmplaceComponent(outEntities.Cameras, index);
 
+				cc.Camera  = SceneCamera(TryDeserializeNode<f32>(cameraComponent, "AspectRatio", 0.0f));
 				cc.Primary = TryDeserializeNode<bool>(cameraComponent, "Primary", false);
 				cc.Camera.SetProjectionType((ProjectionType)TryDeserializeNode<int>(cameraComponent, "ProjectionType",
 				                                                                    (int)ProjectionType::Orthographic));
@@ -763,9 +998,9 @@ namespace SW
 				}
 			}
 
-			if (YAML::Node rigidBody2DComponent = entity["Entity"]["RigidBody2DComponent"])
+			if (YAML::Node rigidBody2DComponent = entity["RigidBody2DComponent"])
 			{
-				RigidBody2DComponent& rbc = deserialized.AddComponent<RigidBody2DComponent>();
+				RigidBody2DComponent& rbc = EmplaceComponent(outEntities.RigidBodies, index);
 
 				rbc.Type =
 				    (PhysicBodyType)TryDeserializeNode<int>(rigidBody2DComponent, "Type", (int)PhysicBodyType::Static);
@@ -781,11 +1016,13 @@ namespace SW
 				rbc.AllowSleep           = TryDeserializeNode<bool>(rigidBody2DComponent, "AllowSleep", true);
 				rbc.InitiallyAwake       = TryDeserializeNode<bool>(rigidBody2DComponent, "InitiallyAwake", true);
 				rbc.IsBullet             = TryDeserializeNode<bool>(rigidBody2DComponent, "IsBullet", false);
+				rbc.CollisionLayer       = TryDeserializeNode<u16>(rigidBody2DComponent, "CollisionLayer", 0x0001);
+				rbc.CollisionMask        = TryDeserializeNode<u16>(rigidBody2DComponent, "CollisionMask", 0xFFFF);
 			}
 
-			if (YAML::Node boxCollider2DComponent = entity["Entity"]["BoxCollider2DComponent"])
+			if (YAML::Node boxCollider2DComponent = entity["BoxCollider2DComponent"])
 			{
-				BoxCollider2DComponent& bcc = deserialized.AddComponent<BoxCollider2DComponent>();
+				BoxCollider2DComponent& bcc = EmplaceComponent(outEntities.BoxColliders, index);
 
 				bcc.Size     = TryDeserializeNode<glm::vec2>(boxCollider2DComponent, "Size", glm::vec2(1.0f));
 				bcc.Offset   = TryDeserializeNode<glm::vec2>(boxCollider2DComponent, "Offset", glm::vec2(0.0f));
@@ -793,9 +1030,9 @@ namespace SW
 				bcc.IsSensor = TryDeserializeNode<bool>(boxCollider2DComponent, "IsSensor", false);
 			}
 
-			if (YAML::Node circleCollider2DComponent = entity["Entity"]["CircleCollider2DComponent"])
+			if (YAML::Node circleCollider2DComponent = entity["CircleCollider2DComponent"])
 			{
-				CircleCollider2DComponent& ccc = deserialized.AddComponent<CircleCollider2DComponent>();
+				CircleCollider2DComponent& ccc = EmplaceComponent(outEntities.CircleColliders, index);
 
 				ccc.Radius   = TryDeserializeNode<f32>(circleCollider2DComponent, "Radius", 0.5f);
 				ccc.Offset   = TryDeserializeNode<glm::vec2>(circleCollider2DComponent, "Offset", glm::vec2(0.0f));
@@ -803,9 +1040,9 @@ namespace SW
 				ccc.IsSensor = TryDeserializeNode<bool>(circleCollider2DComponent, "IsSensor", false);
 			}
 
-			if (YAML::Node polygonCollider2DComponent = entity["Entity"]["PolygonCollider2DComponent"])
+			if (YAML::Node polygonCollider2DComponent = entity["PolygonCollider2DComponent"])
 			{
-				PolygonCollider2DComponent& pcc = deserialized.AddComponent<PolygonCollider2DComponent>();
+				PolygonCollider2DComponent& pcc = EmplaceComponent(outEntities.PolygonColliders, index);
 
 				YAML::Node vertices = polygonCollider2DComponent["Vertices"];
 				u64 count           = TryDeserializeNode<u64>(polygonCollider2DComponent, "VerticesCount", 0);
@@ -822,9 +1059,9 @@ namespace SW
 				pcc.IsSensor = TryDeserializeNode<bool>(polygonCollider2DComponent, "IsSensor", false);
 			}
 
-			if (YAML::Node buoyancyEffector2DComponent = entity["Entity"]["BuoyancyEffector2DComponent"])
+			if (YAML::Node buoyancyEffector2DComponent = entity["BuoyancyEffector2DComponent"])
 			{
-				BuoyancyEffector2DComponent& bec = deserialized.AddComponent<BuoyancyEffector2DComponent>();
+				BuoyancyEffector2DComponent& bec = EmplaceComponent(outEntities.BuoyancyEffectors, index);
 
 				bec.DragMultiplier = TryDeserializeNode<f32>(buoyancyEffector2DComponent, "DragMultiplier", 1.0f);
 				bec.FlowAngle      = TryDeserializeNode<f32>(buoyancyEffector2DComponent, "FlowAngle", 0.0f);
@@ -832,9 +1069,9 @@ namespace SW
 				bec.Density        = TryDeserializeNode<f32>(buoyancyEffector2DComponent, "Density", 2.0f);
 			}
 
-			if (YAML::Node distanceJoint2DComponent = entity["Entity"]["DistanceJoint2DComponent"])
+			if (YAML::Node distanceJoint2DComponent = entity["DistanceJoint2DComponent"])
 			{
-				DistanceJoint2DComponent& djc = deserialized.AddComponent<DistanceJoint2DComponent>();
+				DistanceJoint2DComponent& djc = EmplaceComponent(outEntities.DistanceJoints, index);
 
 				djc.ConnectedEntityID = TryDeserializeNode<u64>(distanceJoint2DComponent, "ConnectedEntityID", 0);
 				djc.EnableCollision   = TryDeserializeNode<bool>(distanceJoint2DComponent, "EnableCollision", false);
@@ -849,9 +1086,9 @@ namespace SW
 				djc.BreakingForce = TryDeserializeNode<f32>(distanceJoint2DComponent, "BreakingForce", FLT_MAX);
 			}
 
-			if (YAML::Node revolutionJoint2DComponent = entity["Entity"]["RevolutionJoint2DComponent"])
+			if (YAML::Node revolutionJoint2DComponent = entity["RevolutionJoint2DComponent"])
 			{
-				RevolutionJoint2DComponent& rjc = deserialized.AddComponent<RevolutionJoint2DComponent>();
+				RevolutionJoint2DComponent& rjc = EmplaceComponent(outEntities.RevolutionJoints, index);
 
 				rjc.ConnectedEntityID = TryDeserializeNode<u64>(revolutionJoint2DComponent, "ConnectedEntityID", 0);
 				rjc.OriginAnchor =
@@ -867,9 +1104,9 @@ namespace SW
 				rjc.EnableCollision = TryDeserializeNode<bool>(revolutionJoint2DComponent, "EnableCollision", false);
 			}
 
-			if (YAML::Node prismaticJoint2DComponent = entity["Entity"]["PrismaticJoint2DComponent"])
+			if (YAML::Node prismaticJoint2DComponent = entity["PrismaticJoint2DComponent"])
 			{
-				PrismaticJoint2DComponent& pjc = deserialized.AddComponent<PrismaticJoint2DComponent>();
+				PrismaticJoint2DComponent& pjc = EmplaceComponent(outEntities.PrismaticJoints, index);
 
 				pjc.ConnectedEntityID = TryDeserializeNode<u64>(prismaticJoint2DComponent, "ConnectedEntityID", 0);
 				pjc.OriginAnchor =
@@ -886,9 +1123,9 @@ namespace SW
 				pjc.EnableCollision  = TryDeserializeNode<bool>(prismaticJoint2DComponent, "EnableCollision", false);
 			}
 
-			if (YAML::Node springJoint2DComponent = entity["Entity"]["SpringJoint2DComponent"])
+			if (YAML::Node springJoint2DComponent = entity["SpringJoint2DComponent"])
 			{
-				SpringJoint2DComponent& sjc = deserialized.AddComponent<SpringJoint2DComponent>();
+				SpringJoint2DComponent& sjc = EmplaceComponent(outEntities.SpringJoints, index);
 
 				sjc.ConnectedEntityID = TryDeserializeNode<u64>(springJoint2DComponent, "ConnectedEntityID", 0);
 				sjc.EnableCollision   = TryDeserializeNode<bool>(springJoint2DComponent, "EnableCollision", false);
@@ -905,9 +1142,9 @@ namespace SW
 				sjc.DampingRatio  = TryDeserializeNode<f32>(springJoint2DComponent, "DampingRatio", 0.5f);
 			}
 
-			if (YAML::Node wheelJoint2DComponent = entity["Entity"]["WheelJoint2DComponent"])
+			if (YAML::Node wheelJoint2DComponent = entity["WheelJoint2DComponent"])
 			{
-				WheelJoint2DComponent& wjc = deserialized.AddComponent<WheelJoint2DComponent>();
+				WheelJoint2DComponent& wjc = EmplaceComponent(outEntities.WheelJoints, index);
 
 				wjc.ConnectedEntityID = TryDeserializeNode<u64>(wheelJoint2DComponent, "ConnectedEntityID", 0);
 				wjc.OriginAnchor =
@@ -925,9 +1162,9 @@ namespace SW
 				wjc.EnableCollision  = TryDeserializeNode<bool>(wheelJoint2DComponent, "EnableCollision", false);
 			}
 
-			if (YAML::Node audioSourceComponent = entity["Entity"]["AudioSourceComponent"])
+			if (YAML::Node audioSourceComponent = entity["AudioSourceComponent"])
 			{
-				AudioSourceComponent& asc = deserialized.AddComponent<AudioSourceComponent>();
+				AudioSourceComponent& asc = EmplaceComponent(outEntities.AudioSources, index);
 
 				asc.Handle       = TryDeserializeNode<AssetHandle>(audioSourceComponent, "AudioHandle", 0);
 				asc.Volume       = TryDeserializeNode<f32>(audioSourceComponent, "Volume", 1.0f);
@@ -949,7 +1186,7 @@ namespace SW
 				asc.DopplerFactor = TryDeserializeNode<f32>(audioSourceComponent, "DopplerFactor", 1.0f);
 			}
 
-			if (YAML::Node audioListenerComponent = entity["Entity"]["AudioListenerComponent"])
+			if (YAML::Node audioListenerComponent = entity["AudioListenerComponent"])
 			{
 				// AudioListenerComponent& alc = deserialized.AddComponent<AudioListenerComponent>();
 
@@ -961,4 +1198,133 @@ namespace SW
 		}
 	}
 
+	void SceneSerializer::CommitEntities(ParsedEntities& entities, Scene* scene)
+	{
+		PROFILE_FUNCTION();
+
+		entt::registry& registry = scene->GetRegistry().GetRegistryHandle();
+
+		std::vector<entt::entity> handles;
+
+		scene->CreateEntitiesWithIDs(entities.IDs.data(), (u32)entities.IDs.size(), handles);
+
+		// Required components were already emplaced by the scene - fill them entity by entity
+		for (size_t i = 0; i < handles.size(); i++)
+		{
+			registry.get<TagComponent>(handles[i]).Tag      = std::move(entities.Tags[i]);
+			registry.get<TransformComponent>(handles[i])    = entities.Transforms[i];
+			registry.get<RelationshipComponent>(handles[i]) = std::move(entities.Relationships[i]);
+		}
+
+		for (SpriteComponent& sc : entities.Sprites.Components)
+		{
+			if (sc.Handle != 0 && !AssetManager::IsValid(sc.Handle))
+			{
+				APP_ERROR("SceneSerializer - Invalid ID: {} for sprite, skipping.", sc.Handle);
+
+				sc.Handle = 0;
+			}
+		}
+
+		InsertComponents(registry, handles, entities.Sprites);
+
+		ParsedComponents<AnimatedSpriteComponent> animatedSprites;
+		animatedSprites.Indices = std::move(entities.AnimatedSprites.Indices);
+		animatedSprites.Components.resize(animatedSprites.Indices.size());
+
+		for (size_t i = 0; i < animatedSprites.Indices.size(); i++)
+		{
+			const ParsedAnimatedSprite& parsed = entities.AnimatedSprites.Components[i];
+			AnimatedSpriteComponent& asc       = animatedSprites.Components[i];
+
+			asc.CurrentFrame = parsed.CurrentFrame;
+			asc.CurrentAnimation =
+			    parsed.CurrentAnimation ? AssetManager::GetAssetRaw<Animation2D>(parsed.CurrentAnimation) : nullptr;
+			asc.DefaultAnimation =
+			    parsed.DefaultAnimation ? AssetManager::GetAssetRaw<Animation2D>(parsed.DefaultAnimation) : nullptr;
+
+			for (const auto& [name, animHandle] : parsed.Animations)
+			{
+				Animation2D** anim = AssetManager::GetAssetRaw<Animation2D>(animHandle);
+
+				if (anim && *anim)
+				{
+					asc.Animations[StringId(name)] = {name, anim};
+				}
+				else
+				{
+					APP_ERROR("SceneSerializer - Invalid ID: {} for animation, skipping.", animHandle);
+				}
+			}
+		}
+
+		InsertComponents(registry, handles, animatedSprites);
+		InsertComponents(registry, handles, entities.Circles);
+		InsertComponents(registry, handles, entities.Texts);
+
+		ParsedComponents<ScriptComponent> scripts;
+		scripts.Indices = std::move(entities.Scripts.Indices);
+		scripts.Components.resize(scripts.Indices.size());
+
+		ScriptingCore& core = ScriptingCore::Get();
+
+		for (size_t i = 0; i < scripts.Indices.size(); i++)
+		{
+			const ParsedScript& parsed = entities.Scripts.Components[i];
+
+			if (!core.IsValidScript(parsed.ScriptID))
+				continue;
+
+			scripts.Components[i].ScriptID = parsed.ScriptID;
+
+			const u64 id               = entities.IDs[scripts.Indices[i]];
+			const auto& scriptMetadata = core.GetScriptMetadata(parsed.ScriptID);
+
+			scene->GetScriptStorage().InitializeEntityStorage(parsed.ScriptID, id);
+
+			auto& entityStorage = scene->GetScriptStorage().EntityStorage.at(id);
+
+			for (const ParsedScriptField& field : parsed.Fields)
+			{
+				const auto it = scriptMetadata.Fields.find(field.ID);
+
+				if (it == scriptMetadata.Fields.end())
+					continue;
+
+				FieldStorage& fieldStorage = entityStorage.Fields[field.ID];
+
+				if (fieldStorage.IsArray())
+					continue;
+
+				const DataType type = it->second.Type;
+
+				if (type == field.Type)
+				{
+					SetFieldValueBits(fieldStorage, type, field.Bits);
+				}
+				else // the field changed type since the scene was saved, convert the written value
+				{
+					YAML::Node value;
+					value["Value"] = field.Value;
+
+					SetFieldValueBits(fieldStorage, type, ParseFieldValueBits(value, type));
+				}
+			}
+		}
+
+		InsertComponents(registry, handles, scripts);
+		InsertComponents(registry, handles, entities.Cameras);
+		InsertComponents(registry, handles, entities.RigidBodies);
+		InsertComponents(registry, handles, entities.BoxColliders);
+		InsertComponents(registry, handles, entities.CircleColliders);
+		InsertComponents(registry, handles, entities.PolygonColliders);
+		InsertComponents(registry, handles, entities.BuoyancyEffectors);
+		InsertComponents(registry, handles, entities.DistanceJoints);
+		InsertComponents(registry, handles, entities.RevolutionJoints);
+		InsertComponents(registry, handles, entities.PrismaticJoints);
+		InsertComponents(registry, handles, entities.SpringJoints);
+		InsertComponents(registry, handles, entities.WheelJoints);
+		InsertComponents(registry, handles, entities.AudioSources);
+	}
+
 } // namespace SW
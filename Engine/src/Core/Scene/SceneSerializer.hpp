@@ -1,7 +1,7 @@
 /**
  * @file SceneSerializer.hpp
  * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
- * @version 0.1.2
+ * @version 0.1.5
  * @date 2024-04-13
  *
  * @copyright Copyright (c) 2024 Tycjan Fortuna
@@ -21,6 +21,89 @@ namespace SW
 
 	class Scene;
 
+	/**
+	 * @brief Components of one type parsed for some of the entities of ParsedEntities.
+	 */
+	template <typename T>
+	struct ParsedComponents
+	{
+		std::vector<u32> Indices;  /**< Indices of the owning entities. */
+		std::vector<T> Components; /**< The components, parallel to Indices. */
+	};
+
+	/**
+	 * @brief Animated sprite as written in the file, the animations are resolved by handle on commit.
+	 */
+	struct ParsedAnimatedSprite
+	{
+		int CurrentFrame             = 0;
+		AssetHandle CurrentAnimation = 0u;
+		AssetHandle DefaultAnimation = 0u;
+
+		std::vector<std::pair<std::string, AssetHandle>> Animations; /**< Name and handle of every animation. */
+	};
+
+	/**
+	 * @brief Non array script field as written in the file.
+	 */
+	struct ParsedScriptField
+	{
+		u32 ID        = 0;              /**< ID of the field. */
+		DataType Type = DataType::Byte; /**< Type written in the file. */
+		u64 Bits      = 0;              /**< The value parsed as Type, packed by ToValueBits(). */
+
+		std::string Value; /**< The raw value, re-parsed on commit if the field changed type since. */
+	};
+
+	/**
+	 * @brief Script as written in the file, the storage is initialized on commit.
+	 */
+	struct ParsedScript
+	{
+		u64 ScriptID = 0u;
+
+		std::vector<ParsedScriptField> Fields;
+	};
+
+	/**
+	 * @brief Entities parsed from YAML into plain records, not tied to any scene yet.
+	 *
+	 * 		  Parsing touches neither the scene nor the asset manager, so chunks of the entities can be parsed on
+	 * 		  worker threads, appended in file order and committed to the scene at once (see CommitEntities()).
+	 */
+	struct ParsedEntities
+	{
+		std::vector<u64> IDs;
+		std::vector<std::string> Tags;
+		std::vector<TransformComponent> Transforms;
+		std::vector<RelationshipComponent> Relationships;
+
+		ParsedComponents<SpriteComponent> Sprites;
+		ParsedComponents<ParsedAnimatedSprite> AnimatedSprites;
+		ParsedComponents<CircleComponent> Circles;
+		ParsedComponents<TextComponent> Texts;
+		ParsedComponents<ParsedScript> Scripts;
+		ParsedComponents<CameraComponent> Cameras;
+		ParsedComponents<RigidBody2DComponent> RigidBodies;
+		ParsedComponents<BoxCollider2DComponent> BoxColliders;
+		ParsedComponents<CircleCollider2DComponent> CircleColliders;
+		ParsedComponents<PolygonCollider2DComponent> PolygonColliders;
+		ParsedComponents<BuoyancyEffector2DComponent> BuoyancyEffectors;
+		ParsedComponents<DistanceJoint2DComponent> DistanceJoints;
+		ParsedComponents<RevolutionJoint2DComponent> RevolutionJoints;
+		ParsedComponents<PrismaticJoint2DComponent> PrismaticJoints;
+		ParsedComponents<SpringJoint2DComponent> SpringJoints;
+		ParsedComponents<WheelJoint2DComponent> WheelJoints;
+		ParsedComponents<AudioSourceComponent> AudioSources;
+
+		/**
+		 * @brief Moves the entities of other behind the entities of this one.
+		 *
+		 * @param other The entities to append.
+		 */
+		void Append(ParsedEntities&& other);
+	};
+
 	/**
 	 * @brief Class responsible for serializing and deserializing scenes.
 	 */
@@ -29,6 +112,7 @@ namespace SW
 	public:
 		/**
 		 * @brief Serializes scene to file.
+		 * @note Paths with the binary scene extension are written by SceneBinarySerializer.
 		 *
 		 * @param scene Scene to serialize.
 		 * @param path Path to file.
@@ -39,13 +123,59 @@ namespace SW
 
 		/**
 		 * @brief Deserializes scene from file.
+		 * @note Paths with the binary scene extension are read by SceneBinarySerializer.
 		 *
 		 * @param scene Scene to deserialize.
 		 * @param path Path to file.
 		 */
 		[[nodiscard]] static Scene* Deserialize(const std::filesystem::path& path);
 
+		/**
+		 * @brief Reads the dependency manifest of the scene (see SceneDependencies) without deserializing it.
+		 * @note Paths with the binary scene extension are read by SceneBinarySerializer.
+		 *
+		 * @param path Path to file.
+		 * @return The handles of the dependencies, empty if the file has no manifest.
+		 */
+		static std::vector<AssetHandle> DeserializeDependencies(const std::filesystem::path& path);
+
+		/**
+		 * @brief Deserializes the entities into the scene, ParseEntitiesNode() followed by CommitEntities().
+		 *
+		 * @param entitiesNode The sequence of entities.
+		 * @param scene Scene to deserialize into.
+		 */
 		static void DeserializeEntitiesNode(YAML::Node& entitiesNode, Scene* scene);
+
+		/**
+		 * @brief Parses the entities into plain records.
+		 * @note Thread safe as long as the node is not shared with other threads, the node is only read.
+		 *
+		 * @param entitiesNode The sequence of entities.
+		 * @param outEntities The parsed entities are appended here.
+		 */
+		static void ParseEntitiesNode(const YAML::Node& entitiesNode, ParsedEntities& outEntities);
+
+		/**
+		 * @brief Parses the entities of the scene file on worker threads, one range of the entities per worker.
+		 * @note Scenes with too few entities to be worth a second worker are not split.
+		 *
+		 * @param path Path to the scene file.
+		 * @param maxWorkers Maximum number of workers (Deserialize() uses one per hardware thread).
+		 * @param outEntities The parsed entities, in file order.
+		 * @return The number of ranges parsed, 0 if the file was not split and has to be parsed as a whole.
+		 */
+		static u32 ParseEntitiesParallel(const std::filesystem::path& path, u32 maxWorkers,
+		                                 ParsedEntities& outEntities);
+
+		/**
+		 * @brief Creates the parsed entities in the scene, every component type is emplaced in bulk.
+		 * @note Main thread only, the asset handles and scripts are resolved here. The records are moved from.
+		 *
+		 * @param entities The parsed entities.
+		 * @param scene Scene to create the entities in.
+		 */
+		static void CommitEntities(ParsedEntities& entities, Scene* scene);
 	};
 
 } // namespace SW
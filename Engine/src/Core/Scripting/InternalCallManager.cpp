@@ -68,6 +68,25 @@ namespace SW
 		return scene->TryGetEntityByID(entityID);
 	};
 
+	static b2Body* GetRuntimeBody2D(u64 entityID, RigidBody2DComponent& rbc)
+	{
+		// Body added in the current frame is created with the next physics batch - create the batch now
+		if (!rbc.Handle)
+			ScriptingCore::Get().GetCurrentScene()->FlushPhysicsCommands2D();
+
+		// The batch can not be created while the world is locked
+		if (!rbc.Handle)
+		{
+			SYSTEM_ERROR("[SCRIPT]: RigidBody2D of entity {} added inside of a physics callback can not be accessed "
+			             "before the next physics step!",
+			             entityID);
+
+			return nullptr;
+		}
+
+		return static_cast<b2Body*>(rbc.Handle);
+	}
+
 	static inline Entity GetEntityByTag(std::string tag)
 	{
 		Scene* scene = ScriptingCore::Get().GetCurrentScene();
@@ -97,6 +116,8 @@ namespace SW
 		RegisterManagedComponent<TextComponent>(coreAssembly);
 		RegisterManagedComponent<ScriptComponent>(coreAssembly);
 		RegisterManagedComponent<RigidBody2DComponent>(coreAssembly);
+		RegisterManagedComponent<BoxCollider2DComponent>(coreAssembly);
+		RegisterManagedComponent<CircleCollider2DComponent>(coreAssembly);
 		RegisterManagedComponent<AudioSourceComponent>(coreAssembly);
 	}
 
@@ -300,6 +321,80 @@ namespace SW
 		return scene->InstantiatePrefab(prefab, inPosition, inRotation, inScale).GetID();
 	}
 
+	bool Scene_RayCast2D(RayCastQuery2D* inQuery, RayCastHit2D* outHit)
+	{
+		Scene* scene = ScriptingCore::Get().GetCurrentScene();
+
+		ASSERT(scene, "No active scene!");
+
+		return scene->RayCast2D(*inQuery, outHit);
+	}
+
+	void Scene_RayCast2DBatch(RayCastQuery2D* inQueries, u32 count, RayCastHit2D* outHits)
+	{
+		Scene* scene = ScriptingCore::Get().GetCurrentScene();
+
+		ASSERT(scene, "No active scene!");
+
+		scene->RayCast2DBatch(inQueries, count, outHits);
+	}
+
+	u32 Scene_OverlapAABB2D(AABBQuery2D* inQuery, u64* outEntityIDs, u32 capacity)
+	{
+		Scene* scene = ScriptingCore::Get().GetCurrentScene();
+
+		ASSERT(scene, "No active scene!");
+
+		return scene->OverlapAABB2D(*inQuery, outEntityIDs, capacity);
+	}
+
+	void Scene_OverlapAABB2DBatch(AABBQuery2D* inQueries, u32 count, u64* outEntityIDs, u32 capacityPerQuery,
+	                              u32* outCounts)
+	{
+		Scene* scene = ScriptingCore::Get().GetCurrentScene();
+
+		ASSERT(scene, "No active scene!");
+
+		scene->OverlapAABB2DBatch(inQueries, count, outEntityIDs, capacityPerQuery, outCounts);
+	}
+
+	u32 Scene_OverlapCircle2D(CircleQuery2D* inQuery, u64* outEntityIDs, u32 capacity)
+	{
+		Scene* scene = ScriptingCore::Get().GetCurrentScene();
+
+		ASSERT(scene, "No active scene!");
+
+		return scene->OverlapCircle2D(*inQuery, outEntityIDs, capacity);
+	}
+
+	void Scene_OverlapCircle2DBatch(CircleQuery2D* inQueries, u32 count, u64* outEntityIDs, u32 capacityPerQuery,
+	                                u32* outCounts)
+	{
+		Scene* scene = ScriptingCore::Get().GetCurrentScene();
+
+		ASSERT(scene, "No active scene!");
+
+		scene->OverlapCircle2DBatch(inQueries, count, outEntityIDs, capacityPerQuery, outCounts);
+	}
+
+	bool Scene_ShapeCast2D(ShapeCastQuery2D* inQuery, RayCastHit2D* outHit)
+	{
+		Scene* scene = ScriptingCore::Get().GetCurrentScene();
+
+		ASSERT(scene, "No active scene!");
+
+		return scene->ShapeCast2D(*inQuery, outHit);
+	}
+
+	void Scene_ShapeCast2DBatch(ShapeCastQuery2D* inQueries, u32 count, RayCastHit2D* outHits)
+	{
+		Scene* scene = ScriptingCore::Get().GetCurrentScene();
+
+		ASSERT(scene, "No active scene!");
+
+		scene->ShapeCast2DBatch(inQueries, count, outHits);
+	}
+
 	Coral::String TagComponent_GetTag(u64 entityID)
 	{
 		Entity entity = GetEntityById(entityID);
@@ -354,8 +449,11 @@ namespace SW
 				return;
 			}
 
-			b2Body* body = static_cast<b2Body*>(rbc.Handle);
-			body->SetTransform({inPosition->x, inPosition->y}, body->GetAngle());
+			// Baked collider can not be moved as part of the shared static body
+			ScriptingCore::Get().GetCurrentScene()->UnbakeStaticCollider2D(entity);
+
+			if (b2Body* body = GetRuntimeBody2D(entityID, rbc))
+				body->SetTransform({inPosition->x, inPosition->y}, body->GetAngle());
 		}
 
 		entity.GetComponent<TransformComponent>().Position = *inPosition;
@@ -409,7 +507,7 @@ namespace SW
 
 		Coral::String::Free(name);
 
-		auto it = asc.Animations.find(animationName);
+		auto it = asc.Animations.find(StringId(animationName));
 		if (it == asc.Animations.end())
 		{
 			APP_ERROR("Could not find animation {} for entity {}", animationName, entityID);
@@ -417,7 +515,7 @@ namespace SW
 		}
 
 		asc.CurrentFrame     = 0;
-		asc.CurrentAnimation = it->second;
+		asc.CurrentAnimation = it->second.Value;
 	}
 
 	void AnimatedSpriteComponent_Stop(u64 entityID)
@@ -532,9 +630,15 @@ namespace SW
 
 		RigidBody2DComponent& rbc = entity.GetComponent<RigidBody2DComponent>();
 
-		ASSERT(rbc.Handle);
+		b2Body* body = GetRuntimeBody2D(entityID, rbc);
+
+		if (!body)
+		{
+			*outVelocity = glm::vec2(0.f);
+
+			return;
+		}
 
-		b2Body* body          = (b2Body*)rbc.Handle;
 		const b2Vec2 velocity = body->GetLinearVelocity();
 
 		outVelocity->x = velocity.x;
@@ -549,10 +653,8 @@ namespace SW
 
 		RigidBody2DComponent& rbc = entity.GetComponent<RigidBody2DComponent>();
 
-		ASSERT(rbc.Handle);
-
-		b2Body* body = (b2Body*)rbc.Handle;
-		body->SetLinearVelocity({inVelocity->x, inVelocity->y});
+		if (b2Body* body = GetRuntimeBody2D(entityID, rbc))
+			body->SetLinearVelocity({inVelocity->x, inVelocity->y});
 	}
 
 	void RigidBody2DComponent_ApplyForce(u64 entityID, glm::vec2* inForce, glm::vec2* inOffset, bool wake)
@@ -563,8 +665,6 @@ namespace SW
 
 		RigidBody2DComponent& rbc = entity.GetComponent<RigidBody2DComponent>();
 
-		ASSERT(rbc.Handle);
-
 		if (rbc.Type != PhysicBodyType::Dynamic)
 		{
 			SYSTEM_WARN("[SCRIPT]: Trying to apply force for non-dynamic RigidBody2D for entity with ID: {}.",
@@ -572,8 +672,8 @@ namespace SW
 			return;
 		}
 
-		b2Body* body = (b2Body*)rbc.Handle;
-		body->ApplyForce(*(const b2Vec2*)inForce, body->GetWorldCenter() + *(const b2Vec2*)inOffset, wake);
+		if (b2Body* body = GetRuntimeBody2D(entityID, rbc))
+			body->ApplyForce(*(const b2Vec2*)inForce, body->GetWorldCenter() + *(const b2Vec2*)inOffset, wake);
 	}
 
 	void AudioSourceComponent_Play(u64 entityID)
@@ -706,6 +806,15 @@ namespace SW
 		ADD_INTERNAL_CALL(Scene_InstantiatePrefabWithPositionRotation);
 		ADD_INTERNAL_CALL(Scene_InstantiatePrefabWithPositionRotationScale);
 
+		ADD_INTERNAL_CALL(Scene_RayCast2D);
+		ADD_INTERNAL_CALL(Scene_RayCast2DBatch);
+		ADD_INTERNAL_CALL(Scene_OverlapAABB2D);
+		ADD_INTERNAL_CALL(Scene_OverlapAABB2DBatch);
+		ADD_INTERNAL_CALL(Scene_OverlapCircle2D);
+		ADD_INTERNAL_CALL(Scene_OverlapCircle2DBatch);
+		ADD_INTERNAL_CALL(Scene_ShapeCast2D);
+		ADD_INTERNAL_CALL(Scene_ShapeCast2DBatch);
+
 		ADD_INTERNAL_CALL(TagComponent_GetTag);
 		ADD_INTERNAL_CALL(TagComponent_SetTag);
 
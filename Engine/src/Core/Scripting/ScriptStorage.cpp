@@ -175,4 +175,76 @@ namespace SW
 		fieldStorage.m_Instance = nullptr;
 	}
 
+	u64 GetFieldValueBits(const FieldStorage& storage, DataType type)
+	{
+		switch (type)
+		{
+		case DataType::Byte:
+			return ToValueBits(storage.GetValue<u8>());
+		case DataType::Short:
+			return ToValueBits(storage.GetValue<i16>());
+		case DataType::UShort:
+			return ToValueBits(storage.GetValue<u16>());
+		case DataType::Int:
+			return ToValueBits(storage.GetValue<i32>());
+		case DataType::UInt:
+			return ToValueBits(storage.GetValue<u32>());
+		case DataType::Long:
+			return ToValueBits(storage.GetValue<i64>());
+		case DataType::ULong:
+		case DataType::Entity:
+		case DataType::Prefab:
+			return ToValueBits(storage.GetValue<u64>());
+		case DataType::Float:
+			return ToValueBits(storage.GetValue<f32>());
+		case DataType::Double:
+			return ToValueBits(storage.GetValue<f64>());
+		case DataType::Bool:
+			return ToValueBits(storage.GetValue<bool>());
+		default:
+			return 0;
+		}
+	}
+
+	void SetFieldValueBits(FieldStorage& storage, DataType type, u64 bits)
+	{
+		switch (type)
+		{
+		case DataType::Byte:
+			storage.SetValue(FromValueBits<u8>(bits));
+			break;
+		case DataType::Short:
+			storage.SetValue(FromValueBits<i16>(bits));
+			break;
+		case DataType::UShort:
+			storage.SetValue(FromValueBits<u16>(bits));
+			break;
+		case DataType::Int:
+			storage.SetValue(FromValueBits<i32>(bits));
+			break;
+		case DataType::UInt:
+			storage.SetValue(FromValueBits<u32>(bits));
+			break;
+		case DataType::Long:
+			storage.SetValue(FromValueBits<i64>(bits));
+			break;
+		case DataType::ULong:
+		case DataType::Entity:
+		case DataType::Prefab:
+			storage.SetValue(FromValueBits<u64>(bits));
+			break;
+		case DataType::Float:
+			storage.SetValue(FromValueBits<f32>(bits));
+			break;
+		case DataType::Double:
+			storage.SetValue(FromValueBits<f64>(bits));
+			break;
+		case DataType::Bool:
+			storage.SetValue(FromValueBits<bool>(bits));
+			break;
+		default:
+			break;
+		}
+	}
+
 } // namespace SW
@@ -1,7 +1,7 @@
 /**
  * @file ScriptStorage.hpp
  * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
- * @version 0.1.0
+ * @version 0.1.1
  * @date 2024-03-09
  *
  * @copyright Copyright (c) 2024 Tycjan Fortuna
@@ -271,6 +271,52 @@ namespace SW
 		friend class ScriptingCore;
 	};
 
+	/**
+	 * @brief Packs a single field value into the low bytes of an u64 (e.g. to store it in a flat record).
+	 */
+	template <typename T>
+	inline u64 ToValueBits(T value)
+	{
+		static_assert(sizeof(T) <= sizeof(u64) && std::is_trivially_copyable_v<T>);
+
+		u64 bits = 0;
+		std::memcpy(&bits, &value, sizeof(T));
+
+		return bits;
+	}
+
+	/**
+	 * @brief Unpacks a single field value packed by ToValueBits().
+	 */
+	template <typename T>
+	inline T FromValueBits(u64 bits)
+	{
+		static_assert(sizeof(T) <= sizeof(u64) && std::is_trivially_copyable_v<T>);
+
+		T value;
+		std::memcpy(&value, &bits, sizeof(T));
+
+		return value;
+	}
+
+	/**
+	 * @brief Reads the value of a non array field packed by ToValueBits().
+	 *
+	 * @param storage The field.
+	 * @param type The type to read the value as.
+	 * @return The packed value, 0 for unknown types.
+	 */
+	u64 GetFieldValueBits(const FieldStorage& storage, DataType type);
+
+	/**
+	 * @brief Writes the value of a non array field packed by ToValueBits().
+	 *
+	 * @param storage The field.
+	 * @param type The type the value was packed as.
+	 * @param bits The packed value, ignored for unknown types.
+	 */
+	void SetFieldValueBits(FieldStorage& storage, DataType type, u64 bits);
+
 	struct EntityScriptStorage
 	{
 		u64 ScriptID;
@@ -138,8 +138,7 @@ namespace SW
 				if (fieldNameStr == "ID")
 					continue;
 
-				std::string fullFieldName = std::format("{}.{}", fullName, fieldNameStr);
-				u32 fieldID               = Hash::GenerateFNVHash(fullFieldName);
+				const u32 fieldID = Hash::GenerateFNVHash(fullName, fieldNameStr);
 
 				FieldMetadata& fieldMetadata = metadata.Fields[fieldID];
 				fieldMetadata.Name           = fieldName;
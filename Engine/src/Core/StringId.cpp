@@ -0,0 +1,45 @@
+#include "StringId.hpp"
+
+#include <mutex>
+
+namespace SW
+{
+
+#ifdef SW_DEBUG_BUILD
+
+	static std::mutex s_DebugNamesMutex;
+	static std::unordered_map<u64, std::string> s_DebugNames;
+
+	std::string_view StringId::GetDebugName() const
+	{
+		std::scoped_lock lock(s_DebugNamesMutex);
+
+		auto it = s_DebugNames.find(m_Hash);
+
+		return it != s_DebugNames.end() ? std::string_view(it->second) : std::string_view(); // nodes never move
+	}
+
+	void StringId::RegisterDebugName(u64 hash, std::string_view str)
+	{
+		std::scoped_lock lock(s_DebugNamesMutex);
+
+		auto [it, isInserted] = s_DebugNames.try_emplace(hash, str);
+
+		if (!isInserted && it->second != str)
+			SYSTEM_WARN("StringId collision: '{}' and '{}' share the hash {:#x}", it->second, str, hash);
+	}
+
+#else
+
+	std::string_view StringId::GetDebugName() const
+	{
+		return {};
+	}
+
+	void StringId::RegisterDebugName(u64 /*hash*/, std::string_view /*str*/)
+	{
+	}
+
+#endif
+
+} // namespace SW
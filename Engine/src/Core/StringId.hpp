@@ -0,0 +1,119 @@
+/**
+ * @file StringId.hpp
+ * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
+ * @version 0.1.0
+ * @date 2024-06-03
+ *
+ * @copyright Copyright (c) 2024 Tycjan Fortuna
+ */
+#pragma once
+
+#include <type_traits>
+
+namespace SW
+{
+
+	/**
+	 * @brief Identifier of a string, the 64 bit FNV-1a hash of its characters.
+	 *
+	 * 		  Comparing and hashing is a single integer operation, literals are hashed at compile time ("Idle"_hash).
+	 * 		  In debug builds the ids constructed at runtime remember their strings, so GetDebugName() can tell
+	 * 		  them back and colliding strings are reported.
+	 * @note Default constructed id is invalid, no string hashes to 0 in practice.
+	 */
+	class StringId final
+	{
+	public:
+		constexpr StringId() = default;
+
+		/**
+		 * @brief Hashes the string.
+		 *
+		 * @param str The string to hash.
+		 */
+		explicit constexpr StringId(std::string_view str) : m_Hash(Generate(str))
+		{
+#ifdef SW_DEBUG_BUILD
+			if (!std::is_constant_evaluated())
+				RegisterDebugName(m_Hash, str);
+#endif
+		}
+
+		/**
+		 * @brief Creates the id from an already computed hash (e.g. a deserialized one).
+		 *
+		 * @param hash The hash of the string.
+		 * @return The id.
+		 */
+		static constexpr StringId FromHash(u64 hash)
+		{
+			StringId id;
+			id.m_Hash = hash;
+
+			return id;
+		}
+
+		/**
+		 * @brief Hashes the string with 64 bit FNV-1a.
+		 *
+		 * @param str The string to hash.
+		 * @return The hash.
+		 */
+		static constexpr u64 Generate(std::string_view str)
+		{
+			constexpr u64 FNV_PRIME    = 1099511628211ull;
+			constexpr u64 OFFSET_BASIS = 14695981039346656037ull;
+
+			u64 hash = OFFSET_BASIS;
+
+			for (const char c : str)
+			{
+				hash ^= (u64)(u8)c;
+				hash *= FNV_PRIME;
+			}
+
+			return hash;
+		}
+
+		/**
+		 * @brief Gets the string the id was constructed from.
+		 * @note Only ids constructed at runtime in debug builds are known, literals hashed at compile time are not.
+		 *
+		 * @return The string, empty if unknown.
+		 */
+		std::string_view GetDebugName() const;
+
+		constexpr u64 GetHash() const { return m_Hash; }
+		constexpr bool IsValid() const { return m_Hash != 0; }
+
+		constexpr bool operator==(const StringId& other) const = default;
+
+	private:
+		u64 m_Hash = 0; /**< The hash of the string, 0 if invalid. */
+
+		/**
+		 * @brief Remembers the string of the hash, reports a different string with the same hash.
+		 *
+		 * @param hash The hash of the string.
+		 * @param str The string.
+		 */
+		static void RegisterDebugName(u64 hash, std::string_view str);
+	};
+
+	/**
+	 * @brief Hashes the literal at compile time.
+	 *
+	 * @return The id of the literal.
+	 */
+	consteval StringId operator""_hash(const char* str, size_t length)
+	{
+		return StringId(std::string_view(str, length));
+	}
+
+} // namespace SW
+
+template <>
+struct std::hash<SW::StringId>
+{
+	size_t operator()(const SW::StringId& id) const noexcept { return (size_t)id.GetHash(); }
+};
@@ -0,0 +1,368 @@
+#include "BlockCompression.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace SW
+{
+
+	using BlockPixels = u8[16][4]; // RGBA8 pixels of a single block, row by row
+
+	static void LoadBlock(const u8* pixels, i32 width, i32 height, i32 blockX, i32 blockY, BlockPixels& outBlock)
+	{
+		for (i32 y = 0; y < 4; y++)
+		{
+			const i32 sourceY = std::min(blockY * 4 + y, height - 1);
+
+			for (i32 x = 0; x < 4; x++)
+			{
+				const i32 sourceX = std::min(blockX * 4 + x, width - 1);
+
+				std::memcpy(outBlock[y * 4 + x], pixels + ((u64)sourceY * width + sourceX) * 4, 4);
+			}
+		}
+	}
+
+	static void StoreBlock(const BlockPixels& block, i32 width, i32 height, i32 blockX, i32 blockY, u8* pixels)
+	{
+		for (i32 y = 0; y < 4 && blockY * 4 + y < height; y++)
+		{
+			for (i32 x = 0; x < 4 && blockX * 4 + x < width; x++)
+			{
+				const u64 target = ((u64)(blockY * 4 + y) * width + (blockX * 4 + x)) * 4;
+
+				std::memcpy(pixels + target, block[y * 4 + x], 4);
+			}
+		}
+	}
+
+	static void WriteU16(u8* out, u16 value)
+	{
+		out[0] = (u8)(value & 0xFF);
+		out[1] = (u8)(value >> 8);
+	}
+
+	static u16 ReadU16(const u8* in)
+	{
+		return (u16)(in[0] | (in[1] << 8));
+	}
+
+	static u16 PackRGB565(const f32 color[3])
+	{
+		const i32 r = std::clamp((i32)(color[0] * 31.f / 255.f + 0.5f), 0, 31);
+		const i32 g = std::clamp((i32)(color[1] * 63.f / 255.f + 0.5f), 0, 63);
+		const i32 b = std::clamp((i32)(color[2] * 31.f / 255.f + 0.5f), 0, 31);
+
+		return (u16)((r << 11) | (g << 5) | b);
+	}
+
+	static void UnpackRGB565(u16 packed, i32 outColor[3])
+	{
+		const i32 r = (packed >> 11) & 31;
+		const i32 g = (packed >> 5) & 63;
+		const i32 b = packed & 31;
+
+		outColor[0] = (r << 3) | (r >> 2);
+		outColor[1] = (g << 2) | (g >> 4);
+		outColor[2] = (b << 3) | (b >> 2);
+	}
+
+	// Colors of the indices 0-3, BC1 switches to the 3 color mode with transparent black if color0 <= color1.
+	static void GetColorPalette(u16 color0, u16 color1, bool allowThreeColors, i32 outPalette[4][4])
+	{
+		UnpackRGB565(color0, outPalette[0]);
+		UnpackRGB565(color1, outPalette[1]);
+
+		const bool hasFourColors = color0 > color1 || !allowThreeColors;
+
+		outPalette[0][3] = outPalette[1][3] = outPalette[2][3] = outPalette[3][3] = 255;
+
+		for (i32 i = 0; i < 3; i++)
+		{
+			const i32 c0 = outPalette[0][i];
+			const i32 c1 = outPalette[1][i];
+
+			if (hasFourColors)
+			{
+				outPalette[2][i] = (2 * c0 + c1) / 3;
+				outPalette[3][i] = (c0 + 2 * c1) / 3;
+			}
+			else
+			{
+				outPalette[2][i] = (c0 + c1) / 2;
+				outPalette[3][i] = 0;
+			}
+		}
+
+		if (!hasFourColors)
+			outPalette[3][3] = 0; // transparent black
+	}
+
+	static void GetAlphaPalette(u8 alpha0, u8 alpha1, i32 outPalette[8])
+	{
+		outPalette[0] = alpha0;
+		outPalette[1] = alpha1;
+
+		if (alpha0 > alpha1)
+		{
+			for (i32 i = 2; i < 8; i++)
+				outPalette[i] = ((8 - i) * alpha0 + (i - 1) * alpha1) / 7;
+		}
+		else
+		{
+			for (i32 i = 2; i < 6; i++)
+				outPalette[i] = ((6 - i) * alpha0 + (i - 1) * alpha1) / 5;
+
+			outPalette[6] = 0;
+			outPalette[7] = 255;
+		}
+	}
+
+	static void EncodeColorBlock(const BlockPixels& block, u8* out)
+	{
+		f32 mean[3] = {};
+
+		for (const u8* pixel : block)
+		{
+			for (i32 i = 0; i < 3; i++)
+				mean[i] += pixel[i] / 16.f;
+		}
+
+		f32 covariance[3][3] = {};
+
+		for (const u8* pixel : block)
+		{
+			const f32 d[3] = {pixel[0] - mean[0], pixel[1] - mean[1], pixel[2] - mean[2]};
+
+			for (i32 i = 0; i < 3; i++)
+			{
+				for (i32 j = 0; j < 3; j++)
+					covariance[i][j] += d[i] * d[j];
+			}
+		}
+
+		// Power iteration converges to the axis along which the colors of the block spread the most.
+		f32 axis[3] = {1.f, 1.f, 1.f};
+
+		for (i32 iteration = 0; iteration < 8; iteration++)
+		{
+			f32 next[3] = {};
+
+			for (i32 i = 0; i < 3; i++)
+				next[i] = covariance[i][0] * axis[0] + covariance[i][1] * axis[1] + covariance[i][2] * axis[2];
+
+			const f32 length = std::sqrt(next[0] * next[0] + next[1] * next[1] + next[2] * next[2]);
+
+			if (length < 1e-6f)
+				break; // single color block, every axis will do
+
+			for (i32 i = 0; i < 3; i++)
+				axis[i] = next[i] / length;
+		}
+
+		f32 minProjection = std::numeric_limits<f32>::max();
+		f32 maxProjection = std::numeric_limits<f32>::lowest();
+
+		for (const u8* pixel : block)
+		{
+			const f32 projection =
+			    (pixel[0] - mean[0]) * axis[0] + (pixel[1] - mean[1]) * axis[1] + (pixel[2] - mean[2]) * axis[2];
+
+			minProjection = std::min(minProjection, projection);
+			maxProjection = std::max(maxProjection, projection);
+		}
+
+		f32 endpoint0[3], endpoint1[3];
+
+		for (i32 i = 0; i < 3; i++)
+		{
+			endpoint0[i] = mean[i] + axis[i] * maxProjection;
+			endpoint1[i] = mean[i] + axis[i] * minProjection;
+		}
+
+		u16 color0 = PackRGB565(endpoint0);
+		u16 color1 = PackRGB565(endpoint1);
+
+		if (color0 < color1)
+			std::swap(color0, color1); // color0 > color1 selects the 4 color mode
+
+		WriteU16(out, color0);
+		WriteU16(out + 2, color1);
+
+		u32 indices = 0;
+
+		if (color0 != color1) // otherwise the 3 color mode, but index 0 is the only color anyway
+		{
+			i32 palette[4][4];
+			GetColorPalette(color0, color1, false, palette);
+
+			for (i32 p = 0; p < 16; p++)
+			{
+				u32 bestIndex    = 0;
+				i32 bestDistance = std::numeric_limits<i32>::max();
+
+				for (u32 index = 0; index < 4; index++)
+				{
+					const i32 dr       = block[p][0] - palette[index][0];
+					const i32 dg       = block[p][1] - palette[index][1];
+					const i32 db       = block[p][2] - palette[index][2];
+					const i32 distance = dr * dr + dg * dg + db * db;
+
+					if (distance < bestDistance)
+					{
+						bestIndex    = index;
+						bestDistance = distance;
+					}
+				}
+
+				indices |= bestIndex << (p * 2);
+			}
+		}
+
+		std::memcpy(out + 4, &indices, sizeof(u32)); // little endian, like the format
+	}
+
+	static void EncodeAlphaBlock(const BlockPixels& block, u8* out)
+	{
+		u8 alpha0 = 0;
+		u8 alpha1 = 255;
+
+		for (const u8* pixel : block)
+		{
+			alpha0 = std::max(alpha0, pixel[3]);
+			alpha1 = std::min(alpha1, pixel[3]);
+		}
+
+		out[0] = alpha0;
+		out[1] = alpha1;
+
+		u64 indices = 0;
+
+		if (alpha0 != alpha1) // alpha0 > alpha1 selects the 8 alpha mode
+		{
+			i32 palette[8];
+			GetAlphaPalette(alpha0, alpha1, palette);
+
+			for (i32 p = 0; p < 16; p++)
+			{
+				u64 bestIndex    = 0;
+				i32 bestDistance = std::numeric_limits<i32>::max();
+
+				for (u64 index = 0; index < 8; index++)
+				{
+					const i32 distance = std::abs(block[p][3] - palette[index]);
+
+					if (distance < bestDistance)
+					{
+						bestIndex    = index;
+						bestDistance = distance;
+					}
+				}
+
+				indices |= bestIndex << (p * 3);
+			}
+		}
+
+		for (i32 i = 0; i < 6; i++)
+			out[2 + i] = (u8)(indices >> (i * 8));
+	}
+
+	static void DecodeColorBlock(const u8* in, bool allowThreeColors, BlockPixels& outBlock)
+	{
+		i32 palette[4][4];
+		GetColorPalette(ReadU16(in), ReadU16(in + 2), allowThreeColors, palette);
+
+		u32 indices;
+		std::memcpy(&indices, in + 4, sizeof(u32));
+
+		for (i32 p = 0; p < 16; p++)
+		{
+			const i32* color = palette[(indices >> (p * 2)) & 3];
+
+			for (i32 i = 0; i < 4; i++)
+				outBlock[p][i] = (u8)color[i];
+		}
+	}
+
+	static void DecodeAlphaBlock(const u8* in, BlockPixels& outBlock)
+	{
+		i32 palette[8];
+		GetAlphaPalette(in[0], in[1], palette);
+
+		u64 indices = 0;
+
+		for (i32 i = 0; i < 6; i++)
+			indices |= (u64)in[2 + i] << (i * 8);
+
+		for (i32 p = 0; p < 16; p++)
+			outBlock[p][3] = (u8)palette[(indices >> (p * 3)) & 7];
+	}
+
+	void BlockCompression::EncodeBC1(const u8* pixels, i32 width, i32 height, u8* blocks)
+	{
+		BlockPixels block;
+
+		for (i32 y = 0; y < (height + 3) / 4; y++)
+		{
+			for (i32 x = 0; x < (width + 3) / 4; x++)
+			{
+				LoadBlock(pixels, width, height, x, y, block);
+				EncodeColorBlock(block, blocks);
+
+				blocks += BC1BlockSize;
+			}
+		}
+	}
+
+	void BlockCompression::EncodeBC3(const u8* pixels, i32 width, i32 height, u8* blocks)
+	{
+		BlockPixels block;
+
+		for (i32 y = 0; y < (height + 3) / 4; y++)
+		{
+			for (i32 x = 0; x < (width + 3) / 4; x++)
+			{
+				LoadBlock(pixels, width, height, x, y, block);
+				EncodeAlphaBlock(block, blocks);
+				EncodeColorBlock(block, blocks + 8);
+
+				blocks += BC3BlockSize;
+			}
+		}
+	}
+
+	void BlockCompression::DecodeBC1(const u8* blocks, i32 width, i32 height, u8* pixels)
+	{
+		BlockPixels block;
+
+		for (i32 y = 0; y < (height + 3) / 4; y++)
+		{
+			for (i32 x = 0; x < (width + 3) / 4; x++)
+			{
+				DecodeColorBlock(blocks, true, block);
+				StoreBlock(block, width, height, x, y, pixels);
+
+				blocks += BC1BlockSize;
+			}
+		}
+	}
+
+	void BlockCompression::DecodeBC3(const u8* blocks, i32 width, i32 height, u8* pixels)
+	{
+		BlockPixels block;
+
+		for (i32 y = 0; y < (height + 3) / 4; y++)
+		{
+			for (i32 x = 0; x < (width + 3) / 4; x++)
+			{
+				DecodeColorBlock(blocks + 8, false, block); // the color block of BC3 always has 4 colors
+				DecodeAlphaBlock(blocks, block);
+				StoreBlock(block, width, height, x, y, pixels);
+
+				blocks += BC3BlockSize;
+			}
+		}
+	}
+
+} // namespace SW
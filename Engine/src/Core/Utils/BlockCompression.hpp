@@ -0,0 +1,85 @@
+/**
+ * @file BlockCompression.hpp
+ * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
+ * @version 0.1.0
+ * @date 2024-06-03
+ *
+ * @copyright Copyright (c) 2024 Tycjan Fortuna
+ */
+#pragma once
+
+namespace SW
+{
+
+	/**
+	 * @brief CPU encoder and decoder of the BC1 (DXT1) and BC3 (DXT5) block compressed formats.
+	 * 		  Every 4x4 block of pixels is stored in 8 (BC1, opaque) or 16 (BC3, with alpha) bytes.
+	 * 		  Endpoints are taken from the principal axis of the block colors - a single pass, no refinement.
+	 * @note Pixels are tightly packed RGBA8, blocks are stored row by row. Blocks crossing the edge of the image
+	 * 		 repeat its last column or row.
+	 */
+	class BlockCompression final
+	{
+	public:
+		static constexpr i32 BlockDimension = 4;  /**< Width and height of a block in pixels. */
+		static constexpr u64 BC1BlockSize   = 8;  /**< Size of a BC1 block in bytes. */
+		static constexpr u64 BC3BlockSize   = 16; /**< Size of a BC3 block in bytes. */
+
+		/**
+		 * @brief Gets the size of the image in the block compressed format.
+		 *
+		 * @param width The width of the image.
+		 * @param height The height of the image.
+		 * @param blockSize The size of a block (BC1BlockSize or BC3BlockSize).
+		 * @return The size in bytes.
+		 */
+		static u64 GetCompressedSize(i32 width, i32 height, u64 blockSize)
+		{
+			const u64 columns = (u64)(width + BlockDimension - 1) / BlockDimension;
+			const u64 rows    = (u64)(height + BlockDimension - 1) / BlockDimension;
+
+			return columns * rows * blockSize;
+		}
+
+		/**
+		 * @brief Encodes the image to BC1, alpha is dropped.
+		 *
+		 * @param pixels The RGBA8 pixels of the image.
+		 * @param width The width of the image.
+		 * @param height The height of the image.
+		 * @param blocks The output, GetCompressedSize(width, height, BC1BlockSize) bytes.
+		 */
+		static void EncodeBC1(const u8* pixels, i32 width, i32 height, u8* blocks);
+
+		/**
+		 * @brief Encodes the image to BC3.
+		 *
+		 * @param pixels The RGBA8 pixels of the image.
+		 * @param width The width of the image.
+		 * @param height The height of the image.
+		 * @param blocks The output, GetCompressedSize(width, height, BC3BlockSize) bytes.
+		 */
+		static void EncodeBC3(const u8* pixels, i32 width, i32 height, u8* blocks);
+
+		/**
+		 * @brief Decodes BC1 blocks, used where the GPU does not support the format.
+		 *
+		 * @param blocks The BC1 blocks of the image.
+		 * @param width The width of the image.
+		 * @param height The height of the image.
+		 * @param pixels The output, width * height RGBA8 pixels.
+		 */
+		static void DecodeBC1(const u8* blocks, i32 width, i32 height, u8* pixels);
+
+		/**
+		 * @brief Decodes BC3 blocks, used where the GPU does not support the format.
+		 *
+		 * @param blocks The BC3 blocks of the image.
+		 * @param width The width of the image.
+		 * @param height The height of the image.
+		 * @param pixels The output, width * height RGBA8 pixels.
+		 */
+		static void DecodeBC3(const u8* blocks, i32 width, i32 height, u8* pixels);
+	};
+
+} // namespace SW
@@ -1,5 +1,7 @@
 #include "FileSystem.hpp"
 
+#include <algorithm>
+
 #include <nfd.hpp>
 
 #ifdef SW_WINDOWS
@@ -192,4 +194,22 @@ namespace SW
 		}
 	}
 
+	bool FileSystem::IsSameOrInside(const std::filesystem::path& path, const std::filesystem::path& directory)
+	{
+		return std::mismatch(path.begin(), path.end(), directory.begin(), directory.end()).second == directory.end();
+	}
+
+	std::filesystem::path FileSystem::Rebase(const std::filesystem::path& path, const std::filesystem::path& from,
+	                                         const std::filesystem::path& to)
+	{
+		std::filesystem::path result = to;
+
+		for (auto it = std::next(path.begin(), std::distance(from.begin(), from.end())); it != path.end(); ++it)
+		{
+			result /= *it;
+		}
+
+		return result;
+	}
+
 } // namespace SW
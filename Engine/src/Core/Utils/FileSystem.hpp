@@ -1,7 +1,7 @@
 /**
  * @file FileSystem.hpp
  * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
- * @version 0.1.3
+ * @version 0.1.4
  * @date 2024-03-21
  *
  * @copyright Copyright (c) 2024 Tycjan Fortuna
@@ -156,6 +156,27 @@ namespace SW
 		 * @param path The path where you want to create new file.
 		 */
 		static std::filesystem::path GetUniqueFilename(const std::filesystem::path& path);
+
+		/**
+		 * @brief Checks whether the path is the directory itself or lies inside of it (compared lexically).
+		 *
+		 * @param path The path to check.
+		 * @param directory The directory.
+		 * @return Whether the path is the directory or one of its descendants.
+		 */
+		static bool IsSameOrInside(const std::filesystem::path& path, const std::filesystem::path& directory);
+
+		/**
+		 * @brief Moves the path from one directory to another, e.g. (a/b/c.png, a/b, x) -> x/c.png.
+		 * @warning The path must be the directory itself or lie inside of it (see IsSameOrInside()).
+		 *
+		 * @param path The path to move.
+		 * @param from The directory the path lies in.
+		 * @param to The directory replacing it.
+		 * @return The moved path.
+		 */
+		static std::filesystem::path Rebase(const std::filesystem::path& path, const std::filesystem::path& from,
+		                                    const std::filesystem::path& to);
 	};
 
 } // namespace SW
@@ -0,0 +1,256 @@
+#include "FileWatcher.hpp"
+
+#include <algorithm>
+
+#include "FileSystem.hpp"
+
+#ifdef SW_LINUX
+	#include <sys/inotify.h>
+	#include <unistd.h>
+#endif
+
+namespace SW
+{
+
+	FileWatcher::~FileWatcher()
+	{
+		Stop();
+	}
+
+#ifdef SW_LINUX
+
+	static constexpr u32 WatchMask = IN_CREATE | IN_DELETE | IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR;
+
+	bool FileWatcher::Start(const std::filesystem::path& directory, const std::vector<std::string>& ignoredDirectories)
+	{
+		Stop();
+
+		m_Handle = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+		if (m_Handle == -1)
+		{
+			SYSTEM_ERROR("Failed to initialize inotify, {} is not watched!", directory.string());
+			return false;
+		}
+
+		m_Root               = directory;
+		m_IgnoredDirectories = ignoredDirectories;
+
+		WatchRecursive({});
+
+		return true;
+	}
+
+	void FileWatcher::Stop()
+	{
+		if (m_Handle == -1)
+			return;
+
+		close(m_Handle); // removes all watches
+
+		m_Handle = -1;
+		m_Directories.clear();
+	}
+
+	void FileWatcher::Poll(std::vector<FileChange>& outChanges)
+	{
+		if (m_Handle == -1)
+			return;
+
+		PROFILE_FUNCTION();
+
+		struct PendingMove
+		{
+			u32 Cookie;
+			size_t ChangeIndex;
+		};
+
+		std::vector<PendingMove> pendingMoves; // moved from, not paired with moved to yet
+
+		bool hasOverflown = false;
+
+		alignas(inotify_event) char buffer[16 * 1024];
+
+		while (true)
+		{
+			const ssize_t length = read(m_Handle, buffer, sizeof(buffer));
+
+			if (length <= 0)
+				break; // EAGAIN - nothing more queued
+
+			for (ssize_t offset = 0; offset < length;)
+			{
+				const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+
+				offset += (ssize_t)(sizeof(inotify_event) + event->len);
+
+				if (event->mask & IN_Q_OVERFLOW)
+				{
+					outChanges.emplace_back(FileChange{FileChangeType::Overflow, {}, {}, false});
+
+					hasOverflown = true;
+					continue;
+				}
+
+				if (event->mask & IN_IGNORED)
+				{
+					m_Directories.erase(event->wd);
+					continue;
+				}
+
+				auto directory = m_Directories.find(event->wd);
+
+				if (directory == m_Directories.end() || event->len == 0)
+					continue;
+
+				const bool isDirectory           = event->mask & IN_ISDIR;
+				const std::filesystem::path path = directory->second / event->name;
+
+				if (isDirectory && IsIgnored(path.filename()))
+					continue;
+
+				if (event->mask & IN_MOVED_FROM)
+				{
+					pendingMoves.emplace_back(PendingMove{event->cookie, outChanges.size()});
+					outChanges.emplace_back(FileChange{FileChangeType::Removed, path, {}, isDirectory});
+					continue;
+				}
+
+				if (event->mask & IN_MOVED_TO)
+				{
+					const u32 cookie = event->cookie;
+
+					auto move = std::find_if(pendingMoves.begin(), pendingMoves.end(),
+					                         [cookie](const PendingMove& pending) { return pending.Cookie == cookie; });
+
+					if (move != pendingMoves.end())
+					{
+						FileChange& change = outChanges[move->ChangeIndex];
+						change.Type        = FileChangeType::Renamed;
+						change.OldPath     = std::move(change.Path);
+						change.Path        = path;
+
+						pendingMoves.erase(move);
+
+						if (isDirectory) // the watches follow the moved directories
+						{
+							for (auto&& [watch, watchedPath] : m_Directories)
+							{
+								if (FileSystem::IsSameOrInside(watchedPath, change.OldPath))
+									watchedPath = FileSystem::Rebase(watchedPath, change.OldPath, path);
+							}
+						}
+
+						continue;
+					}
+				}
+
+				if (event->mask & (IN_CREATE | IN_MOVED_TO)) // moved in from outside is the same as created
+				{
+					outChanges.emplace_back(FileChange{FileChangeType::Added, path, {}, isDirectory});
+
+					if (isDirectory)
+						WatchRecursive(path); // entries created before the watch are picked up by the caller's scan
+
+					continue;
+				}
+
+				if (event->mask & IN_DELETE)
+				{
+					outChanges.emplace_back(FileChange{FileChangeType::Removed, path, {}, isDirectory});
+					continue;
+				}
+
+				if (event->mask & IN_CLOSE_WRITE)
+					outChanges.emplace_back(FileChange{FileChangeType::Modified, path, {}, false});
+			}
+		}
+
+		// Moved out of the watched directory, their watches would report paths which are not ours anymore.
+		for (const PendingMove& move : pendingMoves)
+		{
+			const FileChange& change = outChanges[move.ChangeIndex];
+
+			if (change.IsDirectory)
+				UnwatchRecursive(change.Path);
+		}
+
+		if (hasOverflown) // directories created in the meantime are not watched, start over
+		{
+			const std::filesystem::path root       = m_Root;
+			const std::vector<std::string> ignored = m_IgnoredDirectories;
+
+			Start(root, ignored);
+		}
+	}
+
+	void FileWatcher::WatchRecursive(const std::filesystem::path& directory)
+	{
+		const std::filesystem::path fullPath = m_Root / directory;
+
+		const int watch = inotify_add_watch(m_Handle, fullPath.c_str(), WatchMask);
+
+		if (watch == -1)
+		{
+			SYSTEM_WARN("Failed to watch {}, its changes will not be picked up!", fullPath.string());
+			return;
+		}
+
+		m_Directories[watch] = directory;
+
+		std::error_code error;
+
+		for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(fullPath, error))
+		{
+			if (entry.is_directory(error) && !IsIgnored(entry.path().filename()))
+				WatchRecursive(directory / entry.path().filename());
+		}
+	}
+
+	void FileWatcher::UnwatchRecursive(const std::filesystem::path& directory)
+	{
+		std::erase_if(m_Directories, [this, &directory](const auto& pair) {
+			if (!FileSystem::IsSameOrInside(pair.second, directory))
+				return false;
+
+			inotify_rm_watch(m_Handle, pair.first);
+
+			return true;
+		});
+	}
+
+#else
+
+	bool FileWatcher::Start(const std::filesystem::path& directory,
+	                        const std::vector<std::string>& /*ignoredDirectories*/)
+	{
+		SYSTEM_WARN("File watching is not supported on this platform, {} is scanned on refresh.", directory.string());
+
+		return false;
+	}
+
+	void FileWatcher::Stop()
+	{
+	}
+
+	void FileWatcher::Poll(std::vector<FileChange>& /*outChanges*/)
+	{
+	}
+
+	void FileWatcher::WatchRecursive(const std::filesystem::path& /*directory*/)
+	{
+	}
+
+	void FileWatcher::UnwatchRecursive(const std::filesystem::path& /*directory*/)
+	{
+	}
+
+#endif
+
+	bool FileWatcher::IsIgnored(const std::filesystem::path& name) const
+	{
+		return std::find(m_IgnoredDirectories.begin(), m_IgnoredDirectories.end(), name.string()) !=
+		       m_IgnoredDirectories.end();
+	}
+
+} // namespace SW
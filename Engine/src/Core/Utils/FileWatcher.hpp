@@ -0,0 +1,113 @@
+/**
+ * @file FileWatcher.hpp
+ * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
+ * @version 0.1.0
+ * @date 2024-06-02
+ *
+ * @copyright Copyright (c) 2024 Tycjan Fortuna
+ */
+#pragma once
+
+namespace SW
+{
+
+	/**
+	 * @brief Kind of a change reported by the FileWatcher.
+	 */
+	enum class FileChangeType : u8
+	{
+		Added = 0, /**< Entry was created or moved into the watched directory. */
+		Modified,  /**< File was written and closed. */
+		Removed,   /**< Entry was deleted or moved out of the watched directory. */
+		Renamed,   /**< Entry was moved inside the watched directory. */
+		Overflow,  /**< Changes were dropped by the OS, everything has to be scanned again. */
+	};
+
+	/**
+	 * @brief Single change of the watched directory.
+	 */
+	struct FileChange
+	{
+		FileChangeType Type = FileChangeType::Added; /**< Kind of the change. */
+		std::filesystem::path Path;                  /**< Path relative to the watched directory. */
+		std::filesystem::path OldPath;               /**< Previous path of a renamed entry. */
+		bool IsDirectory = false;                    /**< Whether the entry is a directory. */
+	};
+
+	/**
+	 * @brief Recursively watches a directory for changes (inotify on Linux).
+	 *
+	 * 		  Every directory of the tree gets its own watch, watches of directories created or moved in later are
+	 * 		  added as the changes are polled. Moves are paired by their cookie into a single Renamed change.
+	 * 		  The watcher never blocks - Poll() drains whatever the OS queued since the last call.
+	 * @note Not supported on other platforms yet, Start() returns false and the callers fall back to scanning.
+	 */
+	class FileWatcher final
+	{
+	public:
+		FileWatcher() = default;
+		~FileWatcher();
+
+		FileWatcher(const FileWatcher&)            = delete;
+		FileWatcher& operator=(const FileWatcher&) = delete;
+
+		/**
+		 * @brief Starts watching the directory, the previous one is not watched anymore.
+		 *
+		 * @param directory The directory to watch.
+		 * @param ignoredDirectories Names of directories not watched at any level (e.g. "cache").
+		 * @return Whether the directory is watched.
+		 */
+		bool Start(const std::filesystem::path& directory, const std::vector<std::string>& ignoredDirectories);
+
+		/**
+		 * @brief Stops watching, queued changes are dropped.
+		 */
+		void Stop();
+
+		/**
+		 * @brief Whether a directory is watched.
+		 *
+		 * @return True if Start() succeeded.
+		 */
+		bool IsWatching() const { return m_Handle != -1; }
+
+		/**
+		 * @brief Collects the changes queued since the last call.
+		 *
+		 * @param outChanges Receives the changes in the order they happened.
+		 */
+		void Poll(std::vector<FileChange>& outChanges);
+
+	private:
+		std::filesystem::path m_Root;                  /**< The watched directory. */
+		std::vector<std::string> m_IgnoredDirectories; /**< Names of directories not watched. */
+
+		int m_Handle = -1; /**< The inotify instance, -1 if not watching. */
+
+		std::unordered_map<int, std::filesystem::path> m_Directories; /**< Watch to relative directory path. */
+
+		/**
+		 * @brief Watches the directory and all its subdirectories.
+		 *
+		 * @param directory The directory relative to the root.
+		 */
+		void WatchRecursive(const std::filesystem::path& directory);
+
+		/**
+		 * @brief Stops watching the directory and all its subdirectories.
+		 *
+		 * @param directory The directory relative to the root.
+		 */
+		void UnwatchRecursive(const std::filesystem::path& directory);
+
+		/**
+		 * @brief Whether the directory is one of the ignored ones.
+		 *
+		 * @param name Name of the directory.
+		 * @return True if it is not watched.
+		 */
+		bool IsIgnored(const std::filesystem::path& name) const;
+	};
+
+} // namespace SW
@@ -0,0 +1,214 @@
+#include "LZ4.hpp"
+
+#include <algorithm>
+
+namespace SW
+{
+
+	static constexpr u64 MinMatch     = 4;           // shortest match encoded by a sequence
+	static constexpr u64 LastLiterals = 5;           // the block always ends with at least this many literals
+	static constexpr u64 MatchLimit   = 12;          // no match starts within the last MatchLimit bytes
+	static constexpr u64 MaxOffset    = 65535;       // offsets are stored in 2 bytes
+	static constexpr u32 HashLog      = 16;          // 64K entries of the match finder
+	static constexpr u32 HashPrime    = 2654435761u; // multiplicative hash of the 4 byte sequences
+
+	static u32 ReadU32(const u8* data)
+	{
+		u32 value;
+		std::memcpy(&value, data, sizeof(u32));
+
+		return value;
+	}
+
+	static u32 HashSequence(u32 sequence)
+	{
+		return (sequence * HashPrime) >> (32 - HashLog);
+	}
+
+	static u8* WriteLength(u8* out, u64 length)
+	{
+		for (; length >= 255; length -= 255)
+			*out++ = 255;
+
+		*out++ = (u8)length;
+
+		return out;
+	}
+
+	static bool ReadLength(const u8*& in, const u8* end, u64& length)
+	{
+		u8 byte;
+
+		do
+		{
+			if (in == end)
+				return false;
+
+			byte = *in++;
+			length += byte;
+		} while (byte == 255);
+
+		return true;
+	}
+
+	// The space a sequence takes in the worst case - token, both lengths, literals and the offset.
+	static u64 GetSequenceBound(u64 literals, u64 matchLength)
+	{
+		return 1 + literals / 255 + 1 + literals + 2 + matchLength / 255 + 1;
+	}
+
+	static u8* WriteSequence(u8* out, const u8* literals, u64 literalCount, u64 offset, u64 matchLength)
+	{
+		const u64 matchCode = matchLength - MinMatch;
+
+		u8* token = out++;
+		*token    = (u8)((std::min<u64>(literalCount, 15) << 4) | std::min<u64>(matchCode, 15));
+
+		if (literalCount >= 15)
+			out = WriteLength(out, literalCount - 15);
+
+		std::memcpy(out, literals, literalCount);
+		out += literalCount;
+
+		*out++ = (u8)(offset & 0xFF);
+		*out++ = (u8)(offset >> 8);
+
+		if (matchCode >= 15)
+			out = WriteLength(out, matchCode - 15);
+
+		return out;
+	}
+
+	u64 LZ4::Compress(const u8* source, u64 sourceSize, u8* destination, u64 capacity)
+	{
+		const u8* in     = source;
+		const u8* end    = source + sourceSize;
+		const u8* anchor = source; // first byte not yet written
+
+		u8* out          = destination;
+		const u8* outEnd = destination + capacity;
+
+		if (sourceSize > MatchLimit)
+		{
+			std::vector<u32> table(1ull << HashLog, 0); // last position of every hashed sequence
+
+			const u8* matchStartLimit = end - MatchLimit;
+			const u8* matchEndLimit   = end - LastLiterals;
+
+			while (in <= matchStartLimit)
+			{
+				const u32 sequence = ReadU32(in);
+				const u32 hash     = HashSequence(sequence);
+				const u8* match    = source + table[hash];
+
+				table[hash] = (u32)(in - source);
+
+				if (match >= in || (u64)(in - match) > MaxOffset || ReadU32(match) != sequence)
+				{
+					in++;
+					continue;
+				}
+
+				u64 matchLength = MinMatch;
+
+				while (in + matchLength < matchEndLimit && match[matchLength] == in[matchLength])
+					matchLength++;
+
+				const u64 literalCount = (u64)(in - anchor);
+
+				if (GetSequenceBound(literalCount, matchLength) > (u64)(outEnd - out))
+					return 0;
+
+				out = WriteSequence(out, anchor, literalCount, (u64)(in - match), matchLength);
+
+				in += matchLength;
+				anchor = in;
+			}
+		}
+
+		// The last sequence has literals only.
+		const u64 literalCount = (u64)(end - anchor);
+
+		if (1 + literalCount / 255 + 1 + literalCount > (u64)(outEnd - out))
+			return 0;
+
+		u8* token = out++;
+		*token    = (u8)(std::min<u64>(literalCount, 15) << 4);
+
+		if (literalCount >= 15)
+			out = WriteLength(out, literalCount - 15);
+
+		if (literalCount > 0) // the source of an empty input may be null
+			std::memcpy(out, anchor, literalCount);
+
+		out += literalCount;
+
+		return (u64)(out - destination);
+	}
+
+	bool LZ4::Decompress(const u8* source, u64 sourceSize, u8* destination, u64 destinationSize)
+	{
+		const u8* in    = source;
+		const u8* inEnd = source + sourceSize;
+
+		u8* out          = destination;
+		const u8* outEnd = destination + destinationSize;
+
+		while (in < inEnd)
+		{
+			const u8 token = *in++;
+
+			u64 literalCount = token >> 4;
+
+			if (literalCount == 15 && !ReadLength(in, inEnd, literalCount))
+				return false;
+
+			if (literalCount > (u64)(inEnd - in) || literalCount > (u64)(outEnd - out))
+				return false;
+
+			if (literalCount > 0)
+				std::memcpy(out, in, literalCount);
+
+			in += literalCount;
+			out += literalCount;
+
+			if (in == inEnd)
+				break; // the last sequence has no match
+
+			if (inEnd - in < 2)
+				return false;
+
+			const u64 offset = (u64)in[0] | ((u64)in[1] << 8);
+			in += 2;
+
+			if (offset == 0 || offset > (u64)(out - destination))
+				return false;
+
+			u64 matchLength = token & 15;
+
+			if (matchLength == 15 && !ReadLength(in, inEnd, matchLength))
+				return false;
+
+			matchLength += MinMatch;
+
+			if (matchLength > (u64)(outEnd - out))
+				return false;
+
+			const u8* match = out - offset;
+
+			if (offset >= matchLength)
+			{
+				std::memcpy(out, match, matchLength);
+				out += matchLength;
+			}
+			else // overlapping copy repeats the last offset bytes
+			{
+				for (u64 i = 0; i < matchLength; i++)
+					*out++ = match[i];
+			}
+		}
+
+		return out == outEnd;
+	}
+
+} // namespace SW
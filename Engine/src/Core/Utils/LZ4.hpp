@@ -0,0 +1,53 @@
+/**
+ * @file LZ4.hpp
+ * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
+ * @version 0.1.0
+ * @date 2024-06-03
+ *
+ * @copyright Copyright (c) 2024 Tycjan Fortuna
+ */
+#pragma once
+
+namespace SW
+{
+
+	/**
+	 * @brief Compressor of the LZ4 block format (no frame, no checksums).
+	 * 		  Decompression is a plain copy loop, so cooked data costs about as much to unpack as to read.
+	 * @note Blocks are compatible with LZ4_decompress_safe() of the reference implementation.
+	 */
+	class LZ4 final
+	{
+	public:
+		/**
+		 * @brief Gets the worst case size of the compressed data (incompressible input).
+		 *
+		 * @param size The size of the input in bytes.
+		 * @return The size of the buffer Compress() always succeeds with.
+		 */
+		static u64 GetMaxCompressedSize(u64 size) { return size + size / 255 + 16; }
+
+		/**
+		 * @brief Compresses the data into a single block.
+		 *
+		 * @param source The data to compress.
+		 * @param sourceSize The size of the data in bytes.
+		 * @param destination The buffer for the block.
+		 * @param capacity The size of the buffer in bytes.
+		 * @return The size of the block, 0 if it does not fit into the buffer.
+		 */
+		static u64 Compress(const u8* source, u64 sourceSize, u8* destination, u64 capacity);
+
+		/**
+		 * @brief Decompresses a single block, every offset and length is checked against both buffers.
+		 *
+		 * @param source The block.
+		 * @param sourceSize The size of the block in bytes.
+		 * @param destination The buffer for the data.
+		 * @param destinationSize The exact size of the decompressed data in bytes.
+		 * @return Whether the block is valid and decompressed to exactly destinationSize bytes.
+		 */
+		static bool Decompress(const u8* source, u64 sourceSize, u8* destination, u64 destinationSize);
+	};
+
+} // namespace SW
@@ -0,0 +1,164 @@
+#include "MappedFile.hpp"
+
+#ifdef SW_WINDOWS
+	#include <Windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace SW
+{
+
+	MappedFile::MappedFile(const std::filesystem::path& path)
+	{
+		Open(path);
+	}
+
+	MappedFile::~MappedFile()
+	{
+		Close();
+	}
+
+	MappedFile::MappedFile(MappedFile&& other) noexcept
+	{
+		*this = std::move(other);
+	}
+
+	MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+	{
+		if (this == &other)
+			return *this;
+
+		Close();
+
+		m_Data = std::exchange(other.m_Data, nullptr);
+		m_Size = std::exchange(other.m_Size, 0);
+
+#ifdef SW_WINDOWS
+		m_FileHandle    = std::exchange(other.m_FileHandle, nullptr);
+		m_MappingHandle = std::exchange(other.m_MappingHandle, nullptr);
+#endif
+
+		return *this;
+	}
+
+#ifdef SW_WINDOWS
+
+	bool MappedFile::Open(const std::filesystem::path& path)
+	{
+		Close();
+
+		HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+		                          FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			SYSTEM_ERROR("Failed to open file for mapping: {}", path);
+			return false;
+		}
+
+		LARGE_INTEGER size;
+
+		if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+		{
+			CloseHandle(file);
+			return false;
+		}
+
+		HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+		if (!mapping)
+		{
+			SYSTEM_ERROR("Failed to create file mapping: {}", path);
+			CloseHandle(file);
+			return false;
+		}
+
+		void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+		if (!view)
+		{
+			SYSTEM_ERROR("Failed to map view of file: {}", path);
+			CloseHandle(mapping);
+			CloseHandle(file);
+			return false;
+		}
+
+		m_Data          = static_cast<const u8*>(view);
+		m_Size          = (u64)size.QuadPart;
+		m_FileHandle    = file;
+		m_MappingHandle = mapping;
+
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+		if (m_Data)
+			UnmapViewOfFile(m_Data);
+
+		if (m_MappingHandle)
+			CloseHandle(m_MappingHandle);
+
+		if (m_FileHandle)
+			CloseHandle(m_FileHandle);
+
+		m_Data          = nullptr;
+		m_Size          = 0;
+		m_FileHandle    = nullptr;
+		m_MappingHandle = nullptr;
+	}
+
+#else
+
+	bool MappedFile::Open(const std::filesystem::path& path)
+	{
+		Close();
+
+		const int file = open(path.c_str(), O_RDONLY);
+
+		if (file < 0)
+		{
+			SYSTEM_ERROR("Failed to open file for mapping: {}", path);
+			return false;
+		}
+
+		struct stat info;
+
+		if (fstat(file, &info) != 0 || info.st_size == 0)
+		{
+			close(file);
+			return false;
+		}
+
+		void* view = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+		close(file); // the mapping keeps its own reference to the file
+
+		if (view == MAP_FAILED)
+		{
+			SYSTEM_ERROR("Failed to map file: {}", path);
+			return false;
+		}
+
+		m_Data = static_cast<const u8*>(view);
+		m_Size = (u64)info.st_size;
+
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+		if (m_Data)
+			munmap(const_cast<u8*>(m_Data), (size_t)m_Size);
+
+		m_Data = nullptr;
+		m_Size = 0;
+	}
+
+#endif
+
+} // namespace SW
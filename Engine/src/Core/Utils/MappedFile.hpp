@@ -0,0 +1,76 @@
+/**
+ * @file MappedFile.hpp
+ * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
+ * @version 0.1.0
+ * @date 2024-05-25
+ *
+ * @copyright Copyright (c) 2024 Tycjan Fortuna
+ */
+#pragma once
+
+namespace SW
+{
+
+	/**
+	 * @brief Read only view of a whole file mapped into the address space of the process.
+	 * 		  Pages are loaded lazily by the OS, so opening a big file costs nothing until its bytes are touched.
+	 * @note The view is invalidated on Close() or destruction of the object.
+	 */
+	class MappedFile final
+	{
+	public:
+		MappedFile() = default;
+		explicit MappedFile(const std::filesystem::path& path);
+		~MappedFile();
+
+		MappedFile(const MappedFile&)            = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		MappedFile(MappedFile&& other) noexcept;
+		MappedFile& operator=(MappedFile&& other) noexcept;
+
+		/**
+		 * @brief Maps the file. Previously mapped file is closed.
+		 *
+		 * @param path Path to the file.
+		 * @return Whether the operation was successful.
+		 */
+		bool Open(const std::filesystem::path& path);
+
+		/**
+		 * @brief Unmaps the file.
+		 */
+		void Close();
+
+		/**
+		 * @brief Whether a file is currently mapped.
+		 *
+		 * @return True if a file is mapped.
+		 */
+		bool IsOpen() const { return m_Data != nullptr; }
+
+		/**
+		 * @brief Gets the beginning of the mapped bytes.
+		 *
+		 * @return Pointer to the first byte, nullptr if no file is mapped.
+		 */
+		const u8* GetData() const { return m_Data; }
+
+		/**
+		 * @brief Gets the size of the mapped file.
+		 *
+		 * @return The size in bytes.
+		 */
+		u64 GetSize() const { return m_Size; }
+
+	private:
+		const u8* m_Data = nullptr; /**< The mapped bytes. */
+		u64 m_Size       = 0;       /**< The size of the mapping in bytes. */
+
+#ifdef SW_WINDOWS
+		void* m_FileHandle    = nullptr; /**< The file handle. */
+		void* m_MappingHandle = nullptr; /**< The file mapping object handle. */
+#endif
+	};
+
+} // namespace SW
@@ -0,0 +1,50 @@
+/**
+ * @file Timer.hpp
+ * @author Tycjan Fortuna (242213@edu.p.lodz.pl)
+ * @version 0.1.0
+ * @date 2024-05-22
+ *
+ * @copyright Copyright (c) 2024 Tycjan Fortuna
+ */
+#pragma once
+
+#include <chrono>
+
+namespace SW
+{
+
+	/**
+	 * @brief Simple high resolution stopwatch, started on construction.
+	 */
+	class Timer final
+	{
+	public:
+		Timer() { Reset(); }
+
+		/**
+		 * @brief Restarts the measurement.
+		 */
+		void Reset() { m_Start = std::chrono::high_resolution_clock::now(); }
+
+		/**
+		 * @brief Time elapsed since the construction or the last reset.
+		 *
+		 * @return f32 The elapsed time in seconds.
+		 */
+		[[nodiscard]] f32 Elapsed() const { return ElapsedMillis() * 0.001f; }
+
+		/**
+		 * @brief Time elapsed since the construction or the last reset.
+		 *
+		 * @return f32 The elapsed time in milliseconds.
+		 */
+		[[nodiscard]] f32 ElapsedMillis() const
+		{
+			return std::chrono::duration<f32, std::milli>(std::chrono::high_resolution_clock::now() - m_Start).count();
+		}
+
+	private:
+		std::chrono::time_point<std::chrono::high_resolution_clock> m_Start; ///< The start of the measurement.
+	};
+
+} // namespace SW
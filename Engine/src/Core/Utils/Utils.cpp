@@ -23,11 +23,11 @@ namespace SW
 	namespace String
 	{
 
-		std::string BytesToString(u32 bytes)
+		std::string BytesToString(u64 bytes)
 		{
-			constexpr u32 GB = 1024 * 1024 * 1024;
-			constexpr u32 MB = 1024 * 1024;
-			constexpr u32 KB = 1024;
+			constexpr u64 GB = 1024 * 1024 * 1024;
+			constexpr u64 MB = 1024 * 1024;
+			constexpr u64 KB = 1024;
 
 			const std::string result = [bytes]() {
 				if (bytes >= GB)
@@ -58,6 +58,76 @@ namespace SW
 			return filename.substr(0, filename.find_last_of('.'));
 		}
 
+		u32 DecodeUTF8(std::string_view text, size_t& offset)
+		{
+			constexpr u32 ReplacementCharacter = 0xFFFD;
+
+			const u8 lead = (u8)text[offset];
+
+			if (lead < 0x80)
+			{
+				offset++;
+				return lead;
+			}
+
+			size_t length = 0;
+			u32 codepoint = 0;
+			u32 minimum   = 0; // overlong encodings are invalid
+
+			if ((lead & 0xE0) == 0xC0)
+			{
+				length    = 2;
+				codepoint = lead & 0x1F;
+				minimum   = 0x80;
+			}
+			else if ((lead & 0xF0) == 0xE0)
+			{
+				length    = 3;
+				codepoint = lead & 0x0F;
+				minimum   = 0x800;
+			}
+			else if ((lead & 0xF8) == 0xF0)
+			{
+				length    = 4;
+				codepoint = lead & 0x07;
+				minimum   = 0x10000;
+			}
+			else
+			{
+				offset++;
+				return ReplacementCharacter;
+			}
+
+			if (offset + length > text.size())
+			{
+				offset++;
+				return ReplacementCharacter;
+			}
+
+			for (size_t i = 1; i < length; i++)
+			{
+				const u8 continuation = (u8)text[offset + i];
+
+				if ((continuation & 0xC0) != 0x80)
+				{
+					offset++;
+					return ReplacementCharacter;
+				}
+
+				codepoint = (codepoint << 6) | (continuation & 0x3F);
+			}
+
+			if (codepoint < minimum || codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF))
+			{
+				offset++;
+				return ReplacementCharacter;
+			}
+
+			offset += length;
+
+			return codepoint;
+		}
+
 	} // namespace String
 
 } // namespace SW
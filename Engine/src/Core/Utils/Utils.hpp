@@ -32,7 +32,7 @@ namespace SW
 		 * @param bytes The bytes to convert to a string.
 		 * @return std::string The string representation of the given bytes.
 		 */
-		std::string BytesToString(u32 bytes);
+		std::string BytesToString(u64 bytes);
 
 		/**
 		 * @brief Returns a string representation of the sum of allocated memory
@@ -59,6 +59,16 @@ namespace SW
 		 */
 		std::string RemoveExtension(const std::string& filename);
 
+		/**
+		 * @brief Decodes the UTF-8 code point starting at the given offset and moves the offset past it.
+		 * @note Invalid or truncated sequences decode to U+FFFD and skip a single byte.
+		 *
+		 * @param text The UTF-8 encoded text.
+		 * @param offset Offset of the first byte of the code point, must be smaller than the size of the text.
+		 * @return u32 The decoded code point.
+		 */
+		u32 DecodeUTF8(std::string_view text, size_t& offset);
+
 	} // namespace String
 
 } // namespace SW
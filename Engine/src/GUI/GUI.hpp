@@ -8,7 +8,7 @@
  * functionality for creating graphical user interfaces.
  *
  * @author SW
- * @version 0.3.0
+ * @version 0.3.1
  * @date 2024-04-28
  * @copyright Copyright (c) 2024 SW
  *
@@ -1219,9 +1219,9 @@ namespace SW::GUI
 			return modified;
 		}
 
-		template <typename K, typename V>
+		template <typename V>
 		    requires std::is_base_of_v<Asset, V>
-		static bool AssetDropdownTableMap(std::unordered_map<K, V**>* map)
+		static bool AssetDropdownTableMap(std::unordered_map<StringId, NamedAsset<V>>* map)
 		{
 			bool modified = false;
 
@@ -1240,22 +1240,24 @@ namespace SW::GUI
 					ImGui::TableNextRow();
 					ImGui::TableNextColumn();
 
-					std::string key = it->first;
+					std::string key = it->second.Name;
 
-					ImGui::PushID(it->first.c_str());
+					ImGui::PushID(it->second.Name.c_str());
 					if (GUI::Components::SingleLineTextInputDeffered<64>(&key))
 					{
-						auto value  = it->second;
-						it          = map->erase(it);
-						(*map)[key] = value;
-						modified    = true;
+						V** value = it->second.Value;
+						it        = map->erase(it);
+
+						(*map)[StringId(key)] = {key, value};
+
+						modified = true;
 						ImGui::PopID();
 						continue; // Skip the increment because we've modified the map
 					}
 
 					ImGui::TableNextColumn();
 
-					const AssetMetaData& metadata = AssetManager::GetAssetMetaData((*it->second)->GetHandle());
+					const AssetMetaData& metadata = AssetManager::GetAssetMetaData((*it->second.Value)->GetHandle());
 
 					ImGui::Text("%s", metadata.Path.stem().string().c_str());
 
@@ -1272,9 +1274,8 @@ namespace SW::GUI
 
 					if (ImGui::Button(SW_ICON_CLOSE_OCTAGON, {ImGui::GetFrameHeight(), ImGui::GetFrameHeight()}))
 					{
-						auto value = it->second;
-						it         = map->erase(it);
-						modified   = true;
+						it       = map->erase(it);
+						modified = true;
 						ImGui::PopID();
 						continue; // Skip the increment because we've modified the map
 					}
@@ -1295,8 +1296,10 @@ namespace SW::GUI
 				{
 					u64 handle = *static_cast<u64*>(payload->Data);
 
-					V** newElement                 = AssetManager::GetAssetRaw<V>(handle);
-					(*map)[std::to_string(rand())] = newElement;
+					V** newElement   = AssetManager::GetAssetRaw<V>(handle);
+					std::string name = std::to_string(rand());
+
+					(*map)[StringId(name)] = {name, newElement};
 
 					modified = true;
 				}
@@ -1851,21 +1854,20 @@ namespace SW::GUI
 
 		/**
 		 * @brief Draws an asset dropdown table map property in the GUI.
-		 * @tparam K The type of the key in the map.
-		 * @tparam V The type of the value in the map.
-		 * @param map The map of asset pointers to display in the dropdown table.
+		 * @tparam V The type of the assets in the map.
+		 * @param map The map of named assets to display in the dropdown table.
 		 * @param label The label for the property.
 		 * @param tooltip An optional tooltip to display when hovering over the label.
 		 * @returns bool Whether the asset dropdown table map was modified.
 		 */
-		template <typename K, typename V>
+		template <typename V>
 		    requires std::is_base_of_v<Asset, V>
-		static bool AssetDropdownTableMapProperty(std::unordered_map<K, V**>* map, const char* label,
+		static bool AssetDropdownTableMapProperty(std::unordered_map<StringId, NamedAsset<V>>* map, const char* label,
 		                                          const char* tooltip = nullptr)
 		{
 			Properties::BeginPropertyGrid(label, tooltip);
 
-			bool modified = Widgets::AssetDropdownTableMap<K, V>(map);
+			bool modified = Widgets::AssetDropdownTableMap<V>(map);
 
 			Properties::EndPropertyGrid();
 
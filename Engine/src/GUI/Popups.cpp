@@ -288,9 +288,13 @@ namespace SW::GUI::Popups
 				GUI::Properties::BeginProperties("##font_import_advanced_property");
 
 				GUI::Properties::RadioButtonProperty<FontCharsetType>(
-				    &m_Data.CharsetType, {{"ASCII", FontCharsetType::ASCII}, {"ALL", FontCharsetType::ALL}},
+				    &m_Data.CharsetType,
+				    {{"ASCII", FontCharsetType::ASCII},
+				     {"ALL", FontCharsetType::ALL},
+				     {"Dynamic", FontCharsetType::Dynamic}},
 				    "Charset Type",
-				    "Define which set of characters to use (ALL is much more memory intensive than ASCII)");
+				    "Define which set of characters to use (ALL is much more memory intensive than ASCII, Dynamic "
+				    "generates any unicode character the first time it is drawn)");
 
 				GUI::Properties::EndProperties();
 
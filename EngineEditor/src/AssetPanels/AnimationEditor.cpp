@@ -20,6 +20,17 @@ namespace SW
 		if (!m_FramesCount)
 			return;
 
+		Animation2D* animation = *m_Animation;
+
+		if (!animation->IsBaked() && animation->CanBake())
+			animation->Bake(); // the sprites were still loading when the editor was opened
+
+		if (animation->IsBaked())
+		{
+			m_CurrentFrame = (int)animation->GetFrameIndex(m_CurrentTime);
+			return;
+		}
+
 		m_CurrentFrame = (int)(m_CurrentTime * (*m_Animation)->Speed) % m_FramesCount;
 
 		if (m_CurrentFrame >= m_FramesCount)
@@ -73,13 +84,27 @@ namespace SW
 			{
 				m_CurrentFrame = 0;
 			}
-			GUI::Properties::CheckboxProperty(&(*m_Animation)->ReverseAlongX, "Flip X");
-			GUI::Properties::CheckboxProperty(&(*m_Animation)->ReverseAlongY, "Flip Y");
+			bool modified = GUI::Properties::CheckboxProperty(&(*m_Animation)->ReverseAlongX, "Flip X");
+			modified |= GUI::Properties::CheckboxProperty(&(*m_Animation)->ReverseAlongY, "Flip Y");
 
-			GUI::Properties::AssetDropdownTableProperty<Sprite>(&(*m_Animation)->Sprites, "Sprites");
+			modified |= GUI::Properties::AssetDropdownTableProperty<Sprite>(&(*m_Animation)->Sprites, "Sprites");
+
+			std::vector<f32>& durations = (*m_Animation)->FrameDurations;
+			durations.resize((*m_Animation)->Sprites.size(), 1.f);
+
+			for (u64 i = 0; i < durations.size(); i++)
+			{
+				const std::string label = "Frame " + std::to_string(i) + " duration";
+
+				modified |= GUI::Properties::ScalarDragProperty(&durations[i], label.c_str(), "In frames, see Speed",
+				                                                0.05f, 0.f, 100.f);
+			}
 
 			GUI::Properties::EndProperties();
 
+			if (modified)
+				(*m_Animation)->Bake(); // the frame count or the texture coordinates could change
+
 			ImGui::TableNextColumn();
 
 			GUI::MoveMousePosX(20.f);
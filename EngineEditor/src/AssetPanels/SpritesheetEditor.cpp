@@ -416,22 +416,12 @@ namespace SW
 
 	void SpritesheetEditor::ExportSprites() const
 	{
-		const Texture2D* texture = (*m_Spritesheet)->GetSpritesheetTexture();
-		const f32 texWidth       = (f32)texture->GetWidth();
-		const f32 texHeight      = (f32)texture->GetHeight();
-		const glm::vec2 offset   = (*m_Spritesheet)->CenterOffset;
+		const Texture2D* texture    = (*m_Spritesheet)->GetSpritesheetTexture();
+		const glm::vec2 textureSize = {(f32)texture->GetWidth(), (f32)texture->GetHeight()};
 
 		for (const SpriteData& sprite : (*m_Spritesheet)->Sprites)
 		{
-			const f32 x      = sprite.Position.x + offset.x; // 0 -> texWidth
-			const f32 y      = sprite.Position.y + offset.y; // 0 -> texHeight
-			const f32 width  = sprite.Size.x;
-			const f32 height = sprite.Size.y;
-
-			const glm::vec2 leftDown  = {x / texWidth, 1.0f - y / texHeight};
-			const glm::vec2 rightDown = {(x + width) / texWidth, 1.0f - y / texHeight};
-			const glm::vec2 upRight   = {(x + width) / texWidth, 1.0f - (y + height) / texHeight};
-			const glm::vec2 upLeft    = {x / texWidth, 1.0f - (y + height) / texHeight};
+			const SpriteTexCoords coords = (*m_Spritesheet)->GetTexCoords(sprite, textureSize);
 
 			APP_TRACE("Exporting {} sprite", sprite.Name);
 
@@ -443,10 +433,10 @@ namespace SW
 			output << YAML::BeginMap;
 			output << YAML::Key << "SpritesheetTextureHandle" << YAML::Value
 			       << (*m_Spritesheet)->GetSpritesheetTexture()->GetHandle();
-			output << YAML::Key << "TexCordLeftDown" << YAML::Value << leftDown;
-			output << YAML::Key << "TexCordRightDown" << YAML::Value << rightDown;
-			output << YAML::Key << "TexCordUpRight" << YAML::Value << upRight;
-			output << YAML::Key << "TexCordUpLeft" << YAML::Value << upLeft;
+			output << YAML::Key << "TexCordLeftDown" << YAML::Value << coords.LeftDown;
+			output << YAML::Key << "TexCordRightDown" << YAML::Value << coords.RightDown;
+			output << YAML::Key << "TexCordUpRight" << YAML::Value << coords.UpRight;
+			output << YAML::Key << "TexCordUpLeft" << YAML::Value << coords.UpLeft;
 			output << YAML::EndMap;
 
 			output << YAML::EndMap;
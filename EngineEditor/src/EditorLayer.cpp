@@ -1,5 +1,6 @@
 #include "EditorLayer.hpp"
 
+#include "Asset/AssetPack.hpp"
 #include "AssetPanels/AssetEditorPanelManager.hpp"
 #include "Audio/AudioEngine.hpp"
 #include "Core/Project/Project.hpp"
@@ -58,7 +59,7 @@ namespace SW
 		PanelManager::AddPanel(PanelType::PropertiesPanel, new PropertiesPanel(m_Viewport));
 		PanelManager::AddPanel(PanelType::SceneHierarchyPanel, new SceneHierarchyPanel(m_Viewport));
 		PanelManager::AddPanel(PanelType::SceneViewportPanel, m_Viewport);
-		PanelManager::AddPanel(PanelType::StatisticsPanel, new StatisticsPanel());
+		PanelManager::AddPanel(PanelType::StatisticsPanel, new StatisticsPanel(m_Viewport));
 		PanelManager::AddPanel(PanelType::AssetManagerPanel, new AssetManagerPanel());
 		PanelManager::AddPanel(PanelType::AudioEventsPanel, new AudioEventsPanel());
 		PanelManager::AddPanel(PanelType::ProjectSettingsPanel, new ProjectSettingsPanel());
@@ -362,6 +363,11 @@ namespace SW
 						PanelManager::OpenPanel(PanelType::AssetManagerPanel);
 					}
 
+					if (ImGui::MenuItemEx("Cook Asset Pack", SW_ICON_PACKAGE_VARIANT_CLOSED))
+					{
+						CookAssetPack();
+					}
+
 					ImGui::EndMenu();
 				}
 
@@ -581,4 +587,21 @@ namespace SW
 		scriptStorage.SynchronizeStorage();
 	}
 
+	void EditorLayer::CookAssetPack()
+	{
+		if (!ProjectContext::HasContext())
+			return;
+
+		std::filesystem::path filepath = FileSystem::SaveFileDialog({{"SW Engine Asset Pack", "sw_pack"}});
+
+		if (filepath.empty())
+			return;
+
+		if (m_Viewport->IsSceneLoaded())
+			SaveCurrentScene(); // the pack is cooked from the files on disk
+
+		AssetPack::Cook(AssetManager::GetRegistry(), ProjectContext::Get()->GetAssetDirectory(), filepath,
+		                ProjectContext::Get()->GetConfig().TextureCompression);
+	}
+
 } // namespace SW
@@ -33,6 +33,8 @@ namespace SW
 		void SaveProjectAs();
 
 		void ReloadCSharpScripts();
+
+		void CookAssetPack();
 	};
 
 } // namespace SW
@@ -1,6 +1,8 @@
 #include "AssetManagerPanel.hpp"
 
+#include "Core/OpenGL/TextureUploader.hpp"
 #include "Core/Project/ProjectContext.hpp"
+#include "Core/Utils/Utils.hpp"
 #include "GUI/Appearance.hpp"
 
 namespace SW
@@ -26,6 +28,77 @@ namespace SW
 				                                       ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable |
 				                                       ImGuiTableFlags_ScrollY;
 
+				if (GUI::Layout::BeginHeaderCollapse("Resident memory"))
+				{
+					if (ImGui::BeginTable("Memory", 5, tableFlags))
+					{
+						ImGui::TableSetupColumn("Type");
+						ImGui::TableSetupColumn("Loaded");
+						ImGui::TableSetupColumn("Resident");
+						ImGui::TableSetupColumn("Budget");
+						ImGui::TableSetupColumn("Evictions");
+
+						ImGui::TableHeadersRow();
+
+						for (auto&& [type, statistics] : AssetManager::GetMemoryStatistics())
+						{
+							ImGui::TableNextRow();
+
+							ImGui::TableNextColumn();
+							ImGui::Text("%s", Asset::GetStringifiedAssetType(type));
+
+							ImGui::TableNextColumn();
+							ImGui::Text("%u", statistics.ResidentCount);
+
+							ImGui::TableNextColumn();
+							ImGui::Text("%s", String::BytesToString(statistics.ResidentBytes).c_str());
+
+							ImGui::TableNextColumn();
+							if (statistics.Budget)
+							{
+								const f32 usage          = (f32)statistics.ResidentBytes / (f32)statistics.Budget;
+								const std::string budget = String::BytesToString(statistics.Budget);
+
+								ImGui::ProgressBar(usage, ImVec2(120.f, 0.f), budget.c_str());
+							}
+							else
+							{
+								ImGui::Text("Unlimited");
+							}
+
+							ImGui::TableNextColumn();
+							ImGui::Text("%u", statistics.Evictions);
+						}
+
+						ImGui::EndTable();
+					}
+
+					GUI::Layout::EndHeaderCollapse();
+				}
+
+				if (GUI::Layout::BeginHeaderCollapse("Texture uploads"))
+				{
+					const TextureUploadStatistics statistics = TextureUploader::GetStatistics();
+
+					const std::string bandwidth = String::BytesToString((u64)statistics.Bandwidth);
+					const std::string uploaded  = String::BytesToString(statistics.UploadedBytes);
+					const std::string capacity  = String::BytesToString(statistics.StagingCapacity);
+
+					ImGui::Text("Bandwidth: %s/s", bandwidth.c_str());
+					ImGui::Text("Uploaded: %s in %u textures", uploaded.c_str(), statistics.UploadedTextures);
+					ImGui::Text("Pending: %u", statistics.PendingUploads);
+					ImGui::Text("Direct uploads: %u", statistics.DirectUploads);
+
+					if (statistics.StagingCapacity)
+					{
+						const f32 usage = (f32)statistics.StagingUsed / (f32)statistics.StagingCapacity;
+
+						ImGui::ProgressBar(usage, ImVec2(120.f, 0.f), capacity.c_str());
+					}
+
+					GUI::Layout::EndHeaderCollapse();
+				}
+
 				if (GUI::Layout::BeginHeaderCollapse("Available assets"))
 				{
 					const std::map<AssetHandle, AssetMetaData>& avail =
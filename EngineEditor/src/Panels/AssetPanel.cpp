@@ -1,5 +1,7 @@
 #include "AssetPanel.hpp"
 
+#include <algorithm>
+
 #include "Asset/AssetDirectoryTree.hpp"
 #include "Asset/AssetManager.hpp"
 #include "Asset/Sprite.hpp"
@@ -8,6 +10,7 @@
 #include "Core/OpenGL/Texture2D.hpp"
 #include "Core/Project/ProjectContext.hpp"
 #include "Core/Renderer/Renderer2D.hpp"
+#include "Core/Scene/SceneBinarySerializer.hpp"
 #include "Core/Utils/FileSystem.hpp"
 #include "GUI/Appearance.hpp"
 #include "GUI/Editor/EditorResources.hpp"
@@ -32,11 +35,13 @@ namespace SW
 			m_AssetTree->TraverseDirectoryAndMapAssets();
 			m_SelectedItem = m_AssetTree->GetRootItem();
 
+			m_Watcher.Start(m_AssetsDirectory, {"build", "cache"});
+
 			return false;
 		});
 
 		EventSystem::Register(EVENT_CODE_ASSET_DIR_CONTENT_CHANGED, [this](Event /*event*/) -> bool {
-			LoadDirectoryEntries();
+			RefreshDirectoryEntries();
 
 			return true;
 		});
@@ -50,6 +55,15 @@ namespace SW
 	void AssetPanel::OnUpdate(Timestep dt)
 	{
 		m_CurrentTime += dt;
+
+		if (ProjectContext::HasContext())
+		{
+			ApplyFileChanges();
+
+			AssetManager::GetRegistryRaw().Update();
+		}
+
+		m_Cache.Update();
 	}
 
 	void AssetPanel::OnRender()
@@ -88,14 +102,14 @@ namespace SW
 			}
 
 			if (GUI::Popups::DrawDeleteFilePopup(m_FilesystemEntryToDelete, &m_OpenDeleteWarningModal))
-				LoadDirectoryEntries();
+				RefreshDirectoryEntries();
 
 			if (m_SelectedItem &&
 			    GUI::Popups::DrawAddNewFilePopup(m_AssetsDirectory / m_SelectedItem->Path, &m_OpenNewFileModal))
-				LoadDirectoryEntries();
+				RefreshDirectoryEntries();
 
 			if (GUI::Popups::DrawDeleteFileToRenamePopup(m_FilesystemEntryToRename, &m_RenameEntryModal))
-				LoadDirectoryEntries();
+				RefreshDirectoryEntries();
 
 			OnEnd();
 		}
@@ -118,6 +132,54 @@ namespace SW
 			m_SelectedItem = m_AssetTree->GetRootItem();
 	}
 
+	void AssetPanel::RefreshDirectoryEntries()
+	{
+		if (m_Watcher.IsWatching())
+			ApplyFileChanges();
+		else
+			LoadDirectoryEntries();
+	}
+
+	void AssetPanel::ApplyFileChanges()
+	{
+		m_FileChanges.clear();
+		m_Watcher.Poll(m_FileChanges);
+
+		if (m_FileChanges.empty())
+			return;
+
+		const bool hasOverflown = std::any_of(m_FileChanges.begin(), m_FileChanges.end(), [](const FileChange& change) {
+			return change.Type == FileChangeType::Overflow;
+		});
+
+		if (hasOverflown) // some changes were lost, only a full scan can tell
+		{
+			LoadDirectoryEntries();
+			return;
+		}
+
+		// Items of removed entries are deleted, the selection is looked up again by its path after the moves.
+		std::filesystem::path selectedPath = m_SelectedItem->Path;
+
+		for (const FileChange& change : m_FileChanges)
+		{
+			if (change.Type == FileChangeType::Renamed && FileSystem::IsSameOrInside(selectedPath, change.OldPath))
+				selectedPath = FileSystem::Rebase(selectedPath, change.OldPath, change.Path);
+		}
+
+		AssetManager::GetRegistryRaw().ApplyChanges(m_FileChanges);
+		m_AssetTree->ApplyChanges(m_FileChanges);
+
+		AssetSourceItem* selectedItem = m_AssetTree->FindChildItemByPath(m_AssetTree->GetRootItem(), selectedPath);
+
+		if (selectedItem)
+			m_SelectedItem = selectedItem;
+		else
+			m_SelectedItem = m_AssetTree->GetRootItem();
+
+		m_QueuedSelectedItem = nullptr;
+	}
+
 	void AssetPanel::DrawHeader()
 	{
 		if (ImGui::Button(SW_ICON_COGS, {34.f, 34.f}))
@@ -161,7 +223,7 @@ namespace SW
 		if (ImGui::Button(SW_ICON_ARROW_LEFT_BOLD, {34.f, 34.f}))
 		{
 			m_SelectedItem = m_SelectedItem->Parent;
-			LoadDirectoryEntries();
+			RefreshDirectoryEntries();
 		}
 
 		if (atAssetsDir)
@@ -427,7 +489,7 @@ namespace SW
 
 				ImGui::Image(whiteTexId, imageSize, {0, 0}, {1, 1}, backgroundColor, borderColor);
 
-				DrawItemOperationsPopup(item);
+				DrawItemOperationsPopup(item, &refreshDirectory);
 
 				if (ImGui::IsItemHovered())
 				{
@@ -466,15 +528,8 @@ namespace SW
 
 				if (!item->Thumbnail)
 				{
-
-					// ---- !IMPORTANT! ----
-					/*
-					    Actually and edge case, when asset was just created e.g. importing a FontSource and creating
-					   with it a Font, it does not have the correct modification time, since it happened instantly as
-					   for the disk save takes some time and updates the modification time in a deffered way.
-					*/
-					const u64 modificationTime =
-					    FileSystem::GetLastWriteTime(ProjectContext::Get()->GetAssetDirectory() / item->Path);
+					// Thumbnails are keyed by the contents, touching or copying the file keeps them.
+					const u64 contentHash = AssetManager::GetAssetMetaData(item->Handle).ContentHash;
 
 					if (item->Type == AssetType::Sprite)
 					{
@@ -496,14 +551,17 @@ namespace SW
 					}
 					else if (item->Type == AssetType::Texture2D)
 					{
-						Texture2D** texture = m_Cache.GetTextureThumbnail(item->Path, item->Handle, modificationTime);
+						Texture2D** texture = m_Cache.GetTextureThumbnail(item->Path, item->Handle, contentHash);
 
-						Thumbnail thumbnail;
-						thumbnail.Width   = (f32)(*texture)->GetWidth();
-						thumbnail.Height  = (f32)(*texture)->GetHeight();
-						thumbnail.Texture = texture;
+						if (*texture) // otherwise still being generated, asked for again next frame
+						{
+							Thumbnail thumbnail;
+							thumbnail.Width   = (f32)(*texture)->GetWidth();
+							thumbnail.Height  = (f32)(*texture)->GetHeight();
+							thumbnail.Texture = texture;
 
-						item->Thumbnail = thumbnail;
+							item->Thumbnail = thumbnail;
+						}
 					}
 					else if (item->Type == AssetType::Spritesheet)
 					{
@@ -519,19 +577,22 @@ namespace SW
 							const AssetMetaData& metadata = AssetManager::GetAssetMetaData((*texture)->GetHandle());
 
 							texture = m_Cache.GetTextureThumbnail(metadata.Path, (*texture)->GetHandle(),
-							                                      metadata.ModificationTime);
+							                                      metadata.ContentHash);
 						}
 
-						Thumbnail thumbnail;
-						thumbnail.Width   = (f32)(*texture)->GetWidth();
-						thumbnail.Height  = (f32)(*texture)->GetHeight();
-						thumbnail.Texture = texture;
+						if (*texture)
+						{
+							Thumbnail thumbnail;
+							thumbnail.Width   = (f32)(*texture)->GetWidth();
+							thumbnail.Height  = (f32)(*texture)->GetHeight();
+							thumbnail.Texture = texture;
 
-						item->Thumbnail = thumbnail;
+							item->Thumbnail = thumbnail;
+						}
 					}
 					else if (item->Type == AssetType::Font)
 					{
-						Texture2D** texture = m_Cache.GetFontAtlasThumbnail(item->Path, item->Handle, modificationTime);
+						Texture2D** texture = m_Cache.GetFontAtlasThumbnail(item->Path, item->Handle, contentHash);
 
 						Thumbnail thumbnail;
 						thumbnail.Width   = (f32)(*texture)->GetWidth();
@@ -670,7 +731,7 @@ namespace SW
 					AssetManager::CreateNew<Prefab>(
 					    std::filesystem::relative(newFilePath, ProjectContext::Get()->GetAssetDirectory()), entity);
 
-					LoadDirectoryEntries();
+					RefreshDirectoryEntries();
 				}
 				ImGui::EndDragDropTarget();
 			}
@@ -681,7 +742,7 @@ namespace SW
 			if (refreshDirectory)
 			{
 				refreshDirectory = false;
-				LoadDirectoryEntries();
+				RefreshDirectoryEntries();
 			}
 
 			if (m_QueuedSelectedItem)
@@ -692,7 +753,7 @@ namespace SW
 		}
 	}
 
-	void AssetPanel::DrawItemOperationsPopup(const AssetSourceItem* item)
+	void AssetPanel::DrawItemOperationsPopup(const AssetSourceItem* item, bool* refreshDirectory)
 	{
 		if (ImGui::BeginPopupContextItem("DirectoryEntryPopupMenu"))
 		{
@@ -718,6 +779,17 @@ namespace SW
 				{
 					FileSystem::OpenExternally(m_AssetsDirectory / item->Path);
 				}
+
+				if (item->Path.extension() == ".sw_scene" && ImGui::MenuItemEx("Convert to binary", SW_ICON_EXPORT))
+				{
+					const std::filesystem::path source = m_AssetsDirectory / item->Path;
+
+					std::filesystem::path target = source;
+					target.replace_extension(SceneBinarySerializer::Extension);
+
+					if (SceneBinarySerializer::Convert(source, target))
+						*refreshDirectory = true;
+				}
 			}
 
 			if (ImGui::MenuItemEx("Delete", SW_ICON_DELETE))
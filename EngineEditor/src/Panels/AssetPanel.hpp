@@ -1,6 +1,6 @@
 /**
  * @file AssetPanel.hpp
- * @version 0.2.2
+ * @version 0.2.3
  * @date 2024-05-12
  *
  * @copyright Copyright (c) 2024 SW
@@ -10,6 +10,7 @@
 #include <filesystem>
 
 #include "Asset/Cache/ThumbnailCache.hpp"
+#include "Core/Utils/FileWatcher.hpp"
 #include "GUI/Panel.hpp"
 
 namespace SW
@@ -65,6 +66,9 @@ namespace SW
 
 		ThumbnailCache m_Cache;
 
+		FileWatcher m_Watcher;                 /** @brief Watches the assets directory. */
+		std::vector<FileChange> m_FileChanges; /** @brief Changes polled this frame, reused between frames. */
+
 		f32 m_CurrentTime = 0u; // for animation2d thumbnails
 
 		/**
@@ -72,6 +76,16 @@ namespace SW
 		 */
 		void LoadDirectoryEntries();
 
+		/**
+		 * @brief Brings the directory entries up to date, incrementally if the assets directory is watched.
+		 */
+		void RefreshDirectoryEntries();
+
+		/**
+		 * @brief Applies the changes of the watched assets directory to the registry and the tree.
+		 */
+		void ApplyFileChanges();
+
 		/**
 		 * @brief Draws the header of the asset panel.
 		 */
@@ -94,7 +108,7 @@ namespace SW
 		 */
 		void DrawBody();
 
-		void DrawItemOperationsPopup(const AssetSourceItem* item);
+		void DrawItemOperationsPopup(const AssetSourceItem* item, bool* refreshDirectory);
 
 		void HandleItemOnDoubleClick(AssetSourceItem* item, bool* refreshDirectory);
 
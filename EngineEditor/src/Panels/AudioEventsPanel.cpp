@@ -22,7 +22,10 @@ namespace SW
 
 			if (ImGui::Button(SW_ICON_PLUS " Add"))
 			{
-				audioEventsMap[std::format("New Audio Event - {}", Random::CreateTag(5))] = {};
+				AudioEvent event;
+				event.Name = std::format("New Audio Event - {}", Random::CreateTag(5));
+
+				audioEventsMap[StringId(event.Name)] = event;
 			}
 
 			if (ImGui::BeginTable("AudioEventsPanel_MainViewTable", 2, flags | ImGuiTableFlags_ScrollY,
@@ -38,16 +41,16 @@ namespace SW
 
 				if (ImGui::BeginTable("AudioEventsPanel_EventsTable", 1, flags, ImGui::GetContentRegionAvail()))
 				{
-					for (auto& [name, event] : audioEventsMap)
+					for (auto& [id, event] : audioEventsMap)
 					{
 						ImGui::TableNextRow();
 						ImGui::TableNextColumn();
 
-						GUI::ScopedID id(name.c_str());
-						const bool isSelected = m_Selected == name;
-						if (ImGui::Selectable(name.c_str(), isSelected))
+						GUI::ScopedID scopedId(event.Name.c_str());
+						const bool isSelected = m_Selected == id;
+						if (ImGui::Selectable(event.Name.c_str(), isSelected))
 						{
-							m_Selected      = name;
+							m_Selected      = id;
 							m_SelectedEvent = &event;
 						}
 					}
@@ -57,7 +60,7 @@ namespace SW
 
 				ImGui::TableNextColumn();
 
-				if (m_Selected.empty())
+				if (!m_Selected.IsValid())
 				{
 					ImGui::TextUnformatted("Select an event to view its properties");
 				}
@@ -67,14 +70,16 @@ namespace SW
 					GUI::ScopedStyle IndentSpacing(ImGuiStyleVar_IndentSpacing, 0.0f);
 					GUI::ScopedStyle WindowPadding(ImGuiStyleVar_WindowPadding, ImVec2(0.0f, 2.0f));
 
-					std::string name = m_Selected;
+					std::string name = m_SelectedEvent->Name;
 					if (GUI::Components::SingleLineTextInputDeffered<128>(&name))
 					{
-						AudioEvent event = audioEventsMap[m_Selected];
+						AudioEvent event = *m_SelectedEvent;
+						event.Name       = name;
+
 						audioEventsMap.erase(m_Selected);
-						audioEventsMap[name] = event;
-						m_Selected           = name;
-						m_SelectedEvent      = &audioEventsMap[name];
+
+						m_Selected      = StringId(name);
+						m_SelectedEvent = &(audioEventsMap[m_Selected] = event);
 					}
 
 					GUI::Properties::BeginProperties("audio_event_properties");
@@ -126,7 +131,7 @@ namespace SW
 					if (ImGui::Button(SW_ICON_DELETE " Delete"))
 					{
 						audioEventsMap.erase(m_Selected);
-						m_Selected.clear();
+						m_Selected      = {};
 						m_SelectedEvent = nullptr;
 					}
 				}
@@ -1,6 +1,6 @@
 /**
  * @file AudioEventsPanel.hpp
- * @version 0.1.0
+ * @version 0.1.1
  * @date 2024-05-12
  *
  * @copyright Copyright (c) 2024 SW
@@ -26,7 +26,7 @@ namespace SW
 
 	private:
 		AudioEvent* m_SelectedEvent = nullptr;
-		std::string m_Selected;
+		StringId m_Selected; // invalid if nothing is selected
 	};
 
 } // namespace SW
@@ -163,8 +163,7 @@ namespace SW
 					    component.DefaultAnimation = AssetManager::GetAssetRaw<Animation2D>(handle);
 					    component.CurrentAnimation = component.DefaultAnimation;
 				    }
-				    GUI::Properties::AssetDropdownTableMapProperty<std::string, Animation2D>(&component.Animations,
-				                                                                             "Animations");
+				    GUI::Properties::AssetDropdownTableMapProperty<Animation2D>(&component.Animations, "Animations");
 
 				    GUI::Properties::EndProperties();
 			    },
@@ -479,6 +478,13 @@ namespace SW
 					                                      "Is this a fast moving body that should be prevented from "
 					                                      "tunneling through other moving bodies?");
 				    }
+				    GUI::Properties::ScalarInputProperty<u16>(
+				        &component.CollisionLayer, "Collision Layer",
+				        "The layer bits the body's colliders belong to (used by collisions and physics queries)", 1, 1, 0,
+				        0xFFFF, "0x%04X");
+				    GUI::Properties::ScalarInputProperty<u16>(&component.CollisionMask, "Collision Mask",
+				                                              "The layer bits the body's colliders collide with", 1, 1,
+				                                              0, 0xFFFF, "0x%04X");
 				    GUI::Properties::EndProperties();
 			    },
 			    true);
@@ -1,5 +1,7 @@
 #include "SceneViewportPanel.hpp"
 
+#include <algorithm>
+
 #include "Asset/AssetManager.hpp"
 #include "Asset/Prefab.hpp"
 #include "Core/ECS/Entity.hpp"
@@ -63,6 +65,14 @@ namespace SW
 	{
 		PROFILE_FUNCTION();
 
+		if (m_PendingScene)
+		{
+			m_ScenePreloader.Update();
+
+			if (m_ScenePreloader.IsFinished())
+				FinishOpeningScene();
+		}
+
 		FramebufferSpecification spec = m_Framebuffer->GetSpecification();
 
 		if (m_ViewportSize.x > 0.0f && m_ViewportSize.y > 0.0f && // if it's a valid size viewport
@@ -537,20 +547,7 @@ namespace SW
 					{
 						u64 handle = *static_cast<u64*>(payload->Data);
 
-						const AssetMetaData& metadata = AssetManager::GetAssetMetaData(handle);
-
-						if (SelectionManager::IsSelected())
-							SelectionManager::Deselect();
-
-						delete GetCurrentScene();
-
-						Scene* newScene =
-						    SceneSerializer::Deserialize(ProjectContext::Get()->GetAssetDirectory() / metadata.Path);
-						newScene->SetHandle(handle);
-
-						SetCurrentScene(newScene);
-
-						newScene->SortEntities();
+						OpenScene(handle);
 					}
 
 					if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload("Prefab"))
@@ -583,6 +580,9 @@ namespace SW
 			if (isSceneLoaded)
 				RenderSceneToolbar(startCursorPos);
 
+			if (m_PendingScene)
+				RenderScenePreloadProgress(startCursorPos);
+
 			glm::mat4 cameraProjection = m_EditorCamera->GetProjectionMatrix();
 			glm::mat4 cameraView       = m_EditorCamera->GetViewMatrix();
 
@@ -753,6 +753,63 @@ namespace SW
 		return false;
 	}
 
+	void SceneViewportPanel::OpenScene(AssetHandle handle)
+	{
+		const AssetMetaData& metadata = AssetManager::GetAssetMetaData(handle);
+
+		m_PendingScene = handle;
+		m_ScenePreloader.Start(
+		    SceneSerializer::DeserializeDependencies(ProjectContext::Get()->GetAssetDirectory() / metadata.Path));
+
+		APP_INFO("Preloading {} assets of the scene {}", m_ScenePreloader.GetTotalCount(), metadata.Path.string());
+	}
+
+	void SceneViewportPanel::FinishOpeningScene()
+	{
+		PROFILE_FUNCTION();
+
+		const AssetHandle handle = m_PendingScene;
+
+		m_PendingScene = 0;
+
+		if (!AssetManager::IsValid(handle))
+		{
+			m_ScenePreloader.Clear();
+
+			return; // removed while its dependencies were loading
+		}
+
+		const AssetMetaData& metadata = AssetManager::GetAssetMetaData(handle);
+
+		if (SelectionManager::IsSelected())
+			SelectionManager::Deselect();
+
+		delete GetCurrentScene();
+
+		Scene* newScene = SceneSerializer::Deserialize(ProjectContext::Get()->GetAssetDirectory() / metadata.Path);
+		newScene->SetHandle(handle);
+
+		// References of the scene hold its assets from now on, the preloaded ones may be evicted once unused
+		m_ScenePreloader.Clear();
+
+		SetCurrentScene(newScene);
+
+		newScene->SortEntities();
+	}
+
+	void SceneViewportPanel::RenderScenePreloadProgress(ImVec2 startCursorPos)
+	{
+		const f32 width = std::min(m_ViewportSize.x * 0.5f, 400.f);
+
+		ImGui::SetCursorPos({startCursorPos.x + (m_ViewportSize.x - width) / 2.f,
+		                     startCursorPos.y + m_ViewportSize.y / 2.f});
+
+		const std::string overlay = std::format("Loading scene assets {}/{}", m_ScenePreloader.GetFinishedCount(),
+		                                        m_ScenePreloader.GetTotalCount());
+
+		ImGui::ProgressBar(m_ScenePreloader.GetProgress(), ImVec2(width, 0.f), overlay.c_str());
+	}
+
 	void SceneViewportPanel::RenderSceneToolbar(ImVec2 startCursorPos)
 	{
 		const f32 frameHeight     = 1.3f * ImGui::GetFrameHeight();
@@ -812,7 +869,12 @@ namespace SW
 			ImGui::SetCursorPosX(draggerCursorPos.x + draggerSize.x + framePadding.x - 10.f);
 
 			bool isPlaying = currentState == SceneState::Play;
-			if (GUI::Components::ToggleButton(&isPlaying, SW_ICON_PLAY, SW_ICON_PLAY, false))
+
+			ImGui::BeginDisabled(m_PendingScene != 0); // the current scene is about to be replaced
+			const bool isPlayPressed = GUI::Components::ToggleButton(&isPlaying, SW_ICON_PLAY, SW_ICON_PLAY, false);
+			ImGui::EndDisabled();
+
+			if (isPlayPressed)
 			{
 				if (currentState != SceneState::Play)
 				{
@@ -1,12 +1,13 @@
 /**
  * @file SceneViewportPanel.hpp
- * @version 0.2.4
+ * @version 0.2.5
  * @date 2024-05-12
  *
  * @copyright Copyright (c) 2024 SW
  */
 #pragma once
 
+#include "Asset/AssetPreloader.hpp"
 #include "Core/Editor/EditorCamera.hpp"
 #include "GUI/Panel.hpp"
 #include "GUI/Popups.hpp"
@@ -103,6 +104,9 @@ namespace SW
 
 		GUI::Popups::FontSourceImportDialog fontImportDialog;
 
+		AssetPreloader m_ScenePreloader; /** @brief Preloads the dependencies of the opened scene. */
+		AssetHandle m_PendingScene = 0;  /** @brief The scene opened once its dependencies are loaded, 0 if none. */
+
 	private:
 		/**
 		 * Handles the event when a mouse button is pressed.
@@ -120,6 +124,25 @@ namespace SW
 		 */
 		bool OnKeyPressed(KeyCode code);
 
+		/**
+		 * @brief Starts preloading the dependencies of the scene, the scene is opened once they are loaded.
+		 *
+		 * @param handle The handle of the scene.
+		 */
+		void OpenScene(AssetHandle handle);
+
+		/**
+		 * @brief Replaces the current scene with the pending one.
+		 */
+		void FinishOpeningScene();
+
+		/**
+		 * @brief Renders the progress of the preload of the pending scene.
+		 *
+		 * @param startCursorPos Initial cursor position.
+		 */
+		void RenderScenePreloadProgress(ImVec2 startCursorPos);
+
 		/**
 		 * @brief Renders the scene toolbar.
 		 *
@@ -3,13 +3,16 @@
 #include "Core/Application.hpp"
 #include "Core/Editor/EditorSettings.hpp"
 #include "Core/Renderer/Renderer2D.hpp"
+#include "Core/Scene/Scene.hpp"
 #include "GUI/GUI.hpp"
 #include "GUI/Icons.hpp"
+#include "Panels/SceneViewportPanel.hpp"
 
 namespace SW
 {
 
-	StatisticsPanel::StatisticsPanel() : Panel("Statistics", SW_ICON_INFORMATION_VARIANT, true)
+	StatisticsPanel::StatisticsPanel(SceneViewportPanel* sceneViewportPanel)
+	    : Panel("Statistics", SW_ICON_INFORMATION_VARIANT, true), m_SceneViewportPanel(sceneViewportPanel)
 	{
 	}
 
@@ -77,6 +80,8 @@ namespace SW
 				ImGui::TreePop();
 			}
 
+			DrawPhysicsStatistics();
+
 			if (ImGui::TreeNodeEx("##settings_tree_node", treeFlags, "%s",
 			                      SW_ICON_SETTINGS_OUTLINE "  Editor Settings"))
 			{
@@ -96,4 +101,166 @@ namespace SW
 		}
 	}
 
+	void StatisticsPanel::DrawPhysicsStatistics()
+	{
+		Scene* scene = m_SceneViewportPanel->GetCurrentScene();
+
+		if (!scene || !scene->IsPlaying())
+		{
+			m_PhysicsStep.Clear();
+			m_PhysicsCollide.Clear();
+			m_PhysicsSolve.Clear();
+			m_PhysicsBroadphase.Clear();
+			m_PhysicsWriteBack.Clear();
+			m_PhysicsJointBreak.Clear();
+			m_PhysicsBuoyancy.Clear();
+			m_PhysicsTotal.Clear();
+
+			if (scene)
+				DrawStaticColliderBakePreview(scene);
+
+			return;
+		}
+
+		const Physics2DStatistics& stats = scene->GetPhysicsStatistics2D();
+
+		// Frames without a substep did not simulate, they would only drag the minimum and average to zero
+		if (scene->GetCurrentState() != SceneState::Pause && stats.SubSteps > 0)
+		{
+			m_PhysicsStep.Push(stats.StepMs);
+			m_PhysicsCollide.Push(stats.CollideMs);
+			m_PhysicsSolve.Push(stats.SolveMs);
+			m_PhysicsBroadphase.Push(stats.BroadphaseMs);
+			m_PhysicsWriteBack.Push(stats.TransformWriteBackMs);
+			m_PhysicsJointBreak.Push(stats.JointBreakMs);
+			m_PhysicsBuoyancy.Push(stats.BuoyancyMs);
+			m_PhysicsTotal.Push(stats.GetTotalMs());
+		}
+
+		static constexpr ImGuiTreeNodeFlags treeFlags =
+		    ImGuiTreeNodeFlags_DefaultOpen | ImGuiTreeNodeFlags_SpanAvailWidth | ImGuiTreeNodeFlags_AllowItemOverlap |
+		    ImGuiTreeNodeFlags_Framed | ImGuiTreeNodeFlags_Bullet;
+
+		if (!ImGui::TreeNodeEx("##physics_tree_node", treeFlags, "%s", SW_ICON_SOCCER "  Physics 2D"))
+			return;
+
+		const ImVec2 maxWidth = ImGui::GetContentRegionAvail();
+		ImGui::PlotLines("##PhysicsTotal", m_PhysicsTotal.Values.data(), static_cast<int>(m_PhysicsTotal.Count),
+		                 static_cast<int>(m_PhysicsTotal.Count < 200 ? 0 : m_PhysicsTotal.Offset), "Total (ms)", 0.f,
+		                 m_PhysicsTotal.Max * 1.5f, ImVec2(maxWidth.x, 60.0f));
+
+		constexpr ImGuiTableFlags tableFlags =
+		    ImGuiTableFlags_SizingStretchProp | ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders;
+
+		if (ImGui::BeginTable("##physics_timings", 5, tableFlags))
+		{
+			ImGui::TableSetupColumn("Phase (ms)");
+			ImGui::TableSetupColumn("Last");
+			ImGui::TableSetupColumn("Min");
+			ImGui::TableSetupColumn("Avg");
+			ImGui::TableSetupColumn("Max");
+
+			ImGui::TableHeadersRow();
+
+			const auto drawRow = [](const char* name, f32 last, const RollingStatistic<200>& statistic) {
+				ImGui::TableNextRow();
+
+				ImGui::TableNextColumn();
+				ImGui::TextUnformatted(name);
+
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f", last);
+
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f", statistic.Min);
+
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f", statistic.Avg);
+
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f", statistic.Max);
+			};
+
+			drawRow("Step", stats.StepMs, m_PhysicsStep);
+			drawRow("  Collide", stats.CollideMs, m_PhysicsCollide);
+			drawRow("  Solve", stats.SolveMs, m_PhysicsSolve);
+			drawRow("  Broadphase", stats.BroadphaseMs, m_PhysicsBroadphase);
+			drawRow("Transform write-back", stats.TransformWriteBackMs, m_PhysicsWriteBack);
+			drawRow("Joint breaking", stats.JointBreakMs, m_PhysicsJointBreak);
+			drawRow("Buoyancy", stats.BuoyancyMs, m_PhysicsBuoyancy);
+			drawRow("Total", stats.GetTotalMs(), m_PhysicsTotal);
+
+			ImGui::EndTable();
+		}
+
+		GUI::Properties::BeginProperties("##physics2d_properties");
+
+		std::string subSteps = std::to_string(stats.SubSteps);
+		GUI::Properties::SingleLineTextInputProperty(&subSteps, "Substeps", nullptr, ImGuiInputTextFlags_ReadOnly);
+
+		std::string bodies = std::to_string(stats.BodyCount);
+		GUI::Properties::SingleLineTextInputProperty(&bodies, "Bodies", nullptr, ImGuiInputTextFlags_ReadOnly);
+
+		std::string awakeBodies = std::to_string(stats.AwakeBodyCount);
+		GUI::Properties::SingleLineTextInputProperty(&awakeBodies, "Awake Bodies", nullptr,
+		                                             ImGuiInputTextFlags_ReadOnly);
+
+		std::string contacts = std::to_string(stats.ContactCount);
+		GUI::Properties::SingleLineTextInputProperty(&contacts, "Contacts", nullptr, ImGuiInputTextFlags_ReadOnly);
+
+		std::string joints = std::to_string(stats.JointCount);
+		GUI::Properties::SingleLineTextInputProperty(&joints, "Joints", nullptr, ImGuiInputTextFlags_ReadOnly);
+
+		const StaticColliderBakeInfo2D& bake = scene->GetStaticColliderBake2D();
+
+		std::string baked = std::to_string(bake.SourceColliders) + " -> " + std::to_string(bake.BakedFixtures);
+		GUI::Properties::SingleLineTextInputProperty(&baked, "Baked Static Colliders", nullptr,
+		                                             ImGuiInputTextFlags_ReadOnly);
+
+		GUI::Properties::EndProperties();
+
+		ImGui::TreePop();
+	}
+
+	void StatisticsPanel::DrawStaticColliderBakePreview(Scene* scene)
+	{
+		static constexpr ImGuiTreeNodeFlags treeFlags =
+		    ImGuiTreeNodeFlags_SpanAvailWidth | ImGuiTreeNodeFlags_AllowItemOverlap | ImGuiTreeNodeFlags_Framed |
+		    ImGuiTreeNodeFlags_Bullet;
+
+		if (!ImGui::TreeNodeEx("##physics_bake_tree_node", treeFlags, "%s", SW_ICON_SOCCER "  Physics 2D"))
+			return;
+
+		ImGui::TextWrapped("Static box and polygon colliders are baked into a single body at runtime start. "
+		                   "Touching boxes with equal materials are merged. The editor only previews the bake, "
+		                   "nothing is stored with the scene.");
+
+		if (ImGui::Button("Preview Static Collider Bake"))
+		{
+			m_BakePreview    = scene->PreviewStaticColliderBake2D();
+			m_HasBakePreview = true;
+		}
+
+		if (m_HasBakePreview)
+		{
+			GUI::Properties::BeginProperties("##physics2d_bake_properties");
+
+			std::string colliders = std::to_string(m_BakePreview.SourceColliders);
+			GUI::Properties::SingleLineTextInputProperty(&colliders, "Static Colliders", nullptr,
+			                                             ImGuiInputTextFlags_ReadOnly);
+
+			std::string fixtures = std::to_string(m_BakePreview.BakedFixtures);
+			GUI::Properties::SingleLineTextInputProperty(&fixtures, "Baked Fixtures", nullptr,
+			                                             ImGuiInputTextFlags_ReadOnly);
+
+			std::string merged = std::to_string(m_BakePreview.MergedBoxes);
+			GUI::Properties::SingleLineTextInputProperty(&merged, "Merged Boxes", nullptr,
+			                                             ImGuiInputTextFlags_ReadOnly);
+
+			GUI::Properties::EndProperties();
+		}
+
+		ImGui::TreePop();
+	}
+
 } // namespace SW
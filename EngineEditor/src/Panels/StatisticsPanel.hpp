@@ -9,17 +9,60 @@
 
 #include <vector>
 
+#include "Core/Physics/StaticColliderBaker2D.hpp"
 #include "GUI/Panel.hpp"
 
 namespace SW
 {
+
+	class Scene;
+	class SceneViewportPanel;
+
+	/**
+	 * @brief Keeps the last N samples of a value and their min / avg / max.
+	 */
+	template <u32 N>
+	struct RollingStatistic
+	{
+		std::array<f32, N> Values = {}; ///< Ring buffer of samples
+		u32 Offset                = 0;  ///< Index of the next sample
+		u32 Count                 = 0;  ///< Number of valid samples
+
+		f32 Min = 0.f; ///< Minimum of the valid samples
+		f32 Avg = 0.f; ///< Average of the valid samples
+		f32 Max = 0.f; ///< Maximum of the valid samples
+
+		void Push(f32 value)
+		{
+			Values[Offset] = value;
+			Offset         = (Offset + 1) % N;
+			Count          = std::min(Count + 1, N);
+
+			Min = FLT_MAX;
+			Max = -FLT_MAX;
+
+			f32 sum = 0.f;
+
+			for (u32 i = 0; i < Count; i++)
+			{
+				Min = std::min(Min, Values[i]);
+				Max = std::max(Max, Values[i]);
+				sum += Values[i];
+			}
+
+			Avg = sum / static_cast<f32>(Count);
+		}
+
+		void Clear() { *this = {}; }
+	};
+
 	/**
 	 * @brief The StatisticsPanel class represents a panel that displays statistics.
 	 */
 	class StatisticsPanel final : public Panel
 	{
 	public:
-		StatisticsPanel();
+		StatisticsPanel(SceneViewportPanel* sceneViewportPanel);
 		~StatisticsPanel() override = default;
 
 		StatisticsPanel(const StatisticsPanel& other)            = delete;
@@ -39,6 +82,32 @@ namespace SW
 	private:
 		float m_FpsValues[200]        = {}; ///< Last 200 fps values
 		std::vector<f32> m_FrameTimes = {}; ///< Last 200 frame times
+
+		SceneViewportPanel* m_SceneViewportPanel = nullptr; ///< The current scene viewport context.
+
+		RollingStatistic<200> m_PhysicsStep;       ///< b2World::Step time (ms)
+		RollingStatistic<200> m_PhysicsCollide;    ///< Narrow phase time (ms)
+		RollingStatistic<200> m_PhysicsSolve;      ///< Solver time (ms)
+		RollingStatistic<200> m_PhysicsBroadphase; ///< Broad phase time (ms)
+		RollingStatistic<200> m_PhysicsWriteBack;  ///< Transform write-back time (ms)
+		RollingStatistic<200> m_PhysicsJointBreak; ///< Joint breaking time (ms)
+		RollingStatistic<200> m_PhysicsBuoyancy;   ///< Buoyancy time (ms)
+		RollingStatistic<200> m_PhysicsTotal;      ///< Total physics time (ms)
+
+		StaticColliderBakeInfo2D m_BakePreview = {};    ///< The last static collider bake preview
+		bool m_HasBakePreview                  = false; ///< Whether the bake preview was computed
+
+		/**
+		 * @brief Samples the physics statistics of the simulated scene and draws the physics section.
+		 */
+		void DrawPhysicsStatistics();
+
+		/**
+		 * @brief Draws the static collider bake preview of the edited scene.
+		 *
+		 * @param scene The edited scene.
+		 */
+		void DrawStaticColliderBakePreview(Scene* scene);
 	};
 
 } // namespace SW
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <pch.hpp>
+
+#include <Asset/Animation2D.hpp>
+#include <GUI/Editor/EditorResources.hpp>
+
+inline SW::AnimationClip MakeClip(const std::vector<f32>& durations)
+{
+	SW::AnimationClip clip;
+
+	for (f32 duration : durations)
+	{
+		clip.Length += duration;
+		clip.IsUniform &= duration == 1.f;
+
+		clip.TexCoords.emplace_back(0.f, 0.f, 1.f, 1.f);
+		clip.FrameEnds.emplace_back(clip.Length);
+	}
+
+	return clip;
+}
+
+TEST_CASE("Animation2D - tests")
+{
+	SW::Animation2D animation;
+
+	SUBCASE("uniform frames follow the speed")
+	{
+		animation.Speed = 4.f;
+		animation.SetClip(MakeClip({1.f, 1.f, 1.f}));
+
+		CHECK(animation.IsBaked());
+		CHECK(animation.GetFrameIndex(0.f) == 0);
+		CHECK(animation.GetFrameIndex(0.3f) == 1);  // 1.2 frames
+		CHECK(animation.GetFrameIndex(0.55f) == 2); // 2.2 frames
+		CHECK(animation.GetFrameIndex(0.8f) == 0);  // 3.2 frames, looped
+	}
+
+	SUBCASE("variable frame timing")
+	{
+		animation.Speed = 1.f;
+		animation.SetClip(MakeClip({0.5f, 2.f, 0.f, 1.f}));
+
+		CHECK(animation.GetFrameIndex(0.25f) == 0);
+		CHECK(animation.GetFrameIndex(0.5f) == 1);
+		CHECK(animation.GetFrameIndex(2.4f) == 1);
+		CHECK(animation.GetFrameIndex(2.6f) == 3); // frames without duration are skipped
+		CHECK(animation.GetFrameIndex(3.6f) == 0);
+	}
+
+	SUBCASE("negative speed plays backwards")
+	{
+		animation.Speed = -1.f;
+		animation.SetClip(MakeClip({1.f, 1.f, 1.f}));
+
+		CHECK(animation.GetFrameIndex(0.5f) == 2);
+		CHECK(animation.GetFrameIndex(1.5f) == 1);
+	}
+
+	SUBCASE("baking waits for the sprites")
+	{
+		SW::Sprite placeholder; // placeholders have no handle
+		SW::Sprite* sprite = &placeholder;
+
+		animation.Sprites.emplace_back(&sprite);
+
+		CHECK_FALSE(animation.Bake());
+		CHECK(animation.CanBake());
+
+		SW::Texture2D* loadingTexture = nullptr;
+
+		SW::Sprite loaded;
+		loaded.SetHandle(42);
+		loaded.SetTexture(&loadingTexture);
+
+		sprite = &loaded;
+
+		CHECK_FALSE(animation.Bake());
+		CHECK(animation.CanBake());
+
+		loaded.SetTexture(&SW::EditorResources::MissingAssetIcon); // broken sprite, never baked
+
+		CHECK_FALSE(animation.Bake());
+		CHECK_FALSE(animation.CanBake());
+		CHECK_FALSE(animation.IsBaked());
+	}
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <pch.hpp>
+
+#include <algorithm>
+
+#include <Asset/AssetDependencyGraph.hpp>
+
+inline u64 IndexOfDependent(const std::vector<SW::AssetHandle>& order, SW::AssetHandle handle)
+{
+	return (u64)(std::find(order.begin(), order.end(), handle) - order.begin());
+}
+
+TEST_CASE("AssetDependencyGraph - tests")
+{
+	constexpr SW::AssetHandle texture     = 1;
+	constexpr SW::AssetHandle spritesheet = 2;
+	constexpr SW::AssetHandle subSprite   = 3;
+	constexpr SW::AssetHandle sprite      = 4;
+	constexpr SW::AssetHandle animation   = 5;
+	constexpr SW::AssetHandle unrelated   = 6;
+
+	SW::AssetDependencyGraph graph;
+
+	graph.AddDependency(spritesheet, texture);
+	graph.AddDependency(subSprite, spritesheet);
+	graph.AddDependency(sprite, texture);
+	graph.AddDependency(animation, subSprite);
+	graph.AddDependency(animation, sprite);
+	graph.AddDependency(unrelated, 7);
+
+	SUBCASE("edges are recorded in both directions once")
+	{
+		CHECK_FALSE(graph.AddDependency(animation, sprite));
+		CHECK_FALSE(graph.AddDependency(texture, texture));
+
+		CHECK(graph.GetDependencies(animation) == std::vector<SW::AssetHandle>{subSprite, sprite});
+		CHECK(graph.GetDependents(texture) == std::vector<SW::AssetHandle>{spritesheet, sprite});
+		CHECK(graph.GetDependencies(texture).empty());
+		CHECK(graph.GetDependents(animation).empty());
+	}
+
+	SUBCASE("clearing the dependencies removes the reverse edges")
+	{
+		graph.ClearDependencies(animation);
+
+		CHECK(graph.GetDependencies(animation).empty());
+		CHECK(graph.GetDependents(sprite).empty());
+		CHECK(graph.GetDependents(subSprite).empty());
+		CHECK(graph.GetDependents(texture).size() == 2); // edges of other assets stay
+	}
+
+	SUBCASE("dependents are collected transitively in topological order")
+	{
+		const std::vector<SW::AssetHandle> order = graph.CollectDependents(texture);
+
+		REQUIRE(order.size() == 4);
+		CHECK(IndexOfDependent(order, unrelated) == order.size());
+		CHECK(IndexOfDependent(order, texture) == order.size());
+
+		CHECK(IndexOfDependent(order, spritesheet) < IndexOfDependent(order, subSprite));
+		CHECK(IndexOfDependent(order, subSprite) < IndexOfDependent(order, animation));
+		CHECK(IndexOfDependent(order, sprite) < IndexOfDependent(order, animation));
+
+		CHECK(graph.CollectDependents(animation).empty());
+		CHECK(graph.CollectDependents(sprite) == std::vector<SW::AssetHandle>{animation});
+	}
+
+	SUBCASE("every asset is collected once, also in a cycle")
+	{
+		graph.AddDependency(texture, animation); // closes texture -> ... -> animation -> texture
+
+		const std::vector<SW::AssetHandle> order = graph.CollectDependents(texture);
+
+		CHECK(order.size() == 4);
+		CHECK(IndexOfDependent(order, texture) == order.size());
+	}
+
+	SUBCASE("many dependents of a single asset")
+	{
+		SW::AssetDependencyGraph shared;
+
+		for (SW::AssetHandle handle = 100; handle < 400; handle++)
+		{
+			shared.AddDependency(handle, texture);
+			shared.AddDependency(handle + 1000, handle); // e.g. an animation per sprite
+		}
+
+		const std::vector<SW::AssetHandle> order = shared.CollectDependents(texture);
+
+		REQUIRE(order.size() == 600);
+
+		for (SW::AssetHandle handle = 100; handle < 400; handle++)
+			CHECK(IndexOfDependent(order, handle) < IndexOfDependent(order, handle + 1000));
+	}
+}
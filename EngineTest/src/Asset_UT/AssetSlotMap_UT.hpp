@@ -0,0 +1,247 @@
+#pragma once
+
+#include <pch.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+#include <Asset/AssetManagerBase.hpp>
+#include <Asset/AssetSlotMap.hpp>
+
+/**
+ * @brief Manager holding plain assets in a hash map, the way the editor and runtime managers do.
+ */
+class SlotMapTestAssetManager final : public SW::AssetManagerBase
+{
+public:
+	SlotMapTestAssetManager() : SW::AssetManagerBase(std::map<SW::AssetHandle, SW::AssetMetaData>()) {}
+
+	~SlotMapTestAssetManager() override
+	{
+		for (auto&& [handle, asset] : m_Assets)
+			delete asset;
+	}
+
+	SW::Asset** GetAssetRaw(SW::AssetHandle handle) override
+	{
+		auto it = m_Assets.find(handle);
+
+		return it != m_Assets.end() ? &it->second : nullptr;
+	}
+
+	const SW::Asset** GetAsset(SW::AssetHandle handle) override
+	{
+		return const_cast<const SW::Asset**>(GetAssetRaw(handle));
+	}
+
+	bool ForceUnload(SW::AssetHandle handle) override
+	{
+		auto it = m_Assets.find(handle);
+
+		if (it == m_Assets.end())
+			return true;
+
+		delete it->second;
+		m_Assets.erase(it);
+		m_Slots.Set(handle, nullptr);
+
+		return true;
+	}
+
+	bool ForceReload(SW::AssetHandle handle) override
+	{
+		if (!m_Assets.contains(handle))
+			return false;
+
+		SW::Asset* oldAsset = m_Assets[handle];
+
+		m_Assets[handle] = new SW::Asset();
+		m_Slots.Set(handle, m_Assets[handle]);
+
+		delete oldAsset;
+
+		return true;
+	}
+
+	SW::AssetState GetAssetState(SW::AssetHandle handle) const override
+	{
+		return m_Assets.contains(handle) ? SW::AssetState::Loaded : SW::AssetState::Invalid;
+	}
+
+	void Add(SW::AssetHandle handle)
+	{
+		m_Assets[handle] = new SW::Asset();
+		m_Slots.Set(handle, m_Assets[handle]);
+	}
+
+	/**
+	 * @brief Same as AssetManager::Resolve(), which needs a project context.
+	 */
+	SW::Asset* Resolve(SW::AssetHandle handle, SW::AssetSlot& slot)
+	{
+		if (SW::Asset* asset = ResolveSlot(handle, slot))
+			return asset;
+
+		SW::Asset** element = GetAssetRaw(handle);
+		SW::Asset* asset    = element ? *element : nullptr;
+
+		slot = asset ? SyncSlot(handle, asset) : SW::AssetSlot{};
+
+		return asset;
+	}
+
+private:
+	std::unordered_map<SW::AssetHandle, SW::Asset*> m_Assets;
+};
+
+TEST_CASE("AssetSlotMap - tests")
+{
+	SlotMapTestAssetManager manager;
+
+	manager.Add(10);
+	manager.Add(20);
+
+	SUBCASE("default constructed slot never resolves")
+	{
+		const SW::AssetSlot slot;
+
+		CHECK(manager.ResolveSlot(0, slot) == nullptr);
+		CHECK(manager.ResolveSlot(10, slot) == nullptr);
+	}
+
+	SUBCASE("cached slot resolves to the looked up asset")
+	{
+		SW::AssetSlot slot;
+
+		SW::Asset* asset = manager.Resolve(10, slot);
+
+		REQUIRE(asset != nullptr);
+		CHECK(asset == *manager.GetAssetRaw(10));
+		CHECK(manager.ResolveSlot(10, slot) == asset);
+		CHECK(manager.Resolve(10, slot) == asset);
+	}
+
+	SUBCASE("slot resolves only for the handle it was resolved for")
+	{
+		SW::AssetSlot slot;
+		manager.Resolve(10, slot);
+
+		CHECK(manager.ResolveSlot(20, slot) == nullptr);
+		CHECK(manager.Resolve(20, slot) == *manager.GetAssetRaw(20)); // handle changed, resolved again
+		CHECK(slot.Handle == 20);
+	}
+
+	SUBCASE("reload makes the cached slot stale")
+	{
+		SW::AssetSlot slot;
+		manager.Resolve(10, slot);
+
+		const SW::AssetSlot cached = slot;
+
+		manager.ForceReload(10);
+
+		CHECK(manager.ResolveSlot(10, cached) == nullptr);
+		CHECK(manager.Resolve(10, slot) == *manager.GetAssetRaw(10));
+		CHECK(slot.Index == cached.Index); // same slot, new generation
+		CHECK(slot.Generation != cached.Generation);
+	}
+
+	SUBCASE("unload makes the cached slot stale")
+	{
+		SW::AssetSlot slot;
+		manager.Resolve(20, slot);
+
+		manager.ForceUnload(20);
+
+		CHECK(manager.ResolveSlot(20, slot) == nullptr);
+		CHECK(manager.Resolve(20, slot) == nullptr);
+		CHECK(slot.Generation == 0);
+	}
+
+	SUBCASE("slots of another manager never resolve")
+	{
+		SW::AssetSlot slot;
+		manager.Resolve(10, slot);
+
+		SlotMapTestAssetManager other;
+		other.Add(10);
+
+		CHECK(other.ResolveSlot(10, slot) == nullptr);
+	}
+
+	SUBCASE("storing the same asset keeps the generation")
+	{
+		SW::AssetSlotMap slots;
+
+		SW::Asset asset;
+
+		slots.Set(1, &asset);
+
+		const SW::AssetSlot slot = slots.Acquire(1);
+
+		slots.Set(1, &asset);
+
+		CHECK(slots.Resolve(1, slot) == &asset);
+		CHECK(slots.Acquire(1).Generation == slot.Generation);
+		CHECK(slots.GetSize() == 1);
+	}
+}
+
+// Run with --no-skip, prints the resolution times instead of checking them.
+TEST_CASE("AssetSlotMap - handle resolution against the manager lookup - benchmark" * doctest::skip())
+{
+	constexpr u32 assetCount = 10000;
+	constexpr u32 rounds     = 200;
+
+	SlotMapTestAssetManager manager;
+
+	std::vector<SW::AssetHandle> handles;
+
+	for (u32 i = 0; i < assetCount; i++)
+	{
+		handles.emplace_back((SW::AssetHandle)i * 2654435761ull + 1); // spread like random ids
+		manager.Add(handles.back());
+	}
+
+	std::shuffle(handles.begin(), handles.end(), std::mt19937(42)); // components do not come in handle order
+
+	std::vector<SW::AssetSlot> slots(assetCount);
+
+	for (u32 i = 0; i < assetCount; i++)
+		manager.Resolve(handles[i], slots[i]);
+
+	SW::AssetManagerBase* base = &manager; // the way AssetManager calls it, through the base class
+
+	uintptr_t lookupSum = 0;
+	uintptr_t slotSum   = 0;
+
+	const auto lookupStart = std::chrono::steady_clock::now();
+
+	for (u32 round = 0; round < rounds; round++)
+	{
+		for (u32 i = 0; i < assetCount; i++)
+			lookupSum += (uintptr_t)*base->GetAssetRaw(handles[i]);
+	}
+
+	const auto lookupEnd = std::chrono::steady_clock::now();
+
+	const auto slotStart = std::chrono::steady_clock::now();
+
+	for (u32 round = 0; round < rounds; round++)
+	{
+		for (u32 i = 0; i < assetCount; i++)
+			slotSum += (uintptr_t)base->ResolveSlot(handles[i], slots[i]);
+	}
+
+	const auto slotEnd = std::chrono::steady_clock::now();
+
+	CHECK(lookupSum == slotSum); // same assets resolved, also keeps the loops from being optimized out
+
+	const f64 resolutions = (f64)assetCount * rounds;
+	const f64 lookupNs    = std::chrono::duration<f64, std::nano>(lookupEnd - lookupStart).count() / resolutions;
+	const f64 slotNs      = std::chrono::duration<f64, std::nano>(slotEnd - slotStart).count() / resolutions;
+
+	MESSAGE(std::format("{} assets: GetAssetRaw {:.2f} ns, cached slot {:.2f} ns per resolution ({:.2f}x)",
+	                    assetCount, lookupNs, slotNs, lookupNs / slotNs));
+}
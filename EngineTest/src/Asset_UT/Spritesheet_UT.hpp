@@ -0,0 +1,66 @@
+#pragma once
+
+#include <pch.hpp>
+
+#include <Asset/Spritesheet.hpp>
+
+TEST_CASE("Spritesheet - GetSpriteHandle - tests")
+{
+	SUBCASE("handle is stable")
+	{
+		CHECK(SW::Spritesheet::GetSpriteHandle(42, "Idle") == SW::Spritesheet::GetSpriteHandle(42, "Idle"));
+	}
+
+	SUBCASE("handle depends on the name and the spritesheet")
+	{
+		const SW::AssetHandle handle = SW::Spritesheet::GetSpriteHandle(42, "Idle");
+
+		CHECK(handle != 0);
+		CHECK(handle != SW::Spritesheet::GetSpriteHandle(42, "Walk"));
+		CHECK(handle != SW::Spritesheet::GetSpriteHandle(43, "Idle"));
+	}
+
+	SUBCASE("sprites are found by their derived handles")
+	{
+		SW::Spritesheet spritesheet;
+		spritesheet.Sprites.emplace_back("Idle");
+		spritesheet.Sprites.emplace_back("Walk");
+		spritesheet.UpdateSpriteHandles(42);
+
+		const SW::SpriteData* sprite = spritesheet.FindSprite(SW::Spritesheet::GetSpriteHandle(42, "Walk"));
+
+		REQUIRE(sprite != nullptr);
+		CHECK(sprite->Name == "Walk");
+		CHECK(spritesheet.FindSprite(SW::Spritesheet::GetSpriteHandle(43, "Walk")) == nullptr);
+	}
+
+	SUBCASE("duplicate names are made unique")
+	{
+		SW::Spritesheet spritesheet;
+		spritesheet.Sprites.emplace_back("Idle");
+		spritesheet.Sprites.emplace_back("Idle");
+		spritesheet.Sprites.emplace_back("Idle (2)");
+		spritesheet.UpdateSpriteHandles(42);
+
+		CHECK(spritesheet.Sprites[1].Name == "Idle (2)");
+		CHECK(spritesheet.Sprites[2].Name == "Idle (2) (2)");
+		CHECK(spritesheet.Sprites[0].Handle != spritesheet.Sprites[1].Handle);
+		CHECK(spritesheet.FindSprite(spritesheet.Sprites[1].Handle) == &spritesheet.Sprites[1]);
+	}
+}
+
+TEST_CASE("Spritesheet - GetTexCoords - tests")
+{
+	SW::Spritesheet spritesheet;
+
+	SW::SpriteData sprite("Idle");
+	sprite.Position = {32.f, 0.f};
+	sprite.Size     = {32.f, 64.f};
+
+	const SW::SpriteTexCoords coords = spritesheet.GetTexCoords(sprite, {128.f, 128.f});
+
+	CHECK(coords.LeftDown == glm::vec2(0.25f, 1.f));
+	CHECK(coords.RightDown == glm::vec2(0.5f, 1.f));
+	CHECK(coords.UpRight == glm::vec2(0.5f, 0.5f));
+	CHECK(coords.UpLeft == glm::vec2(0.25f, 0.5f));
+}
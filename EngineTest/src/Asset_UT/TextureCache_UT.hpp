@@ -0,0 +1,247 @@
+#pragma once
+
+#include <pch.hpp>
+
+#include <algorithm>
+#include <random>
+
+#include <Asset/Cache/TextureCache.hpp>
+#include <Core/Utils/BlockCompression.hpp>
+#include <Core/Utils/LZ4.hpp>
+
+inline std::vector<u8> MakeGradientImage(i32 width, i32 height, bool withAlpha)
+{
+	std::vector<u8> pixels((u64)width * height * 4);
+
+	for (i32 y = 0; y < height; y++)
+	{
+		for (i32 x = 0; x < width; x++)
+		{
+			u8* pixel = pixels.data() + ((u64)y * width + x) * 4;
+
+			pixel[0] = (u8)(x * 255 / std::max(width - 1, 1));
+			pixel[1] = (u8)(y * 255 / std::max(height - 1, 1));
+			pixel[2] = (u8)(255 - pixel[0] / 2);
+			pixel[3] = withAlpha ? (u8)((x + y) * 255 / std::max(width + height - 2, 1)) : 255;
+		}
+	}
+
+	return pixels;
+}
+
+inline i32 GetMaxChannelError(const std::vector<u8>& a, const std::vector<u8>& b, u64 channel)
+{
+	i32 error = 0;
+
+	for (u64 i = channel; i < a.size(); i += 4)
+		error = std::max(error, std::abs(a[i] - b[i]));
+
+	return error;
+}
+
+TEST_CASE("LZ4 - tests")
+{
+	std::mt19937 random(42);
+
+	std::vector<std::vector<u8>> inputs;
+	inputs.emplace_back();                              // empty
+	inputs.emplace_back(std::vector<u8>{1, 2, 3});      // too short for a match
+	inputs.emplace_back(std::vector<u8>(100000, 0x7F)); // overlapping matches
+
+	std::vector<u8> noise(70000);
+	for (u8& byte : noise)
+		byte = (u8)random();
+	inputs.emplace_back(noise);
+
+	const std::vector<u8> image = MakeGradientImage(300, 200, true);
+	inputs.emplace_back(image);
+
+	SUBCASE("every input survives the round trip")
+	{
+		for (const std::vector<u8>& input : inputs)
+		{
+			std::vector<u8> block(SW::LZ4::GetMaxCompressedSize(input.size()));
+
+			const u64 blockSize = SW::LZ4::Compress(input.data(), input.size(), block.data(), block.size());
+			REQUIRE(blockSize > 0);
+
+			std::vector<u8> output(input.size());
+
+			CHECK(SW::LZ4::Decompress(block.data(), blockSize, output.data(), output.size()));
+			CHECK(output == input);
+		}
+
+		std::vector<u8> block(SW::LZ4::GetMaxCompressedSize(inputs[2].size()));
+		CHECK(SW::LZ4::Compress(inputs[2].data(), inputs[2].size(), block.data(), block.size()) < 1000);
+	}
+
+	SUBCASE("too small buffers and corrupted blocks are rejected")
+	{
+		const std::vector<u8>& input = inputs[4];
+
+		std::vector<u8> block(SW::LZ4::GetMaxCompressedSize(input.size()));
+		const u64 blockSize = SW::LZ4::Compress(input.data(), input.size(), block.data(), block.size());
+
+		CHECK(SW::LZ4::Compress(input.data(), input.size(), block.data(), blockSize / 2) == 0);
+
+		std::vector<u8> output(input.size() + 1);
+
+		CHECK_FALSE(SW::LZ4::Decompress(block.data(), blockSize - 1, output.data(), input.size()));
+		CHECK_FALSE(SW::LZ4::Decompress(block.data(), blockSize, output.data(), input.size() - 1));
+		CHECK_FALSE(SW::LZ4::Decompress(block.data(), blockSize, output.data(), input.size() + 1));
+	}
+}
+
+TEST_CASE("BlockCompression - tests")
+{
+	constexpr i32 width  = 61; // partial blocks on both edges
+	constexpr i32 height = 29;
+
+	SUBCASE("BC1 keeps smooth colors close")
+	{
+		const std::vector<u8> pixels = MakeGradientImage(width, height, false);
+
+		std::vector<u8> blocks(SW::BlockCompression::GetCompressedSize(width, height, 8));
+		std::vector<u8> decoded(pixels.size());
+
+		REQUIRE(blocks.size() == 16 * 8 * 8);
+
+		SW::BlockCompression::EncodeBC1(pixels.data(), width, height, blocks.data());
+		SW::BlockCompression::DecodeBC1(blocks.data(), width, height, decoded.data());
+
+		for (u64 channel = 0; channel < 3; channel++)
+			CHECK(GetMaxChannelError(pixels, decoded, channel) <= 16);
+
+		CHECK(GetMaxChannelError(pixels, decoded, 3) == 0); // opaque
+	}
+
+	SUBCASE("BC3 keeps alpha close")
+	{
+		const std::vector<u8> pixels = MakeGradientImage(width, height, true);
+
+		std::vector<u8> blocks(SW::BlockCompression::GetCompressedSize(width, height, 16));
+		std::vector<u8> decoded(pixels.size());
+
+		SW::BlockCompression::EncodeBC3(pixels.data(), width, height, blocks.data());
+		SW::BlockCompression::DecodeBC3(blocks.data(), width, height, decoded.data());
+
+		for (u64 channel = 0; channel < 3; channel++)
+			CHECK(GetMaxChannelError(pixels, decoded, channel) <= 16);
+
+		CHECK(GetMaxChannelError(pixels, decoded, 3) <= 4);
+	}
+
+	SUBCASE("two colors are exact")
+	{
+		std::vector<u8> pixels((u64)width * height * 4);
+
+		for (u64 i = 0; i < pixels.size(); i += 4)
+		{
+			const u8 value = (i / 4) % 3 ? 255 : 0;
+
+			pixels[i] = pixels[i + 1] = pixels[i + 2] = value;
+			pixels[i + 3]                             = 255 - value;
+		}
+
+		std::vector<u8> blocks(SW::BlockCompression::GetCompressedSize(width, height, 16));
+		std::vector<u8> decoded(pixels.size());
+
+		SW::BlockCompression::EncodeBC3(pixels.data(), width, height, blocks.data());
+		SW::BlockCompression::DecodeBC3(blocks.data(), width, height, decoded.data());
+
+		CHECK(decoded == pixels);
+	}
+}
+
+TEST_CASE("TextureCache - tests")
+{
+	constexpr i32 width  = 37;
+	constexpr i32 height = 20;
+
+	const std::vector<u8> pixels = MakeGradientImage(width, height, true);
+
+	SUBCASE("the whole mip chain is cooked")
+	{
+		const SW::CookedTexture texture =
+		    SW::TextureCache::Cook(pixels.data(), width, height, 4, SW::TextureCompressionMode::None);
+
+		REQUIRE(texture.Format == SW::ImageFormat::RGBA8);
+		REQUIRE(texture.Levels.size() == 6);
+
+		const i32 expected[6][2] = {{37, 20}, {18, 10}, {9, 5}, {4, 2}, {2, 1}, {1, 1}};
+
+		for (u64 i = 0; i < texture.Levels.size(); i++)
+		{
+			CHECK(texture.Levels[i].Width == expected[i][0]);
+			CHECK(texture.Levels[i].Height == expected[i][1]);
+			CHECK(texture.Levels[i].Size == (u64)expected[i][0] * expected[i][1] * 4);
+		}
+
+		CHECK(std::equal(pixels.begin(), pixels.end(), texture.Data.begin())); // level 0 is lossless
+	}
+
+	SUBCASE("block compression picks the format by alpha")
+	{
+		const std::vector<u8> opaque = MakeGradientImage(width, height, false);
+
+		const SW::CookedTexture bc1 =
+		    SW::TextureCache::Cook(opaque.data(), width, height, 4, SW::TextureCompressionMode::BC);
+		const SW::CookedTexture bc3 =
+		    SW::TextureCache::Cook(pixels.data(), width, height, 4, SW::TextureCompressionMode::BC);
+
+		CHECK(bc1.Format == SW::ImageFormat::BC1);
+		CHECK(bc3.Format == SW::ImageFormat::BC3);
+
+		REQUIRE(bc1.Levels.size() == 6);
+		CHECK(bc1.Levels[0].Size == 10 * 5 * 8);
+		CHECK(bc3.Levels[0].Size == 10 * 5 * 16);
+		CHECK(bc3.Levels[5].Size == 16); // 1x1 still takes a whole block
+	}
+
+	SUBCASE("grey images are expanded and transparent pixels do not bleed")
+	{
+		const u8 grey[4] = {200, 255, 0, 0}; // grey + alpha, only the first pixel is visible
+
+		const SW::CookedTexture texture =
+		    SW::TextureCache::Cook(grey, 2, 1, 2, SW::TextureCompressionMode::None);
+
+		REQUIRE(texture.Levels.size() == 2);
+
+		const u8* mip = texture.Data.data() + texture.Levels[1].Offset;
+
+		CHECK(mip[0] == 200); // a plain average would darken it to 100
+		CHECK(mip[1] == 200);
+		CHECK(mip[2] == 200);
+		CHECK(mip[3] == 128);
+	}
+
+	SUBCASE("serialization round trip")
+	{
+		for (SW::TextureCompressionMode mode : {SW::TextureCompressionMode::None, SW::TextureCompressionMode::BC})
+		{
+			const SW::CookedTexture texture = SW::TextureCache::Cook(pixels.data(), width, height, 4, mode);
+			const std::vector<u8> data      = SW::TextureCache::Serialize(texture, 1234);
+
+			CHECK(SW::TextureCache::IsCookedTexture(data.data(), data.size()));
+
+			SW::CookedTexture deserialized;
+			REQUIRE(SW::TextureCache::Deserialize(data.data(), data.size(), deserialized));
+
+			CHECK(deserialized.Format == texture.Format);
+			CHECK(deserialized.Data == texture.Data);
+			REQUIRE(deserialized.Levels.size() == texture.Levels.size());
+
+			for (u64 i = 0; i < texture.Levels.size(); i++)
+			{
+				CHECK(deserialized.Levels[i].Width == texture.Levels[i].Width);
+				CHECK(deserialized.Levels[i].Height == texture.Levels[i].Height);
+				CHECK(deserialized.Levels[i].Offset == texture.Levels[i].Offset);
+			}
+
+			CHECK_FALSE(SW::TextureCache::Deserialize(data.data(), data.size() - 1, deserialized));
+		}
+
+		const u8 png[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+		CHECK_FALSE(SW::TextureCache::IsCookedTexture(png, sizeof(png)));
+	}
+}
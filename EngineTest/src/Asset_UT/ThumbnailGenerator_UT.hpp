@@ -0,0 +1,69 @@
+#pragma once
+
+#include <pch.hpp>
+
+#include <Asset/Cache/ThumbnailGenerator.hpp>
+
+TEST_CASE("ThumbnailGenerator - Downscale - tests")
+{
+	SUBCASE("image that fits is copied")
+	{
+		const std::vector<u8> pixels = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+
+		SW::GeneratedThumbnail thumbnail;
+		SW::ThumbnailGenerator::Downscale(pixels.data(), 2, 2, 3, 256, thumbnail);
+
+		CHECK(thumbnail.Width == 2);
+		CHECK(thumbnail.Height == 2);
+		CHECK(thumbnail.Channels == 3);
+		CHECK(thumbnail.Pixels == pixels);
+	}
+
+	SUBCASE("every destination pixel averages the covered block")
+	{
+		// 4x2 RGBA image, left half black, right half white, alpha 255 everywhere
+		std::vector<u8> pixels;
+
+		for (int y = 0; y < 2; y++)
+		{
+			for (int x = 0; x < 4; x++)
+			{
+				const u8 value = x < 2 ? 0 : 255;
+
+				pixels.insert(pixels.end(), {value, value, value, 255});
+			}
+		}
+
+		SW::GeneratedThumbnail thumbnail;
+		SW::ThumbnailGenerator::Downscale(pixels.data(), 4, 2, 4, 2, thumbnail);
+
+		REQUIRE(thumbnail.Width == 2);
+		REQUIRE(thumbnail.Height == 1);
+		REQUIRE(thumbnail.Pixels.size() == 8);
+
+		CHECK(thumbnail.Pixels == std::vector<u8>{0, 0, 0, 255, 255, 255, 255, 255});
+	}
+
+	SUBCASE("aspect ratio is kept and averages are rounded")
+	{
+		// 3x6 single column of values per row: 0, 1, 2, 3, 4, 5 (channel count 3, all channels equal)
+		std::vector<u8> pixels;
+
+		for (u8 y = 0; y < 6; y++)
+		{
+			for (int x = 0; x < 3; x++)
+			{
+				pixels.insert(pixels.end(), {y, y, y});
+			}
+		}
+
+		SW::GeneratedThumbnail thumbnail;
+		SW::ThumbnailGenerator::Downscale(pixels.data(), 3, 6, 3, 2, thumbnail);
+
+		REQUIRE(thumbnail.Width == 1);
+		REQUIRE(thumbnail.Height == 2);
+
+		CHECK(thumbnail.Pixels[0] == 1); // (0 + 1 + 2) / 3
+		CHECK(thumbnail.Pixels[3] == 4); // (3 + 4 + 5) / 3
+	}
+}
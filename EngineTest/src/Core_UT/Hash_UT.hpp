@@ -0,0 +1,40 @@
+#pragma once
+
+#include <pch.hpp>
+
+#include <algorithm>
+
+#include <Core/Hash.hpp>
+
+TEST_CASE("Hash - XXHash - tests")
+{
+	SUBCASE("matches the reference XXH64")
+	{
+		CHECK(SW::Hash::GenerateXXHash(nullptr, 0) == 0xEF46DB3751D8E999ull);
+		CHECK(SW::Hash::GenerateXXHash("abc", 3) == 0x44BC2CF5AD770999ull);
+
+		const std::string input(100, 'a');
+
+		CHECK(SW::Hash::GenerateXXHash(input.data(), input.size()) == 0x375041E8B1DECFB3ull);
+	}
+
+	SUBCASE("streaming in pieces gives the same hash")
+	{
+		std::vector<u8> input(1000);
+
+		for (size_t i = 0; i < input.size(); i++)
+			input[i] = (u8)(i * 31 + 7);
+
+		const u64 expected = SW::Hash::GenerateXXHash(input.data(), input.size(), 42);
+
+		for (size_t pieceSize : {1, 5, 31, 32, 33, 100})
+		{
+			SW::StreamingHash hash(42);
+
+			for (size_t offset = 0; offset < input.size(); offset += pieceSize)
+				hash.Update(input.data() + offset, std::min(pieceSize, input.size() - offset));
+
+			CHECK(hash.Digest() == expected);
+		}
+	}
+}
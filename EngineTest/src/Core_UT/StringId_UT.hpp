@@ -0,0 +1,61 @@
+#pragma once
+
+#include <pch.hpp>
+
+#include <Core/Hash.hpp>
+#include <Core/StringId.hpp>
+
+using SW::operator""_hash;
+
+TEST_CASE("StringId - tests")
+{
+	SUBCASE("matches the reference FNV-1a 64")
+	{
+		static_assert(SW::StringId::Generate("") == 0xCBF29CE484222325ull);
+		static_assert(SW::StringId::Generate("a") == 0xAF63DC4C8601EC8Cull);
+		static_assert("foobar"_hash.GetHash() == 0x85944171F73967E8ull);
+
+		CHECK(SW::StringId(std::string("foobar")).GetHash() == 0x85944171F73967E8ull);
+	}
+
+	SUBCASE("literals equal the ids constructed at runtime")
+	{
+		const std::string name = "Idle";
+
+		CHECK(SW::StringId(name) == "Idle"_hash);
+		CHECK(SW::StringId(name) != "Walk"_hash);
+		CHECK(std::hash<SW::StringId>()(SW::StringId(name)) == std::hash<SW::StringId>()("Idle"_hash));
+	}
+
+	SUBCASE("default constructed id is invalid")
+	{
+		CHECK_FALSE(SW::StringId().IsValid());
+		CHECK(SW::StringId("").IsValid());
+		CHECK(SW::StringId::FromHash("Idle"_hash.GetHash()) == "Idle"_hash);
+	}
+
+	SUBCASE("keys an unordered map")
+	{
+		std::unordered_map<SW::StringId, int> map;
+		map[SW::StringId(std::string("Jump"))] = 1;
+
+		CHECK(map.contains("Jump"_hash));
+		CHECK_FALSE(map.contains("Fall"_hash));
+	}
+
+#ifdef SW_DEBUG_BUILD
+	SUBCASE("remembers the strings constructed at runtime")
+	{
+		const SW::StringId id(std::string("Player.Health"));
+
+		CHECK(id.GetDebugName() == "Player.Health");
+	}
+#endif
+}
+
+TEST_CASE("Hash - FNV of a scoped name equals the hash of the joined string")
+{
+	static_assert(SW::Hash::GenerateFNVHash("Game.Player", "Speed") == SW::Hash::GenerateFNVHash("Game.Player.Speed"));
+
+	CHECK(SW::Hash::GenerateFNVHash(std::string("A"), std::string("")) == SW::Hash::GenerateFNVHash("A."));
+}
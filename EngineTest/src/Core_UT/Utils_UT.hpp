@@ -0,0 +1,35 @@
+#pragma once
+
+#include <pch.hpp>
+
+#include <Core/Utils/Utils.hpp>
+
+TEST_CASE("String - DecodeUTF8 - tests")
+{
+	const auto decodeAll = [](std::string_view text) {
+		std::vector<u32> codepoints;
+
+		size_t offset = 0;
+
+		while (offset < text.size())
+			codepoints.emplace_back(SW::String::DecodeUTF8(text, offset));
+
+		return codepoints;
+	};
+
+	SUBCASE("sequences of every length")
+	{
+		// "A", "é", "€", "😀"
+		const std::vector<u32> codepoints = decodeAll("A\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80");
+
+		CHECK(codepoints == std::vector<u32>{0x41, 0xE9, 0x20AC, 0x1F600});
+	}
+
+	SUBCASE("invalid bytes decode to the replacement character one at a time")
+	{
+		CHECK(decodeAll("\xC3") == std::vector<u32>{0xFFFD});                         // truncated
+		CHECK(decodeAll("\xC0\xAF") == std::vector<u32>{0xFFFD, 0xFFFD});             // overlong
+		CHECK(decodeAll("\xED\xA0\x80") == std::vector<u32>{0xFFFD, 0xFFFD, 0xFFFD}); // surrogate
+		CHECK(decodeAll("\x80" "A") == std::vector<u32>{0xFFFD, 0x41});               // stray continuation byte
+	}
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <pch.hpp>
+
+#include <Core/Physics/StaticColliderBaker2D.hpp>
+
+TEST_CASE("StaticColliderBaker2D - tests")
+{
+	SUBCASE("Touching tiles are merged and every point resolves to the tile under it")
+	{
+		std::vector<SW::StaticBox2D> boxes;
+
+		for (u32 y = 0; y < 2; y++)
+		{
+			for (u32 x = 0; x < 3; x++)
+			{
+				SW::StaticBox2D box;
+				box.Min    = {(f32)x, (f32)y};
+				box.Max    = {(f32)x + 1.f, (f32)y + 1.f};
+				box.Entity = y * 3 + x;
+
+				boxes.emplace_back(box);
+			}
+		}
+
+		std::vector<SW::BakedStaticBox2D> baked;
+		SW::StaticColliderBaker2D::Merge(boxes, baked);
+
+		REQUIRE(baked.size() == 1);
+		CHECK(baked[0].SourceCount == 6);
+		CHECK(baked[0].Min == glm::vec2(0.f, 0.f));
+		CHECK(baked[0].Max == glm::vec2(3.f, 2.f));
+
+		const auto entityAt = [&](glm::vec2 point) {
+			return boxes[SW::StaticColliderBaker2D::FindSource(baked[0], boxes.data(), point)].Entity;
+		};
+
+		CHECK(entityAt({0.5f, 0.5f}) == 0);
+		CHECK(entityAt({2.5f, 1.5f}) == 5);
+		CHECK(entityAt({1.5f, 2.f}) == 4);    // hit point on the top surface
+		CHECK(entityAt({2.25f, 2.01f}) == 5); // contact point slightly above the surface
+		CHECK(entityAt({-0.1f, 0.5f}) == 0);  // contact point slightly left of the surface
+	}
+
+	SUBCASE("Overlapping boxes are not merged")
+	{
+		std::vector<SW::StaticBox2D> boxes(2);
+		boxes[0].Min    = {0.f, 0.f};
+		boxes[0].Max    = {2.f, 1.f};
+		boxes[0].Entity = 1;
+		boxes[1].Min    = {1.f, 0.f};
+		boxes[1].Max    = {3.f, 1.f};
+		boxes[1].Entity = 2;
+
+		std::vector<SW::BakedStaticBox2D> baked;
+		SW::StaticColliderBaker2D::Merge(boxes, baked);
+
+		REQUIRE(baked.size() == 2);
+		CHECK(baked[0].SourceCount == 1);
+		CHECK(baked[1].SourceCount == 1);
+	}
+}
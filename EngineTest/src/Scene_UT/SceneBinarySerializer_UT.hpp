@@ -0,0 +1,241 @@
+#pragma once
+
+#include <pch.hpp>
+
+#include <Core/ECS/Entity.hpp>
+#include <Core/Scene/Scene.hpp>
+#include <Core/Scene/SceneBinarySerializer.hpp>
+#include <Core/Scene/SceneSerializer.hpp>
+
+inline SW::Scene* CreateBinarySerializerTestScene()
+{
+	SW::Scene* scene = new SW::Scene();
+
+	SW::Entity parent = scene->CreateEntityWithID(100, "Parent");
+	SW::Entity child  = scene->CreateEntityWithID(200, "Child");
+	SW::Entity label  = scene->CreateEntityWithID(300, "Child"); // same tag - shared string table entry
+
+	parent.GetTransform() = {{1.f, 2.f, 3.f}, {0.f, 0.f, 0.5f}, {2.f, 2.f, 1.f}};
+	child.GetTransform()  = {{-4.f, 0.25f, 0.f}, {0.f, 0.f, -1.f}, {1.f, 3.f, 1.f}};
+
+	parent.GetRelations().ChildrenIDs = {200, 300};
+	child.GetRelations().ParentID     = 100;
+	label.GetRelations().ParentID     = 100;
+
+	SW::SpriteComponent& sc = parent.AddComponent<SW::SpriteComponent>(glm::vec4(0.1f, 0.2f, 0.3f, 1.f));
+	sc.ZIndex               = 7;
+
+	SW::CameraComponent& cc = parent.AddComponent<SW::CameraComponent>();
+	cc.Primary              = true;
+	cc.Camera.SetPerspective(1.2f, 0.1f, 500.f);
+
+	SW::CircleComponent& circle = child.AddComponent<SW::CircleComponent>(glm::vec4(1.f, 0.f, 0.f, 1.f));
+	circle.Thickness            = 0.25f;
+
+	SW::RigidBody2DComponent& rbc = child.AddComponent<SW::RigidBody2DComponent>();
+	rbc.Type                      = SW::PhysicBodyType::Dynamic;
+	rbc.Mass                      = 3.f;
+	rbc.FixedRotation             = true;
+	rbc.CollisionLayer            = 0x0004;
+	rbc.CollisionMask             = 0x00F0;
+
+	SW::BoxCollider2DComponent& bcc = child.AddComponent<SW::BoxCollider2DComponent>();
+	bcc.Size                        = {2.f, 0.5f};
+	bcc.IsSensor                    = true;
+
+	SW::PolygonCollider2DComponent& pcc = child.AddComponent<SW::PolygonCollider2DComponent>();
+	pcc.Vertices                        = {{0.f, 0.f}, {2.f, 0.f}, {2.f, 1.f}, {0.f, 1.f}};
+	pcc.Density                         = 4.f;
+
+	SW::DistanceJoint2DComponent& djc = child.AddComponent<SW::DistanceJoint2DComponent>();
+	djc.ConnectedEntityID             = 100;
+	djc.AutoLength                    = false;
+	djc.Length                        = 2.5f;
+	djc.BreakingForce                 = 40.f;
+
+	SW::TextComponent& tc = label.AddComponent<SW::TextComponent>();
+	tc.TextString         = "Hello binary scene";
+	tc.Kerning            = 0.5f;
+
+	return scene;
+}
+
+inline void CheckScenesEqual(SW::Scene* expected, SW::Scene* actual)
+{
+	CHECK(expected->GetRegistry().GetEntitiesWith<SW::IDComponent>().size() ==
+	      actual->GetRegistry().GetEntitiesWith<SW::IDComponent>().size());
+
+	for (auto&& [handle, idc] : expected->GetRegistry().GetEntitiesWith<SW::IDComponent>().each())
+	{
+		SW::Entity lhs = {handle, expected};
+		SW::Entity rhs = actual->TryGetEntityByID(idc.ID);
+
+		REQUIRE(rhs);
+
+		CHECK(lhs.GetTag() == rhs.GetTag());
+
+		CHECK(lhs.GetTransform().Position == rhs.GetTransform().Position);
+		CHECK(lhs.GetTransform().Rotation == rhs.GetTransform().Rotation);
+		CHECK(lhs.GetTransform().Scale == rhs.GetTransform().Scale);
+
+		CHECK(lhs.GetRelations().ParentID == rhs.GetRelations().ParentID);
+		CHECK(lhs.GetRelations().ChildrenIDs == rhs.GetRelations().ChildrenIDs);
+
+		REQUIRE(lhs.HasComponent<SW::SpriteComponent>() == rhs.HasComponent<SW::SpriteComponent>());
+		if (lhs.HasComponent<SW::SpriteComponent>())
+		{
+			CHECK(lhs.GetComponent<SW::SpriteComponent>().Color == rhs.GetComponent<SW::SpriteComponent>().Color);
+			CHECK(lhs.GetComponent<SW::SpriteComponent>().ZIndex == rhs.GetComponent<SW::SpriteComponent>().ZIndex);
+		}
+
+		REQUIRE(lhs.HasComponent<SW::CameraComponent>() == rhs.HasComponent<SW::CameraComponent>());
+		if (lhs.HasComponent<SW::CameraComponent>())
+		{
+			const SW::CameraComponent& a = lhs.GetComponent<SW::CameraComponent>();
+			const SW::CameraComponent& b = rhs.GetComponent<SW::CameraComponent>();
+
+			CHECK(a.Primary == b.Primary);
+			CHECK(a.Camera.GetProjectionType() == b.Camera.GetProjectionType());
+			CHECK(a.Camera.GetPerspectiveVerticalFOV() == b.Camera.GetPerspectiveVerticalFOV());
+			CHECK(a.Camera.GetPerspectiveFarClip() == b.Camera.GetPerspectiveFarClip());
+		}
+
+		REQUIRE(lhs.HasComponent<SW::CircleComponent>() == rhs.HasComponent<SW::CircleComponent>());
+		if (lhs.HasComponent<SW::CircleComponent>())
+		{
+			CHECK(lhs.GetComponent<SW::CircleComponent>().Color == rhs.GetComponent<SW::CircleComponent>().Color);
+			CHECK(lhs.GetComponent<SW::CircleComponent>().Thickness ==
+			      rhs.GetComponent<SW::CircleComponent>().Thickness);
+		}
+
+		REQUIRE(lhs.HasComponent<SW::TextComponent>() == rhs.HasComponent<SW::TextComponent>());
+		if (lhs.HasComponent<SW::TextComponent>())
+		{
+			CHECK(lhs.GetComponent<SW::TextComponent>().TextString ==
+			      rhs.GetComponent<SW::TextComponent>().TextString);
+			CHECK(lhs.GetComponent<SW::TextComponent>().Kerning == rhs.GetComponent<SW::TextComponent>().Kerning);
+		}
+
+		REQUIRE(lhs.HasComponent<SW::RigidBody2DComponent>() == rhs.HasComponent<SW::RigidBody2DComponent>());
+		if (lhs.HasComponent<SW::RigidBody2DComponent>())
+		{
+			const SW::RigidBody2DComponent& a = lhs.GetComponent<SW::RigidBody2DComponent>();
+			const SW::RigidBody2DComponent& b = rhs.GetComponent<SW::RigidBody2DComponent>();
+
+			CHECK(a.Type == b.Type);
+			CHECK(a.Mass == b.Mass);
+			CHECK(a.FixedRotation == b.FixedRotation);
+			CHECK(a.CollisionLayer == b.CollisionLayer);
+			CHECK(a.CollisionMask == b.CollisionMask);
+		}
+
+		REQUIRE(lhs.HasComponent<SW::BoxCollider2DComponent>() == rhs.HasComponent<SW::BoxCollider2DComponent>());
+		if (lhs.HasComponent<SW::BoxCollider2DComponent>())
+		{
+			CHECK(lhs.GetComponent<SW::BoxCollider2DComponent>().Size ==
+			      rhs.GetComponent<SW::BoxCollider2DComponent>().Size);
+			CHECK(lhs.GetComponent<SW::BoxCollider2DComponent>().IsSensor ==
+			      rhs.GetComponent<SW::BoxCollider2DComponent>().IsSensor);
+		}
+
+		REQUIRE(lhs.HasComponent<SW::PolygonCollider2DComponent>() ==
+		        rhs.HasComponent<SW::PolygonCollider2DComponent>());
+		if (lhs.HasComponent<SW::PolygonCollider2DComponent>())
+		{
+			CHECK(lhs.GetComponent<SW::PolygonCollider2DComponent>().Vertices ==
+			      rhs.GetComponent<SW::PolygonCollider2DComponent>().Vertices);
+			CHECK(lhs.GetComponent<SW::PolygonCollider2DComponent>().Density ==
+			      rhs.GetComponent<SW::PolygonCollider2DComponent>().Density);
+		}
+
+		REQUIRE(lhs.HasComponent<SW::DistanceJoint2DComponent>() ==
+		        rhs.HasComponent<SW::DistanceJoint2DComponent>());
+		if (lhs.HasComponent<SW::DistanceJoint2DComponent>())
+		{
+			const SW::DistanceJoint2DComponent& a = lhs.GetComponent<SW::DistanceJoint2DComponent>();
+			const SW::DistanceJoint2DComponent& b = rhs.GetComponent<SW::DistanceJoint2DComponent>();
+
+			CHECK(a.ConnectedEntityID == b.ConnectedEntityID);
+			CHECK(a.AutoLength == b.AutoLength);
+			CHECK(a.Length == b.Length);
+			CHECK(a.BreakingForce == b.BreakingForce);
+		}
+	}
+}
+
+TEST_CASE("SceneBinarySerializer - round trip against YAML - tests")
+{
+	const std::filesystem::path directory  = std::filesystem::temp_directory_path();
+	const std::filesystem::path yamlPath   = directory / "SceneBinarySerializer_UT.sw_scene";
+	const std::filesystem::path binaryPath = directory / "SceneBinarySerializer_UT.sw_scenebin";
+
+	SW::Scene* source = CreateBinarySerializerTestScene();
+
+	SW::SceneSerializer::Serialize(source, yamlPath);
+
+	REQUIRE(SW::SceneBinarySerializer::Convert(yamlPath, binaryPath));
+
+	SUBCASE("Binary scene matches the YAML scene")
+	{
+		SW::Scene* fromYaml   = SW::SceneSerializer::Deserialize(yamlPath);
+		SW::Scene* fromBinary = SW::SceneSerializer::Deserialize(binaryPath);
+
+		CheckScenesEqual(fromYaml, fromBinary);
+
+		delete fromYaml;
+		delete fromBinary;
+	}
+
+	SUBCASE("Serializing the loaded binary scene produces identical bytes")
+	{
+		const std::filesystem::path secondPath = directory / "SceneBinarySerializer_UT_2.sw_scenebin";
+
+		SW::Scene* fromBinary = SW::SceneBinarySerializer::Deserialize(binaryPath);
+
+		REQUIRE(SW::SceneBinarySerializer::Serialize(fromBinary, secondPath));
+
+		std::ifstream first(binaryPath, std::ios::binary);
+		std::ifstream second(secondPath, std::ios::binary);
+
+		const std::string firstBytes((std::istreambuf_iterator<char>(first)), std::istreambuf_iterator<char>());
+		const std::string secondBytes((std::istreambuf_iterator<char>(second)), std::istreambuf_iterator<char>());
+
+		CHECK(firstBytes == secondBytes);
+
+		delete fromBinary;
+
+		std::filesystem::remove(secondPath);
+	}
+
+	SUBCASE("Dependency manifest is read without the entities")
+	{
+		CHECK(SW::SceneSerializer::DeserializeDependencies(yamlPath).empty()); // no project, nothing collected
+		CHECK(SW::SceneSerializer::DeserializeDependencies(binaryPath).empty());
+
+		{
+			std::ofstream file(yamlPath, std::ios::trunc);
+			file << "Dependencies: [3, 1, 2]\nEntities:\n  - this part is never parsed: [\n";
+		}
+
+		CHECK(SW::SceneSerializer::DeserializeDependencies(yamlPath) == std::vector<SW::AssetHandle>{3, 1, 2});
+	}
+
+	SUBCASE("Invalid file produces an empty scene")
+	{
+		{
+			std::ofstream file(binaryPath, std::ios::binary | std::ios::trunc);
+			file << "definitely not a scene";
+		}
+
+		SW::Scene* invalid = SW::SceneBinarySerializer::Deserialize(binaryPath);
+
+		CHECK(invalid->GetRegistry().GetEntitiesWith<SW::IDComponent>().size() == 0);
+
+		delete invalid;
+	}
+
+	delete source;
+
+	std::filesystem::remove(yamlPath);
+	std::filesystem::remove(binaryPath);
+}
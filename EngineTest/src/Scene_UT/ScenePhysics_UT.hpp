@@ -0,0 +1,55 @@
+#pragma once
+
+#include <pch.hpp>
+
+#include <box2d/b2_body.h>
+
+#include <Core/ECS/Entity.hpp>
+#include <Core/Scene/Scene.hpp>
+
+TEST_CASE("Scene - 2D physics in runtime - tests")
+{
+	SW::Scene* scene = new SW::Scene();
+
+	SW::Entity original = scene->CreateEntityWithID(100, "Crate");
+
+	SW::RigidBody2DComponent& rbc = original.AddComponent<SW::RigidBody2DComponent>();
+	rbc.Type                      = SW::PhysicBodyType::Dynamic;
+
+	original.AddComponent<SW::BoxCollider2DComponent>();
+
+	scene->SetNewState(SW::SceneState::Play);
+	scene->OnRuntimeStart();
+
+	SUBCASE("Duplicated entity gets its own body")
+	{
+		std::unordered_map<u64, SW::Entity> duplicatedEntities;
+
+		SW::Entity duplicate = scene->DuplicateEntity(original, duplicatedEntities);
+
+		scene->OnUpdatePhysics2D(0.05f);
+
+		const b2Body* originalBody  = (b2Body*)original.GetComponent<SW::RigidBody2DComponent>().Handle;
+		const b2Body* duplicateBody = (b2Body*)duplicate.GetComponent<SW::RigidBody2DComponent>().Handle;
+
+		REQUIRE(originalBody);
+		REQUIRE(duplicateBody);
+		CHECK(duplicateBody != originalBody);
+		CHECK(duplicate.GetComponent<SW::BoxCollider2DComponent>().Handle !=
+		      original.GetComponent<SW::BoxCollider2DComponent>().Handle);
+		CHECK(scene->GetPhysicsStatistics2D().BodyCount == 2);
+
+		scene->DestroyEntity(original);
+
+		scene->OnUpdatePhysics2D(0.05f);
+
+		REQUIRE(duplicate.GetComponent<SW::RigidBody2DComponent>().Handle == duplicateBody);
+		CHECK(scene->GetPhysicsStatistics2D().BodyCount == 1);
+		CHECK(duplicateBody->GetFixtureList());
+		CHECK(duplicateBody->GetPosition().y < 0.f); // still simulated, falls with the gravity
+	}
+
+	scene->OnRuntimeStop();
+
+	delete scene;
+}
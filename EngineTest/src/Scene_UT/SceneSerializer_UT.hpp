@@ -0,0 +1,180 @@
+#pragma once
+
+#include <pch.hpp>
+
+#include <chrono>
+
+#include <Core/ECS/Entity.hpp>
+#include <Core/Scene/Scene.hpp>
+#include <Core/Scene/SceneSerializer.hpp>
+#include <Core/Utils/SerializationUtils.hpp>
+
+#include "SceneBinarySerializer_UT.hpp"
+
+inline SW::Scene* CreateLargeSerializerTestScene(u32 entityCount)
+{
+	SW::Scene* scene = new SW::Scene();
+
+	for (u32 i = 0; i < entityCount; i++)
+	{
+		const u64 id = i + 1;
+
+		SW::Entity entity = scene->CreateEntityWithID(id, std::format("Entity {}", i % 100));
+
+		entity.GetTransform().Position = {(f32)i, (f32)(i % 7), 0.f};
+		entity.GetTransform().Scale    = {1.f, 1.f + (f32)(i % 3), 1.f};
+
+		if (i % 10 == 0) // every tenth entity parents the nine after it
+		{
+			for (u64 child = id + 1; child < id + 10 && child <= entityCount; child++)
+				entity.GetRelations().ChildrenIDs.push_back(child);
+		}
+		else
+		{
+			entity.GetRelations().ParentID = id - i % 10;
+		}
+
+		if (i % 2 == 0)
+		{
+			SW::SpriteComponent& sc = entity.AddComponent<SW::SpriteComponent>(glm::vec4(0.5f, (f32)(i % 4), 1.f, 1.f));
+			sc.ZIndex               = (int)(i % 5);
+		}
+
+		if (i % 3 == 0)
+		{
+			SW::RigidBody2DComponent& rbc = entity.AddComponent<SW::RigidBody2DComponent>();
+			rbc.Type                      = SW::PhysicBodyType::Dynamic;
+			rbc.Mass                      = (f32)(i % 11);
+
+			entity.AddComponent<SW::BoxCollider2DComponent>().Size = {1.f, (f32)(i % 4) + 0.5f};
+		}
+
+		if (i % 5 == 0)
+			entity.AddComponent<SW::TextComponent>().TextString = std::format("Label {}", i);
+	}
+
+	return scene;
+}
+
+inline SW::Scene* DeserializeSceneSerially(const std::filesystem::path& path)
+{
+	SW::Scene* scene = new SW::Scene();
+
+	YAML::Node entities = YAML::LoadFile(path.string())["Entities"];
+
+	SW::SceneSerializer::DeserializeEntitiesNode(entities, scene);
+
+	return scene;
+}
+
+TEST_CASE("SceneSerializer - parallel YAML load - tests")
+{
+	const std::filesystem::path path = std::filesystem::temp_directory_path() / "SceneSerializer_UT.sw_scene";
+
+	SW::Scene* source = CreateLargeSerializerTestScene(3000); // enough entities to be split between workers
+
+	SW::SceneSerializer::Serialize(source, path);
+
+	SUBCASE("Scene parsed in parts matches the scene parsed as a whole")
+	{
+		SW::ParsedEntities entities;
+
+		// Worker count is fixed, the machine running the tests may have a single hardware thread
+		const u32 rangeCount = SW::SceneSerializer::ParseEntitiesParallel(path, 4, entities);
+
+		REQUIRE(rangeCount == 4);
+
+		SW::Scene* parallel = new SW::Scene();
+		SW::SceneSerializer::CommitEntities(entities, parallel);
+
+		SW::Scene* serial = DeserializeSceneSerially(path);
+
+		CheckScenesEqual(source, parallel);
+		CheckScenesEqual(serial, parallel);
+
+		delete parallel;
+		delete serial;
+	}
+
+	SUBCASE("Deserialized scene matches the source scene")
+	{
+		SW::Scene* loaded = SW::SceneSerializer::Deserialize(path);
+
+		CheckScenesEqual(source, loaded);
+
+		delete loaded;
+	}
+
+	SUBCASE("Parsed entities are appended in order")
+	{
+		YAML::Node entities = YAML::LoadFile(path.string())["Entities"];
+
+		SW::ParsedEntities first;
+		SW::ParsedEntities second;
+
+		SW::SceneSerializer::ParseEntitiesNode(entities, first);
+		SW::SceneSerializer::ParseEntitiesNode(entities, second);
+
+		first.Append(std::move(second));
+
+		REQUIRE(first.IDs.size() == 6000);
+		CHECK(first.IDs[3000] == first.IDs[0]);
+		CHECK(first.Sprites.Indices.size() == 3000);
+		CHECK(first.Sprites.Indices[1500] == 3000); // offset by the entities of the first part
+		CHECK(first.Texts.Components[600].TextString == first.Texts.Components[0].TextString);
+	}
+
+	SUBCASE("Scene without entities is loaded empty")
+	{
+		{
+			std::ofstream file(path, std::ios::trunc);
+			file << "Dependencies: []\nEntities: []\n";
+		}
+
+		SW::Scene* empty = SW::SceneSerializer::Deserialize(path);
+
+		CHECK(empty->GetRegistry().GetEntitiesWith<SW::IDComponent>().size() == 0);
+
+		delete empty;
+	}
+
+	delete source;
+
+	std::filesystem::remove(path);
+}
+
+// Run with --no-skip, prints the load times instead of checking them.
+TEST_CASE("SceneSerializer - YAML load time against entity count - benchmark" * doctest::skip())
+{
+	const std::filesystem::path path = std::filesystem::temp_directory_path() / "SceneSerializer_Benchmark.sw_scene";
+
+	for (const u32 entityCount : {1000u, 10000u, 50000u})
+	{
+		SW::Scene* source = CreateLargeSerializerTestScene(entityCount);
+
+		SW::SceneSerializer::Serialize(source, path);
+
+		delete source;
+
+		const auto serialStart = std::chrono::steady_clock::now();
+		SW::Scene* serial      = DeserializeSceneSerially(path);
+		const auto serialEnd   = std::chrono::steady_clock::now();
+
+		const auto parallelStart = std::chrono::steady_clock::now();
+		SW::Scene* parallel      = SW::SceneSerializer::Deserialize(path);
+		const auto parallelEnd   = std::chrono::steady_clock::now();
+
+		const f64 serialMs   = std::chrono::duration<f64, std::milli>(serialEnd - serialStart).count();
+		const f64 parallelMs = std::chrono::duration<f64, std::milli>(parallelEnd - parallelStart).count();
+
+		MESSAGE(std::format("{} entities: serial {:.1f} ms, parallel {:.1f} ms ({:.2f}x)", entityCount, serialMs,
+		                    parallelMs, serialMs / parallelMs));
+
+		CHECK(parallel->GetRegistry().GetEntitiesWith<SW::IDComponent>().size() == entityCount);
+
+		delete serial;
+		delete parallel;
+	}
+
+	std::filesystem::remove(path);
+}
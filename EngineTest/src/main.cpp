@@ -21,9 +21,23 @@
 #include <Core/Defines.hpp>
 #include <Logger/Logger.hpp>
 
+// Tests of the engine classes include <pch.hpp> first, the engine headers rely on its precompiled header.
 #include "Math_UT/Vector2_UT.hpp"
 #include "Math_UT/Vector3_UT.hpp"
 #include "Math_UT/Vector4_UT.hpp"
+#include "Scene_UT/SceneBinarySerializer_UT.hpp"
+#include "Scene_UT/SceneSerializer_UT.hpp"
+#include "Scene_UT/ScenePhysics_UT.hpp"
+#include "Asset_UT/ThumbnailGenerator_UT.hpp"
+#include "Asset_UT/Spritesheet_UT.hpp"
+#include "Asset_UT/AssetSlotMap_UT.hpp"
+#include "Asset_UT/AssetDependencyGraph_UT.hpp"
+#include "Asset_UT/TextureCache_UT.hpp"
+#include "Asset_UT/Animation2D_UT.hpp"
+#include "Core_UT/Utils_UT.hpp"
+#include "Core_UT/Hash_UT.hpp"
+#include "Core_UT/StringId_UT.hpp"
+#include "Physics_UT/StaticColliderBaker2D_UT.hpp"
 
 int main(int argc, char** argv) {
 	doctest::Context context;